@@ -27,6 +27,10 @@ elseif (FALCON_ENGINE_WINDOW_GLFW)
     add_definitions(-DFALCON_ENGINE_WINDOW_GLFW)
 endif()
 
+if(FALCON_ENGINE_PROFILE)
+    add_definitions(-DFALCON_ENGINE_PROFILE)
+endif()
+
 fe_assert_defined(CMAKE_CXX_COMPILER_ID)
 
 if(CMAKE_CXX_COMPILER_ID STREQUAL MSVC)
@@ -10,6 +10,7 @@
 
 #include <FalconEngine/Content/ModelImportOption.h>
 #include <FalconEngine/Content/TextureImportOption.h>
+#include <FalconEngine/Core/Memory.h>
 #include <FalconEngine/Core/Path.h>
 #include <FalconEngine/Graphics/Renderer/Resource/Texture.h>
 #include <FalconEngine/Graphics/Renderer/Resource/Texture1d.h>
@@ -28,6 +29,11 @@ class Texture1d;
 class Texture2d;
 class ShaderSource;
 
+// @summary Asset lookup table whose memory is recorded with asset tag.
+template <typename T>
+using AssetTable = std::map<std::string, std::shared_ptr<T>, std::less<std::string>,
+      MemoryTagStlAllocator<std::pair<const std::string, std::shared_ptr<T>>, MemoryTag::Asset>>;
+
 #pragma warning(disable: 4251)
 class FALCON_ENGINE_API AssetManager
 {
@@ -67,6 +73,11 @@ public:
     std::shared_ptr<Font>
     LoadFont(const std::string& fontAssetPath);
 
+    // @summary Load the TrueType or OpenType font, whose glyph is rasterized
+    // at runtime when it is first used instead of baked.
+    std::shared_ptr<Font>
+    LoadFontDynamic(const std::string& fontFilePath);
+
     std::shared_ptr<Model>
     GetModel(const std::string& modelFilePath);
 
@@ -120,6 +131,8 @@ public:
             return texture;
         }
 
+        MemoryTagScope memoryTagScope(MemoryTag::Asset);
+
         std::shared_ptr<Texture> t = LoadTextureInternal(textureAssetPath, textureImportOption, GetTextureType<T>());
         texture = std::dynamic_pointer_cast<T>(t);
         mTextureTable[texture->mFilePath] = texture;
@@ -133,6 +146,9 @@ private:
     std::shared_ptr<Font>
     LoadFontInternal(const std::string& fontAssetPath);
 
+    std::shared_ptr<Font>
+    LoadFontDynamicInternal(const std::string& fontFilePath);
+
     std::shared_ptr<Model>
     LoadModelInternal(const std::string& modelFilePath, const ModelImportOption& modelImportOption);
 
@@ -204,10 +220,10 @@ private:
 private:
     AssetImporter                                       *mImporter;
 
-    std::map<std::string, std::shared_ptr<Font>>         mFontTable;            // Index is file path.
-    std::map<std::string, std::shared_ptr<Model>>        mModelTable;           // Index is file path.
-    std::map<std::string, std::shared_ptr<ShaderSource>> mShaderSourceTable;    // Index is file path.
-    std::map<std::string, std::shared_ptr<Texture>>      mTextureTable;         // Index is file path.
+    AssetTable<Font>                                     mFontTable;            // Index is file path.
+    AssetTable<Model>                                    mModelTable;           // Index is file path.
+    AssetTable<ShaderSource>                             mShaderSourceTable;    // Index is file path.
+    AssetTable<Texture>                                  mTextureTable;         // Index is file path.
 };
 #pragma warning(default: 4251)
 
@@ -8,15 +8,37 @@
 namespace FalconEngine
 {
 
+// @summary Vertex data compression used when importing model.
+enum class FALCON_ENGINE_API ModelVertexCompression
+{
+    // 32 bytes per vertex: float position, float normal and float texture
+    // coordinate.
+    None,
+
+    // 16 bytes per vertex: snorm16 position relative to mesh AABB, snorm16
+    // octahedral normal and half texture coordinate.
+    Snorm16Position,
+
+    // 16 bytes per vertex: half position relative to mesh AABB, snorm16
+    // octahedral normal and half texture coordinate.
+    HalfPosition,
+};
+
 class FALCON_ENGINE_API ModelLayoutOption
 {
 public:
     ModelLayoutOption() = default;
 
+    // @remark Compressed vertex data is always interleaved into one vertex
+    // buffer.
+    explicit ModelLayoutOption(ModelVertexCompression vertexCompression);
+
 public:
     const BufferLayout mPosition = BufferLayout::Separated;
     const BufferLayout mNormal = BufferLayout::Separated;
     const BufferLayout mTexCoord = BufferLayout::Separated;
+
+    const ModelVertexCompression mVertexCompression = ModelVertexCompression::None;
 };
 
 class FALCON_ENGINE_API ModelUsageOption
@@ -60,6 +82,10 @@ public:
     ModelUsageOption  mVertexBufferUsage;
     BufferUsage       mIndexBufferUsage;
     IndexType         mIndexType;
+    bool              mMaterialPacked = false;                               // Whether material textures are packed into texture arrays, see MaterialAtlas.
+    int               mLodNum = 1;                                           // Level of detail number including the original mesh, see MeshSimplifier.
+    float             mLodReduction = 0.5f;                                  // Index number ratio of each level to the previous level.
+    float             mLodErrorMax = 0.1f;                                   // Largest error of any level, relative to the radius of mesh bound.
 };
 
 }
@@ -16,7 +16,9 @@
 #include <FalconEngine/Graphics/Renderer/Resource/VertexFormat.h>
 #include <FalconEngine/Graphics/Renderer/Resource/VertexGroup.h>
 #include <FalconEngine/Graphics/Renderer/Scene/Material.h>
+#include <FalconEngine/Graphics/Renderer/Scene/MaterialAtlas.h>
 #include <FalconEngine/Graphics/Renderer/Scene/Mesh.h>
+#include <FalconEngine/Graphics/Renderer/Scene/MeshSimplifier.h>
 #include <FalconEngine/Graphics/Renderer/Scene/Model.h>
 #include <FalconEngine/Graphics/Renderer/Scene/Node.h>
 #include <FalconEngine/Graphics/Renderer/Scene/Visual.h>
@@ -37,7 +39,18 @@ public:
 };
 #pragma pack(pop)
 
-class ModelImporter
+// @summary Compressed vertex interleaved in a single vertex buffer.
+#pragma pack(push, 1)
+class FALCON_ENGINE_API ModelVertexCompressed
+{
+public:
+    uint64_t mPosition;                                                      // 4 x snorm16 or 4 x half, relative to mesh AABB, w is unused.
+    uint32_t mNormal;                                                        // 2 x snorm16, octahedral encoded.
+    uint32_t mTexCoord;                                                      // 2 x half.
+};
+#pragma pack(pop)
+
+class FALCON_ENGINE_API ModelImporter
 {
 public:
     /************************************************************************/
@@ -133,11 +146,47 @@ private:
         return indexBuffer;
     }
 
+    template <typename T>
+    static std::shared_ptr<IndexBuffer>
+    CreateIndexBufferInternal(_IN_ IndexType                        indexType,
+                              _IN_ BufferUsage                      indexBufferUsage,
+                              _IN_ const std::vector<unsigned int>& indexList)
+    {
+        static auto sMasterRenderer = Renderer::GetInstance();
+
+        auto indexBuffer = std::make_shared<IndexBuffer>(int(indexList.size()), indexType,
+                           BufferStorageMode::Device, indexBufferUsage);
+        auto indexData = reinterpret_cast<T *>(sMasterRenderer->Map(indexBuffer.get(),
+                                               BufferAccessMode::WriteBuffer,
+                                               BufferFlushMode::Automatic,
+                                               BufferSynchronizationMode::Unsynchronized,
+                                               indexBuffer->GetDataOffset(),
+                                               indexBuffer->GetDataSize()));
+
+        for (size_t i = 0; i < indexList.size(); ++i)
+        {
+            indexData[i] = T(indexList[i]);
+        }
+
+        sMasterRenderer->Unmap(indexBuffer.get());
+
+        return indexBuffer;
+    }
+
+    // @summary Simplify the mesh into the chain of level of detail, which
+    // shares the vertex group with the mesh.
+    static void
+    CreateLod(_IN_OUT_ Mesh                                *mesh,
+              _IN_     const ModelImportOption&             modelImportOption,
+              _IN_     const std::shared_ptr<VertexFormat>& vertexFormat,
+              _IN_     const std::shared_ptr<VertexGroup>&  vertexGroup,
+              _IN_     const aiMesh                        *aiMesh);
+
     static std::shared_ptr<VertexFormat>
-    CreateVertexFormat();
+    CreateVertexFormat(ModelVertexCompression vertexCompression);
 
     static std::shared_ptr<VertexFormat>
-    GetVertexFormat();
+    GetVertexFormat(ModelVertexCompression vertexCompression);
 
     // @remark In any case, the vertex buffer contains interlaced data of vertex
     // position, normal and texture coordinate.
@@ -145,8 +194,30 @@ private:
     CreateVertexGroup(_IN_OUT_ Model                   *model,
                       _IN_     const ModelUsageOption&  vertexBufferUsage,
                       _IN_     const ModelLayoutOption& vertexBufferLayout,
+                      _IN_     const AABB&              aabb,
                       _IN_     const aiMesh            *aiMesh);
 
+    // @remark The vertex position is stored relative to the mesh AABB so that
+    // the shader could decode it using AABB center and extent.
+    static std::shared_ptr<VertexGroup>
+    CreateVertexGroupCompressed(_IN_OUT_ Model                   *model,
+                                _IN_     const ModelUsageOption&  vertexBufferUsage,
+                                _IN_     const ModelLayoutOption& vertexBufferLayout,
+                                _IN_     const AABB&              aabb,
+                                _IN_     const aiMesh            *aiMesh);
+
+    // @summary Map unit vector onto octahedron then unfold it onto [-1, 1]^2.
+    // @ref Cigolle et al., A Survey of Efficient Representations for Independent
+    // Unit Vectors, 2014.
+    static Vector2f
+    EncodeOctahedral(const Vector3f& normal);
+
+    static void
+    ReportVertexCompression(const Model *model, const ModelLayoutOption& vertexBufferLayout);
+
+    static void
+    CollectMaterial(Node *node, vector<Material *>& materialList);
+
     static std::shared_ptr<Material>
     CreateMaterial(
         _IN_ const string&  modelFilePath,
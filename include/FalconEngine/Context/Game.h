@@ -52,6 +52,8 @@ public:
     virtual void
     RenderBegin(GameEngineGraphics *graphics);
 
+    // @param percent -- Interpolation alpha in [0, 1) from the state of the
+    //     second last update to the state of the last update.
     virtual void
     Render(GameEngineGraphics *graphics, double percent);
 
@@ -61,8 +63,9 @@ public:
     /************************************************************************/
     /* Update Operation                                                     */
     /************************************************************************/
-    // @remark This function is called at variable rate but at lease once per frame.
-    // @param elapsed -- Millisecond elapsed during last update / render cycle.
+    // @remark This function is called at fixed rate, so it could be called
+    // zero or several times in one frame.
+    // @param elapsed -- Millisecond of the fixed time step.
     virtual void
     Update(GameEngineGraphics *graphics, GameEngineInput *input, double elapsed);
 
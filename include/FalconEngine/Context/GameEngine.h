@@ -42,8 +42,11 @@ private:
     Initialize();
 
     // @summary Main loop
-    // @note The main goal of this algorithm is to ensure the render rate is
-    // constant and update rate is flexible.
+    // @note The game is updated with fixed time step, as many times as the
+    // elapsed time allows up to the catch-up budget, and rendered once per
+    // frame with the interpolation alpha between the last two updates.
+    //
+    // @ref Glenn Fiedler, Fix Your Timestep!, 2004.
     void
     Loop();
 
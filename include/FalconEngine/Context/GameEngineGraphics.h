@@ -2,7 +2,11 @@
 
 #include <FalconEngine/Context/Common.h>
 
+#include <condition_variable>
+#include <exception>
 #include <limits>
+#include <mutex>
+#include <thread>
 
 #include <FalconEngine/Graphics/Renderer/Viewport.h>
 #include <FalconEngine/Graphics/Renderer/Window.h>
@@ -38,6 +42,29 @@ class Renderer;
 class GameEngineData;
 class GameEngineSettings;
 
+// @summary Requested frame buffer clear, which is performed on the render
+// side before anything is drawn.
+class GameEngineGraphicsClear
+{
+public:
+    bool         mEnabled = false;
+    Vector4f     mColor;
+    float        mDepth = 1.0f;
+    unsigned int mStencil = 0;
+};
+
+// @summary The game side submits the frame between RenderBegin and RenderEnd,
+// where RenderEnd hands the submitted frame off to the render side. The render
+// side then draws and presents the frame, either in place or on the render
+// thread, which owns the rendering context while it is running.
+//
+// @remark At the handoff, the game side waits for the render side to finish
+// the previous frame, then copies the camera, the interpolated transform and
+// the visual list of each drawn entity, and swaps the debug and text streams,
+// so that the render side doesn't read what the game side writes. The light
+// and the material are still read by the render side, which should not be
+// changed outside the submission. The asset loading which maps the buffer has
+// to be done while the render thread is stopped.
 #pragma warning(disable: 4251)
 class FALCON_ENGINE_API GameEngineGraphics
 {
@@ -68,6 +95,10 @@ public:
     void
     Initialize();
 
+    // @summary Clear the frame buffer before the submitted frame is drawn.
+    void
+    ClearFrameBuffer(const Vector4f& color, float depth, unsigned int stencil);
+
     void
     RenderBegin();
 
@@ -83,10 +114,55 @@ public:
     void
     UpdateFrame(double elapsed);
 
+    /************************************************************************/
+    /* Render Thread API                                                    */
+    /************************************************************************/
+    // @summary Render the handed off frames on the render thread, which takes
+    // the rendering context from the calling thread.
+    void
+    StartRenderThread();
+
+    // @summary Finish the last handed off frame and take the rendering context
+    // back to the calling thread.
+    void
+    StopRenderThread();
+
+    bool
+    IsRenderThreadRunning() const;
+
+    // @summary Time the render side spent on the previous frame, excluding
+    // the swap.
+    double
+    GetLastRenderElapsedMillisecond() const;
+
+    double
+    GetLastSwapElapsedMillisecond() const;
+
+    // @summary Time the game side waited for the render side at the last
+    // handoff.
+    double
+    GetLastHandoffElapsedMillisecond() const;
+
+    // @summary Time from the handoff of the previous frame to its presentation.
+    double
+    GetLastFrameLatencyMillisecond() const;
+
 private:
     void
     Destroy();
 
+    // @summary Wait for the render side to finish the previous frame and pass
+    // the submitted frame to the render side.
+    void
+    Handoff();
+
+    // @summary Draw and present the handed off frame.
+    void
+    RenderFrame();
+
+    void
+    RenderThread();
+
 public:
     DebugRenderer *
     GetDebugRenderer() const
@@ -118,6 +194,30 @@ private:
     FontRenderer       *mFontRenderer;
     Renderer           *mMasterRenderer;
     UiRenderer         *mUiRenderer;
+
+    GameEngineGraphicsClear mClearRecord;                                       // Clear submitted on the game side.
+    GameEngineGraphicsClear mClearRender;                                       // Clear performed on the render side.
+    double                  mPercentRecord;                                     // Interpolation alpha submitted on the game side.
+    double                  mPercentRender;                                     // Interpolation alpha of the handed off frame.
+
+    // NOTE: The render side only writes the timings of its own, which
+    // are published at the handoff after the render side finishes.
+    double                  mHandoffMillisecond;                                // Time of the last handoff.
+    double                  mRenderElapsedMillisecond;
+    double                  mSwapElapsedMillisecond;
+    double                  mFrameLatencyMillisecond;
+
+    double                  mLastRenderElapsedMillisecond;
+    double                  mLastSwapElapsedMillisecond;
+    double                  mLastHandoffElapsedMillisecond;
+    double                  mLastFrameLatencyMillisecond;
+
+    std::thread             mRenderThread;
+    std::mutex              mRenderMutex;
+    std::condition_variable mRenderCondition;
+    bool                    mRenderPending;                                     // Whether the handed off frame is not rendered yet.
+    bool                    mRenderExiting;
+    std::exception_ptr      mRenderException;                                   // Exception on the render thread, thrown again at the handoff.
 };
 #pragma warning(default: 4251)
 
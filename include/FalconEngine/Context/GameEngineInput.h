@@ -2,15 +2,29 @@
 
 #include <FalconEngine/Context/Common.h>
 
+#include <fstream>
 #include <memory>
+#include <string>
 #include <vector>
 
+#include <FalconEngine/Input/InputRecord.h>
+#include <FalconEngine/Input/KeyState.h>
+#include <FalconEngine/Input/MouseButton.h>
+
+namespace cereal
+{
+class PortableBinaryOutputArchive;
+}
+
 namespace FalconEngine
 {
 
 class GameEngineData;
 class GameEngineSettings;
 
+class InputMap;
+using InputMapSharedPtr = std::shared_ptr<InputMap>;
+
 class KeyboardState;
 using KeyboardStateSharedPtr = std::shared_ptr<KeyboardState>;
 
@@ -50,6 +64,11 @@ public:
     ~GameEngineInput();
 
 public:
+    // @summary Action and axis mapping resolved once every frame, which the
+    // game should query instead of the raw keyboard and mouse state.
+    InputMap *
+    GetInputMap() const;
+
     KeyboardState *
     GetKeyboardState() const;
 
@@ -61,9 +80,59 @@ public:
     Initialize();
 
     // @remark Update gets called once every frame by game engine.
-    void
+    //
+    // @return The elapsed time the frame should use, which is the recorded
+    // one when replaying.
+    double
     UpdateFrame(double elasped);
 
+    /************************************************************************/
+    /* Record and Replay                                                    */
+    /************************************************************************/
+    // @summary Record the input events and the elapsed time of each frame
+    // into the file, so that the run could be replayed.
+    void
+    StartRecord(const std::string& recordFilePath);
+
+    void
+    StopRecord();
+
+    bool
+    IsRecording() const;
+
+    // @summary Replay the recorded file in place of the live input. The
+    // elapsed time of each frame is replaced by the recorded one, so that the
+    // game updates exactly as it did when recorded.
+    void
+    StartReplay(const std::string& recordFilePath);
+
+    void
+    StopReplay();
+
+    bool
+    IsReplaying() const;
+
+    // @return Whether all the recorded frames have been replayed.
+    bool
+    IsReplayFinished() const;
+
+// internal
+public:
+    /************************************************************************/
+    /* Internal Members                                                     */
+    /************************************************************************/
+    void
+    SetKeyInternal(Key key, bool keyPressed);
+
+    void
+    SetMouseButtonInternal(MouseButton button, bool buttonPressed);
+
+    void
+    SetMousePositionInternal(double x, double y);
+
+    void
+    SetMouseWheelInternal(double yoffset);
+
 private:
     void
     InitializePlatform();
@@ -77,11 +146,39 @@ private:
     void
     UpdateEvent(double elapsed);
 
+    void
+    ApplyEvent(const InputEvent& event, double timeCurrent);
+
+    // @summary Record and apply the live event.
+    void
+    DispatchEvent(InputEventType type, int code, bool pressed, double x, double y);
+
+    void
+    RecordEvent(const InputEvent& event);
+
+    void
+    RecordFrame(double elapsed);
+
+    // @return The recorded elapsed time of the replayed frame.
+    double
+    ReplayFrame(double elapsed);
+
 private:
     std::unique_ptr<GameEngineInputDispatcher, GameEngineInputDispatcherDeleter> mDispatcher;
 
+    InputMapSharedPtr                                                            mInputMap;
     KeyboardStateSharedPtr                                                       mKeyboardState;
     MouseStateSharedPtr                                                          mMouseState;
+
+    std::ofstream                                                                mRecordStream;
+    std::unique_ptr<cereal::PortableBinaryOutputArchive>                         mRecordArchive;
+    double                                                                       mRecordBegunMillisecond;
+    InputFrame                                                                   mRecordFrame;          // Events polled in current frame.
+
+    bool                                                                         mReplaying;
+    double                                                                       mReplayBegunMillisecond;
+    std::vector<InputFrame>                                                      mReplayFrameList;
+    size_t                                                                       mReplayFrameIndex;
 };
 #pragma warning(default: 4251)
 
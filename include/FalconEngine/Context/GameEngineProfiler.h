@@ -2,7 +2,9 @@
 
 #include <FalconEngine/Context/Common.h>
 
+#include <fstream>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace FalconEngine
@@ -11,6 +13,7 @@ namespace FalconEngine
 class GameEngineData;
 class GameEngineSettings;
 
+#pragma warning(disable: 4251)
 class FALCON_ENGINE_API GameEngineProfiler
 {
     friend class GameEngine;
@@ -42,6 +45,18 @@ public:
     void
     Initialize();
 
+    // @summary Write the timing of each frame as a row of the CSV file, which
+    // is compared across the runs replaying the same input.
+    void
+    StartFrameTiming(const std::string& frameTimingFilePath);
+
+    void
+    StopFrameTiming();
+
+    // @summary Number of frames profiled since startup.
+    uint64_t
+    GetFrameNum() const;
+
     double
     GetLastFrameElapsedMillisecond() const;
 
@@ -51,19 +66,87 @@ public:
     double
     GetLastFrameUpdateTotalCount() const;
 
+    // @summary Number of updates dropped in last frame because the catch-up
+    // budget is exceeded.
+    int
+    GetLastFrameUpdateSkippedCount() const;
+
+    // @summary Number of updates dropped since startup.
+    uint64_t
+    GetUpdateSkippedTotalCount() const;
+
+    // @summary Number of frames whose elapsed time is clamped to the catch-up
+    // budget since startup.
+    uint64_t
+    GetUpdateClampedTotalCount() const;
+
+    // @summary Interpolation alpha between the last two updates used by last
+    // frame's render.
+    double
+    GetLastFrameInterpolationAlpha() const;
+
     double
     GetLastUpdateElapsedMillisecond() const;
 
+    // @summary Time the render side spent on last frame, excluding the swap.
     double
     GetLastRenderElapsedMillisecond() const;
 
+    // @summary Time the render side spent on swapping last frame.
+    double
+    GetLastSwapElapsedMillisecond() const;
+
+    // @summary Time the game side waited for the render side to finish last
+    // frame at the handoff.
+    double
+    GetLastHandoffElapsedMillisecond() const;
+
+    // @summary Time from the handoff of last frame to its presentation.
+    double
+    GetLastFrameLatencyMillisecond() const;
+
+    // @summary Number of tracked heap allocations in last frame.
+    uint64_t
+    GetLastFrameAllocationNum() const;
+
+    // @summary Main thread frame allocator memory used in last frame.
+    size_t
+    GetLastFrameAllocatorUsedByte() const;
+
+    // @summary Maximum main thread frame allocator memory used in any frame.
+    size_t
+    GetFrameAllocatorHighWaterMarkByte() const;
+
 private:
-    double mLastFrameElapsedMillisecond;
-    double mLastFrameFps;
-    int    mLastFrameUpdateTotalCount;
+    // @summary Close the statistics of last frame, called by the engine at the
+    // end of each frame.
+    void
+    UpdateFrame();
+
+private:
+    double mLastFrameElapsedMillisecond = 0;
+    double mLastFrameFps = 0;
+    int    mLastFrameUpdateTotalCount = 0;
+    int    mLastFrameUpdateSkippedCount = 0;
+    double mLastFrameInterpolationAlpha = 0;
+
+    uint64_t mUpdateSkippedTotalCount = 0;
+    uint64_t mUpdateClampedTotalCount = 0;
+
+    double mLastUpdateElapsedMillisecond = 0;
+    double mLastRenderElapsedMillisecond = 0;
+    double mLastSwapElapsedMillisecond = 0;
+    double mLastHandoffElapsedMillisecond = 0;
+    double mLastFrameLatencyMillisecond = 0;
+
+    uint64_t mLastFrameAllocationNum = 0;
+
+    size_t mLastFrameAllocatorUsedByte = 0;
+    size_t mFrameAllocatorHighWaterMarkByte = 0;
 
-    double mLastUpdateElapsedMillisecond;
-    double mLastRenderElapsedMillisecond;
+    uint64_t      mFrameNum = 0;
+    std::ofstream mFrameTimingStream;
 };
+#pragma warning(default: 4251)
 
 }
@@ -36,10 +36,46 @@ public:
     std::string mShaderDirectory;
 
     /************************************************************************/
-    /* Display                                                              */
+    /* Update                                                               */
+    /************************************************************************/
+    double      mUpdateElapsedMillisecond;                                      // Fixed time step of game update.
+    int         mUpdateCountMax;                                                // Maximum update number in one frame. Time beyond is dropped.
+
+    /************************************************************************/
+    /* Render                                                               */
+    /************************************************************************/
+    bool        mRenderThreadEnabled;                                           // Whether the frame is rendered on its own thread, one frame behind the game.
+    bool        mBatchEnabled;                                                  // Whether compatible draws are submitted with multi-draw indirect.
+    int         mBatchDrawNumMax;                                               // Maximum draw number in one batch flush.
+    int         mBatchVertexNumMax;                                             // Vertex capacity of each shared geometry buffer.
+    int         mBatchIndexNumMax;                                              // Index capacity of each shared geometry buffer.
+    bool        mBatchCullEnabled;                                              // Whether batched draws are frustum culled by compute shader.
+    bool        mBatchOcclusionEnabled;                                         // Whether batched draws are occlusion culled with previous frame depth, requiring cull enabled.
+    bool        mBatchBindlessEnabled;                                          // Whether batched materials are sampled with bindless texture, requiring GL_ARB_bindless_texture.
+    bool        mShadowEnabled;                                                 // Whether the directional light casts cascaded shadow, see ShadowRenderer.
+    int         mShadowCascadeNum;                                              // Cascade number, from one to four.
+    int         mShadowCascadeSize;                                             // Width and height of each cascade in texel.
+    float       mShadowCascadeSplitLambda;                                      // Blend from uniform split at zero to logarithmic split at one.
+    float       mShadowDistance;                                                // Farthest eye space distance that receives shadow.
+    int         mShadowFilterRadius;                                            // Radius of PCF kernel in texel, zero for single hardware filtered lookup.
+    bool        mLodEnabled;                                                    // Whether the coarser level of detail of mesh is selected by its projected size.
+    float       mLodErrorPixel;                                                 // Largest projected error of selected level of detail in pixel.
+    float       mLodHysteresis;                                                 // Fraction of the error band around the switch point, which keeps the level from flickering.
+
+    /************************************************************************/
+    /* Input                                                                */
     /************************************************************************/
-    double      mFrameElapsedMillisecond;
+    std::string mInputRecordFilePath;                                           // File the input of each frame is recorded into, empty to disable.
+    std::string mInputReplayFilePath;                                           // File the input is replayed from in place of the live input, empty to disable. The engine exits when the replay finishes.
 
+    /************************************************************************/
+    /* Profile                                                              */
+    /************************************************************************/
+    std::string mFrameTimingFilePath;                                           // CSV file the timing of each frame is written into, empty to disable.
+
+    /************************************************************************/
+    /* Display                                                              */
+    /************************************************************************/
     bool        mMouseLimited;
     bool        mMouseVisible;
 
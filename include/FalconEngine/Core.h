@@ -3,8 +3,13 @@
 #include <FalconEngine/Core/Common.h>
 
 #include <FalconEngine/Core/EventHandler.h>
+#include <FalconEngine/Core/FrameAllocator.h>
+#include <FalconEngine/Core/LinearAllocator.h>
 #include <FalconEngine/Core/Memory.h>
-#include <FalconEngine/Core/MemoryPool.h>
+#include <FalconEngine/Core/MemoryAllocator.h>
+#include <FalconEngine/Core/MemoryTracker.h>
 #include <FalconEngine/Core/Object.h>
 #include <FalconEngine/Core/Path.h>
+#include <FalconEngine/Core/PoolAllocator.h>
 #include <FalconEngine/Core/Rtti.h>
+#include <FalconEngine/Core/StackAllocator.h>
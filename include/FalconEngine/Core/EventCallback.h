@@ -2,13 +2,228 @@
 
 #include <FalconEngine/Core/Common.h>
 
-#include <functional>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 namespace FalconEngine
 {
 
+// @summary Type-erased callable invoked with event sender and event data.
+// Callable no larger than the inline buffer, like lambda capturing a few
+// pointers, is stored in place without heap allocation. Larger callable falls
+// back to heap storage.
+#pragma warning(disable: 4251)
 template <typename T>
-using EventBinder = std::function<void(void *, T)>;
+class EventBinder
+{
+public:
+    static const size_t BufferSize = 3 * sizeof(void *);
+
+public:
+    /************************************************************************/
+    /* Constructors and Destructor                                          */
+    /************************************************************************/
+    EventBinder() :
+        mInvoker(nullptr),
+        mManager(nullptr)
+    {
+    }
+
+    template <typename F, typename = typename std::enable_if<!std::is_same<typename std::decay<F>::type, EventBinder>::value>::type>
+    EventBinder(F&& function)
+    {
+        using Storage = EventBinderStorage<typename std::decay<F>::type>;
+
+        Storage::Create(mBuffer, std::forward<F>(function));
+        mInvoker = &Storage::Invoke;
+        mManager = &Storage::Manage;
+    }
+
+    EventBinder(const EventBinder& rhs) :
+        mInvoker(rhs.mInvoker),
+        mManager(rhs.mManager)
+    {
+        if (mManager)
+        {
+            mManager(Operation::Copy, mBuffer, const_cast<unsigned char *>(rhs.mBuffer));
+        }
+    }
+
+    EventBinder(EventBinder&& rhs) noexcept :
+        mInvoker(rhs.mInvoker),
+        mManager(rhs.mManager)
+    {
+        if (mManager)
+        {
+            mManager(Operation::Move, mBuffer, rhs.mBuffer);
+
+            rhs.mInvoker = nullptr;
+            rhs.mManager = nullptr;
+        }
+    }
+
+    ~EventBinder()
+    {
+        Reset();
+    }
+
+    EventBinder&
+    operator=(const EventBinder& rhs)
+    {
+        if (this != &rhs)
+        {
+            EventBinder copy(rhs);
+            *this = std::move(copy);
+        }
+
+        return *this;
+    }
+
+    EventBinder&
+    operator=(EventBinder&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            Reset();
+
+            mInvoker = rhs.mInvoker;
+            mManager = rhs.mManager;
+            if (mManager)
+            {
+                mManager(Operation::Move, mBuffer, rhs.mBuffer);
+
+                rhs.mInvoker = nullptr;
+                rhs.mManager = nullptr;
+            }
+        }
+
+        return *this;
+    }
+
+public:
+    /************************************************************************/
+    /* Public Members                                                       */
+    /************************************************************************/
+    explicit operator bool() const
+    {
+        return mInvoker != nullptr;
+    }
+
+    void
+    operator()(void *sender, T data) const
+    {
+        mInvoker(const_cast<unsigned char *>(mBuffer), sender, data);
+    }
+
+    void
+    Reset()
+    {
+        if (mManager)
+        {
+            mManager(Operation::Destroy, mBuffer, nullptr);
+        }
+
+        mInvoker = nullptr;
+        mManager = nullptr;
+    }
+
+private:
+    enum class Operation
+    {
+        Copy,
+        Move,                                                                   // Move source into destination and destroy source.
+        Destroy,
+    };
+
+    using Invoker = void(*)(unsigned char *buffer, void *sender, T data);
+    using Manager = void(*)(Operation operation, unsigned char *destination, unsigned char *source);
+
+    template <typename F, bool Inline = sizeof(F) <= BufferSize
+                                        && alignof(F) <= alignof(void *)
+                                        && std::is_nothrow_move_constructible<F>::value>
+    class EventBinderStorage;
+
+    // NOTE: The callable lives in the buffer.
+    template <typename F>
+    class EventBinderStorage<F, true>
+    {
+    public:
+        template <typename G>
+        static void
+        Create(unsigned char *buffer, G&& function)
+        {
+            new (buffer) F(std::forward<G>(function));
+        }
+
+        static void
+        Invoke(unsigned char *buffer, void *sender, T data)
+        {
+            (*reinterpret_cast<F *>(buffer))(sender, data);
+        }
+
+        static void
+        Manage(Operation operation, unsigned char *destination, unsigned char *source)
+        {
+            switch (operation)
+            {
+            case Operation::Copy:
+                new (destination) F(*reinterpret_cast<const F *>(source));
+                break;
+            case Operation::Move:
+                new (destination) F(std::move(*reinterpret_cast<F *>(source)));
+                reinterpret_cast<F *>(source)->~F();
+                break;
+            case Operation::Destroy:
+                reinterpret_cast<F *>(destination)->~F();
+                break;
+            }
+        }
+    };
+
+    // NOTE: The buffer holds the pointer to the callable on heap.
+    template <typename F>
+    class EventBinderStorage<F, false>
+    {
+    public:
+        template <typename G>
+        static void
+        Create(unsigned char *buffer, G&& function)
+        {
+            *reinterpret_cast<F **>(buffer) = new F(std::forward<G>(function));
+        }
+
+        static void
+        Invoke(unsigned char *buffer, void *sender, T data)
+        {
+            (**reinterpret_cast<F **>(buffer))(sender, data);
+        }
+
+        static void
+        Manage(Operation operation, unsigned char *destination, unsigned char *source)
+        {
+            switch (operation)
+            {
+            case Operation::Copy:
+                *reinterpret_cast<F **>(destination) = new F(**reinterpret_cast<F **>(source));
+                break;
+            case Operation::Move:
+                *reinterpret_cast<F **>(destination) = *reinterpret_cast<F **>(source);
+                break;
+            case Operation::Destroy:
+                delete *reinterpret_cast<F **>(destination);
+                break;
+            }
+        }
+    };
+
+private:
+    alignas(void *) unsigned char mBuffer[BufferSize];
+    Invoker                       mInvoker;
+    Manager                       mManager;
+};
+#pragma warning(default: 4251)
 
 #pragma warning(disable: 4251)
 template <typename T>
@@ -32,4 +247,3 @@ public:
 #pragma warning(default: 4251)
 
 }
-
@@ -2,16 +2,82 @@
 
 #include <FalconEngine/Core/Common.h>
 
-#include <list>
+#include <algorithm>
+#include <cstdint>
+#include <new>
 
 #include <FalconEngine/Core/EventCallback.h>
 
 namespace FalconEngine
 {
 
+// @summary Subscription stored in event handler. The sequence is increasing in
+// the order of subscription, which locates where the invocation continues
+// after the slots change during invocation.
 template <typename T>
-using EventCallbackList = std::list<EventCallback<T>*>;
+class EventSlot
+{
+public:
+    const EventCallback<T> *mCallback;
+    uint64_t                mSequence;
+};
+
+// @summary Subscription block allocated on the second subscription. The slots
+// are stored right after the block header in the order of invocation, which is
+// the latest subscription first, so that invocation only needs one indirection
+// from the event handler.
+template <typename T>
+class alignas(alignof(EventSlot<T>)) EventSlotBlock
+{
+public:
+    static EventSlotBlock *
+    Create(int slotCapacity)
+    {
+        auto memory = ::operator new(sizeof(EventSlotBlock) + sizeof(EventSlot<T>) * size_t(slotCapacity));
+        return new (memory) EventSlotBlock(slotCapacity);
+    }
+
+    static void
+    Destroy(EventSlotBlock *slotBlock)
+    {
+        slotBlock->~EventSlotBlock();
+        ::operator delete(slotBlock);
+    }
+
+private:
+    explicit EventSlotBlock(int slotCapacity) :
+        mSlotNum(0),
+        mSlotCapacity(slotCapacity),
+        mSlotVersion(0),
+        mSlotSequence(0)
+    {
+    }
 
+    ~EventSlotBlock() = default;
+
+public:
+    EventSlot<T> *
+    GetSlotData()
+    {
+        return reinterpret_cast<EventSlot<T> *>(this + 1);
+    }
+
+public:
+    int      mSlotNum;
+    int      mSlotCapacity;
+    uint32_t mSlotVersion;                                                      // Changed whenever the slots are added or removed.
+    uint64_t mSlotSequence;                                                     // Sequence of the next subscription.
+};
+
+// @summary Event handler storing subscriptions contiguously. Invocation
+// doesn't allocate, and returns immediately when there is no subscriber. The
+// only subscription is stored in the event handler, which is the case of most
+// events, so that it doesn't allocate the slot block.
+//
+// @remark Subscribing or unsubscribing in a callback during invocation is
+// allowed. Removed callback is not invoked again. Added callback takes effect
+// from the next invocation.
+//
 // @ref Luis Sempe User Interface Programming for Games, 2014.
 #pragma warning(disable: 4251)
 template <typename T>
@@ -21,42 +87,149 @@ public:
     EventHandler();
     virtual ~EventHandler();
 
+    EventHandler(const EventHandler&) = delete;
+    EventHandler& operator=(const EventHandler&) = delete;
+
 public:
-    typename EventCallbackList<T>::iterator
+    void
     operator += (EventCallback<T> *callback)
     {
-        mCallbackList.emplace_front(callback);
-        return mCallbackList.begin();
+        if (mSlotBlock == nullptr)
+        {
+            if (mCallback == nullptr)
+            {
+                mCallback = callback;
+                return;
+            }
+
+            mSlotBlock = EventSlotBlock<T>::Create(2);
+            mSlotBlock->GetSlotData()[0] = EventSlot<T> { mCallback, mSlotBlock->mSlotSequence++ };
+            mSlotBlock->mSlotNum = 1;
+            mCallback = nullptr;
+        }
+        else if (mSlotBlock->mSlotNum == mSlotBlock->mSlotCapacity)
+        {
+            auto slotBlock = EventSlotBlock<T>::Create(mSlotBlock->mSlotCapacity * 2);
+            std::copy_n(mSlotBlock->GetSlotData(), mSlotBlock->mSlotNum, slotBlock->GetSlotData());
+            slotBlock->mSlotNum = mSlotBlock->mSlotNum;
+            slotBlock->mSlotVersion = mSlotBlock->mSlotVersion;
+            slotBlock->mSlotSequence = mSlotBlock->mSlotSequence;
+            EventSlotBlock<T>::Destroy(mSlotBlock);
+
+            mSlotBlock = slotBlock;
+        }
+
+        auto slotData = mSlotBlock->GetSlotData();
+        std::copy_backward(slotData, slotData + mSlotBlock->mSlotNum, slotData + mSlotBlock->mSlotNum + 1);
+        slotData[0] = EventSlot<T> { callback, mSlotBlock->mSlotSequence++ };
+        ++mSlotBlock->mSlotNum;
+        ++mSlotBlock->mSlotVersion;
     }
 
     void
     operator -= (EventCallback<T> *callback)
     {
-        mCallbackList.remove(callback);
+        if (mCallback == callback)
+        {
+            mCallback = nullptr;
+        }
+
+        if (mSlotBlock == nullptr)
+        {
+            return;
+        }
+
+        auto slotData = mSlotBlock->GetSlotData();
+        auto slotEnd = std::remove_if(slotData, slotData + mSlotBlock->mSlotNum, [callback](const EventSlot<T>& slot)
+        {
+            return slot.mCallback == callback;
+        });
+
+        auto slotNum = int(slotEnd - slotData);
+        if (slotNum != mSlotBlock->mSlotNum)
+        {
+            mSlotBlock->mSlotNum = slotNum;
+            ++mSlotBlock->mSlotVersion;
+        }
+    }
+
+    bool
+    IsEmpty() const
+    {
+        return mCallback == nullptr && (mSlotBlock == nullptr || mSlotBlock->mSlotNum == 0);
     }
 
     void
     Invoke(void *sender, T data)
     {
-        for (auto callback : mCallbackList)
+        if (mCallback != nullptr)
         {
-            callback->mBinder(sender, data);
+            mCallback->mBinder(sender, data);
+        }
+        else if (mSlotBlock != nullptr)
+        {
+            InvokeInternal(sender, data);
         }
     }
 
 private:
-    EventCallbackList<T> mCallbackList;
+    void
+    InvokeInternal(void *sender, T data)
+    {
+        // NOTE: Invocation only reads the handler. Subscribing or unsubscribing
+        // in the callback changes the slot version, or the block when the
+        // block is reallocated, after which the invocation continues from the
+        // slot subscribed before the one just invoked.
+        auto slotBlock = mSlotBlock;
+        auto slotVersion = slotBlock->mSlotVersion;
+        auto slotData = slotBlock->GetSlotData();
+        for (int slotIndex = 0; slotIndex < slotBlock->mSlotNum; ++slotIndex)
+        {
+            auto& slot = slotData[slotIndex];
+            auto slotSequence = slot.mSequence;
+            slot.mCallback->mBinder(sender, data);
+
+            if (mSlotBlock != slotBlock || slotBlock->mSlotVersion != slotVersion)
+            {
+                slotBlock = mSlotBlock;
+                slotVersion = slotBlock->mSlotVersion;
+                slotData = slotBlock->GetSlotData();
+                slotIndex = FindSlotRemaining(slotSequence) - 1;
+            }
+        }
+    }
+
+    // @return The index of the first slot subscribed before the sequence.
+    int
+    FindSlotRemaining(uint64_t slotSequence) const
+    {
+        auto slotData = mSlotBlock->GetSlotData();
+        return int(std::partition_point(slotData, slotData + mSlotBlock->mSlotNum, [slotSequence](const EventSlot<T>& slot)
+        {
+            return slot.mSequence >= slotSequence;
+        }) - slotData);
+    }
+
+private:
+    const EventCallback<T> *mCallback;                                          // The only subscription before the slot block is allocated.
+    EventSlotBlock<T>      *mSlotBlock;
 };
 #pragma warning(default: 4251)
 
 template <typename T>
-EventHandler<T>::EventHandler()
+EventHandler<T>::EventHandler() :
+    mCallback(nullptr),
+    mSlotBlock(nullptr)
 {
 }
 
 template <typename T>
 EventHandler<T>::~EventHandler()
 {
+    if (mSlotBlock != nullptr)
+    {
+        EventSlotBlock<T>::Destroy(mSlotBlock);
+    }
 }
 
 }
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <FalconEngine/Core/Common.h>
+
+#include <atomic>
+
+#include <FalconEngine/Core/LinearAllocator.h>
+
+namespace FalconEngine
+{
+
+// @summary Thread-local linear allocator for per-frame temporary memory. All
+// the memory allocated in a frame is released when the next frame begins, so
+// the memory should never be held across frame boundaries.
+//
+// @remark Each thread owns its own frame allocator so no synchronization is
+// needed. The calling thread of BeginFrame resets its allocator immediately,
+// the other threads reset lazily on their first allocation in the new frame.
+class FALCON_ENGINE_API FrameAllocator final : public LinearAllocator
+{
+public:
+    /************************************************************************/
+    /* Static Members                                                       */
+    /************************************************************************/
+    static const size_t Capacity;
+
+    // @summary Get the frame allocator of the calling thread.
+    static FrameAllocator *
+    GetInstance();
+
+    // @summary Mark the beginning of a new frame. Called by the game engine at
+    // the beginning of each loop iteration.
+    static void
+    BeginFrame();
+
+    static int64_t
+    GetFrameIndex();
+
+private:
+    static std::atomic<int64_t> sFrameIndex;
+
+    /************************************************************************/
+    /* Constructors and Destructor                                          */
+    /************************************************************************/
+private:
+    FrameAllocator();
+
+public:
+    virtual ~FrameAllocator();
+
+public:
+    /************************************************************************/
+    /* Public Members                                                       */
+    /************************************************************************/
+    virtual void *
+    Allocate(size_t size, size_t alignment = MemoryAlignmentDefault) override;
+
+private:
+    int64_t mFrameIndex;
+};
+
+// @summary Standard library allocator adapter backed by the calling thread's
+// frame allocator. Deallocation is no-op, so the container must not outlive
+// the frame.
+template <typename T>
+class FrameStlAllocator
+{
+public:
+    using value_type = T;
+
+public:
+    FrameStlAllocator() = default;
+
+    template <typename U>
+    FrameStlAllocator(const FrameStlAllocator<U>& /* rhs */)
+    {
+    }
+
+public:
+    T *
+    allocate(size_t n)
+    {
+        return FrameAllocator::GetInstance()->AllocateArray<T>(n);
+    }
+
+    void
+    deallocate(T * /* pointer */, size_t /* n */)
+    {
+    }
+};
+
+template <typename T, typename U>
+bool
+operator==(const FrameStlAllocator<T>&, const FrameStlAllocator<U>&)
+{
+    return true;
+}
+
+template <typename T, typename U>
+bool
+operator!=(const FrameStlAllocator<T>&, const FrameStlAllocator<U>&)
+{
+    return false;
+}
+
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <FalconEngine/Core/Common.h>
+
+#include <vector>
+
+#include <FalconEngine/Core/MemoryAllocator.h>
+
+namespace FalconEngine
+{
+
+// @summary Allocate memory by bumping an offset inside a preallocated storage.
+// Individual allocation could not be released, all the allocations are
+// released at once by Reset.
+#pragma warning(disable: 4251)
+class FALCON_ENGINE_API LinearAllocator : public MemoryAllocator
+{
+public:
+    /************************************************************************/
+    /* Constructors and Destructor                                          */
+    /************************************************************************/
+    explicit LinearAllocator(size_t capacity, MemoryTag tag = MemoryTag::General);
+    virtual ~LinearAllocator();
+
+public:
+    /************************************************************************/
+    /* Public Members                                                       */
+    /************************************************************************/
+    virtual void *
+    Allocate(size_t size, size_t alignment = MemoryAlignmentDefault) override;
+
+    // @remark Linear allocator doesn't support individual deallocation.
+    virtual void
+    Deallocate(void *pointer) override;
+
+    // @summary Release all the allocations.
+    void
+    Reset();
+
+protected:
+    // @summary Release all the allocations after given used size.
+    void
+    Rewind(size_t usedSize);
+
+protected:
+    unsigned char      *mStorage;
+
+#if defined(FALCON_ENGINE_DEBUG_MEMORY)
+    // NOTE: Guard offset in order of allocation, which is checked
+    // when the allocation is released.
+    std::vector<size_t> mGuardOffsetList;
+#endif
+};
+#pragma warning(default: 4251)
+
+}
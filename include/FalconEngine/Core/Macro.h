@@ -53,6 +53,12 @@
 #define FALCON_ENGINE_DEBUG_MEMORY
 #endif
 
+// NOTE: Memory profiling is enabled in debug build and in release
+// build with FALCON_ENGINE_PROFILE defined.
+#if defined(FALCON_ENGINE_DEBUG) || defined(FALCON_ENGINE_PROFILE)
+#define FALCON_ENGINE_PROFILE_MEMORY
+#endif
+
 /************************************************************************/
 /* Development Items                                                    */
 /************************************************************************/
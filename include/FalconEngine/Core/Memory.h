@@ -2,6 +2,9 @@
 
 #include <FalconEngine/Core/Common.h>
 
+#include <FalconEngine/Core/MemoryAllocator.h>
+#include <FalconEngine/Core/MemoryTracker.h>
+
 namespace FalconEngine
 {
 
@@ -32,22 +35,39 @@ Terabytes(int i)
     return Gigabytes(i) * 1024LL;
 }
 
+/************************************************************************/
+/* Memory Record                                                        */
+/************************************************************************/
+// @remark Memory records are only kept when FALCON_ENGINE_DEBUG_MEMORY is
+// defined. Otherwise the record functions are no-op.
 void
 PushMemoryRecord(void *pointer, const char *file, size_t line);
 
 void
 PopMemoryRecord(void *pointer);
 
-extern const char *__file__;
-extern size_t __line__;
+// @summary Get the number of allocations not released yet.
+size_t
+GetMemoryRecordNum();
 
 }
 
+// @remark Use as New(allocator) Type(arguments) and Delete(allocator, pointer),
+// or New(tag) Type(arguments) and Delete(tag, pointer) for tagged heap memory.
+// Memory must be returned to the same allocator or released with the same tag,
+// so Delete requires the allocator or tag as well.
+//
+// NOTE: The call site is passed as placement arguments rather than through
+// global variables, because allocation happens on the render thread and the
+// recording threads as well.
+#if defined(FALCON_ENGINE_PROFILE_MEMORY)
+#define New(memoryAllocator) new(memoryAllocator, __FILE__, size_t(__LINE__))
+#else
+#define New(memoryAllocator) new(memoryAllocator)
+#endif
+
 #if defined(FALCON_ENGINE_DEBUG_MEMORY)
-// http://stackoverflow.com/questions/619467/macro-to-replace-c-operator-new
-#define New(memoryPool) (FalconEngine::__file__=__FILE__, FalconEngine::__line__=__LINE__) && 0 ? NULL : new(memoryPool)
-#define Delete(memoryPointer) (FalconEngine::__file__=__FILE__, FalconEngine::__line__=__LINE__) && 0 ? NULL : delete memoryPointer
+#define Delete(memoryAllocator, memoryPointer) (FalconEngine::PopMemoryRecord(memoryPointer), FalconEngine::DeleteInternal(memoryAllocator, memoryPointer))
 #else
-#define New(memoryPool) new(memoryPool)
-#define Delete(memoryPool) delete(memoryPool)
+#define Delete(memoryAllocator, memoryPointer) FalconEngine::DeleteInternal(memoryAllocator, memoryPointer)
 #endif
\ No newline at end of file
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <FalconEngine/Core/Common.h>
+
+#include <cstddef>
+
+#include <FalconEngine/Core/MemoryTracker.h>
+
+namespace FalconEngine
+{
+
+class MemoryAllocator;
+
+}
+
+void *operator new(size_t size, FalconEngine::MemoryAllocator *allocator);
+void *operator new[](size_t size, FalconEngine::MemoryAllocator *allocator);
+void *operator new(size_t size, FalconEngine::MemoryAllocator *allocator, const char *file, size_t line);
+void *operator new[](size_t size, FalconEngine::MemoryAllocator *allocator, const char *file, size_t line);
+
+// NOTE: Only called when the constructor throws during placement new.
+void operator delete(void *pointer, FalconEngine::MemoryAllocator *allocator);
+void operator delete[](void *pointer, FalconEngine::MemoryAllocator *allocator);
+void operator delete(void *pointer, FalconEngine::MemoryAllocator *allocator, const char *file, size_t line);
+void operator delete[](void *pointer, FalconEngine::MemoryAllocator *allocator, const char *file, size_t line);
+
+namespace FalconEngine
+{
+
+// @summary Alignment suitable for any scalar type, which is the alignment
+// malloc guarantees.
+const size_t MemoryAlignmentDefault = alignof(std::max_align_t);
+
+inline bool
+IsMemoryAlignmentValid(size_t alignment)
+{
+    return alignment != 0 && (alignment & (alignment - 1)) == 0;
+}
+
+inline uintptr_t
+AlignMemoryAddress(uintptr_t address, size_t alignment)
+{
+    return (address + (alignment - 1)) & ~uintptr_t(alignment - 1);
+}
+
+// @summary Base class of engine allocators. All the allocators honor requested
+// alignment, throw when running out of capacity and track the high-water mark
+// of used bytes. In debug memory builds, guard bytes are written after each
+// allocation so that buffer overflow could be detected when memory is released.
+//
+// @remark Allocators are not thread-safe unless stated otherwise.
+#pragma warning(disable: 4251)
+class FALCON_ENGINE_API MemoryAllocator
+{
+public:
+#if defined(FALCON_ENGINE_DEBUG_MEMORY)
+    static const uint32_t GuardValue = 0xFDFDFDFD;
+    static const size_t   GuardSize = sizeof(uint32_t);
+#else
+    static const size_t   GuardSize = 0;
+#endif
+
+protected:
+    /************************************************************************/
+    /* Constructors and Destructor                                          */
+    /************************************************************************/
+    MemoryAllocator(size_t capacity, MemoryTag tag);
+
+public:
+    virtual ~MemoryAllocator();
+
+    MemoryAllocator(const MemoryAllocator&) = delete;
+    MemoryAllocator& operator=(const MemoryAllocator&) = delete;
+
+public:
+    /************************************************************************/
+    /* Public Members                                                       */
+    /************************************************************************/
+    virtual void *
+    Allocate(size_t size, size_t alignment = MemoryAlignmentDefault) = 0;
+
+    // @remark Allocators that release memory in bulk, like linear allocator,
+    // treat this as no-op.
+    virtual void
+    Deallocate(void *pointer) = 0;
+
+    template <typename T>
+    T *
+    AllocateArray(size_t elementNum)
+    {
+        return static_cast<T *>(Allocate(sizeof(T) * elementNum, alignof(T)));
+    }
+
+    // @summary Total bytes managed by this allocator.
+    size_t
+    GetCapacity() const;
+
+    // @summary Bytes currently in use, including alignment padding.
+    size_t
+    GetUsedSize() const;
+
+    // @summary Maximum bytes ever in use since construction.
+    size_t
+    GetHighWaterMark() const;
+
+    // @summary Tag the storage of this allocator is recorded with.
+    MemoryTag
+    GetTag() const;
+
+protected:
+    void
+    UpdateHighWaterMark();
+
+    void
+    WriteGuard(unsigned char *address) const;
+
+    bool
+    CheckGuard(const unsigned char *address) const;
+
+    void
+    ThrowOverflow() const;
+
+    void
+    ThrowOutOfCapacity(size_t size) const;
+
+protected:
+    size_t    mCapacity;
+    size_t    mUsedSize;
+    size_t    mHighWaterMark;
+    MemoryTag mTag;
+};
+#pragma warning(default: 4251)
+
+// @summary Destruct the object and return its memory to the allocator.
+template <typename T>
+void
+DeleteInternal(MemoryAllocator *allocator, T *pointer)
+{
+    if (pointer != nullptr)
+    {
+        pointer->~T();
+        allocator->Deallocate(pointer);
+    }
+}
+
+}
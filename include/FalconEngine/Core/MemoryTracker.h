@@ -0,0 +1,298 @@
+#pragma once
+
+#include <FalconEngine/Core/Common.h>
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+
+namespace FalconEngine
+{
+
+// @summary Subsystem that owns an allocation. Used to break down engine memory
+// usage by subsystem.
+enum class MemoryTag
+{
+    General,
+    Asset,
+    Debug,
+    Font,
+    Renderer,
+    Scene,
+
+    Count,
+};
+
+FALCON_ENGINE_API extern const char *MemoryTagName[int(MemoryTag::Count)];
+
+}
+
+// NOTE: Tagged heap allocation. In memory profiling builds each
+// allocation is prefixed with a header recording its size, tag and call site.
+//
+// @remark Array allocation is only supported for trivially destructible
+// element types, because the array cookie would otherwise shift the pointer
+// returned to Delete.
+void *operator new(size_t size, FalconEngine::MemoryTag tag);
+void *operator new[](size_t size, FalconEngine::MemoryTag tag);
+void *operator new(size_t size, FalconEngine::MemoryTag tag, const char *file, size_t line);
+void *operator new[](size_t size, FalconEngine::MemoryTag tag, const char *file, size_t line);
+
+// NOTE: Only called when the constructor throws during placement new.
+void operator delete(void *pointer, FalconEngine::MemoryTag tag);
+void operator delete[](void *pointer, FalconEngine::MemoryTag tag);
+void operator delete(void *pointer, FalconEngine::MemoryTag tag, const char *file, size_t line);
+void operator delete[](void *pointer, FalconEngine::MemoryTag tag, const char *file, size_t line);
+
+namespace FalconEngine
+{
+
+class MemoryTagStat
+{
+public:
+    size_t   mLiveByte;
+    size_t   mPeakByte;
+    uint64_t mAllocationNum;                                                    // Total allocation number since startup.
+    uint64_t mDeallocationNum;                                                  // Total deallocation number since startup.
+    double   mAllocationRate;                                                   // Allocation number per second in last frame.
+};
+
+// @summary Track live bytes, peak bytes and allocation rate for each memory
+// tag, and the call site of each tagged heap allocation.
+//
+// @remark Tracking is only enabled when FALCON_ENGINE_PROFILE_MEMORY is
+// defined. Counters are lock-free atomics with relaxed ordering; only tagged
+// heap allocation takes a per-tag lock to link its header into the live list,
+// so the tracking is cheap enough to stay on in profiling builds.
+#pragma warning(disable: 4251)
+class FALCON_ENGINE_API MemoryTracker
+{
+public:
+    /************************************************************************/
+    /* Static Members                                                       */
+    /************************************************************************/
+    static MemoryTracker *
+    GetInstance()
+    {
+        static MemoryTracker sInstance;
+
+        // NOTE: The exit handler is registered after the tracker is
+        // constructed, so that it runs after every static object constructed
+        // later is destroyed, but before the tracker is destroyed.
+        static bool sInstanceExitRegistered = std::atexit(OutputLeakAtExitInternal) == 0;
+        (void) sInstanceExitRegistered;
+
+        return &sInstance;
+    }
+
+    /************************************************************************/
+    /* Constructors and Destructor                                          */
+    /************************************************************************/
+private:
+    MemoryTracker();
+
+public:
+    ~MemoryTracker() = default;
+
+public:
+    /************************************************************************/
+    /* Allocation                                                           */
+    /************************************************************************/
+    void *
+    Allocate(size_t size, MemoryTag tag, const char *file, size_t line);
+
+    void
+    Deallocate(void *pointer, MemoryTag tag);
+
+    /************************************************************************/
+    /* Record                                                               */
+    /************************************************************************/
+    // @summary Record memory that is managed elsewhere, like allocator storage
+    // or standard container nodes.
+    void
+    RecordAllocation(MemoryTag tag, size_t size)
+    {
+#if defined(FALCON_ENGINE_PROFILE_MEMORY)
+        auto& counter = mCounterTable[int(tag)];
+        auto liveByte = counter.mLiveByte.fetch_add(size, std::memory_order_relaxed) + size;
+
+        // NOTE: Peak could be slightly stale under contention, which
+        // is acceptable for profiling.
+        auto peakByte = counter.mPeakByte.load(std::memory_order_relaxed);
+        while (liveByte > peakByte
+                && !counter.mPeakByte.compare_exchange_weak(peakByte, liveByte, std::memory_order_relaxed))
+        {
+        }
+
+        counter.mAllocationNum.fetch_add(1, std::memory_order_relaxed);
+        mFrameAllocationNum.fetch_add(1, std::memory_order_relaxed);
+#else
+        (void) tag;
+        (void) size;
+#endif
+    }
+
+    void
+    RecordDeallocation(MemoryTag tag, size_t size)
+    {
+#if defined(FALCON_ENGINE_PROFILE_MEMORY)
+        auto& counter = mCounterTable[int(tag)];
+        counter.mLiveByte.fetch_sub(size, std::memory_order_relaxed);
+        counter.mDeallocationNum.fetch_add(1, std::memory_order_relaxed);
+#else
+        (void) tag;
+        (void) size;
+#endif
+    }
+
+    /************************************************************************/
+    /* Statistics                                                           */
+    /************************************************************************/
+    MemoryTagStat
+    GetTagStat(MemoryTag tag) const;
+
+    // @summary Allocation number of all the tags in last frame.
+    uint64_t
+    GetLastFrameAllocationNum() const;
+
+    // @summary Close the current frame and update allocation rate. Called by
+    // the game engine once per frame.
+    void
+    UpdateFrame(double elapsedMillisecond);
+
+    // @summary Output live bytes, peak bytes and allocation rate of each tag.
+    void
+    OutputReport() const;
+
+    // @summary Output every tagged heap allocation that is still alive with
+    // its call site, and the live bytes of each tag.
+    //
+    // @return The number of tagged heap allocations still alive.
+    size_t
+    OutputLeak() const;
+
+    // @summary Output the leak at process exit, after the asset manager and
+    // the renderers have released their resources in static destruction.
+    void
+    OutputLeakAtExit();
+
+private:
+    static void
+    OutputLeakAtExitInternal();
+
+private:
+    class MemoryCounter
+    {
+    public:
+        std::atomic<size_t>   mLiveByte;
+        std::atomic<size_t>   mPeakByte;
+        std::atomic<uint64_t> mAllocationNum;
+        std::atomic<uint64_t> mDeallocationNum;
+    };
+
+    class MemoryHeader;
+
+    std::array<MemoryCounter, int(MemoryTag::Count)> mCounterTable;
+    std::atomic<uint64_t>                            mFrameAllocationNum;
+
+    // NOTE: Only accessed by the thread calling UpdateFrame.
+    std::array<uint64_t, int(MemoryTag::Count)>      mLastAllocationNumTable;
+    std::array<double, int(MemoryTag::Count)>        mAllocationRateTable;
+    uint64_t                                         mLastFrameAllocationNum;
+
+    // NOTE: Live tagged heap allocation is kept in an intrusive list
+    // per tag, so that the leak dump doesn't need a separate lookup table.
+    std::array<MemoryHeader *, int(MemoryTag::Count)> mHeaderListHead;
+    mutable std::array<std::mutex, int(MemoryTag::Count)> mHeaderListMutex;
+
+    bool                                             mLeakOutputAtExit;
+};
+#pragma warning(default: 4251)
+
+// @summary Set the default memory tag of the calling thread for the lifetime
+// of the scope. Used by the resources that don't know which subsystem they
+// belong to, like buffer and texture storage.
+class FALCON_ENGINE_API MemoryTagScope
+{
+public:
+    static MemoryTag
+    GetCurrent();
+
+public:
+    explicit MemoryTagScope(MemoryTag tag);
+    ~MemoryTagScope();
+
+    MemoryTagScope(const MemoryTagScope&) = delete;
+    MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+
+private:
+    MemoryTag mTagPrevious;
+};
+
+// @summary Standard library allocator adapter that records container memory
+// under given tag. Call sites are not recorded, only the counters.
+template <typename T, MemoryTag Tag>
+class MemoryTagStlAllocator
+{
+public:
+    using value_type = T;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = MemoryTagStlAllocator<U, Tag>;
+    };
+
+public:
+    MemoryTagStlAllocator() = default;
+
+    template <typename U>
+    MemoryTagStlAllocator(const MemoryTagStlAllocator<U, Tag>& /* rhs */)
+    {
+    }
+
+public:
+    T *
+    allocate(size_t n)
+    {
+        auto size = sizeof(T) * n;
+        MemoryTracker::GetInstance()->RecordAllocation(Tag, size);
+        return static_cast<T *>(::operator new(size));
+    }
+
+    void
+    deallocate(T *pointer, size_t n)
+    {
+        MemoryTracker::GetInstance()->RecordDeallocation(Tag, sizeof(T) * n);
+        ::operator delete(pointer);
+    }
+};
+
+template <typename T, typename U, MemoryTag Tag>
+bool
+operator==(const MemoryTagStlAllocator<T, Tag>&, const MemoryTagStlAllocator<U, Tag>&)
+{
+    return true;
+}
+
+template <typename T, typename U, MemoryTag Tag>
+bool
+operator!=(const MemoryTagStlAllocator<T, Tag>&, const MemoryTagStlAllocator<U, Tag>&)
+{
+    return false;
+}
+
+// @summary Destruct the object and return its memory to the tagged heap.
+template <typename T>
+void
+DeleteInternal(MemoryTag tag, T *pointer)
+{
+    if (pointer != nullptr)
+    {
+        pointer->~T();
+        MemoryTracker::GetInstance()->Deallocate(pointer, tag);
+    }
+}
+
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <FalconEngine/Core/Common.h>
+
+#include <vector>
+
+#include <FalconEngine/Core/MemoryAllocator.h>
+
+namespace FalconEngine
+{
+
+// @summary Allocate fixed-size blocks from a preallocated storage. Free blocks
+// are kept in an intrusive free list so that both allocation and deallocation
+// are constant time.
+#pragma warning(disable: 4251)
+class FALCON_ENGINE_API PoolAllocator final : public MemoryAllocator
+{
+public:
+    /************************************************************************/
+    /* Constructors and Destructor                                          */
+    /************************************************************************/
+    PoolAllocator(size_t blockSize, size_t blockNum, size_t blockAlignment = MemoryAlignmentDefault, MemoryTag tag = MemoryTag::General);
+    virtual ~PoolAllocator();
+
+public:
+    /************************************************************************/
+    /* Public Members                                                       */
+    /************************************************************************/
+    // @remark The size should not be larger than block size and the alignment
+    // should not be larger than block alignment.
+    virtual void *
+    Allocate(size_t size, size_t alignment = MemoryAlignmentDefault) override;
+
+    virtual void
+    Deallocate(void *pointer) override;
+
+    size_t
+    GetBlockSize() const;
+
+    size_t
+    GetBlockNum() const;
+
+    size_t
+    GetBlockUsedNum() const;
+
+private:
+    size_t
+    GetBlockIndex(const void *pointer) const;
+
+private:
+    size_t             mBlockAlignment;
+    size_t             mBlockSize;                                           // Block size requested.
+    size_t             mBlockStride;                                         // Block size including guard and alignment padding.
+    size_t             mBlockNum;
+    void              *mBlockFreeList;                                       // Head of the intrusive free list.
+
+    unsigned char     *mStorage;
+    unsigned char     *mStorageAligned;
+
+#if defined(FALCON_ENGINE_DEBUG_MEMORY)
+    std::vector<bool>  mBlockAllocated;                                      // Used to detect double free.
+#endif
+};
+#pragma warning(default: 4251)
+
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <FalconEngine/Core/Common.h>
+
+#include <FalconEngine/Core/LinearAllocator.h>
+
+namespace FalconEngine
+{
+
+// @summary Linear allocator that could release allocations in LIFO order by
+// rolling back to a previously obtained marker.
+//
+// @remark Typical usage is to get a marker before a scope of temporary
+// allocations, then free to that marker when the scope ends.
+class FALCON_ENGINE_API StackAllocator final : public LinearAllocator
+{
+public:
+    using Marker = size_t;
+
+public:
+    /************************************************************************/
+    /* Constructors and Destructor                                          */
+    /************************************************************************/
+    explicit StackAllocator(size_t capacity, MemoryTag tag = MemoryTag::General);
+    virtual ~StackAllocator();
+
+public:
+    /************************************************************************/
+    /* Public Members                                                       */
+    /************************************************************************/
+    // @summary Get marker of current stack top.
+    Marker
+    GetMarker() const;
+
+    // @summary Release all the allocations made after the marker is obtained.
+    void
+    FreeToMarker(Marker marker);
+};
+
+}
@@ -20,10 +20,13 @@
 #include <FalconEngine/Graphics/Renderer/Debug/DebugRenderer.h>
 
 #include <FalconEngine/Graphics/Renderer/Entity/Entity.h>
+#include <FalconEngine/Graphics/Renderer/Entity/EntityManager.h>
 #include <FalconEngine/Graphics/Renderer/Entity/EntityRenderer.h>
 
 #include <FalconEngine/Graphics/Renderer/Font/Font.h>
+#include <FalconEngine/Graphics/Renderer/Font/FontAtlas.h>
 #include <FalconEngine/Graphics/Renderer/Font/FontGlyph.h>
+#include <FalconEngine/Graphics/Renderer/Font/FontGlyphMap.h>
 #include <FalconEngine/Graphics/Renderer/Font/FontLine.h>
 #include <FalconEngine/Graphics/Renderer/Font/FontText.h>
 #include <FalconEngine/Graphics/Renderer/Font/FontWord.h>
@@ -52,11 +55,16 @@
 #include <FalconEngine/Graphics/Renderer/Scene/Light.h>
 #include <FalconEngine/Graphics/Renderer/Scene/Material.h>
 #include <FalconEngine/Graphics/Renderer/Scene/Mesh.h>
+#include <FalconEngine/Graphics/Renderer/Scene/MeshSimplifier.h>
 #include <FalconEngine/Graphics/Renderer/Scene/Model.h>
 #include <FalconEngine/Graphics/Renderer/Scene/Node.h>
+#include <FalconEngine/Graphics/Renderer/Scene/SceneQuery.h>
 #include <FalconEngine/Graphics/Renderer/Scene/Spatial.h>
+#include <FalconEngine/Graphics/Renderer/Scene/SpatialPool.h>
 #include <FalconEngine/Graphics/Renderer/Scene/Visual.h>
 
+#include <FalconEngine/Graphics/Renderer/Shadow/ShadowRenderer.h>
+
 #include <FalconEngine/Graphics/Renderer/State/BlendState.h>
 #include <FalconEngine/Graphics/Renderer/State/CullState.h>
 #include <FalconEngine/Graphics/Renderer/State/DepthTestState.h>
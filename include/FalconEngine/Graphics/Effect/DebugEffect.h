@@ -9,7 +9,8 @@
 #include <FalconEngine/Graphics/Renderer/VisualEffect.h>
 #include <FalconEngine/Graphics/Renderer/VisualEffectParams.h>
 #include <FalconEngine/Math/Color.h>
-#include <FalconEngine/Math/Vector2.h>
+#include <FalconEngine/Math/Matrix4.h>
+#include <FalconEngine/Math/Vector3.h>
 #include <FalconEngine/Graphics/Renderer/Shader/ShaderUniform.h>
 
 namespace FalconEngine
@@ -23,7 +24,7 @@ class Node;
 class FALCON_ENGINE_API DebugVertex
 {
 public:
-    Vector2f mPosition;
+    Vector3f mPosition;
     Vector4f mColor;
 
     // This index is used to index into the uniform view projection transform
@@ -32,6 +33,18 @@ public:
 };
 #pragma pack(pop)
 
+// @summary Instancing buffer content unit of the debug shape, which transforms
+// the unit mesh of the shape into world space.
+#pragma pack(push, 1)
+class FALCON_ENGINE_API DebugInstance
+{
+public:
+    Vector4f mColor;
+    int      mCamera;
+    Matrix4f mTransform;
+};
+#pragma pack(pop)
+
 #pragma warning(disable: 4251)
 class FALCON_ENGINE_API DebugEffectParams : public VisualEffectParams
 {
@@ -92,6 +105,38 @@ protected:
         _IN_OUT_ VisualEffectInstance              *instance,
         _IN_     std::shared_ptr<DebugEffectParams> params) const;
 };
+
+// @summary Implements the debug shape effect using hardware instancing, so
+// that all the shapes of the same unit mesh are drawn in one draw call.
+class FALCON_ENGINE_API DebugInstancingEffect : public VisualEffect
+{
+    FALCON_ENGINE_EFFECT_DECLARE(DebugInstancingEffect);
+
+public:
+    /************************************************************************/
+    /* Constructors and Destructor                                          */
+    /************************************************************************/
+    explicit DebugInstancingEffect(bool depthTestEnabled);
+    virtual ~DebugInstancingEffect();
+
+public:
+    /************************************************************************/
+    /* Public Members                                                       */
+    /************************************************************************/
+    std::shared_ptr<VisualEffectInstance>
+    CreateInstance(_IN_OUT_ Visual                                   *visual,
+                   _IN_     const std::shared_ptr<DebugEffectParams>& params);
+
+    virtual std::shared_ptr<VertexFormat>
+    GetVertexFormat() const override;
+
+    /************************************************************************/
+    /* Protected Members                                                    */
+    /************************************************************************/
+protected:
+    virtual std::shared_ptr<VertexFormat>
+    CreateVertexFormat() const override;
+};
 #pragma warning(default: 4251)
 
 }
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <FalconEngine/Graphics/Common.h>
+
+#include <memory>
+
+#include <FalconEngine/Math/Matrix4.h>
+
+namespace FalconEngine
+{
+
+class Camera;
+class Shader;
+class ShaderBuffer;
+template <typename T>
+class ShaderUniformValue;
+
+// @summary Header of the depth pyramid read by fe_DepthPyramid.glsl. The layout
+// follows std430.
+class BatchDepthPyramidHeader
+{
+public:
+    static const int LevelNumMax = 16;
+
+public:
+    Matrix4f     mReprojectTransform;                                           // From captured normalized device coordinate to current clip space.
+    unsigned int mLevelNum;
+    unsigned int mPadding[3];
+    unsigned int mLevel[LevelNumMax][4];                                        // Width, height and offset in the pyramid buffer of each level.
+};
+
+// @summary Hierarchical depth buffer used to reject the batched draws hidden
+// behind the geometry rendered in previous frame. Each texel of a level holds
+// the farthest depth of the texels it covers in the previous level.
+//
+// @remark The depth captured at the end of a frame is reprojected into the
+// current view before the pyramid is built. Each captured pixel is scattered
+// to the pixel it lands on and the nearest depth is kept. Pixels that no
+// captured pixel lands on, like the ones just disoccluded, are kept at the
+// far plane, so that the test is conservative for static occluders. Moving
+// occluders could still hide a draw for one frame.
+#pragma warning(disable: 4251)
+class FALCON_ENGINE_API BatchDepthPyramid final
+{
+public:
+    /************************************************************************/
+    /* Constructors and Destructor                                          */
+    /************************************************************************/
+    BatchDepthPyramid();
+    ~BatchDepthPyramid();
+
+    BatchDepthPyramid(const BatchDepthPyramid&) = delete;
+    BatchDepthPyramid& operator=(const BatchDepthPyramid&) = delete;
+
+public:
+    /************************************************************************/
+    /* Public Members                                                       */
+    /************************************************************************/
+    // @summary Camera which the captured depth is rendered with.
+    const Camera *
+    GetCamera() const;
+
+    const ShaderBuffer *
+    GetHeaderBuffer() const;
+
+    const ShaderBuffer *
+    GetPyramidBuffer() const;
+
+    // @summary Copy the depth of the viewport rendered with the camera.
+    void
+    Capture(const Camera *camera);
+
+    // @summary Reproject the captured depth into the current view of the
+    // camera and build the pyramid, which is done once after each capture.
+    //
+    // @return Whether the pyramid could be used to cull the draws of the
+    // camera.
+    bool
+    Build(const Camera *camera);
+
+    // @summary Discard the captured depth.
+    void
+    Reset();
+
+private:
+    void
+    Resize(int width, int height);
+
+private:
+    std::shared_ptr<Shader>                  mShader;
+    std::shared_ptr<ShaderUniformValue<int>> mPassUniform;
+    std::shared_ptr<ShaderUniformValue<int>> mLevelUniform;
+
+    BatchDepthPyramidHeader                  mHeader;
+    std::shared_ptr<ShaderBuffer>            mHeaderBuffer;
+    std::shared_ptr<ShaderBuffer>            mDepthBuffer;                      // Captured depth in window space.
+    std::shared_ptr<ShaderBuffer>            mPyramidBuffer;
+    int                                      mWidth;
+    int                                      mHeight;
+
+    const Camera                            *mCamera;
+    Matrix4f                                 mCameraViewProjection;             // View projection when the depth is captured.
+    bool                                     mCaptured;
+    bool                                     mBuilt;
+};
+#pragma warning(default: 4251)
+
+}
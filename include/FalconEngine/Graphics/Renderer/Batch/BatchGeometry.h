@@ -0,0 +1,110 @@
+#pragma once
+
+#include <FalconEngine/Graphics/Common.h>
+
+#include <map>
+#include <utility>
+
+namespace FalconEngine
+{
+
+class IndexBuffer;
+enum class IndexType;
+class Primitive;
+class VertexBuffer;
+class VertexFormat;
+class VertexGroup;
+
+// @summary Location of a primitive in the shared geometry buffers, in the
+// layout of indexed indirect draw command.
+class BatchGeometryRange
+{
+public:
+    int  mVertexBase;                                                           // Added to each index before fetching vertex.
+    int  mIndexBegin;
+    int  mIndexNum;
+    bool mAppended;                                                             // Whether primitive is in the shared buffers.
+};
+
+// @summary Shared vertex buffers and index buffer that hold the geometry of
+// all the batched primitives with the same vertex format and index type, so
+// that the primitives could be drawn with one multi-draw call without
+// switching buffers.
+//
+// @remark The primitive geometry is copied on the device when the primitive is
+// first batched, because imported geometry resides on the device only. The
+// geometry is assumed to be static and to outlive the batch geometry, since
+// the range is looked up by the address of vertex group and primitive. Reset
+// the batch geometry when the scene is unloaded.
+#pragma warning(disable: 4251)
+class FALCON_ENGINE_API BatchGeometry final
+{
+public:
+    // @summary Vertex attribute location reserved for the draw index.
+    static const int DrawIndexLocation;
+
+public:
+    /************************************************************************/
+    /* Constructors and Destructor                                          */
+    /************************************************************************/
+    BatchGeometry(const VertexFormat                   *vertexFormat,
+                  IndexType                             indexType,
+                  int                                   vertexNumMax,
+                  int                                   indexNumMax,
+                  const std::shared_ptr<VertexBuffer>&  drawIndexBuffer);
+    ~BatchGeometry();
+
+    BatchGeometry(const BatchGeometry&) = delete;
+    BatchGeometry& operator=(const BatchGeometry&) = delete;
+
+public:
+    /************************************************************************/
+    /* Public Members                                                       */
+    /************************************************************************/
+    // @summary Vertex format with the draw index attribute appended.
+    const VertexFormat *
+    GetVertexFormat() const;
+
+    const VertexGroup *
+    GetVertexGroup() const;
+
+    const IndexBuffer *
+    GetIndexBuffer() const;
+
+    IndexType
+    GetIndexType() const;
+
+    // @summary Find the range of the primitive, appending the primitive
+    // geometry when it is drawn the first time.
+    //
+    // @return Null if the primitive could not be batched.
+    const BatchGeometryRange *
+    FindRange(const VertexGroup *vertexGroup, const Primitive *primitive);
+
+    // @summary Discard all the appended geometry.
+    void
+    Reset();
+
+private:
+    BatchGeometryRange
+    Append(const VertexGroup *vertexGroup, const Primitive *primitive);
+
+private:
+    using BatchGeometryKey = std::pair<const VertexGroup *, const Primitive *>;
+
+    IndexType                                     mIndexType;
+    std::shared_ptr<IndexBuffer>                  mIndexBuffer;
+    int                                           mIndexNum;
+    int                                           mIndexNumMax;
+
+    std::shared_ptr<VertexFormat>                 mVertexFormat;
+    std::shared_ptr<VertexGroup>                  mVertexGroup;
+    int                                           mDrawIndexBindingIndex;       // Binding of the draw index, after all the geometry bindings.
+    int                                           mVertexNum;
+    int                                           mVertexNumMax;
+
+    std::map<BatchGeometryKey, BatchGeometryRange> mRangeTable;
+};
+#pragma warning(default: 4251)
+
+}
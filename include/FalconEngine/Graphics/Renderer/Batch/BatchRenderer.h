@@ -0,0 +1,309 @@
+#pragma once
+
+#include <FalconEngine/Graphics/Common.h>
+
+#include <array>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <FalconEngine/Graphics/Renderer/Scene/Material.h>
+#include <FalconEngine/Math/Matrix4.h>
+#include <FalconEngine/Math/Vector4.h>
+
+namespace FalconEngine
+{
+
+class BatchDepthPyramid;
+class BatchGeometry;
+class BatchGeometryRange;
+class Camera;
+class IndirectBuffer;
+enum class IndexType;
+class Mesh;
+class Shader;
+class ShaderBuffer;
+class VertexBuffer;
+class VertexFormat;
+class Visual;
+class VisualEffectInstance;
+class VisualEffectInstancePass;
+class VisualEffectPass;
+
+// @summary Per draw data read by fe_Draw.glsl. The layout follows std430.
+class BatchDrawData
+{
+public:
+    Matrix4f mModelTransform;
+    Matrix4f mModelNormalTransform;
+    Vector4f mVertexPositionScale;
+    Vector4f mVertexPositionOffset;                                             // W component is one when normal is octahedral encoded.
+    int      mBoundIndex;                                                       // Negative when the draw has no bound.
+    int      mBatchIndex;
+    int      mMaterialIndex;                                                    // Negative when the material is read from the uniforms.
+    int      mPadding[1];
+};
+
+// @summary Material data read by fe_MaterialTexture.glsl. The layout follows
+// std430.
+class BatchMaterialData
+{
+public:
+    Vector4f mAmbient;
+    Vector4f mDiffuse;
+    Vector4f mEmissive;
+    Vector4f mSpecular;                                                         // W component is shininess.
+    uint64_t mAmbientTexture;                                                   // Texture handle.
+    uint64_t mDiffuseTexture;
+    uint64_t mEmissiveTexture;
+    uint64_t mShininessTexture;
+    uint64_t mSpecularTexture;
+    unsigned int mTextureExist;                                                 // Bit of each existing texture handle, see fe_MaterialTexture.glsl.
+    int      mAmbientLayer;                                                     // Layer in the material texture array, negative when not packed.
+    int      mDiffuseLayer;
+    int      mEmissiveLayer;
+    int      mShininessLayer;
+    int      mSpecularLayer;
+};
+
+// @summary Material uploaded into the material buffer. The material is
+// uploaded again when it is changed since the upload.
+class BatchMaterialEntry
+{
+public:
+    Material mMaterial;                                                         // Copy of the material uploaded.
+    int      mMaterialIndex;                                                    // Negative when the material buffer is full.
+};
+
+// @summary Model space bound of a mesh, read by the culling compute shader.
+class BatchDrawBound
+{
+public:
+    Vector4f mCenter;
+    Vector4f mExtent;
+};
+
+// @summary Per batch data read by the culling compute shader. The layout
+// follows std430.
+class BatchCullBatch
+{
+public:
+    Matrix4f     mViewProjection;
+    unsigned int mCommandBegin;
+    unsigned int mOcclusionEnabled;
+    unsigned int mPadding[2];
+};
+
+// @summary Header of the per batch data.
+class BatchCullHeader
+{
+public:
+    unsigned int mDrawNum;
+    unsigned int mPadding[3];
+};
+
+class BatchDrawItem
+{
+public:
+    const Camera             *mCamera;
+    const Visual             *mVisual;
+    int                       mPassIndex;
+    const VisualEffectPass   *mPass;
+    VisualEffectInstancePass *mInstancePass;
+    BatchGeometry            *mGeometry;
+    const BatchGeometryRange *mGeometryRange;
+    int                       mMaterialIndex;                                   // Negative when the material is read from the uniforms.
+};
+
+// @summary The batch renderer collects the draws of visuals that share the
+// same effect pass, geometry buffers and batch key, then submits them with one
+// multi-draw indirect call per batch. Per draw transform is read from shader
+// buffer indexed by the draw index.
+//
+// @remark Only the instance pass which is set up with batch key is batched.
+// The instance pass of the first draw in a batch is used for the entire batch,
+// so that the batch key must cover all the uniforms and textures except the
+// per draw data.
+//
+// @remark When GPU culling is enabled, a compute pass tests the mesh bound of
+// each draw against the frustum of its camera and compacts the commands of
+// the visible draws with an atomic counter per batch. The bounds are uploaded
+// once per mesh, looked up by the id of mesh.
+//
+// @remark When occlusion culling is enabled as well, the depth rendered with
+// the occlusion camera of entity renderer is captured into a depth pyramid,
+// which the draws of the same camera are tested against in next frame. Reset the
+// geometry when the camera is destroyed.
+//
+// @remark The colors of material are read from the material buffer indexed by
+// the draw data, so that the batch key doesn't need to cover the material
+// without texture. Textures are read either through the layer of material
+// texture array, which the batch key covers instead, see MaterialAtlas, or
+// through bindless handle when bindless texture is enabled. The material is
+// looked up by the id of material, and uploaded again when it is changed. The
+// instance is drawn unbatched when the material buffer is full.
+#pragma warning(disable: 4251)
+class FALCON_ENGINE_API BatchRenderer final
+{
+    /************************************************************************/
+    /* Static Members                                                       */
+    /************************************************************************/
+public:
+    static BatchRenderer *
+    GetInstance()
+    {
+        static BatchRenderer sInstance;
+        return &sInstance;
+    }
+
+    /************************************************************************/
+    /* Constructors and Destructor                                          */
+    /************************************************************************/
+private:
+    BatchRenderer();
+
+public:
+    ~BatchRenderer();
+
+public:
+    /************************************************************************/
+    /* Rendering API                                                        */
+    /************************************************************************/
+    // @summary Queue the visual effect instance into the batch.
+    //
+    // @return Whether the instance is queued. Instance which could not be
+    // batched should be drawn by the master renderer.
+    bool
+    Draw(const Camera *camera, const Visual *visual, VisualEffectInstance *visualEffectInstance);
+
+    // @summary Whether the batch is being drawn. Used by the shader uniform
+    // to select per draw data source.
+    bool
+    IsBatchDrawing() const;
+
+    bool
+    IsCullEnabled() const;
+
+    bool
+    IsOcclusionEnabled() const;
+
+    bool
+    IsTextureBindless() const;
+
+    // @summary Whether the material could be read from the material buffer.
+    // Material with texture requires either its textures being packed, or
+    // bindless texture and sampler of each existing texture.
+    bool
+    IsMaterialBuffered(const Material *material) const;
+
+    int
+    GetFrameBatchNum() const;
+
+    int
+    GetFrameDrawNum() const;
+
+    // @summary Number of draws that passed GPU culling, which is read back
+    // asynchronously so that it is from a few frames earlier.
+    //
+    // @return Negative before any result is read back.
+    int
+    GetFrameVisibleNum() const;
+
+    // @summary Number of draws in the frustum rejected by the depth pyramid,
+    // which is read back together with the visible number.
+    //
+    // @return Negative before any result is read back.
+    int
+    GetFrameOccludedNum() const;
+
+    // @summary Discard the geometry appended in the shared buffers.
+    void
+    ResetGeometry();
+
+    /************************************************************************/
+    /* Rendering Engine API                                                 */
+    /************************************************************************/
+    void
+    Initialize();
+
+    void
+    RenderBegin();
+
+    // @summary Submit the queued draws.
+    void
+    Render(double percent);
+
+    // @summary Capture the depth rendered so far, used for occlusion culling
+    // of the draws of the camera in next frame.
+    void
+    CaptureDepth(const Camera *camera);
+
+    void
+    RenderEnd();
+
+private:
+    int
+    FindBound(const Mesh *mesh);
+
+    int
+    FindMaterial(const Material *material);
+
+    BatchGeometry *
+    FindGeometry(const VertexFormat *vertexFormat, IndexType indexType);
+
+    // @summary Draw all the queued draws, grouped into batches.
+    void
+    Flush();
+
+private:
+    using BatchGeometryKey = std::pair<const VertexFormat *, int>;
+    using BatchRange = std::pair<int, int>;
+
+    static const int CullVisibleBufferNum = 3;
+
+    bool                                                      mBatchEnabled;
+    bool                                                      mBatchDrawing;
+    int                                                       mBatchDrawNumMax;
+    int                                                       mBatchVertexNumMax;
+    int                                                       mBatchIndexNumMax;
+
+    std::vector<BatchDrawItem>                                mDrawItemList;
+    std::vector<BatchRange>                                   mBatchList;
+    std::shared_ptr<ShaderBuffer>                             mDrawDataBuffer;
+    std::shared_ptr<VertexBuffer>                             mDrawIndexBuffer;
+    std::shared_ptr<IndirectBuffer>                           mDrawCommandBuffer;
+
+    std::map<BatchGeometryKey, std::unique_ptr<BatchGeometry>> mGeometryTable;
+
+    bool                                                      mCullEnabled;
+    std::shared_ptr<Shader>                                   mCullShader;
+    std::shared_ptr<ShaderBuffer>                             mCullBatchBuffer;
+    std::array<std::shared_ptr<ShaderBuffer>, CullVisibleBufferNum> mCullVisibleBuffer;
+    int                                                       mCullVisibleBufferIndex;
+    int                                                       mCullFrameNum;
+    std::shared_ptr<IndirectBuffer>                           mDrawCommandCulledBuffer;
+    std::shared_ptr<ShaderBuffer>                             mDrawCountBuffer;
+
+    bool                                                      mOcclusionEnabled;
+    std::unique_ptr<BatchDepthPyramid>                        mDepthPyramid;
+
+    std::shared_ptr<ShaderBuffer>                             mDrawBoundBuffer;
+    std::map<uint64_t, int>                                   mDrawBoundTable;   // Bound index by mesh id.
+    int                                                       mDrawBoundNum;
+    bool                                                      mDrawBoundReset;
+
+    bool                                                      mTextureBindless;
+    std::shared_ptr<ShaderBuffer>                             mDrawMaterialBuffer;
+    std::map<uint64_t, BatchMaterialEntry>                    mDrawMaterialTable;
+    int                                                       mDrawMaterialNum;
+    bool                                                      mDrawMaterialReset;
+
+    int                                                       mFrameBatchNum;
+    int                                                       mFrameDrawNum;
+    int                                                       mFrameVisibleNum;
+    int                                                       mFrameOccludedNum;
+};
+#pragma warning(default: 4251)
+
+}
@@ -129,6 +129,19 @@ public:
     virtual void
     Update(double elapsed);
 
+    /************************************************************************/
+    /* Deep and Shallow Copy                                                */
+    /************************************************************************/
+    // @summary Copy the transform and projection into the camera with the
+    // same coordinate and handedness.
+    void
+    CopyTo(Camera *lhs) const;
+
+    // @return The clone of the transform and projection of this camera,
+    // without the state of the derived camera. Grant for no shared ownership.
+    Camera *
+    GetClone() const;
+
 protected:
     /************************************************************************/
     /* Constant Data                                                        */
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <FalconEngine/Graphics/Common.h>
+#include <FalconEngine/Math/Matrix4.h>
 #include <FalconEngine/Math/Vector3.h>
 #include "FalconEngine/Math/Color.h"
 
@@ -18,9 +19,13 @@ enum class DebugRenderType
     OBB,
 
     Circle,
+    Cone,
     Cross,
+    Cylinder,
+    Hemisphere,
     Line,
     Sphere,
+    Triangle,
 
     Text,
 
@@ -43,6 +48,8 @@ public:
         mFloat2(),
         mFloatVector1(),
         mFloatVector2(),
+        mFloatVector3(),
+        mTransform(),
         mString1()
     {
     }
@@ -61,6 +68,11 @@ public:
     float           mFloat2;
     Vector3f        mFloatVector1;
     Vector3f        mFloatVector2;
+    Vector3f        mFloatVector3;
+
+    // NOTE: Transform from the unit shape, computed when the shape is
+    // added, so that the shape is drawn as instance of the unit mesh.
+    Matrix4f        mTransform;
 
     std::string     mString1;
 };
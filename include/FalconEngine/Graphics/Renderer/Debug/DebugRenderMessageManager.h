@@ -2,32 +2,80 @@
 
 #include <FalconEngine/Graphics/Common.h>
 
-#include <list>
+#include <cstdint>
+#include <memory>
 #include <vector>
 
+#include <FalconEngine/Core/Memory.h>
 #include <FalconEngine/Graphics/Renderer/Debug/DebugRenderMessage.h>
 
 namespace FalconEngine
 {
 
+using DebugRenderMessageList = std::vector<DebugRenderMessage, MemoryTagStlAllocator<DebugRenderMessage, MemoryTag::Debug>>;
+
+// @summary Command buffer of the debug messages recorded by one thread.
+class DebugRenderMessageBuffer
+{
+public:
+    DebugRenderMessageList mMessageList;
+};
+
+class DebugRenderMessageBufferPool;
+
+// @summary Collect the debug messages recorded from any thread. Each thread
+// records into its own buffer without locking, and the buffers are merged
+// into the message list once per frame. The buffer of the exited thread is
+// reused by the next thread recording, so that the number of the buffers is
+// bounded by the number of the threads recording at the same time.
+//
+// @remark Merge must be called at the frame boundary, when the threads have
+// finished recording of the frame, like the jobs of the frame have joined.
+// The message recorded by another thread during the merge is a data race.
+#pragma warning(disable: 4251)
 class DebugRenderMessageManager
 {
 public:
     /************************************************************************/
     /* Constructors and Destructor                                          */
     /************************************************************************/
-    DebugRenderMessageManager() = default;
-    ~DebugRenderMessageManager() = default;
+    DebugRenderMessageManager();
+    ~DebugRenderMessageManager();
+
+    DebugRenderMessageManager(const DebugRenderMessageManager&) = delete;
+    DebugRenderMessageManager& operator=(const DebugRenderMessageManager&) = delete;
 
 public:
     /************************************************************************/
     /* Public Members                                                       */
     /************************************************************************/
+    // @summary Record the message into the buffer of the calling thread.
+    //
+    // @remark Only the first message of each thread takes the lock to
+    // acquire the buffer of the thread.
+    void
+    AddMessage(DebugRenderMessage&& message);
+
+    // @summary Move the messages recorded by all the threads since last merge
+    // into the message list.
+    void
+    Merge();
+
+    // @summary Remove the message whose duration has run out.
     void
     UpdateFrame(double elapsed);
 
 public:
-    std::list<DebugRenderMessage> mMessageList;
+    DebugRenderMessageList mMessageList;                                        // Message merged and not timed out yet.
+
+private:
+    DebugRenderMessageBuffer *
+    GetThreadBuffer();
+
+private:
+    uint64_t                                      mManagerId;                   // Identify the manager in the thread-local buffer cache.
+    std::shared_ptr<DebugRenderMessageBufferPool> mBufferPool;                  // Shared with the threads, which return their buffer when they exit.
 };
+#pragma warning(default: 4251)
 
 }
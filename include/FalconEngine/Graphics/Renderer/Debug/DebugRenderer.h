@@ -2,6 +2,9 @@
 
 #include <FalconEngine/Graphics/Common.h>
 
+#include <utility>
+#include <vector>
+
 #include <FalconEngine/Core/Memory.h>
 // NOTE(Wuxiang): Necessary for template parameter checking.
 #include <FalconEngine/Graphics/Renderer/PrimitivePoints.h>
@@ -30,6 +33,7 @@ class Entity;
 class Node;
 
 class Renderer;
+class VisualEffectInstance;
 
 #pragma warning(disable: 4251)
 class FALCON_ENGINE_API DebugRenderer final
@@ -57,6 +61,8 @@ public:
     /************************************************************************/
     /* Rendering API                                                        */
     /************************************************************************/
+    // NOTE: The rendering API could be called from any thread, as long
+    // as the recording of the frame finishes before UpdateFrame is called.
     // @summary Recursively draw AABB for the entity.
     void
     AddAABB(const Camera *camera,
@@ -89,6 +95,18 @@ public:
             float           duration = 0.0f,
             bool            depthEnabled = true);
 
+    // @summary Draw the capsule whose segment goes from one center of the
+    // hemisphere to the other.
+    void
+    AddCapsule(const Camera   *camera,
+               const Vector3f& from,
+               const Vector3f& to,
+               float           radius,
+
+               const Color&    color,
+               float           duration = 0.0f,
+               bool            depthEnabled = true);
+
     void
     AddCircle(const Camera   *camera,
               const Vector3f& center,
@@ -99,6 +117,17 @@ public:
               float           duration = 0.0f,
               bool            depthEnabled = true);
 
+    void
+    AddCone(const Camera   *camera,
+            const Vector3f& apex,
+            const Vector3f& direction,
+            float           length,
+            float           radius,
+
+            const Color&    color,
+            float           duration = 0.0f,
+            bool            depthEnabled = true);
+
     void
     AddCross(const Camera   *camera,
              const Vector3f& center,
@@ -117,13 +146,16 @@ public:
             float           duration = 0.0f,
             bool            depthEnabled = true);
 
-    // NEW(Wuxiang): Add OBB support.
-    // void
-    // AddOBB(const Matrix4f& centerTransform,
-    //        const Vector3f& scale,
-    //        const Color&    color,
-    //        float           duration = 0.0f,
-    //        bool            depthEnabled = true);
+    // @summary Draw the box of half extent in the space of the transform,
+    // centered at the origin of that space.
+    void
+    AddOBB(const Camera   *camera,
+           const Matrix4f& transform,
+           const Vector3f& extent,
+
+           const Color&    color,
+           float           duration = 0.0f,
+           bool            depthEnabled = true);
 
     void
     AddSphere(const Camera   *camera,
@@ -134,6 +166,16 @@ public:
               float           duration = 0.0f,
               bool            depthEnabled = true);
 
+    void
+    AddTriangle(const Camera   *camera,
+                const Vector3f& position1,
+                const Vector3f& position2,
+                const Vector3f& position3,
+
+                const Color&    color,
+                float           duration = 0.0f,
+                bool            depthEnabled = true);
+
     // NEW(Wuxiang): Add 3d text rendering support.
 
     // @summary Render 2d text on screen space.
@@ -161,6 +203,14 @@ public:
     void
     Initialize();
 
+    // @summary Pass the messages recorded since last handoff to the render
+    // side.
+    //
+    // @remark The messages are only filled into the buffer on the render
+    // side, so that recording doesn't touch the graphics resource.
+    void
+    Handoff();
+
     void
     RenderBegin();
 
@@ -202,17 +252,41 @@ private:
 
         auto primitive = make_shared<T>(vertexFormat, vertexGroup, nullptr);
 
-        auto visual = make_shared<Visual>(make_shared<Mesh>(primitive, nullptr));
+        auto visual = CreateSpatial<Visual>(make_shared<Mesh>(primitive, nullptr));
         visualEffect->CreateInstance(visual.get(), mDebugEffectParams);
 
         mDebugBufferResource->CreateChannel(channel, vertexBufferAdaptor, visual);
     }
 
+    // @summary Create the channel drawing the unit mesh of the shape, whose
+    // buffer is the per-instance data rather than the vertex data.
+    void
+    CreateShapeChannel(int                                    channel,
+                       int                                    channelInstanceNum,
+                       DebugShapeType                         shapeType,
+                       std::shared_ptr<DebugInstancingEffect> visualEffect);
+
+    void
+    AddShape(DebugRenderType type,
+             const Camera   *camera,
+             const Matrix4f& transform,
+             const Color&    color,
+             float           duration,
+             bool            depthEnabled);
+
 private:
     std::shared_ptr<BufferResource<BufferResourceChannel>> mDebugBufferResource;
+    std::shared_ptr<BufferResource<BufferResourceChannel>> mDebugShapeBufferResource;
+    std::vector<std::shared_ptr<VisualEffectInstance>>     mDebugShapeEffectInstanceList; // Effect instance of the shape channel, indexed by channel.
     const Font                                            *mDebugFont;
     std::shared_ptr<DebugEffectParams>                     mDebugEffectParams;
     std::shared_ptr<DebugRenderMessageManager>             mDebugMessageManager;
+    std::vector<std::pair<int, DebugRenderMessage>>        mDebugMessageRecordList; // Message with its camera slot recorded on the game side.
+    std::vector<std::pair<int, DebugRenderMessage>>        mDebugMessageRenderList; // Message with its camera slot drawn on the render side.
+    std::vector<int>                                       mDebugChannelElementNumRecord; // Vertex number of each streaming channel counted on the game side.
+    std::vector<int>                                       mDebugChannelElementNumRender;
+    std::vector<int>                                       mDebugShapeElementNumRecord;   // Instance number of each shape channel counted on the game side.
+    std::vector<int>                                       mDebugShapeElementNumRender;
 };
 #pragma warning(default: 4251)
 
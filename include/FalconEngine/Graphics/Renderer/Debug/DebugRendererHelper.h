@@ -3,13 +3,29 @@
 #include <FalconEngine/Graphics/Common.h>
 
 #include <memory>
+#include <vector>
 
 #include <FalconEngine/Graphics/Effect/DebugEffect.h>
 #include <FalconEngine/Graphics/Renderer/Resource/BufferAdaptor.h>
+#include <FalconEngine/Math/Matrix4.h>
 
 namespace FalconEngine
 {
 
+// @summary Unit mesh drawn with instancing. Each shape is a line list around
+// the Z axis, which is transformed into the world space by the instance.
+enum class DebugShapeType
+{
+    Box,                                                                        // [-1, 1] in each axis.
+    Circle,                                                                     // Radius 1 on XY plane.
+    Cone,                                                                       // Apex at origin and base of radius 1 at Z = 1.
+    Cylinder,                                                                   // Radius 1 from Z = 0 to Z = 1.
+    Hemisphere,                                                                 // Radius 1 on the side of Z >= 0.
+    Sphere,                                                                     // Radius 1.
+
+    Count,
+};
+
 class DebugRendererHelper
 {
 public:
@@ -19,27 +35,41 @@ public:
 
 public:
     /************************************************************************/
-    /* Public Members                                                       */
+    /* Shape Members                                                        */
     /************************************************************************/
+    // @summary Create the vertex positions of the unit mesh of the shape.
     static void
-    FillAABB(_IN_OUT_ BufferAdaptor *bufferAdaptor,
-             _IN_OUT_ unsigned char *bufferData,
-
-             _IN_ const Vector3f& min,
-             _IN_ const Vector3f& max,
-             _IN_ const Color&    color,
-             _IN_ int             cameraIndex);
+    CreateShapeMesh(_IN_  DebugShapeType         shapeType,
+                    _OUT_ std::vector<Vector3f>& positionList);
+
+    // @summary Create the transform of the unit mesh, whose Z axis is mapped
+    // to the given axis and scaled by the length, and other two axes are
+    // scaled by the radius.
+    //
+    // @params axis Must be unit vector.
+    static Matrix4f
+    CreateShapeTransform(_IN_ const Vector3f& origin,
+                         _IN_ const Vector3f& axis,
+                         _IN_ float           radius,
+                         _IN_ float           length);
 
     static void
-    FillCircle(_IN_OUT_ BufferAdaptor *bufferAdaptor,
-               _IN_OUT_ unsigned char *bufferData,
+    FillInstance(_IN_OUT_ BufferAdaptor *bufferAdaptor,
+                 _IN_OUT_ unsigned char *bufferData,
 
-               _IN_ const Vector3f& center,
-               _IN_ const Vector3f& normal,
-               _IN_ float           radius,
-               _IN_ const Color&    color,
-               _IN_ int             cameraIndex);
+                 _IN_ const Matrix4f& transform,
+                 _IN_ const Color&    color,
+                 _IN_ int             cameraIndex)
+    {
+        bufferAdaptor->Fill(bufferData, Vector4f(color));
+        bufferAdaptor->Fill(bufferData, cameraIndex);
+        bufferAdaptor->Fill(bufferData, transform);
+    }
 
+public:
+    /************************************************************************/
+    /* Vertex Members                                                       */
+    /************************************************************************/
     static void
     FillCross(_IN_OUT_ BufferAdaptor *bufferAdaptor,
               _IN_OUT_ unsigned char *bufferData,
@@ -75,15 +105,6 @@ public:
         bufferAdaptor->Fill(bufferData, cameraIndex);
     }
 
-    static void
-    FillSphere(_IN_OUT_ BufferAdaptor *bufferAdaptor,
-               _IN_OUT_ unsigned char *bufferData,
-
-               _IN_ const Vector3f& center,
-               _IN_ float           radius,
-               _IN_ const Color&    color,
-               _IN_ int             cameraIndex);
-
     static void
     FillTriangle(_IN_OUT_ BufferAdaptor *bufferAdaptor,
                  _IN_OUT_ unsigned char *bufferData,
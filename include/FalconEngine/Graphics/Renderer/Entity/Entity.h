@@ -4,6 +4,7 @@
 
 #include <FalconEngine/Core/EventHandler.h>
 #include <FalconEngine/Core/Object.h>
+#include <FalconEngine/Graphics/Renderer/Entity/EntityManager.h>
 #include <FalconEngine/Math/Vector3.h>
 
 namespace FalconEngine
@@ -59,8 +60,9 @@ protected:
     UpdateLocalTransformFeedback(bool initiator);
 
 public:
-    // NEW(Wuxiang): Id is not implemented.
-    int         mId;
+    // @summary Id in the entity manager, which the components of the entity
+    // are added to.
+    EntityId    mId;
     std::string mName;
 
 protected:
@@ -0,0 +1,433 @@
+#pragma once
+
+#include <FalconEngine/Graphics/Common.h>
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace FalconEngine
+{
+
+// @summary Stable identifier of the entity. The low bits are the index of the
+// entity record, the high bits are the generation of the record, so that the
+// identifier of the destroyed entity is not alive even when the index is
+// reused.
+using EntityId = uint32_t;
+
+const int ComponentTypeNumMax = 64;
+using ComponentMask = std::bitset<ComponentTypeNumMax>;
+
+// @return The next unused component type id.
+FALCON_ENGINE_API int
+GetComponentTypeIdNext();
+
+// @summary Component type id assigned on the first use of the type.
+template <typename T>
+class ComponentType
+{
+public:
+    static int
+    GetId()
+    {
+        static const int sId = GetComponentTypeIdNext();
+        return sId;
+    }
+};
+
+/************************************************************************/
+/* Component Storage                                                    */
+/************************************************************************/
+// @summary Type erased contiguous array of the components of one type in an
+// archetype. The row of the component is the row of its entity.
+class FALCON_ENGINE_API ComponentArrayBase
+{
+public:
+    virtual ~ComponentArrayBase() = default;
+
+public:
+    // @return Empty array of the same component type.
+    virtual std::unique_ptr<ComponentArrayBase>
+    CreateEmpty() const = 0;
+
+    // @summary Append the component at the row to the array of the same type.
+    // The component left at the row is moved from and should be removed.
+    virtual void
+    MoveTo(size_t row, ComponentArrayBase *componentArray) = 0;
+
+    // @summary Remove the component at the row by moving the last component
+    // into the row.
+    virtual void
+    Remove(size_t row) = 0;
+};
+
+#pragma warning(disable: 4251)
+template <typename T>
+class ComponentArray final : public ComponentArrayBase
+{
+public:
+    virtual std::unique_ptr<ComponentArrayBase>
+    CreateEmpty() const override
+    {
+        return std::make_unique<ComponentArray<T>>();
+    }
+
+    virtual void
+    MoveTo(size_t row, ComponentArrayBase *componentArray) override
+    {
+        static_cast<ComponentArray<T> *>(componentArray)->mComponentList.push_back(std::move(mComponentList[row]));
+    }
+
+    virtual void
+    Remove(size_t row) override
+    {
+        if (row + 1 != mComponentList.size())
+        {
+            mComponentList[row] = std::move(mComponentList.back());
+        }
+
+        mComponentList.pop_back();
+    }
+
+    T *
+    GetData()
+    {
+        return mComponentList.data();
+    }
+
+public:
+    std::vector<T> mComponentList;
+};
+
+// @summary Storage of all the entities which have exactly the same set of
+// component types. Each component type is stored in its own array, so that
+// the query iterates the components linearly.
+class FALCON_ENGINE_API EntityArchetype
+{
+public:
+    /************************************************************************/
+    /* Constructors and Destructor                                          */
+    /************************************************************************/
+    explicit EntityArchetype(const ComponentMask& componentMask);
+
+public:
+    /************************************************************************/
+    /* Public Members                                                       */
+    /************************************************************************/
+    // @return Component array of the type, or null when the archetype doesn't
+    // have the type.
+    template <typename T>
+    ComponentArray<T> *
+    GetComponentArray()
+    {
+        auto componentArrayIndex = mComponentArrayIndexTable[ComponentType<T>::GetId()];
+        return componentArrayIndex >= 0
+               ? static_cast<ComponentArray<T> *>(mComponentArrayList[componentArrayIndex].get())
+               : nullptr;
+    }
+
+    size_t
+    GetEntityNum() const;
+
+public:
+    ComponentMask                                    mComponentMask;
+    std::vector<EntityId>                            mEntityList;                   // Entity of each row.
+    std::vector<std::unique_ptr<ComponentArrayBase>> mComponentArrayList;
+    std::vector<int>                                 mComponentTypeList;            // Component type of each component array.
+    std::array<int, ComponentTypeNumMax>             mComponentArrayIndexTable;     // Component array index by component type, -1 when not in the archetype.
+
+    // NOTE: Cache the archetype transition, so that adding or
+    // removing the component doesn't look up the archetype by the mask again.
+    std::array<EntityArchetype *, ComponentTypeNumMax> mArchetypeAddedTable;
+    std::array<EntityArchetype *, ComponentTypeNumMax> mArchetypeRemovedTable;
+};
+
+/************************************************************************/
+/* Entity Query                                                         */
+/************************************************************************/
+// @summary Cached list of the archetypes having all the component types of
+// the query. The list is updated when an archetype is created, so that the
+// iteration doesn't test the entities which don't match.
+class FALCON_ENGINE_API EntityQuery
+{
+public:
+    /************************************************************************/
+    /* Constructors and Destructor                                          */
+    /************************************************************************/
+    explicit EntityQuery(const ComponentMask& componentMask);
+
+public:
+    /************************************************************************/
+    /* Public Members                                                       */
+    /************************************************************************/
+    // @summary Visit each matching entity with visit(EntityId, T&...).
+    //
+    // @remark The component types should be part of the query. Creating or
+    // destroying entity, or adding or removing component during iteration is
+    // not allowed, because the archetype storage could be moved.
+    template <typename ... T, typename F>
+    void
+    ForEach(F visit)
+    {
+        for (auto archetype : mArchetypeList)
+        {
+            auto entityNum = archetype->GetEntityNum();
+            if (entityNum == 0)
+            {
+                continue;
+            }
+
+            ForEachRow(visit, entityNum, archetype->mEntityList.data(), archetype->GetComponentArray<T>()->GetData()...);
+        }
+    }
+
+    size_t
+    GetEntityNum() const;
+
+    bool
+    IsMatched(const EntityArchetype *archetype) const;
+
+private:
+    template <typename F, typename ... P>
+    static void
+    ForEachRow(F& visit, size_t entityNum, const EntityId *entityData, P * ... componentData)
+    {
+        for (size_t row = 0; row < entityNum; ++row)
+        {
+            visit(entityData[row], componentData[row]...);
+        }
+    }
+
+public:
+    ComponentMask                  mComponentMask;
+    std::vector<EntityArchetype *> mArchetypeList;                              // Archetype having all the component types.
+};
+
+/************************************************************************/
+/* Entity Manager                                                       */
+/************************************************************************/
+// @summary Entity storage grouping the components by the archetype of their
+// entity. Looking up the component of an entity is constant time through the
+// entity record, iterating the components of a query is linear over the
+// matching archetypes.
+class FALCON_ENGINE_API EntityManager final
+{
+public:
+    /************************************************************************/
+    /* Static Members                                                       */
+    /************************************************************************/
+    static const int      EntityIndexBitNum = 24;
+    static const uint32_t EntityIndexMask = (1u << EntityIndexBitNum) - 1;
+    static const EntityId EntityIdNull = 0xFFFFFFFFu;
+
+    static EntityManager *
+    GetInstance()
+    {
+        static EntityManager sInstance;
+        return &sInstance;
+    }
+
+    static uint32_t
+    GetEntityIndex(EntityId entity)
+    {
+        return entity & EntityIndexMask;
+    }
+
+    static uint32_t
+    GetEntityGeneration(EntityId entity)
+    {
+        return entity >> EntityIndexBitNum;
+    }
+
+public:
+    /************************************************************************/
+    /* Constructors and Destructor                                          */
+    /************************************************************************/
+    EntityManager();
+    ~EntityManager();
+
+    EntityManager(const EntityManager&) = delete;
+    EntityManager& operator=(const EntityManager&) = delete;
+
+public:
+    /************************************************************************/
+    /* Entity Management                                                    */
+    /************************************************************************/
+    EntityId
+    CreateEntity();
+
+    void
+    DestroyEntity(EntityId entity);
+
+    bool
+    IsAlive(EntityId entity) const;
+
+    size_t
+    GetEntityNum() const;
+
+    size_t
+    GetArchetypeNum() const;
+
+    /************************************************************************/
+    /* Component Management                                                 */
+    /************************************************************************/
+    // @summary Add the component to the entity, which moves the entity into
+    // the archetype having the component. The existing component of the same
+    // type is replaced.
+    //
+    // @return The component, which is valid until next structural change.
+    template <typename T, typename ... Args>
+    T&
+    AddComponent(EntityId entity, Args&& ... args)
+    {
+        CheckEntity(entity);
+
+        auto componentType = ComponentType<T>::GetId();
+        auto& entityRecord = mEntityRecordList[GetEntityIndex(entity)];
+        auto archetype = entityRecord.mArchetype;
+        if (archetype->mComponentMask.test(componentType))
+        {
+            auto& component = archetype->template GetComponentArray<T>()->mComponentList[entityRecord.mRow];
+            component = T(std::forward<Args>(args)...);
+            return component;
+        }
+
+        if (mComponentArrayPrototypeList[componentType] == nullptr)
+        {
+            mComponentArrayPrototypeList[componentType] = std::make_unique<ComponentArray<T>>();
+        }
+
+        auto archetypeAdded = archetype->mArchetypeAddedTable[componentType];
+        if (archetypeAdded == nullptr)
+        {
+            auto componentMask = archetype->mComponentMask;
+            componentMask.set(componentType);
+            archetypeAdded = GetArchetype(componentMask);
+            archetype->mArchetypeAddedTable[componentType] = archetypeAdded;
+        }
+
+        MoveEntity(entity, archetypeAdded);
+
+        auto& componentList = archetypeAdded->template GetComponentArray<T>()->mComponentList;
+        componentList.emplace_back(std::forward<Args>(args)...);
+        return componentList.back();
+    }
+
+    template <typename T>
+    void
+    RemoveComponent(EntityId entity)
+    {
+        CheckEntity(entity);
+
+        auto componentType = ComponentType<T>::GetId();
+        auto archetype = mEntityRecordList[GetEntityIndex(entity)].mArchetype;
+        if (!archetype->mComponentMask.test(componentType))
+        {
+            return;
+        }
+
+        auto archetypeRemoved = archetype->mArchetypeRemovedTable[componentType];
+        if (archetypeRemoved == nullptr)
+        {
+            auto componentMask = archetype->mComponentMask;
+            componentMask.reset(componentType);
+            archetypeRemoved = GetArchetype(componentMask);
+            archetype->mArchetypeRemovedTable[componentType] = archetypeRemoved;
+        }
+
+        MoveEntity(entity, archetypeRemoved);
+    }
+
+    // @return The component of the entity, or null when the entity doesn't
+    // have the component.
+    template <typename T>
+    T *
+    GetComponent(EntityId entity)
+    {
+        CheckEntity(entity);
+
+        auto& entityRecord = mEntityRecordList[GetEntityIndex(entity)];
+        auto componentArray = entityRecord.mArchetype->template GetComponentArray<T>();
+        return componentArray ? &componentArray->mComponentList[entityRecord.mRow] : nullptr;
+    }
+
+    template <typename T>
+    bool
+    HasComponent(EntityId entity) const
+    {
+        CheckEntity(entity);
+
+        return mEntityRecordList[GetEntityIndex(entity)].mArchetype->mComponentMask.test(ComponentType<T>::GetId());
+    }
+
+    /************************************************************************/
+    /* Entity Query                                                         */
+    /************************************************************************/
+    // @return The cached query of the entities having all the component
+    // types. The query is kept updated until the entity manager is destroyed.
+    template <typename ... T>
+    EntityQuery *
+    GetQuery()
+    {
+        ComponentMask componentMask;
+        int componentTypeList[] = { 0, (componentMask.set(ComponentType<T>::GetId()), 0)... };
+        (void) componentTypeList;
+
+        return GetQuery(componentMask);
+    }
+
+    // @summary Visit each entity having all the component types with
+    // visit(EntityId, T&...).
+    template <typename ... T, typename F>
+    void
+    ForEach(F visit)
+    {
+        GetQuery<T...>()->template ForEach<T...>(visit);
+    }
+
+private:
+    void
+    CheckEntity(EntityId entity) const;
+
+    EntityArchetype *
+    GetArchetype(const ComponentMask& componentMask);
+
+    EntityQuery *
+    GetQuery(const ComponentMask& componentMask);
+
+    // @summary Move the entity and the components it keeps into the archetype.
+    // The component not in the archetype is destroyed.
+    void
+    MoveEntity(EntityId entity, EntityArchetype *archetype);
+
+    // @summary Remove the row of the archetype by moving the last row into it.
+    void
+    RemoveRow(EntityArchetype *archetype, size_t row);
+
+private:
+    class EntityRecord
+    {
+    public:
+        EntityArchetype *mArchetype = nullptr;                                  // Null when the entity is destroyed.
+        size_t           mRow = 0;
+        uint32_t         mGeneration = 0;
+    };
+
+    std::vector<EntityRecord>                                              mEntityRecordList;
+    std::vector<uint32_t>                                                  mEntityIndexFreeList;
+    size_t                                                                 mEntityNum;
+
+    std::vector<std::unique_ptr<EntityArchetype>>                          mArchetypeList;
+    std::unordered_map<ComponentMask, EntityArchetype *>                   mArchetypeTable;
+    EntityArchetype                                                       *mArchetypeEmpty;           // Archetype of the entity without component.
+
+    std::array<std::unique_ptr<ComponentArrayBase>, ComponentTypeNumMax>   mComponentArrayPrototypeList; // Used to create the component array of the new archetype.
+    std::unordered_map<ComponentMask, std::unique_ptr<EntityQuery>>        mQueryTable;
+};
+#pragma warning(default: 4251)
+
+}
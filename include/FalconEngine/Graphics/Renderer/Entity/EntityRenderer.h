@@ -4,9 +4,12 @@
 
 #include <vector>
 #include <map>
+#include <memory>
 #include <queue>
+#include <utility>
 
 #include <FalconEngine/Math/Color.h>
+#include <FalconEngine/Graphics/Renderer/Scene/SpatialPool.h>
 
 namespace FalconEngine
 {
@@ -18,6 +21,31 @@ class Primitive;
 class Renderer;
 class Visual;
 
+// @summary Visuals seen from the camera, collected when the frame is handed
+// off to the render side.
+class EntityRenderList
+{
+public:
+    std::shared_ptr<Camera>                    mCamera;                         // Copy of the drawing camera taken at the handoff.
+    std::vector<std::shared_ptr<const Visual>> mVisualList;                     // Shared until the next handoff.
+    std::vector<int>                           mVisualLodList;                  // Level of detail selected for each visual.
+};
+
+// @summary The entity renderer draws the visuals of entities per camera,
+// queueing them into the batch renderer when possible.
+//
+// @remark The level of detail of each visual is selected per camera at the
+// handoff, as the coarsest level whose error projected onto the screen is
+// within the pixel limit. The visual moves to a coarser level only when the
+// error is clearly below the limit, and back to a finer level only when the
+// error is clearly above, so that it doesn't flicker around the switch point.
+//
+// @remark The entities drawn are only recorded until the handoff, which
+// interpolates their visuals, flattens the scene graph into the render list
+// and copies the camera, so that the render side never reads the scene graph
+// or the camera the update is changing. The render list shares the visuals,
+// so that detaching or destroying them in the update is safe. The level of
+// detail selected is applied to the visual right before it is drawn.
 #pragma warning(disable: 4251)
 class FALCON_ENGINE_API EntityRenderer final
 {
@@ -48,12 +76,35 @@ public:
     void
     Draw(const Camera *camera, const Entity *entity);
 
+    // @summary Number of triangles of the visuals drawn in last rendered
+    // frame, counted once per visual and camera.
+    int
+    GetFrameTriangleNum() const;
+
+    // @summary Number of triangles not drawn in last rendered frame because
+    // the coarser level of detail is selected.
+    int
+    GetFrameTriangleSavedNum() const;
+
+    const Camera *
+    GetOcclusionCamera() const;
+
+    // @summary Set the camera whose depth occludes its batched draws in next
+    // frame, when occlusion culling is enabled.
+    void
+    SetOcclusionCamera(const Camera *camera);
+
     /************************************************************************/
     /* Rendering Engine API                                                 */
     /************************************************************************/
     void
     Initialize();
 
+    // @summary Hand the entities drawn off to the render side. Called when
+    // the render side is idle.
+    void
+    Handoff(double percent);
+
     void
     RenderBegin();
 
@@ -64,8 +115,30 @@ public:
     RenderEnd();
 
 private:
-    std::map<const Camera *, std::vector<const Entity *>> mEntityListTable;
+    // @summary Select the level of detail of the visual seen from the camera.
+    int
+    SelectLod(const Camera *camera, const Visual *visual);
 
+private:
+    // NOTE: The visual is keyed by its handle, so that the visual
+    // created at the address of a destroyed one doesn't inherit its level.
+    using LodKey = std::pair<const Camera *, SpatialHandle>;
+
+    std::map<const Camera *, std::vector<const Entity *>> mEntityListTable;       // Entities drawn since last handoff.
+    std::map<const Camera *, EntityRenderList>            mRenderListTable;       // Render list of each drawing camera.
+    std::vector<const Node *>                             mNodeStack;             // Traversal stack kept across the frames.
+    const Camera                                         *mOcclusionCamera;
+
+    bool                                                  mLodEnabled;
+    float                                                 mLodErrorPixel;
+    float                                                 mLodHysteresis;
+    std::map<LodKey, int>                                 mLodTable;        // Level selected in last frame.
+    std::map<LodKey, int>                                 mLodTableCurrent; // Level selected in current frame.
+
+    int                                                   mFrameTriangleNum;
+    int                                                   mFrameTriangleSavedNum;
+    int                                                   mFrameTriangleNumRendered;      // Triangle number of last rendered frame.
+    int                                                   mFrameTriangleSavedNumRendered;
 };
 #pragma warning(default: 4251)
 
@@ -8,6 +8,7 @@
 #include <vector>
 
 #include <cereal/access.hpp>
+#include <cereal/cereal.hpp>
 #include <cereal/types/base_class.hpp>
 // https://github.com/USCiLab/cereal/issues/286
 #include <cereal/types/memory.hpp>
@@ -15,7 +16,10 @@
 #include <cereal/types/vector.hpp>
 
 #include <FalconEngine/Content/Asset.h>
+#include <FalconEngine/Core/Memory.h>
+#include <FalconEngine/Graphics/Renderer/Font/FontAtlas.h>
 #include <FalconEngine/Graphics/Renderer/Font/FontGlyph.h>
+#include <FalconEngine/Graphics/Renderer/Font/FontGlyphMap.h>
 
 namespace FalconEngine
 {
@@ -54,13 +58,65 @@ public:
     const Texture2dArray *
     GetTexture() const;
 
+    // @summary Set the texture array whose pages not set yet are loaded from
+    // the directory when they are first used.
+    void
+    SetTexture(std::shared_ptr<Texture2dArray> texture, const std::string& textureDirectoryPath);
+
+    // @summary Set the atlas the glyphs are rasterized into at runtime, which
+    // replaces the baked glyphs and texture pages.
+    void
+    SetAtlas(std::shared_ptr<FontAtlas> atlas);
+
+    // @return The atlas of the font loaded from TrueType or OpenType font, or
+    // null for the baked font.
+    FontAtlas *
+    GetAtlas() const;
+
+    bool
+    IsTexturePageLoaded(int page) const;
+
+    // @summary Load the page texture into the texture array and upload it if
+    // the texture array is already on the device.
+    //
+    // @remark Only call on the render thread.
+    void
+    LoadTexturePage(int page) const;
+
+    /************************************************************************/
+    /* Glyph Management                                                     */
+    /************************************************************************/
+
+    // @summary Rebuild the glyph map from the glyph table, which is required
+    // after the glyph table is loaded.
+    void
+    BuildGlyphMap();
+
+    // @return The glyph of the codepoint, or the none glyph when the font
+    // doesn't have the codepoint.
+    //
+    // @remark The glyph of the font with atlas is rasterized when it is first
+    // used, so only call on the render thread for that font.
+    const FontGlyph&
+    GetGlyph(uint32_t codepoint) const
+    {
+        if (mAtlas)
+        {
+            return mAtlas->GetGlyph(codepoint);
+        }
+
+        return mGlyphTable[mGlyphMap.Find(codepoint)];
+    }
+
 public:
     /************************************************************************/
     /* Font Runtime Data -- Glyph (1/2)                                     */
     /************************************************************************/
 
-    // NOTE(Wuxiang): Not serialized members include: mSizeScale, mTexture. mTexture,
-    // which is texture array, is composited during loading using multiple textures.
+    // NOTE(Wuxiang): Not serialized members include: mSizeScale, mGlyphMap,
+    // mAtlas, mTexture. mGlyphMap is rebuilt from the glyph table during loading.
+    // mTexture, which is texture array, is composited during loading using
+    // multiple textures.
 
     double                        mSizePt = 0;                                 // Font size in point.
     double                        mSizePx = 0;                                 // Font size in pixel.
@@ -71,8 +127,9 @@ public:
     double                        mLineHeight = 0;                             // Font line height (em height) in pixel.
 
     size_t                        mGlyphCount = 0;                             // Font glyph number the font contains
-    std::vector<size_t>           mGlyphIndexTable;                            // Font glyph index table that map glyph Codepoint into glyph's index in glyph table.
-    std::vector<FontGlyph>        mGlyphTable;
+    FontGlyphMap                  mGlyphMap;                                   // Font glyph map that map glyph Codepoint into glyph's index in glyph table.
+    std::vector<FontGlyph, MemoryTagStlAllocator<FontGlyph, MemoryTag::Font>>
+                                  mGlyphTable;
 
     /************************************************************************/
     /* Font Metadata                                                        */
@@ -95,7 +152,10 @@ private:
     // textures would not be destroyed because Texture2DArray class use shared_ptr
     // to manage Texture2D.
 
+    std::shared_ptr<FontAtlas>      mAtlas;                                    // Font runtime glyph atlas.
     std::shared_ptr<Texture2dArray> mTexture;                                  // Font texture.
+    std::string                     mTextureDirectoryPath;                     // Font texture directory the pages not loaded yet are loaded from.
+    mutable std::vector<bool>       mTexturePageLoadedList;                    // Font texture page loaded flag, index is the page id
     std::shared_ptr<Sampler>        mSampler;                                  // Font texture sampler.
 
     /************************************************************************/
@@ -104,8 +164,15 @@ private:
 public:
     friend class cereal::access;
     template<class Archive>
-    void serialize(Archive& ar)
+    void serialize(Archive& ar, std::uint32_t const version)
     {
+        // NOTE: The font baked before the version was added has no version
+        // stored, so that its asset type is read as the version instead.
+        if (version != 1)
+        {
+            FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("Font asset format is out of date, re-bake the font.");
+        }
+
         ar & cereal::base_class<Asset>(this);
 
         ar & mSizePt;
@@ -115,7 +182,6 @@ public:
         ar & mLineHeight;
 
         ar & mGlyphCount;
-        ar & mGlyphIndexTable;
         ar & mGlyphTable;
 
         ar & mTextureWidth;
@@ -130,3 +196,5 @@ public:
 
 }
 
+CEREAL_CLASS_VERSION(FalconEngine::Font, 1);
+
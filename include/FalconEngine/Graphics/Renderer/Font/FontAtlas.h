@@ -0,0 +1,166 @@
+#pragma once
+
+#include <FalconEngine/Graphics/Common.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <FalconEngine/Core/MemoryTracker.h>
+#include <FalconEngine/Graphics/Renderer/Font/FontGlyph.h>
+#include <FalconEngine/Graphics/Renderer/Font/FontGlyphMap.h>
+
+struct stbtt_fontinfo;
+
+namespace FalconEngine
+{
+
+class Texture2d;
+class Texture2dArray;
+
+// @summary Row of the glyphs with the same height class in the atlas page.
+class FontAtlasShelf
+{
+public:
+    int mY;
+    int mHeight;
+    int mWidthUsed;
+};
+
+// @summary Texture page of the atlas, which is one slice of the atlas texture
+// array. The page texture is only allocated when the page is opened.
+#pragma warning(disable: 4251)
+class FontAtlasPage
+{
+public:
+    std::shared_ptr<Texture2d>  mTexture;
+    std::vector<FontAtlasShelf> mShelfList;
+    int                         mShelfHeightUsed = 0;
+
+    std::vector<uint32_t>       mCodepointList;                                 // Codepoint of the glyphs packed in the page.
+    uint64_t                    mFrameUsed = 0;                                 // Last frame the glyph in the page is laid out.
+    bool                        mDirty = false;                                 // The page has glyph not uploaded yet.
+};
+#pragma warning(default: 4251)
+
+// @summary Glyph atlas of the TrueType or OpenType font, whose glyph is
+// rasterized into signed distance field on demand, when the text using the
+// glyph is first laid out. The glyphs are packed into shelves of the atlas
+// pages. The atlas grows by opening the next page, and evicts the least
+// recently used page when every page is full.
+//
+// @remark The atlas is only used on the render thread, because the glyph is
+// rasterized in laying out the text.
+#pragma warning(disable: 4251)
+class FALCON_ENGINE_API FontAtlas final
+{
+public:
+    /************************************************************************/
+    /* Static Members                                                       */
+    /************************************************************************/
+    static const int GlyphSize;
+    static const int GlyphPadding;
+    static const int GlyphSpacing;
+
+    static const int PageSize;
+    static const int PageNumMax;
+
+    static const uint32_t GlyphIndexNone;
+    static const uint32_t GlyphIndexMissing;
+
+public:
+    /************************************************************************/
+    /* Constructors and Destructor                                          */
+    /************************************************************************/
+    explicit FontAtlas(std::vector<unsigned char>&& fontFileData);
+    ~FontAtlas();
+
+    FontAtlas(const FontAtlas&) = delete;
+    FontAtlas& operator=(const FontAtlas&) = delete;
+
+public:
+    /************************************************************************/
+    /* Public Members                                                       */
+    /************************************************************************/
+    double
+    GetLineBase() const;
+
+    double
+    GetLineHeight() const;
+
+    int
+    GetPageNum() const;
+
+    const std::shared_ptr<Texture2dArray>&
+    GetTexture() const;
+
+    // @return The glyph of the codepoint, which is rasterized when it is not
+    // in the atlas yet. The none glyph is returned when the glyph could not be
+    // packed because every page is used in this frame.
+    const FontGlyph&
+    GetGlyph(uint32_t codepoint)
+    {
+        auto glyphIndex = mGlyphMap.Find(codepoint);
+        if (glyphIndex == GlyphIndexNone)
+        {
+            return LoadGlyph(codepoint);
+        }
+
+        auto& glyph = mGlyphTable[glyphIndex];
+        if (glyph.mWidth > 0)
+        {
+            mPageList[glyph.mPage].mFrameUsed = mFrame;
+        }
+
+        return glyph;
+    }
+
+    // @summary Start the new frame, so that the pages used by the last frame
+    // could be evicted.
+    void
+    BeginFrame();
+
+    // @summary Upload the pages with the glyphs rasterized since last upload.
+    void
+    Upload();
+
+private:
+    bool
+    AllocateRegion(int width, int height, int& page, int& x, int& y);
+
+    bool
+    AllocateRegionInPage(int page, int width, int height, int& x, int& y);
+
+    void
+    EvictPage(int page);
+
+    const FontGlyph&
+    LoadGlyph(uint32_t codepoint);
+
+    void
+    OpenPage(int page);
+
+    uint32_t
+    PushGlyph(const FontGlyph& glyph);
+
+private:
+    std::vector<unsigned char>      mFontFileData;
+    std::unique_ptr<stbtt_fontinfo> mFontInfo;
+    float                           mFontScale;                                 // Scale from the font unit into the pixel.
+
+    double                          mLineBase;
+    double                          mLineHeight;
+
+    std::vector<FontGlyph, MemoryTagStlAllocator<FontGlyph, MemoryTag::Font>>
+                                    mGlyphTable;
+    std::vector<uint32_t>           mGlyphSlotFreeList;                         // Glyph table index released by the eviction.
+    FontGlyphMap                    mGlyphMap;
+
+    uint64_t                        mFrame;
+    int                             mPageNum;                                   // Number of the pages opened.
+    std::vector<FontAtlasPage>      mPageList;
+    std::shared_ptr<Texture2dArray> mTexture;
+};
+#pragma warning(default: 4251)
+
+}
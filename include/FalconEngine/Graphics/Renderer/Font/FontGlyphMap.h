@@ -0,0 +1,74 @@
+#pragma once
+
+#include <FalconEngine/Graphics/Common.h>
+
+#include <cstdint>
+#include <vector>
+
+#include <FalconEngine/Core/MemoryTracker.h>
+
+namespace FalconEngine
+{
+
+// @summary Map the codepoint into the glyph index in the glyph table of the
+// font, covering the whole Unicode range. The codepoint is split into the
+// block number in its high bits and the offset in the block in its low bits.
+// The block table maps each block number into the block storing the glyph
+// index, and the blocks without any glyph share the empty block, so that
+// only the blocks the font uses take memory.
+#pragma warning(disable: 4251)
+class FALCON_ENGINE_API FontGlyphMap
+{
+public:
+    static const uint32_t CodepointMax = 0x10FFFF;
+
+    static const int      BlockBit = 8;
+    static const uint32_t BlockSize = 1u << BlockBit;
+    static const uint32_t BlockNum = (CodepointMax >> BlockBit) + 1;
+
+public:
+    /************************************************************************/
+    /* Constructors and Destructor                                          */
+    /************************************************************************/
+    FontGlyphMap();
+    ~FontGlyphMap() = default;
+
+public:
+    /************************************************************************/
+    /* Public Members                                                       */
+    /************************************************************************/
+    void
+    Clear();
+
+    // @return The glyph index of the codepoint, or zero when the font doesn't
+    // have the glyph, which refers to the none character loaded first.
+    uint32_t
+    Find(uint32_t codepoint) const
+    {
+        if (codepoint > CodepointMax)
+        {
+            return 0;
+        }
+
+        auto blockIndex = uint32_t(mBlockTable[codepoint >> BlockBit]);
+        return mBlockData[(blockIndex << BlockBit) | (codepoint & (BlockSize - 1))];
+    }
+
+    void
+    Insert(uint32_t codepoint, uint32_t glyphIndex);
+
+    // @return Number of the blocks including the empty block.
+    size_t
+    GetBlockNum() const;
+
+    // @return Byte size of the table storage.
+    size_t
+    GetMemorySize() const;
+
+private:
+    std::vector<uint16_t, MemoryTagStlAllocator<uint16_t, MemoryTag::Font>> mBlockTable; // Block index of each block number, where zero refers to the empty block.
+    std::vector<uint32_t, MemoryTagStlAllocator<uint32_t, MemoryTag::Font>> mBlockData;  // Glyph index of each codepoint in each block.
+};
+#pragma warning(default: 4251)
+
+}
@@ -10,7 +10,7 @@ namespace FalconEngine
 class FontGlyph;
 
 #pragma warning(disable: 4251)
-class FontLine
+class FALCON_ENGINE_API FontLine
 {
 public:
     explicit FontLine(double lineWidth);
@@ -5,6 +5,7 @@
 #include <limits>
 #include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <FalconEngine/Graphics/Renderer/Font/FontResourceChannel.h>
@@ -77,6 +78,13 @@ public:
     void
     Initialize();
 
+    // @summary Pass the text added since last handoff to the render side.
+    //
+    // @remark The text is only laid out and filled into the buffer on the
+    // render side, so that adding text doesn't touch the graphics resource.
+    void
+    Handoff();
+
     void
     RenderBegin();
 
@@ -88,13 +96,7 @@ public:
 
 private:
     void
-    BatchText(const Font *font,
-              float       fontSize,
-
-              const std::wstring& textString,
-              const Vector2f&     textPosition,
-              Color               textColor = ColorPalette::White,
-              float               textLineWidth = std::numeric_limits<float>().max());
+    BatchText(const Font *font, FontRenderItem&& textItem);
 
     const std::shared_ptr<FontResourceChannel>&
     FindChannel(const Font *font);
@@ -110,6 +112,8 @@ private:
     // support.
     std::shared_ptr<BufferResource<FontResourceChannel>> mTextBufferResource;
 
+    std::vector<std::pair<const Font *, FontRenderItem>> mTextRecordList;         // Text added on the game side.
+    std::vector<std::pair<const Font *, FontRenderItem>> mTextRenderList;         // Text drawn on the render side.
 };
 #pragma warning(default: 4251)
 
@@ -45,7 +45,9 @@ public:
         int textLineNum = int(sTextLineStrings.size());
         for (int textLineIndex = 0; textLineIndex < textLineNum; ++textLineIndex)
         {
-            for (const wchar_t& c : sTextLineStrings[textLineIndex])
+            auto& textLineString = sTextLineStrings[textLineIndex];
+            auto  textLineStringSize = textLineString.size();
+            for (size_t characterIndex = 0; characterIndex < textLineStringSize; ++characterIndex)
             {
                 // NOTE(Wuxiang): When processing English, a word is defined as space
                 // separated letters. But this concept would not work
@@ -56,9 +58,29 @@ public:
                 // higher level code to preprocess this kind of information. This function
                 // only deals new line characters.
 
-                Uint32 glyphCodepoint = c;
-                auto   glyphIndex = font->mGlyphIndexTable.at(glyphCodepoint);
-                auto&  glyph = font->mGlyphTable.at(glyphIndex);
+                auto glyphCodepoint = uint32_t(textLineString[characterIndex]);
+
+                // NOTE: The wide string is UTF-16 when wchar_t is 16-bit,
+                // where the codepoint outside the Basic Multilingual Plane is
+                // encoded as the surrogate pair.
+                if (sizeof(wchar_t) == 2
+                        && glyphCodepoint >= 0xD800 && glyphCodepoint <= 0xDBFF
+                        && characterIndex + 1 < textLineStringSize)
+                {
+                    auto glyphCodepointLow = uint32_t(textLineString[characterIndex + 1]);
+                    if (glyphCodepointLow >= 0xDC00 && glyphCodepointLow <= 0xDFFF)
+                    {
+                        glyphCodepoint = 0x10000 + ((glyphCodepoint - 0xD800) << 10) + (glyphCodepointLow - 0xDC00);
+                        ++characterIndex;
+                    }
+                }
+
+                auto& glyph = font->GetGlyph(glyphCodepoint);
+                if (!font->IsTexturePageLoaded(glyph.mPage))
+                {
+                    font->LoadTexturePage(glyph.mPage);
+                }
+
                 ++glyphCount;
 
                 double fontSizeScale = text.mFontSize / font->mSizePt;
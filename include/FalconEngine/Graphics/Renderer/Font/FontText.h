@@ -31,7 +31,7 @@ namespace FalconEngine
 // @note The structure of this class should be able to support different
 // font type.
 #pragma warning(disable: 4251)
-class FontText
+class FALCON_ENGINE_API FontText
 {
 public:
     FontText(float fontSize,
@@ -17,6 +17,9 @@ public:
 public:
     std::unique_ptr<PlatformRendererState> mState;
     GLFWwindow                            *mWindow;
+
+    // Framebuffer used for rendering into texture, created when first used.
+    GLuint                                 mFramebufferObj;
 };
 #pragma warning(default: 4251)
 
@@ -37,6 +37,11 @@ public:
     void
     Flush(int64_t offset, int64_t size);
 
+    // @summary Copy buffer data into destination buffer without the round
+    // trip through the host memory.
+    void
+    Copy(PlatformBuffer *destinationBuffer, int64_t sourceOffset, int64_t destinationOffset, int64_t size);
+
 protected:
     /************************************************************************/
     /* Protected Members                                                    */
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <FalconEngine/Graphics/Renderer/Platform/OpenGL/OGLMapping.h>
+#include <FalconEngine/Graphics/Renderer/Platform/OpenGL/OGLBuffer.h>
+#include <FalconEngine/Graphics/Renderer/Resource/IndirectBuffer.h>
+
+namespace FalconEngine
+{
+
+class FALCON_ENGINE_API PlatformIndirectBuffer : public PlatformBuffer
+{
+public:
+    /************************************************************************/
+    /* Constructors and Destructor                                          */
+    /************************************************************************/
+    explicit PlatformIndirectBuffer(const IndirectBuffer *indirectBuffer);
+    ~PlatformIndirectBuffer();
+
+public:
+    /************************************************************************/
+    /* Public Members                                                       */
+    /************************************************************************/
+    void
+    Enable();
+
+    // @summary Enable buffer on the indexed binding point of shader storage
+    // buffer.
+    void
+    Enable(unsigned int bindingIndex);
+
+    void
+    Disable();
+};
+
+}
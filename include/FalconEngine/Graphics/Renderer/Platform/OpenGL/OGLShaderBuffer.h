@@ -23,6 +23,22 @@ public:
     void
     Enable();
 
+    // @summary Enable buffer on the indexed binding point, which is referred
+    // by the binding layout qualifier of shader storage block.
+    void
+    Enable(unsigned int bindingIndex);
+
+    // @summary Enable buffer as the source of indirect draw parameters.
+    void
+    EnableParameter();
+
+    // @summary Enable buffer as the destination of pixel read.
+    void
+    EnablePack();
+
+    void
+    DisablePack();
+
     void
     Disable();
 };
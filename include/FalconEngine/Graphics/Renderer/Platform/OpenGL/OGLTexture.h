@@ -2,9 +2,13 @@
 
 #include <FalconEngine/Graphics/Renderer/Platform/OpenGL/OGLMapping.h>
 
+#include <map>
+
 namespace FalconEngine
 {
 
+class PlatformSampler;
+
 #pragma warning(disable: 4251)
 class FALCON_ENGINE_API PlatformTexture
 {
@@ -35,18 +39,25 @@ public:
     void
     Unmap();
 
+    // @summary Get the bindless handle of the texture sampled with the
+    // sampler, which is made resident when it is first requested and stays
+    // resident until the texture is destroyed.
+    GLuint64
+    GetHandle(const PlatformSampler *sampler);
+
 protected:
-    GLuint         mBufferObj;
+    GLuint                     mBufferObj;
+    std::map<GLuint, GLuint64> mHandleTable;                                    // Handle indexed by sampler object.
 
-    GLuint         mTextureObj;
-    GLuint         mTextureObjPrevious;
-    const Texture *mTexturePtr;
+    GLuint                     mTextureObj;
+    GLuint                     mTextureObjPrevious;
+    const Texture             *mTexturePtr;
 
-    GLuint         mDimension[3];
-    GLuint         mFormat;
-    GLuint         mFormatInternal;
-    GLuint         mType;
-    GLuint         mUsage;
+    GLuint                     mDimension[3];
+    GLuint                     mFormat;
+    GLuint                     mFormatInternal;
+    GLuint                     mType;
+    GLuint                     mUsage;
 };
 #pragma warning(default: 4251)
 
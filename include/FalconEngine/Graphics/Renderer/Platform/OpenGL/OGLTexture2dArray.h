@@ -19,6 +19,11 @@ public:
     /************************************************************************/
     explicit PlatformTexture2dArray(const Texture2dArray *textures);
     ~PlatformTexture2dArray();
+
+public:
+    // @summary Upload the slice set after the texture array was created.
+    void
+    UpdateSlice(int textureIndex);
 };
 #pragma warning(default: 4251)
 
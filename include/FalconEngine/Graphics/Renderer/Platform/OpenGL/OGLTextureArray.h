@@ -21,6 +21,9 @@ public:
     /************************************************************************/
     /* Public Members                                                       */
     /************************************************************************/
+    GLuint
+    GetTextureObj() const;
+
     void
     Enable(int textureUnit);
 
@@ -25,6 +25,9 @@ public:
     void
     Disable(int textureUnit);
 
+    GLuint
+    GetSamplerObj() const;
+
 private:
     GLuint mSampler;
     GLuint mSamplerPrevious;
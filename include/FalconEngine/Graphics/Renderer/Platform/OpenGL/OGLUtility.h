@@ -5,6 +5,13 @@
 namespace FalconEngine
 {
 
+// @summary Whether the objects could be edited without binding them, which is
+// core in OpenGL 4.5 or provided by ARB_direct_state_access.
+//
+// @remark Only valid after the extensions are loaded.
+bool
+IsDirectStateAccessSupported();
+
 // @return previous bound texture
 GLuint
 BindTexture(TextureType textureType, GLuint texture);
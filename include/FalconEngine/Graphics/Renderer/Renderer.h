@@ -6,6 +6,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include <FalconEngine/Core/Memory.h>
 #include <FalconEngine/Graphics/Renderer/Viewport.h>
 #include <FalconEngine/Graphics/Renderer/Window.h>
 
@@ -25,6 +26,7 @@ class Camera;
 class Font;
 class FontText;
 class Primitive;
+enum class PrimitiveType;
 class Shader;
 class ShaderUniform;
 class Visual;
@@ -40,6 +42,8 @@ enum class BufferAccessMode;
 enum class BufferFlushMode;
 enum class BufferSynchronizationMode;
 class IndexBuffer;
+enum class IndexType;
+class IndirectBuffer;
 class ShaderBuffer;
 class VertexBuffer;
 class VertexFormat;
@@ -67,8 +71,10 @@ class WireframeState;
 /************************************************************************/
 /* Platform Renderer Resource                                           */
 /************************************************************************/
+class PlatformBuffer;
 class PlatformShaderBuffer;
 class PlatformIndexBuffer;
+class PlatformIndirectBuffer;
 class PlatformVertexBuffer;
 class PlatformVertexFormat;
 class PlatformTexture1d;
@@ -126,6 +132,17 @@ private:
     DestroyData();
 
 public:
+    /************************************************************************/
+    /* Context Management                                                   */
+    /************************************************************************/
+    // @summary Make the rendering context current on the calling thread, or
+    // release it from the calling thread.
+    //
+    // @remark The context is only current on one thread at a time, so that it
+    // has to be released before made current on another thread.
+    void
+    SetContextCurrent(bool current);
+
     /************************************************************************/
     /* Framebuffer Management                                               */
     /************************************************************************/
@@ -141,6 +158,20 @@ public:
     void
     ClearFrameBuffer(const Vector4f& color, float depth, unsigned int stencil);
 
+    // @summary Copy the depth of the viewport into the buffer as float per
+    // pixel in rows from the bottom, without the round trip through the host
+    // memory.
+    void
+    CopyDepthBuffer(const ShaderBuffer *buffer);
+
+    // @summary Render the depth into the layer of depth texture array instead
+    // of the default framebuffer, without color output.
+    //
+    // @param depthTextureArray - depth texture array, null to render into the
+    // default framebuffer again.
+    void
+    SetRenderTarget(const Texture2dArray *depthTextureArray, int layer);
+
     /************************************************************************/
     /* Viewport Management                                                  */
     /************************************************************************/
@@ -206,6 +237,15 @@ public:
            BufferFlushMode           flush,
            BufferSynchronizationMode synchronization);
 
+    // @summary Copy data between buffers on the device. Both offsets are in
+    // bytes relative to the start of the device buffer.
+    void
+    Copy(const Buffer *sourceBuffer,
+         int64_t       sourceOffset,
+         const Buffer *destinationBuffer,
+         int64_t       destinationOffset,
+         int64_t       size);
+
     /************************************************************************/
     /* Shader Buffer Management                                             */
     /************************************************************************/
@@ -218,6 +258,11 @@ public:
     void
     Enable(const ShaderBuffer *shaderBuffer);
 
+    // @summary Enable shader buffer on the binding point of shader storage
+    // block.
+    void
+    Enable(const ShaderBuffer *shaderBuffer, unsigned int bindingIndex);
+
     void
     Disable(const ShaderBuffer *shaderBuffer);
 
@@ -268,6 +313,42 @@ public:
           int64_t            offset,
           int64_t            size);
 
+    /************************************************************************/
+    /* Indirect Buffer Management                                           */
+    /************************************************************************/
+    void
+    Bind(const IndirectBuffer *indirectBuffer);
+
+    void
+    Unbind(const IndirectBuffer *indirectBuffer);
+
+    void
+    Enable(const IndirectBuffer *indirectBuffer);
+
+    // @summary Enable indirect buffer on the binding point of shader storage
+    // buffer, so that the commands could be written by compute shader.
+    void
+    Enable(const IndirectBuffer *indirectBuffer, unsigned int bindingIndex);
+
+    void
+    Disable(const IndirectBuffer *indirectBuffer);
+
+    void *
+    Map(const IndirectBuffer     *indirectBuffer,
+        BufferAccessMode          access,
+        BufferFlushMode           flush,
+        BufferSynchronizationMode synchronization,
+        int64_t                   offset,
+        int64_t                   size);
+
+    void
+    Unmap(const IndirectBuffer *indirectBuffer);
+
+    void
+    Flush(const IndirectBuffer *indirectBuffer,
+          int64_t               offset,
+          int64_t               size);
+
     /************************************************************************/
     /* Vertex Buffer Management                                             */
     /************************************************************************/
@@ -432,6 +513,11 @@ public:
           int                   textureIndex,
           int                   mipmapLevel);
 
+    // @summary Upload the slice set after the texture array was bound.
+    void
+    Update(const Texture2dArray *textureArray,
+           int                   textureIndex);
+
     /************************************************************************/
     /* Texture 3D Management                                                */
     /************************************************************************/
@@ -462,6 +548,21 @@ public:
     void
     Disable(int textureUnit, const Sampler *sampler);
 
+    /************************************************************************/
+    /* Texture Handle Management                                            */
+    /************************************************************************/
+    // @summary Whether texture could be sampled through its handle without
+    // being bound to a texture unit.
+    bool
+    IsTextureHandleSupported() const;
+
+    // @summary Get the handle of the texture sampled with the sampler, which
+    // stays resident until the texture is unbound.
+    //
+    // @return Zero when texture handle is not supported.
+    uint64_t
+    GetTextureHandle(const Texture *texture, const Sampler *sampler);
+
     /************************************************************************/
     /* Shader Management                                                   */
     /************************************************************************/
@@ -477,6 +578,11 @@ public:
     void
     Disable(const Shader *shader);
 
+    // @summary Dispatch the compute shader. The memory written by the shader
+    // is visible to the following draw, copy and buffer map.
+    void
+    Dispatch(Shader *shader, int groupNumX, int groupNumY, int groupNumZ);
+
     /************************************************************************/
     /* Pass Management                                                      */
     /************************************************************************/
@@ -490,6 +596,10 @@ public:
     void
     Update(const VisualEffectInstancePass *pass, ShaderUniform *uniform, const Camera *camera, const Visual *visual);
 
+    // @summary Update uniform of the enabled shader.
+    void
+    Update(const Shader *shader, ShaderUniform *uniform, const Camera *camera, const Visual *visual);
+
     /************************************************************************/
     /* Draw                                                                 */
     /************************************************************************/
@@ -501,6 +611,41 @@ public:
     void
     Draw(const Camera *camera, const Visual *visual, VisualEffectInstance *visualEffectInstance);
 
+    // @summary Draw indexed primitives described by consecutive commands in
+    // the indirect buffer with one call. The vertex format, vertex group,
+    // index buffer and pass should be enabled beforehand.
+    //
+    // @param commandBegin - index of the first command.
+    // @param commandNum - number of commands to draw.
+    void
+    DrawIndirect(const IndirectBuffer *indirectBuffer,
+                 int                   commandBegin,
+                 int                   commandNum,
+                 PrimitiveType         primitiveType,
+                 IndexType             indexType);
+
+    // @summary Draw indexed primitives with the command number read from
+    // the count buffer, which is at most the given maximum command number.
+    //
+    // @remark When the command number could not be read from buffer on the
+    // platform, all the commands up to the maximum are drawn, so that the
+    // unused commands should have zero instance number.
+    //
+    // @param countOffset - byte offset of the unsigned command number in the
+    // count buffer, which should be multiple of four.
+    void
+    DrawIndirect(const IndirectBuffer *indirectBuffer,
+                 int                   commandBegin,
+                 int                   commandNumMax,
+                 const ShaderBuffer   *countBuffer,
+                 int64_t               countOffset,
+                 PrimitiveType         primitiveType,
+                 IndexType             indexType);
+
+private:
+    PlatformBuffer *
+    GetPlatformBuffer(const Buffer *buffer);
+
 private:
     /************************************************************************/
     /* Platform Resource Table                                              */
@@ -509,6 +654,7 @@ private:
     // number is relatively small to a point that the performance gain is not
     // significant.
     std::map<const IndexBuffer *, PlatformIndexBuffer *>       mIndexBufferTable;
+    std::map<const IndirectBuffer *, PlatformIndirectBuffer *> mIndirectBufferTable;
     std::map<const ShaderBuffer *, PlatformShaderBuffer *>     mShaderBufferTable;
     std::map<const VertexBuffer *, PlatformVertexBuffer *>     mVertexBufferTable;
     std::map<const VertexFormat *, PlatformVertexFormat *>     mVertexFormatTable;
@@ -523,6 +669,7 @@ private:
     /* Dirty Flags                                                          */
     /************************************************************************/
     const IndexBuffer             *mIndexBufferPrevious;
+    const IndirectBuffer          *mIndirectBufferPrevious;
     const ShaderBuffer            *mShaderBufferPrevious;
     const VertexGroup             *mVertexGroupPrevious;
     const VertexFormat            *mVertexFormatPrevious;
@@ -621,15 +768,56 @@ public:
     void
     ClearFrameBufferPlatform(const Vector4f& color, float depth, unsigned int stencil);
 
+    void
+    CopyDepthBufferPlatform(PlatformShaderBuffer *buffer, int x, int y, int width, int height);
+
+    void
+    SetRenderTargetPlatform(PlatformTexture2dArray *depthTextureArray, int layer);
+
     void
     SwapFrameBufferPlatform();
 
+    /************************************************************************/
+    /* Context Management                                                   */
+    /************************************************************************/
+    void
+    SetContextCurrentPlatform(bool current);
+
     /************************************************************************/
     /* Draw                                                                 */
     /************************************************************************/
     void
     DrawPrimitivePlatform(const Primitive *primitive, int instancingNum);
 
+    void
+    DrawPrimitiveIndirectPlatform(PrimitiveType primitiveType,
+                                  IndexType     indexType,
+                                  int           commandBegin,
+                                  int           commandNum);
+
+    void
+    DrawPrimitiveIndirectCountPlatform(PrimitiveType         primitiveType,
+                                       IndexType             indexType,
+                                       int                   commandBegin,
+                                       int                   commandNumMax,
+                                       PlatformShaderBuffer *countBuffer,
+                                       int64_t               countOffset);
+
+    /************************************************************************/
+    /* Compute                                                              */
+    /************************************************************************/
+    void
+    DispatchPlatform(int groupNumX, int groupNumY, int groupNumZ);
+
+    /************************************************************************/
+    /* Texture Handle                                                       */
+    /************************************************************************/
+    bool
+    IsTextureHandleSupportedPlatform() const;
+
+    uint64_t
+    GetTextureHandlePlatform(const Texture *texture, const PlatformSampler *sampler);
+
 private:
     std::unique_ptr<PlatformRendererData, PlatformRendererDataDeleter> mData;
     bool                                                               mDataInitialized = false;
@@ -657,7 +845,7 @@ FALCON_ENGINE_CHECK_NULLPTR(resource); \
 \
 if (resourceTable.find(resource) == resourceTable.end()) \
 { \
-    resourceTable[resource] = new PlatformResourceKlass(resource); \
+    resourceTable[resource] = New(FalconEngine::MemoryTag::Renderer) PlatformResourceKlass(resource); \
 }
 
 #define FALCON_ENGINE_RENDERER_UNBIND_IMPLEMENT(resource, resourceTable) \
@@ -667,7 +855,7 @@ auto iter = resourceTable.find(resource); \
 if (iter != resourceTable.end()) \
 { \
     auto resource##Platform = iter->second; \
-    delete resource##Platform; \
+    Delete(FalconEngine::MemoryTag::Renderer, resource##Platform); \
     resourceTable.erase(iter); \
 }
 
@@ -698,7 +886,7 @@ if (iter != resourceTable.end()) \
 } \
 else \
 { \
-    resource##Platform = new PlatformResourceKlass(resource); \
+    resource##Platform = New(FalconEngine::MemoryTag::Renderer) PlatformResourceKlass(resource); \
     resourceTable[resource] = resource##Platform; \
 } \
 \
@@ -725,7 +913,7 @@ if (iter != resourceTable.end()) \
 } \
 else \
 { \
-    resource##Platform = new PlatformResourceKlass(resource); \
+    resource##Platform = New(FalconEngine::MemoryTag::Renderer) PlatformResourceKlass(resource); \
     resourceTable[resource] = resource##Platform; \
 } \
 \
@@ -783,7 +971,7 @@ if (iter != textureTable.end()) \
 } \
 else \
 { \
-    texture##Platform = new PlatformTextureKlass(texture); \
+    texture##Platform = New(FalconEngine::MemoryTag::Renderer) PlatformTextureKlass(texture); \
     textureTable[texture] = texture##Platform; \
 } \
 \
@@ -810,7 +998,7 @@ if (iter != textureTable.end()) \
 } \
 else \
 { \
-    texturePlatform = new PlatformTextureKlass(texture); \
+    texturePlatform = New(FalconEngine::MemoryTag::Renderer) PlatformTextureKlass(texture); \
     textureTable[texture] = texturePlatform; \
 } \
 \
@@ -837,7 +1025,7 @@ if (iter != textureArrayTable.end()) \
 } \
 else \
 { \
-    texturePlatform = new PlatformTextureArrayKlass(textureArray); \
+    texturePlatform = New(FalconEngine::MemoryTag::Renderer) PlatformTextureArrayKlass(textureArray); \
     textureArrayTable[textureArray] = texturePlatform; \
 } \
 \
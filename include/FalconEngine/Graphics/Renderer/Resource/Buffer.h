@@ -2,6 +2,8 @@
 
 #include <FalconEngine/Graphics/Common.h>
 
+#include <FalconEngine/Core/Memory.h>
+
 namespace FalconEngine
 {
 
@@ -53,6 +55,7 @@ enum class FALCON_ENGINE_API BufferType
     IndexBuffer,
     ShaderBuffer,
     UniformBuffer,
+    IndirectBuffer,
 };
 
 enum class FALCON_ENGINE_API BufferLayout
@@ -137,6 +140,7 @@ public:
 
 private:
     unsigned char    *mData;
+    MemoryTag         mDataMemoryTag;       // Memory tag of host data, taken from memory tag scope at construction.
     size_t            mDataSize;            // Actual data size in bytes.
     int64_t           mDataOffset;
 
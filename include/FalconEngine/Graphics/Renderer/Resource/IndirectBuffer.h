@@ -0,0 +1,34 @@
+#pragma once
+
+#include <FalconEngine/Graphics/Common.h>
+
+#include <FalconEngine/Graphics/Renderer/Resource/Buffer.h>
+
+namespace FalconEngine
+{
+
+// @summary Command layout consumed by indexed indirect draw. The layout is
+// defined by the graphics API so that the member order must not be changed.
+class DrawElementsIndirectCommand
+{
+public:
+    unsigned int mIndexNum;
+    unsigned int mInstanceNum;
+    unsigned int mIndexBegin;                                                   // First index in the index buffer.
+    int          mVertexBase;                                                   // Added to each index before fetching vertex.
+    unsigned int mInstanceBase;                                                 // Added to instance index of instanced vertex attribute.
+};
+
+// @summary Buffer of draw commands that are sourced by the GPU instead of
+// being passed through the draw call arguments.
+class FALCON_ENGINE_API IndirectBuffer : public Buffer
+{
+public:
+    /************************************************************************/
+    /* Constructors and Destructor                                          */
+    /************************************************************************/
+    IndirectBuffer(int commandNum, BufferStorageMode storageMode, BufferUsage usage);
+    virtual ~IndirectBuffer();
+};
+
+}
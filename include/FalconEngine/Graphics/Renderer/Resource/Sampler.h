@@ -57,6 +57,10 @@ public:
     SamplerWrapMode            mWrapS;
     SamplerWrapMode            mWrapT;
     SamplerWrapMode            mWrapR;
+
+    // Compare the reference with the depth texture instead of returning the
+    // depth, as the shadow sampler. The border is treated as the farthest depth.
+    bool                       mCompareEnabled;
 };
 
 }
@@ -11,6 +11,7 @@
 #include <cereal/types/memory.hpp>
 
 #include <FalconEngine/Content/Asset.h>
+#include <FalconEngine/Core/Memory.h>
 #include <FalconEngine/Graphics/Common.h>
 #include <FalconEngine/Graphics/Renderer/Resource/Buffer.h>
 
@@ -26,6 +27,8 @@ enum class FALCON_ENGINE_API TextureUnit
     Specular  = 4,
 
     Font      = 5,
+    Material  = 6,
+    Shadow    = 7,
 
     Count,
 };
@@ -67,6 +70,8 @@ enum class FALCON_ENGINE_API TextureFormat
 
     R8G8B8A8,
 
+    D32F,                                                                       // Depth only, used as render target.
+
     Count
 };
 
@@ -75,6 +80,8 @@ const size_t TexelSize[int(TextureFormat::Count)] =
     0, // None
 
     4, // R8G8B8A8
+
+    4, // D32F
 };
 
 // @summary Thin layer describing what the most basic texture consists of. A texture
@@ -118,6 +125,7 @@ public:
 
     // Texture buffer specific data.
     unsigned char     *mData;
+    MemoryTag          mDataMemoryTag;
     size_t             mDataSize;
 
     // Texture buffer storage mode, currently only in Host mode.
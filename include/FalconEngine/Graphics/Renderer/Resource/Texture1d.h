@@ -44,14 +44,15 @@ public:
     template<class Archive>
     void load(Archive & ar)
     {
-        delete[] mData;
+        Delete(mDataMemoryTag, mData);
 
         ar & cereal::base_class<Texture>(this);
 
         // NOTE(Wuxiang): mDataByteNum is serialized in TextureBuffer. It may
         // be changed by serialization result so that it needs a new memory
         // location.
-        mData = new unsigned char[mDataSize];
+        mDataMemoryTag = MemoryTagScope::GetCurrent();
+        mData = New(mDataMemoryTag) unsigned char[mDataSize];
 
         ar & cereal::binary_data(mData, mDataSize);
     }
@@ -34,12 +34,21 @@ public:
     virtual ~Texture2dArray();
 
 public:
+    // @return The texture slice, or null when the slice has not been set.
     virtual const Texture2d *
     GetTextureSlice(int index) const override;
 
+    virtual int
+    GetTextureSliceNum() const override;
+
     void
     PushTextureSlice(std::shared_ptr<Texture2d> texture);
 
+    // @summary Set the slice at the index. The other slices not set stay null
+    // until they are set, so that the slices could be loaded later.
+    void
+    SetTextureSlice(int index, std::shared_ptr<Texture2d> texture);
+
 protected:
     // NOTE(Wuxiang): The Texture2D should not be released before owner of them
     // being released.
@@ -27,6 +27,11 @@ public:
 public:
     virtual const Texture *
     GetTextureSlice(int textureIndex) const = 0;
+
+    // @summary Number of slices with data. Texture array without slice only
+    // has storage allocated, e.g. for rendering into.
+    virtual int
+    GetTextureSliceNum() const = 0;
 };
 #pragma warning(default: 4251)
 
@@ -23,6 +23,15 @@ enum class FALCON_ENGINE_API VertexAttributeType
     IntVec3,
     IntVec4,
 
+    // NOTE: 16-bit types are mainly used for compressed vertex data.
+    // Short types are normalized to [-1, 1] (snorm16) when the attribute is
+    // marked as normalized.
+    HalfVec2,
+    HalfVec4,
+
+    ShortVec2,
+    ShortVec4,
+
     Count,
 };
 
@@ -37,8 +46,14 @@ const int VertexAttributeChannels[int(VertexAttributeType::Count)] =
 
     1,  // Int
     2,  // IntVec2
-    3,  // IntVec2
-    4   // IntVec4
+    3,  // IntVec3
+    4,  // IntVec4
+
+    2,  // HalfVec2
+    4,  // HalfVec4
+
+    2,  // ShortVec2
+    4   // ShortVec4
 };
 
 // @summary Attribute sizeof operation result in byte.
@@ -53,8 +68,14 @@ const int VertexAttributeSize[int(VertexAttributeType::Count)] =
 
     4,  // Int
     8,  // IntVec2
-    12, // IntVec2
-    16  // IntVec4
+    12, // IntVec3
+    16, // IntVec4
+
+    4,  // HalfVec2
+    8,  // HalfVec4
+
+    4,  // ShortVec2
+    8   // ShortVec4
 };
 
 #pragma warning(disable: 4251)
@@ -9,6 +9,7 @@ namespace FalconEngine
 {
 
 class Texture2d;
+class Texture2dArray;
 class Sampler;
 
 class FALCON_ENGINE_API Material : public Object
@@ -20,8 +21,22 @@ public:
     /* Constructors and Destructor                                          */
     /************************************************************************/
     Material();
+    Material(const Material& rhs);
+    Material& operator=(const Material& rhs);
     virtual ~Material() = default;
 
+public:
+    /************************************************************************/
+    /* Public Members                                                       */
+    /************************************************************************/
+    // @return The id unique to the material, which is not reused after the
+    // material is destroyed and not copied to the other material.
+    uint64_t
+    GetId() const;
+
+private:
+    uint64_t         mId;
+
 public:
     Color            mAmbientColor = ColorPalette::Transparent;
     Color            mDiffuseColor = ColorPalette::Transparent;
@@ -40,6 +55,16 @@ public:
     const Sampler   *mEmissiveSampler = nullptr;
     const Sampler   *mSpecularSampler = nullptr;
     const Sampler   *mShininessSampler = nullptr;
+
+    // NOTE: Set when the textures are packed by material atlas. Each
+    // existing texture is also a layer of the texture array.
+    const Texture2dArray *mTextureArray = nullptr;
+    const Sampler        *mTextureArraySampler = nullptr;
+    int                   mAmbientTextureLayer = -1;
+    int                   mDiffuseTextureLayer = -1;
+    int                   mEmissiveTextureLayer = -1;
+    int                   mSpecularTextureLayer = -1;
+    int                   mShininessTextureLayer = -1;
 };
 
 }
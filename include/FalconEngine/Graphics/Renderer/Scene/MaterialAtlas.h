@@ -0,0 +1,59 @@
+#pragma once
+
+#include <FalconEngine/Graphics/Common.h>
+
+#include <memory>
+#include <vector>
+
+namespace FalconEngine
+{
+
+class Material;
+class Texture2dArray;
+
+// @summary Packs the textures of materials into texture arrays, so that the
+// visuals with different materials could be drawn in one batch with the
+// texture array bound, selecting the layer of each material per draw.
+//
+// @remark Textures are grouped by size, format and sampler. A material is
+// packed only when all its textures fall in one group and are managed by the
+// asset manager. The packed texture is kept in both the texture array and the
+// material, so that the visual drawn without batch is not affected. The atlas
+// should outlive the packed materials.
+#pragma warning(disable: 4251)
+class FALCON_ENGINE_API MaterialAtlas final
+{
+public:
+    /************************************************************************/
+    /* Constructors and Destructor                                          */
+    /************************************************************************/
+    explicit MaterialAtlas(int layerNumMax = 256);
+    ~MaterialAtlas();
+
+    MaterialAtlas(const MaterialAtlas&) = delete;
+    MaterialAtlas& operator=(const MaterialAtlas&) = delete;
+
+public:
+    /************************************************************************/
+    /* Public Members                                                       */
+    /************************************************************************/
+    int
+    GetTextureArrayNum() const;
+
+    const Texture2dArray *
+    GetTextureArray(int textureArrayIndex) const;
+
+    // @summary Pack the textures of the materials which are not packed yet.
+    // Should be called before the materials are drawn.
+    //
+    // @return Number of materials packed.
+    int
+    Pack(const std::vector<Material *>& materialList);
+
+private:
+    int                                          mLayerNumMax;
+    std::vector<std::shared_ptr<Texture2dArray>> mTextureArrayList;
+};
+#pragma warning(default: 4251)
+
+}
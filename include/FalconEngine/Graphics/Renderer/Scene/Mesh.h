@@ -2,6 +2,8 @@
 
 #include <FalconEngine/Graphics/Common.h>
 
+#include <vector>
+
 #include <FalconEngine/Graphics/Renderer/Primitive.h>
 
 namespace FalconEngine
@@ -17,7 +19,19 @@ class VertexBuffer;
 class VertexFormat;
 class VertexGroup;
 
+// @summary Coarser level of detail of mesh.
+class MeshLod
+{
+public:
+    std::shared_ptr<Primitive> mPrimitive;
+    float                      mError;                                          // Largest distance from the original surface, relative to the radius of mesh bound.
+};
+
 // @summary Represents bundle of geometry and all the metadata used in rendering.
+//
+// @remark The mesh could contain a chain of coarser primitives as its level of
+// detail, which share the vertex group and bound with the original primitive,
+// see MeshSimplifier. The level of detail is selected by EntityRenderer.
 #pragma warning(disable: 4251)
 class FALCON_ENGINE_API Mesh : public Object
 {
@@ -30,6 +44,9 @@ public:
     explicit Mesh(std::shared_ptr<Primitive> primitive, std::shared_ptr<Material> material);
     virtual ~Mesh();
 
+    Mesh(const Mesh&) = delete;
+    Mesh& operator=(const Mesh&) = delete;
+
 protected:
     Mesh();
 
@@ -40,6 +57,11 @@ public:
     const AABB *
     GetAABB() const;
 
+    // @return The id unique to the mesh, which is not reused after the mesh is
+    // destroyed, unlike the address of the mesh.
+    uint64_t
+    GetId() const;
+
     const Material *
     GetMaterial() const;
 
@@ -55,6 +77,25 @@ public:
     std::shared_ptr<Primitive>
     GetPrimitive();
 
+    /************************************************************************/
+    /* Level of Detail Management                                           */
+    /************************************************************************/
+    // @return Level number including the original primitive.
+    int
+    GetLodNum() const;
+
+    // @return The error of the level, which is zero for the original primitive.
+    float
+    GetLodError(int lodIndex) const;
+
+    const Primitive *
+    GetLodPrimitive(int lodIndex) const;
+
+    // @summary Append a coarser level, whose error should not be less than the
+    // last level.
+    void
+    PushLod(std::shared_ptr<Primitive> primitive, float error);
+
     /************************************************************************/
     /* Deep and Shallow Copy                                                */
     /************************************************************************/
@@ -65,8 +106,10 @@ public:
     GetClone() const;
 
 protected:
+    uint64_t                   mId;                                             // Not copied to the clone.
     std::shared_ptr<Material>  mMaterial;
     std::shared_ptr<Primitive> mPrimitive;
+    std::vector<MeshLod>       mLodList;
 };
 #pragma warning(default: 4251)
 
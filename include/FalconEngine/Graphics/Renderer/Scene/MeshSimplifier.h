@@ -0,0 +1,46 @@
+#pragma once
+
+#include <FalconEngine/Graphics/Common.h>
+
+#include <vector>
+
+#include <FalconEngine/Math/Vector3.h>
+
+namespace FalconEngine
+{
+
+// @summary Simplifies triangle list by collapsing edges in the order of the
+// quadric error, used to generate the level of detail chain of mesh.
+//
+// @remark Each edge is collapsed into one of its existing vertices, so that the
+// simplified index list shares the vertex buffer with the original one. The
+// vertices on the open border, which includes the seam where the vertices are
+// split by different normal or texture coordinate, are never collapsed away,
+// so that the silhouette and the attributes are kept.
+//
+// @ref Garland and Heckbert, Surface Simplification Using Quadric Error
+// Metrics, 1997.
+#pragma warning(disable: 4251)
+class FALCON_ENGINE_API MeshSimplifier final
+{
+public:
+    /************************************************************************/
+    /* Public Members                                                       */
+    /************************************************************************/
+    // @summary Simplify the triangle list until the index number reaches the
+    // target or the next collapse exceeds the error limit.
+    //
+    // @param errorMax Largest distance each vertex could move from the
+    // surface, relative to the radius of the mesh bound.
+    // @return The largest error of applied collapses, relative to the radius of
+    // the mesh bound.
+    static float
+    Simplify(_OUT_ std::vector<unsigned int>&    indexListSimplified,
+             _IN_  const std::vector<Vector3f>&     positionList,
+             _IN_  const std::vector<unsigned int>& indexList,
+             _IN_  int                              indexNumTarget,
+             _IN_  float                            errorMax);
+};
+#pragma warning(default: 4251)
+
+}
@@ -11,6 +11,7 @@
 namespace FalconEngine
 {
 
+class MaterialAtlas;
 class Sampler;
 
 class Node;
@@ -41,6 +42,13 @@ public:
     const Sampler *
     GetSampler() const;
 
+    // @return Null when the material textures are not packed.
+    const MaterialAtlas *
+    GetMaterialAtlas() const;
+
+    void
+    SetMaterialAtlas(std::shared_ptr<MaterialAtlas> materialAtlas);
+
 public:
     /************************************************************************/
     /* Model Metadata                                                       */
@@ -48,12 +56,17 @@ public:
     int                      mIndexNum;
     int                      mVertexNum;
 
+    size_t                   mVertexBufferByteNum;                           // Vertex buffer size in byte as imported.
+    size_t                   mVertexBufferByteNumUncompressed;               // Vertex buffer size in byte without vertex compression.
+    int                      mVertexBufferNum;                               // Vertex buffer number, i.e. vertex stream number.
+
 private:
     /************************************************************************/
     /* Model Runtime Data                                                   */
     /************************************************************************/
     std::shared_ptr<Node>    mNode;                                          // Model root node.
     std::shared_ptr<Sampler> mSampler;                                       // Model texture sampler.
+    std::shared_ptr<MaterialAtlas> mMaterialAtlas;                           // Texture arrays the material textures are packed into.
 };
 #pragma warning(default: 4251)
 
@@ -94,6 +94,15 @@ public:
     std::shared_ptr<Spatial>
     SetChildAt(int slotIndex, std::shared_ptr<Spatial> child);
 
+    // @summary Get the first child in attaching order. The children are
+    // traversed with GetNextSibling, which skips the empty slots and doesn't
+    // touch the shared pointer of the children.
+    const Spatial *
+    GetFirstChild() const;
+
+    Spatial *
+    GetFirstChild();
+
     int
     GetChildrenNum() const;
 
@@ -107,6 +116,9 @@ public:
     virtual void
     Update(double elapsed, bool initiator) override;
 
+    virtual void
+    Interpolate(double alpha) const override;
+
     /************************************************************************/
     /* Deep and Shallow Copy                                                */
     /************************************************************************/
@@ -127,12 +139,25 @@ protected:
     virtual void
     UpdateWorldTransform(double elapsed) override;
 
+private:
+    void
+    LinkChild(Spatial *child);
+
+    void
+    UnlinkChild(Spatial *child);
+
+    void
+    UnlinkChildAll();
+
 public:
     EventHandler<bool>                    mUpdateBegun;
     EventHandler<bool>                    mUpdateEnded;
 
 private:
-    std::vector<std::shared_ptr<Spatial>> mChildrenSlot;
+    std::vector<std::shared_ptr<Spatial>> mChildrenSlot;                        // Ownership of the children.
+    Spatial                              *mFirstChild;
+    Spatial                              *mLastChild;
+    int                                   mChildrenNum;
 };
 #pragma warning(default: 4251)
 
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <FalconEngine/Graphics/Common.h>
+
+#include <unordered_map>
+#include <vector>
+
+#include <FalconEngine/Math/AABB.h>
+#include <FalconEngine/Math/BoundingVolumeHierarchy.h>
+#include <FalconEngine/Math/Vector2.h>
+
+namespace FalconEngine
+{
+
+class Camera;
+class Entity;
+class Visual;
+
+// @summary Visual of entity stored in the scene query.
+class SceneQueryItem
+{
+public:
+    explicit SceneQueryItem(const AABB& bound) :
+        mEntity(nullptr),
+        mVisual(nullptr),
+        mBound(bound)
+    {
+    }
+
+public:
+    const Entity *mEntity;
+    const Visual *mVisual;
+    AABB          mBound;                                                       // World space bound of the visual.
+};
+
+class SceneQueryHit
+{
+public:
+    const Entity *mEntity;
+    const Visual *mVisual;
+    float         mDistance;                                                    // Distance to the world bound along the ray, zero on overlap query.
+};
+
+// @summary The scene query keeps the world bound of the visuals of entities in
+// the bounding volume hierarchy, which answers the ray picking, overlap and
+// frustum query without iterating all the entities.
+//
+// @remark The world bound is the mesh bound transformed by the world transform
+// of the last update, because the interpolated world transform belongs to the
+// render side. The entity should be updated after its world transform changes.
+#pragma warning(disable: 4251)
+class FALCON_ENGINE_API SceneQuery final
+{
+public:
+    /************************************************************************/
+    /* Static Members                                                       */
+    /************************************************************************/
+    // @summary Create the world space ray through the position on the near
+    // plane of the camera.
+    //
+    // @param positionNdc Position in the normalized device coordinate.
+    static Ray
+    CreateRay(const Camera *camera, const Vector2f& positionNdc);
+
+public:
+    /************************************************************************/
+    /* Constructors and Destructor                                          */
+    /************************************************************************/
+    // @param margin Distance the bound in the hierarchy is enlarged by, so
+    // that the moving visual doesn't need to be reinserted each frame.
+    explicit SceneQuery(float margin = 0.1f);
+    ~SceneQuery();
+
+public:
+    /************************************************************************/
+    /* Entity Management                                                    */
+    /************************************************************************/
+    void
+    Insert(const Entity *entity);
+
+    void
+    Remove(const Entity *entity);
+
+    // @summary Update the world bound of visuals of the entity.
+    void
+    Update(const Entity *entity);
+
+    // @summary Update the world bound of visuals of all the entities.
+    void
+    Update();
+
+    // @summary Rebuild the hierarchy for faster query, after the many
+    // entities are inserted or moved far.
+    void
+    Rebuild();
+
+    void
+    Clear();
+
+    int
+    GetEntityNum() const;
+
+    int
+    GetVisualNum() const;
+
+    const BoundingVolumeHierarchy *
+    GetHierarchy() const;
+
+    /************************************************************************/
+    /* Query                                                                */
+    /************************************************************************/
+    // @summary Find the visual with the nearest world bound hit by the ray.
+    //
+    // @return Whether any visual is hit.
+    bool
+    Pick(const Ray& ray, float distanceMax, SceneQueryHit& hit) const;
+
+    void
+    QueryAABB(const AABB& aabb, std::vector<SceneQueryHit>& hitList) const;
+
+    void
+    QuerySphere(const Sphere& sphere, std::vector<SceneQueryHit>& hitList) const;
+
+    // @summary Find the visuals in the view frustum of the camera.
+    void
+    QueryFrustum(const Camera *camera, std::vector<SceneQueryHit>& hitList) const;
+
+    void
+    QueryFrustum(const Frustum& frustum, std::vector<SceneQueryHit>& hitList) const;
+
+private:
+    BoundingVolumeHierarchy                              mHierarchy;
+    std::unordered_map<int, SceneQueryItem>              mItemTable;         // Item indexed by proxy.
+    std::unordered_map<const Entity *, std::vector<int>> mEntityTable;       // Proxies of visuals of entity.
+};
+#pragma warning(default: 4251)
+
+}
@@ -3,8 +3,10 @@
 #include <FalconEngine/Graphics/Common.h>
 
 #include <functional>
+#include <memory>
 
 #include <FalconEngine/Core/Object.h>
+#include <FalconEngine/Graphics/Renderer/Scene/SpatialPool.h>
 #include <FalconEngine/Math/Matrix4.h>
 
 namespace FalconEngine
@@ -13,23 +15,62 @@ namespace FalconEngine
 class Spatial;
 using SpatialSharedPtr = std::shared_ptr<Spatial>;
 
-class FALCON_ENGINE_API Spatial : public Object
+// @summary Kind of the spatial in the scene graph, which only consists of the
+// node and the visual.
+enum class FALCON_ENGINE_API SpatialType
+{
+    Node,
+    Visual,
+};
+
+// @remark The spatial should be owned by shared pointer, which the renderer
+// shares to keep the spatial alive while rendering it.
+#pragma warning(disable: 4251)
+class FALCON_ENGINE_API Spatial : public Object, public std::enable_shared_from_this<Spatial>
 {
     FALCON_ENGINE_RTTI_DECLARE;
 
+public:
+    /************************************************************************/
+    /* Memory Allocation                                                    */
+    /************************************************************************/
+    // @summary Allocate the spatial created by new, like the clone, from the
+    // spatial pool.
+    static void *
+    operator new(size_t size);
+
+    static void
+    operator delete(void *pointer, size_t size);
+
 protected:
     /************************************************************************/
     /* Constructors and Destructor                                          */
     /************************************************************************/
-    Spatial();
+    explicit Spatial(SpatialType spatialType);
 
 public:
     virtual ~Spatial();
 
+    // NOTE: The handle is unique to each spatial, so the spatial is
+    // only copied by CopyTo.
+    Spatial(const Spatial&) = delete;
+    Spatial& operator=(const Spatial&) = delete;
+
 public:
     /************************************************************************/
     /* Public Members                                                       */
     /************************************************************************/
+    SpatialHandle
+    GetHandle() const;
+
+    // @return Next child of the parent in attaching order, or null when this
+    // is the last child.
+    const Spatial *
+    GetNextSibling() const;
+
+    Spatial *
+    GetNextSibling();
+
     const Spatial *
     GetParent() const;
 
@@ -43,6 +84,15 @@ public:
     virtual void
     Update(double elapsed, bool initiator);
 
+    // @summary Blend the world transform of the last two updates for render.
+    // @param alpha - interpolation alpha in [0, 1] from the previous world
+    //     transform to the current world transform.
+    //
+    // @remark The interpolated transform is rendering state instead of
+    // spatial state, so that it could be set on the constant spatial.
+    virtual void
+    Interpolate(double alpha) const;
+
     /************************************************************************/
     /* Deep and Shallow Copy                                                */
     /************************************************************************/
@@ -61,6 +111,10 @@ protected:
     virtual void UpdateWorldTransform(double elapsed);
 
 public:
+    // @summary Kind of the spatial, tested when traversing the scene graph
+    // so that the child is cast statically instead of dynamically.
+    const SpatialType mSpatialType;
+
     // @summary Local transform from parent
     Matrix4f mLocalTransform;
 
@@ -73,11 +127,31 @@ public:
     Matrix4f mWorldTransform;
     bool     mWorldTransformIsCurrent = false;
 
+    // @summary World transform snapshot before the last update.
+    Matrix4f mWorldTransformPrevious;
+    bool     mWorldTransformChanged = false;                                    // Whether the last update changed world transform.
+
+    // @summary World transform used by render, blended from the previous one
+    // when interpolated. The entity renderer interpolates the visuals it draws
+    // when the frame is handed off to the render side, so that the transform
+    // doesn't change while the render side reads it.
+    mutable Matrix4f mWorldTransformInterpolated;
+    bool     mWorldTransformUpdated = false;                                    // Whether world transform has been updated once.
+
     // @note Because the child would not need to manage the lifetime of its
     // parent, it allows child to use get / set on parent conveniently without
     // caring memory management. Using raw pointer here won't affect the code
     // that needs to check parent exists.
     Spatial *mParent;
+
+    // @summary Intrusive sibling links maintained by the parent, so that the
+    // children are traversed without touching their shared pointer.
+    Spatial *mNextSibling;
+    Spatial *mPreviousSibling;
+
+private:
+    SpatialHandle mHandle;
 };
+#pragma warning(default: 4251)
 
 }
@@ -0,0 +1,228 @@
+#pragma once
+
+#include <FalconEngine/Graphics/Common.h>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace FalconEngine
+{
+
+class Spatial;
+
+// @summary Weak reference to the spatial that doesn't hold the ownership. The
+// generation is checked when the handle is resolved, so that the handle of a
+// destroyed spatial resolves to null even when its slot has been reused.
+class FALCON_ENGINE_API SpatialHandle
+{
+public:
+    static const uint32_t IndexNull = 0xFFFFFFFF;
+
+public:
+    bool
+    IsNull() const
+    {
+        return mIndex == IndexNull;
+    }
+
+public:
+    uint32_t mIndex = IndexNull;
+    uint32_t mGeneration = 0;
+};
+
+inline bool
+operator==(const SpatialHandle& lhs, const SpatialHandle& rhs)
+{
+    return lhs.mIndex == rhs.mIndex && lhs.mGeneration == rhs.mGeneration;
+}
+
+inline bool
+operator!=(const SpatialHandle& lhs, const SpatialHandle& rhs)
+{
+    return !(lhs == rhs);
+}
+
+inline bool
+operator<(const SpatialHandle& lhs, const SpatialHandle& rhs)
+{
+    return lhs.mIndex < rhs.mIndex || (lhs.mIndex == rhs.mIndex && lhs.mGeneration < rhs.mGeneration);
+}
+
+// @summary Storage of the scene graph. Node and visual, along with the control
+// block of their shared pointer, are allocated from the fixed-size blocks in
+// chunks that are never released, so that building and cloning the hierarchy
+// doesn't go to the heap for each spatial. The small blocks hold the control
+// block allocated apart from the spatial. The pool also keeps the handle slot
+// of each living spatial.
+//
+// @remark The pool is thread-safe, because the model could be imported on
+// another thread.
+//
+// @remark The pool is never destroyed, so that the spatial released in static
+// destruction, like the one held by the renderer singleton, still returns to
+// the pool. Its chunks are reported alive in the leak output.
+#pragma warning(disable: 4251)
+class FALCON_ENGINE_API SpatialPool final
+{
+public:
+    /************************************************************************/
+    /* Static Members                                                       */
+    /************************************************************************/
+    static const size_t ChunkBlockNum;
+    static const size_t SmallBlockSize;
+
+    static SpatialPool *
+    GetInstance()
+    {
+        static auto sInstance = new SpatialPool();
+        return sInstance;
+    }
+
+    /************************************************************************/
+    /* Constructors and Destructor                                          */
+    /************************************************************************/
+private:
+    SpatialPool();
+    ~SpatialPool() = delete;
+
+public:
+    SpatialPool(const SpatialPool&) = delete;
+    SpatialPool& operator=(const SpatialPool&) = delete;
+
+public:
+    /************************************************************************/
+    /* Allocation                                                           */
+    /************************************************************************/
+    // @remark Allocation larger than the block, like the subclass with extra
+    // members, falls back to the heap.
+    void *
+    Allocate(size_t size);
+
+    // @remark The size should be the same as the one allocated with.
+    void
+    Deallocate(void *pointer, size_t size);
+
+    size_t
+    GetBlockSize() const;
+
+    // @return Number of the blocks in both sizes.
+    size_t
+    GetBlockNum() const;
+
+    size_t
+    GetBlockUsedNum() const;
+
+    /************************************************************************/
+    /* Handle                                                               */
+    /************************************************************************/
+    SpatialHandle
+    CreateHandle(Spatial *spatial);
+
+    void
+    DestroyHandle(SpatialHandle handle);
+
+    // @return The spatial of the handle, or null when the spatial has been
+    // destroyed.
+    Spatial *
+    GetSpatial(SpatialHandle handle) const;
+
+private:
+    class SpatialBlockList
+    {
+    public:
+        size_t                       mBlockSize;
+        size_t                       mBlockUsedNum;
+        void                        *mBlockFreeList;                            // Head of the intrusive free list.
+        std::vector<unsigned char *> mChunkList;
+    };
+
+    SpatialBlockList *
+    GetBlockList(size_t size);
+
+    void
+    AllocateChunk(SpatialBlockList& blockList);
+
+private:
+    class SpatialHandleSlot
+    {
+    public:
+        Spatial  *mSpatial;
+        uint32_t  mGeneration;
+        uint32_t  mSlotFreeNext;                                                // Next free slot index when the slot is free.
+    };
+
+    mutable std::mutex             mMutex;
+
+    SpatialBlockList               mBlockListSmall;
+    SpatialBlockList               mBlockListLarge;
+
+    std::vector<SpatialHandleSlot> mHandleSlotList;
+    uint32_t                       mHandleSlotFree;                             // Head of the free slot list.
+};
+#pragma warning(default: 4251)
+
+// @summary Standard library allocator adapter backed by the spatial pool, used
+// to allocate the spatial together with its shared pointer control block.
+template <typename T>
+class SpatialStlAllocator
+{
+public:
+    using value_type = T;
+
+public:
+    SpatialStlAllocator() = default;
+
+    template <typename U>
+    SpatialStlAllocator(const SpatialStlAllocator<U>& /* rhs */)
+    {
+    }
+
+public:
+    T *
+    allocate(size_t n)
+    {
+        return static_cast<T *>(SpatialPool::GetInstance()->Allocate(sizeof(T) * n));
+    }
+
+    void
+    deallocate(T *pointer, size_t n)
+    {
+        SpatialPool::GetInstance()->Deallocate(pointer, sizeof(T) * n);
+    }
+};
+
+template <typename T, typename U>
+bool
+operator==(const SpatialStlAllocator<T>&, const SpatialStlAllocator<U>&)
+{
+    return true;
+}
+
+template <typename T, typename U>
+bool
+operator!=(const SpatialStlAllocator<T>&, const SpatialStlAllocator<U>&)
+{
+    return false;
+}
+
+// @summary Create the node or visual from the spatial pool. Use this instead
+// of std::make_shared for the scene graph.
+template <typename T, typename ... Args>
+std::shared_ptr<T>
+CreateSpatial(Args&& ... args)
+{
+    return std::allocate_shared<T>(SpatialStlAllocator<T>(), std::forward<Args>(args)...);
+}
+
+// @summary Take the ownership of the spatial created by GetClone, whose shared
+// pointer control block is allocated from the spatial pool as well.
+template <typename T>
+std::shared_ptr<T>
+ShareSpatial(T *spatial)
+{
+    return std::shared_ptr<T>(spatial, std::default_delete<T>(), SpatialStlAllocator<T>());
+}
+
+}
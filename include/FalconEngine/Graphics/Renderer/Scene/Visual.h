@@ -146,6 +146,20 @@ public:
     void
     SetMesh(std::shared_ptr<Mesh> mesh);
 
+    // @return The primitive of the level of detail selected for current draw.
+    const Primitive *
+    GetPrimitive() const;
+
+    int
+    GetLodIndex() const;
+
+    // @remark The level of detail is set by EntityRenderer per camera on the
+    // render side before the visual is drawn, which is rendering state instead
+    // of visual state, so that it could be set on the constant visual. It is
+    // neither reset nor copied by the update.
+    void
+    SetLodIndex(int lodIndex) const;
+
     /************************************************************************/
     /* Spatial Management                                                   */
     /************************************************************************/
@@ -172,6 +186,7 @@ protected:
     /* Mesh Data                                                            */
     /************************************************************************/
     std::shared_ptr<Mesh>                            mMesh;
+    mutable int                                      mLodIndex;
 
     /************************************************************************/
     /* Effect Data                                                          */
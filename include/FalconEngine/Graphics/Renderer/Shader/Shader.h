@@ -19,6 +19,7 @@ enum class FALCON_ENGINE_API ShaderType
     VertexShader   = 0,
     GeometryShader = 1,
     FragmentShader = 2,
+    ComputeShader  = 3,
 
     Count,
 };
@@ -28,6 +29,7 @@ enum ShaderIndex
     VertexShaderIndex   = 0,
     GeometryShaderIndex = 1,
     FragmentShaderIndex = 2,
+    ComputeShaderIndex  = 3,
 };
 
 class ShaderSource;
@@ -0,0 +1,183 @@
+#pragma once
+
+#include <FalconEngine/Graphics/Common.h>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include <FalconEngine/Math/Matrix4.h>
+#include <FalconEngine/Math/Vector3.h>
+
+namespace FalconEngine
+{
+
+class Camera;
+class Light;
+class Sampler;
+class Shader;
+class Texture2dArray;
+class Visual;
+class VisualEffectPass;
+template <typename T>
+class ShaderUniformValue;
+
+// @summary Shadow caster collected in current frame.
+class ShadowCaster
+{
+public:
+    const Visual *mVisual;
+    Vector3f      mCenter;                                                      // Light space bound center, before translated to the cascade.
+    Vector3f      mExtent;                                                      // Light space bound half size.
+};
+
+// @summary Light space of a cascade, which covers the view frustum between
+// the previous split and its split.
+class ShadowCascade
+{
+public:
+    Matrix4f mViewProjection;                                                   // From world space into the clip space of the cascade.
+    Matrix4f mEyeTransform;                                                     // From eye space of the camera into the texture space of the cascade.
+    float    mSplit;                                                            // Eye space distance of the far plane of the cascade.
+};
+
+// @summary The shadow renderer renders the cascaded shadow map of the
+// directional light, which is sampled by PhongEffect through fe_Shadow.glsl.
+//
+// @remark Each cascade is fitted with the bounding sphere of its part of the
+// camera frustum, so that the size of cascade doesn't change with the camera
+// rotation, and the cascade is snapped to its texel on the light plane, so that
+// the shadow edge doesn't shimmer when the camera moves.
+//
+// @remark The casters are culled against each cascade on the CPU and rendered
+// with depth-only pass into the layer of a single depth texture array. The
+// near plane of each cascade is pulled back to the nearest caster in front of
+// it instead of a fixed distance.
+#pragma warning(disable: 4251)
+class FALCON_ENGINE_API ShadowRenderer final
+{
+    /************************************************************************/
+    /* Static Members                                                       */
+    /************************************************************************/
+public:
+    static const int CascadeNumMax = 4;
+
+    static ShadowRenderer *
+    GetInstance()
+    {
+        static ShadowRenderer sInstance;
+        return &sInstance;
+    }
+
+    /************************************************************************/
+    /* Constructors and Destructor                                          */
+    /************************************************************************/
+private:
+    ShadowRenderer();
+
+public:
+    ~ShadowRenderer();
+
+public:
+    /************************************************************************/
+    /* Rendering API                                                        */
+    /************************************************************************/
+    bool
+    IsShadowEnabled() const;
+
+    // @summary Whether the shadow rendered in current frame is for the light
+    // seen from the camera drawing on the render side.
+    bool
+    IsShadowRendered(const Camera *camera, const Light *light) const;
+
+    const Camera *
+    GetCamera() const;
+
+    // @summary Set the camera that sees the shadow.
+    void
+    SetCamera(const Camera *camera);
+
+    const Light *
+    GetLight() const;
+
+    // @summary Set the directional light that casts the shadow.
+    void
+    SetLight(const Light *light);
+
+    int
+    GetCascadeNum() const;
+
+    const ShadowCascade *
+    GetCascade(int cascadeIndex) const;
+
+    int
+    GetFilterRadius() const;
+
+    float
+    GetTexelSize() const;
+
+    const Texture2dArray *
+    GetShadowTexture() const;
+
+    const Sampler *
+    GetShadowSampler() const;
+
+    /************************************************************************/
+    /* Rendering Engine API                                                 */
+    /************************************************************************/
+    void
+    Initialize();
+
+    void
+    RenderBegin();
+
+    // @summary Render the cascades with the visuals the camera draws.
+    //
+    // @param camera The copy of the camera set, which the entity renderer
+    // draws with on the render side.
+    void
+    Render(const Camera *camera, const std::vector<std::shared_ptr<const Visual>>& visualList);
+
+private:
+    void
+    CollectCaster(const std::vector<std::shared_ptr<const Visual>>& visualList);
+
+    // @summary Fit the cascade and collect the casters in it.
+    void
+    UpdateCascade(const Camera *camera, int cascadeIndex, float splitNear, float splitFar);
+
+    void
+    RenderCascade(int cascadeIndex);
+
+private:
+    bool                                          mShadowEnabled;
+    bool                                          mShadowRendered;
+    const Camera                                 *mCamera;
+    const Camera                                 *mCameraRendered;             // Camera the shadow in current frame is rendered for.
+    const Light                                  *mLight;
+
+    int                                           mCascadeNum;
+    int                                           mCascadeSize;
+    float                                         mCascadeSplitLambda;
+    float                                         mDistance;
+    int                                           mFilterRadius;
+    std::array<ShadowCascade, CascadeNumMax>      mCascadeList;
+
+    std::array<Vector3f, 8>                       mFrustumCorner;               // World space corner of the near plane, then the far plane of camera.
+
+    std::vector<ShadowCaster>                     mCasterList;
+    std::vector<int>                              mCascadeCasterList;           // Index of caster in current cascade.
+    Matrix4f                                      mLightRotation;               // From world space into the light space without translation.
+
+    std::shared_ptr<Texture2dArray>               mShadowTexture;
+    std::shared_ptr<Sampler>                      mShadowSampler;
+
+    std::shared_ptr<Shader>                       mShader;
+    std::unique_ptr<VisualEffectPass>             mPass;
+    std::shared_ptr<ShaderUniformValue<Matrix4f>> mTransformUniform;
+    std::shared_ptr<ShaderUniformValue<Vector3f>> mPositionScaleUniform;
+    std::shared_ptr<ShaderUniformValue<Vector3f>> mPositionOffsetUniform;
+};
+#pragma warning(default: 4251)
+
+}
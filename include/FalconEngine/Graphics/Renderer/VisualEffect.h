@@ -168,6 +168,21 @@ protected:
     void
     SetShaderUniformAutomaticScreenTransform(VisualEffectInstance *visualEffectInstance, int passIndex, const std::string& uniformName) const;
 
+    // @summary Set up uniforms used by fe_Vertex.glsl to decode compressed
+    // vertex position and normal.
+    void
+    SetShaderUniformAutomaticVertexDecode(VisualEffectInstance *visualEffectInstance, int passIndex) const;
+
+    // @summary Set up uniforms used by fe_Draw.glsl and mark the pass as
+    // batchable. When the pass is drawn in a batch, per draw data is read from
+    // the draw data buffer instead of the model uniforms.
+    //
+    // @param key - resource that the pass reads from uniform, like effect
+    // params, so that only instances sharing the same resource are batched.
+    // @param keySecondary - additional resource, like material.
+    void
+    SetShaderUniformAutomaticDraw(VisualEffectInstance *visualEffectInstance, int passIndex, const void *key, const void *keySecondary = nullptr) const;
+
 protected:
     std::vector<std::unique_ptr<VisualEffectPass>> mEffectPassList; // Passes contained in this effect.
 };
@@ -57,6 +57,11 @@ public:
     void
     SetShaderInstancingNum(int passIndex, int instancingNum);
 
+    // @param key - primary resource that the pass reads from uniform.
+    // @param keySecondary - secondary resource that the pass reads from uniform.
+    void
+    SetShaderBatchKey(int passIndex, const void *key, const void *keySecondary);
+
     template <typename T>
     ShaderUniformValue<T> *
     GetShaderUniform(int passIndex, int uniformIndex);
@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <map>
+#include <utility>
 #include <vector>
 
 namespace FalconEngine
@@ -14,6 +15,11 @@ class Shader;
 class ShaderUniform;
 class Texture;
 
+// @summary Identify the instance specific resource, like material and
+// texture, that the shader reads from uniform. Instance passes with the same
+// non-null key could be submitted in one batch.
+using VisualEffectBatchKey = std::pair<const void *, const void *>;
+
 #pragma warning(disable: 4251)
 class FALCON_ENGINE_API VisualEffectInstancePass final
 {
@@ -55,6 +61,14 @@ public:
     void
     SetShaderInstancingNum(int instancingNum);
 
+    // @summary Get the batch key. The pass is not batchable when the key is
+    // null.
+    const VisualEffectBatchKey&
+    GetShaderBatchKey() const;
+
+    void
+    SetShaderBatchKey(const VisualEffectBatchKey& batchKey);
+
     int
     GetShaderUniformNum() const;
 
@@ -131,6 +145,7 @@ private:
     // So there is no way for dangling pointer to affect this 'mShader' field.
     Shader                                     *mShader;
     int                                         mShaderInstancingNum;
+    VisualEffectBatchKey                        mShaderBatchKey;
     std::map<int, const Sampler *>              mShaderSamplerTable;
     std::map<int, const Texture *>              mShaderTextureTable;
     std::vector<std::shared_ptr<ShaderUniform>> mShaderUniformList;
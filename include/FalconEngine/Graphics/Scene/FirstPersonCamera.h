@@ -64,6 +64,10 @@ public:
     /* Control  Data                                                        */
     /************************************************************************/
     float mFlySpeed;                                                         // Meter per second
+
+private:
+    int   mMoveForwardAxis = -1;                                             // Index of the axis in the input map.
+    int   mMoveRightAxis = -1;
 };
 
 }
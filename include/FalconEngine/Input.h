@@ -3,6 +3,8 @@
 #include <FalconEngine/Input/Common.h>
 
 #include <FalconEngine/Input/InputHandler.h>
+#include <FalconEngine/Input/InputMap.h>
+#include <FalconEngine/Input/InputRecord.h>
 #include <FalconEngine/Input/KeyboardHandler.h>
 #include <FalconEngine/Input/KeyboardState.h>
 #include <FalconEngine/Input/KeyState.h>
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <FalconEngine/Input/Common.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <FalconEngine/Input/KeyState.h>
+#include <FalconEngine/Input/MouseButton.h>
+
+namespace FalconEngine
+{
+
+class KeyboardState;
+class MouseState;
+
+enum class FALCON_ENGINE_API MouseAxis
+{
+    PositionX,
+    PositionY,
+    Wheel,
+};
+
+enum class FALCON_ENGINE_API InputBindingType
+{
+    Key,
+    MouseButton,
+    MouseAxis,
+};
+
+// @summary Physical input bound to an action or an axis. The key and the
+// mouse button contribute the scale when pressed, the mouse axis contributes
+// its difference in this frame multiplied by the scale.
+class FALCON_ENGINE_API InputBinding
+{
+public:
+    /************************************************************************/
+    /* Constructors and Destructor                                          */
+    /************************************************************************/
+    InputBinding(Key key, float scale = 1.0f);
+    InputBinding(MouseButton button, float scale = 1.0f);
+    InputBinding(MouseAxis axis, float scale = 1.0f);
+
+public:
+    InputBindingType mType;
+    int              mCode;                                                     // Value of key, mouse button or mouse axis.
+    float            mScale;
+};
+
+#pragma warning(disable: 4251)
+class FALCON_ENGINE_API InputAction
+{
+public:
+    explicit InputAction(const std::string& name);
+
+public:
+    std::string               mName;
+    std::vector<InputBinding> mBindingList;
+
+    bool                      mPressed = false;                                 // Whether any binding is active.
+    bool                      mDown = false;                                    // Transition from being released to being pressed.
+    bool                      mUp = false;                                      // Transition from being pressed to being released.
+};
+
+class FALCON_ENGINE_API InputAxis
+{
+public:
+    explicit InputAxis(const std::string& name);
+
+public:
+    std::string               mName;
+    std::vector<InputBinding> mBindingList;
+
+    float                     mValue = 0.0f;                                    // Sum of the binding value.
+};
+
+// @summary Map from the named action and axis to the physical input. The
+// bindings are resolved once every frame, so that the game queries the
+// precomputed result by the index returned when the action or the axis is
+// added, instead of testing the raw keys.
+class FALCON_ENGINE_API InputMap final
+{
+public:
+    /************************************************************************/
+    /* Constructors and Destructor                                          */
+    /************************************************************************/
+    InputMap();
+    ~InputMap() = default;
+
+public:
+    /************************************************************************/
+    /* Action                                                               */
+    /************************************************************************/
+    // @return The index of the action, which is the existing one when the
+    // name has been added.
+    int
+    AddAction(const std::string& name);
+
+    void
+    BindAction(int action, const InputBinding& binding);
+
+    void
+    UnbindAction(int action);
+
+    // @return The index of the action, or -1 when the name has not been added.
+    int
+    GetAction(const std::string& name) const;
+
+    bool
+    ActionPressed(int action) const;
+
+    bool
+    ActionDown(int action) const;
+
+    bool
+    ActionUp(int action) const;
+
+    /************************************************************************/
+    /* Axis                                                                 */
+    /************************************************************************/
+    // @return The index of the axis, which is the existing one when the name
+    // has been added.
+    int
+    AddAxis(const std::string& name);
+
+    void
+    BindAxis(int axis, const InputBinding& binding);
+
+    void
+    UnbindAxis(int axis);
+
+    // @return The index of the axis, or -1 when the name has not been added.
+    int
+    GetAxis(const std::string& name) const;
+
+    float
+    GetAxisValue(int axis) const;
+
+// internal
+public:
+    // @summary Resolve all the bindings against the state updated in this
+    // frame.
+    void
+    UpdateEvent(const KeyboardState *keyboard, const MouseState *mouse);
+
+private:
+    float
+    GetBindingValue(const InputBinding& binding, const KeyboardState *keyboard, const MouseState *mouse) const;
+
+private:
+    std::vector<InputAction>             mActionList;
+    std::unordered_map<std::string, int> mActionTable;                          // Index of the action by the name.
+
+    std::vector<InputAxis>               mAxisList;
+    std::unordered_map<std::string, int> mAxisTable;                            // Index of the axis by the name.
+};
+#pragma warning(default: 4251)
+
+}
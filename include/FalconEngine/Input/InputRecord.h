@@ -0,0 +1,81 @@
+#pragma once
+
+#include <FalconEngine/Input/Common.h>
+
+#include <cstdint>
+#include <vector>
+
+#include <cereal/access.hpp>
+#include <cereal/types/vector.hpp>
+
+namespace FalconEngine
+{
+
+enum class FALCON_ENGINE_API InputEventType
+{
+    Key,
+    MouseButton,
+    MousePosition,
+    MouseWheel,
+};
+
+// @summary Input event polled from the platform, recorded as it is before
+// applied to the keyboard or mouse state.
+class FALCON_ENGINE_API InputEvent
+{
+public:
+    /************************************************************************/
+    /* Constructors and Destructor                                          */
+    /************************************************************************/
+    InputEvent();
+    InputEvent(InputEventType type, int code, bool pressed, double x, double y, double time);
+
+public:
+    /************************************************************************/
+    /* Asset Importing and Exporting                                        */
+    /************************************************************************/
+    friend class cereal::access;
+    template <typename Archive>
+    void serialize(Archive & ar)
+    {
+        ar & mType;
+        ar & mCode;
+        ar & mPressed;
+        ar & mX;
+        ar & mY;
+        ar & mTime;
+    }
+
+public:
+    uint8_t mType;                                                              // Value of input event type.
+    int16_t mCode;                                                              // Key or mouse button.
+    bool    mPressed;
+    double  mX;                                                                 // Mouse position x.
+    double  mY;                                                                 // Mouse position y or mouse wheel offset.
+    double  mTime;                                                              // Millisecond since the record begun.
+};
+
+// @summary Input events polled in one frame, along with the elapsed time of
+// the frame that drives the game update.
+#pragma warning(disable: 4251)
+class FALCON_ENGINE_API InputFrame
+{
+public:
+    /************************************************************************/
+    /* Asset Importing and Exporting                                        */
+    /************************************************************************/
+    friend class cereal::access;
+    template <typename Archive>
+    void serialize(Archive & ar)
+    {
+        ar & mElapsedMillisecond;
+        ar & mEventList;
+    }
+
+public:
+    double                  mElapsedMillisecond = 0;
+    std::vector<InputEvent> mEventList;
+};
+#pragma warning(default: 4251)
+
+}
@@ -134,25 +134,6 @@ enum class FALCON_ENGINE_API Key
 
 using KeyHash = std::hash<int>;
 
-class FALCON_ENGINE_API KeyState final
-{
-public:
-    /************************************************************************/
-    /* Constructors and Destructor                                          */
-    /************************************************************************/
-    KeyState();
-    explicit KeyState(Key key);
-    ~KeyState() = default;
-
-public:
-    Key    mKey;
-    bool   mKeyChanged = false;
-    bool   mPressed;
-    double mPressedMoment = 0;   // Millisecond time stamp.
-    bool   mUp;                  // Transition from being pressed to being released.
-    bool   mDown;                // Transition from being released to being pressed.
-};
-
 }
 
 namespace std
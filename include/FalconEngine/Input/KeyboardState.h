@@ -2,17 +2,28 @@
 
 #include <FalconEngine/Input/Common.h>
 
-#include <unordered_map>
+#include <bitset>
 
 #include <FalconEngine/Input/KeyState.h>
 
 namespace FalconEngine
 {
 
+// @summary Key state stored in flat bit sets indexed by the key value, so that
+// the query is a bit test and the per-frame update touches only few words.
 #pragma warning(disable: 4251)
-class FALCON_ENGINE_API KeyboardState final : private std::unordered_map<Key, KeyState>
+class FALCON_ENGINE_API KeyboardState final
 {
 public:
+    /************************************************************************/
+    /* Static Members                                                       */
+    /************************************************************************/
+    static const int KeyNum = int(Key::Menu) + 1;
+
+public:
+    /************************************************************************/
+    /* Constructors and Destructor                                          */
+    /************************************************************************/
     KeyboardState();
 
 public:
@@ -36,11 +47,10 @@ public:
     UpdateEvent(double elapsed);
 
 private:
-    void
-    UpdateKey(KeyState& keyState,
-              bool      keyPressedCurrent,
-              bool      keyPressedPrevious,
-              double    timeCurrent);
+    std::bitset<KeyNum> mKeyChanged;                                         // Whether the key has been polled during this frame.
+    std::bitset<KeyNum> mKeyPressed;
+    std::bitset<KeyNum> mKeyDown;                                            // Transition from being released to being pressed.
+    std::bitset<KeyNum> mKeyUp;                                              // Transition from being pressed to being released.
 };
 #pragma warning(default: 4251)
 
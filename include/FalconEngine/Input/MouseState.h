@@ -2,6 +2,8 @@
 
 #include <FalconEngine/Input/Common.h>
 
+#include <bitset>
+
 #include <FalconEngine/Input/MouseButtonState.h>
 #include <FalconEngine/Math/Vector2.h>
 #include "FalconEngine/Math/Vector3.h"
@@ -16,8 +18,15 @@ enum class FALCON_ENGINE_API MouseWheelDirection
     Up = 2
 };
 
+#pragma warning(disable: 4251)
 class FALCON_ENGINE_API MouseState final
 {
+public:
+    /************************************************************************/
+    /* Static Members                                                       */
+    /************************************************************************/
+    static const int ButtonNum = int(MouseButton::MiddleButton) + 1;
+
 public:
     /************************************************************************/
     /* Constructors and Destructor                                          */
@@ -72,12 +81,6 @@ public:
     UpdateEvent(double elapsed);
 
 private:
-    void
-    UpdateButton(MouseButtonState& buttonState,
-                 bool              buttonPressedCurrent,
-                 bool              buttonPressedPrevious,
-                 double            timeCurrent);
-
     void
     UpdatePosition(Vector2f mousePositionCurrent, Vector2f mousePositionPrevious);
 
@@ -85,7 +88,11 @@ private:
     UpdateWheelValue(int wheelValueCurrent, int wheelValuePrevious);
 
 private:
-    MouseButtonStateMap mButtonTable;
+    std::bitset<ButtonNum> mButtonChanged;                                   // Whether the button has been polled during this frame.
+    std::bitset<ButtonNum> mButtonPressed;
+    std::bitset<ButtonNum> mButtonDown;                                      // Transition from being released to being pressed.
+    std::bitset<ButtonNum> mButtonUp;                                        // Transition from being pressed to being released.
+
     Vector2f            mPosition;
     bool                mPositionChanged = false;
     Vector2f            mPositionDiff;
@@ -95,5 +102,6 @@ private:
     bool                mWheelValueChanged = false;
     int                 mWheelValueDiff;
 };
+#pragma warning(default: 4251)
 
 }
@@ -7,14 +7,19 @@
 
 #include <FalconEngine/Math/Common.h>
 
+#include <FalconEngine/Math/AABB.h>
+#include <FalconEngine/Math/BoundingVolumeHierarchy.h>
 #include <FalconEngine/Math/Color.h>
 #include <FalconEngine/Math/Constant.h>
+#include <FalconEngine/Math/Frustum.h>
 #include <FalconEngine/Math/Function.h>
 #include <FalconEngine/Math/Handedness.h>
 #include <FalconEngine/Math/Matrix3.h>
 #include <FalconEngine/Math/Matrix4.h>
 #include <FalconEngine/Math/Quaternion.h>
+#include <FalconEngine/Math/Ray.h>
 #include <FalconEngine/Math/Rectangle.h>
+#include <FalconEngine/Math/Sphere.h>
 #include <FalconEngine/Math/Type.h>
 #include <FalconEngine/Math/Vector2.h>
 #include <FalconEngine/Math/Vector3.h>
@@ -17,6 +17,7 @@ public:
     /* Constructors and Destructor                                          */
     /************************************************************************/
     explicit AABB(const Vector3f& position);
+    AABB(const Vector3f& positionMin, const Vector3f& positionMax);
     ~AABB() = default;
 
 public:
@@ -26,6 +27,27 @@ public:
     void
     Extend(const Vector3f& position);
 
+    void
+    Extend(const AABB& aabb);
+
+    bool
+    Contains(const AABB& aabb) const;
+
+    bool
+    Intersects(const AABB& aabb) const;
+
+    // @summary Get surface area of the box, which is proportional to the
+    // probability that a random ray hits the box.
+    float
+    GetArea() const;
+
+    Vector3f
+    GetCenter() const;
+
+    // @summary Get half size of the box on each axis.
+    Vector3f
+    GetExtent() const;
+
 private:
     /************************************************************************/
     /* Private Members                                                      */
@@ -40,4 +62,34 @@ public:
 #pragma pack(pop)
 #pragma warning(default : 4251)
 
+inline void
+AABB::Extend(const AABB& aabb)
+{
+    Extend(aabb.mMin);
+    Extend(aabb.mMax);
+}
+
+inline bool
+AABB::Contains(const AABB& aabb) const
+{
+    return mMin.x <= aabb.mMin.x && aabb.mMax.x <= mMax.x
+           && mMin.y <= aabb.mMin.y && aabb.mMax.y <= mMax.y
+           && mMin.z <= aabb.mMin.z && aabb.mMax.z <= mMax.z;
+}
+
+inline bool
+AABB::Intersects(const AABB& aabb) const
+{
+    return mMin.x <= aabb.mMax.x && aabb.mMin.x <= mMax.x
+           && mMin.y <= aabb.mMax.y && aabb.mMin.y <= mMax.y
+           && mMin.z <= aabb.mMax.z && aabb.mMin.z <= mMax.z;
+}
+
+inline float
+AABB::GetArea() const
+{
+    auto size = mMax - mMin;
+    return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+}
+
 }
@@ -0,0 +1,414 @@
+#pragma once
+
+#include <FalconEngine/Math/Common.h>
+
+#include <array>
+#include <vector>
+
+#include <FalconEngine/Math/AABB.h>
+#include <FalconEngine/Math/Frustum.h>
+#include <FalconEngine/Math/Ray.h>
+#include <FalconEngine/Math/Sphere.h>
+
+namespace FalconEngine
+{
+
+class BoundingVolumeNode
+{
+public:
+    BoundingVolumeNode();
+
+public:
+    bool
+    IsLeaf() const
+    {
+        return mChild[0] < 0;
+    }
+
+public:
+    AABB  mBound;                                                               // Enlarged by the margin on leaf.
+    void *mData;
+    int   mParent;                                                              // Next free node when the node is free.
+    int   mChild[2];
+    int   mHeight;                                                              // Zero on leaf, negative on free node.
+};
+
+// @summary Traversal stack which only allocates on the heap when the tree is
+// deeper than usual.
+class BoundingVolumeStack
+{
+public:
+    BoundingVolumeStack() :
+        mNum(0)
+    {
+    }
+
+public:
+    bool
+    Empty() const
+    {
+        return mNum == 0;
+    }
+
+    void
+    Push(int nodeIndex)
+    {
+        if (mNum < int(mArray.size()))
+        {
+            mArray[mNum] = nodeIndex;
+        }
+        else
+        {
+            mList.push_back(nodeIndex);
+        }
+
+        ++mNum;
+    }
+
+    int
+    Pop()
+    {
+        --mNum;
+        if (mNum < int(mArray.size()))
+        {
+            return mArray[mNum];
+        }
+
+        auto nodeIndex = mList.back();
+        mList.pop_back();
+        return nodeIndex;
+    }
+
+private:
+    std::array<int, 64> mArray;
+    std::vector<int>    mList;
+    int                 mNum;
+};
+
+// @summary Dynamic bounding volume hierarchy over axis aligned boxes, used to
+// accelerate the ray, overlap and frustum queries of many objects.
+//
+// @remark Each object is referred by the proxy returned on insertion, which
+// stays valid until the object is removed. Moving an object reinserts it only
+// when it leaves its enlarged bound, choosing the sibling with the lowest
+// surface area cost and rotating the ancestors to keep the tree balanced.
+// Refitting an object keeps the tree structure, which is cheaper but degrades
+// the tree when objects move far, so that the tree should be rebuilt with the
+// surface area heuristic after large changes.
+//
+// @ref Catto, Dynamic Bounding Volume Hierarchies, GDC 2019.
+// @ref Wald, On fast Construction of SAH-based Bounding Volume Hierarchies,
+// 2007.
+#pragma warning(disable: 4251)
+class FALCON_ENGINE_API BoundingVolumeHierarchy final
+{
+public:
+    static const int NullIndex = -1;
+
+public:
+    /************************************************************************/
+    /* Constructors and Destructor                                          */
+    /************************************************************************/
+    // @param margin Distance the leaf bound is enlarged by, so that the object
+    // moving within the margin doesn't need to be reinserted.
+    explicit BoundingVolumeHierarchy(float margin = 0.1f);
+    ~BoundingVolumeHierarchy();
+
+public:
+    /************************************************************************/
+    /* Object Management                                                    */
+    /************************************************************************/
+    // @return The proxy of the object.
+    int
+    Insert(const AABB& aabb, void *data);
+
+    void
+    Remove(int proxy);
+
+    // @summary Update the bound of the object, reinserting it when it leaves
+    // its enlarged bound.
+    //
+    // @return Whether the object is reinserted.
+    bool
+    Move(int proxy, const AABB& aabb);
+
+    // @summary Update the bound of the object and its ancestors without
+    // changing the tree structure.
+    void
+    Refit(int proxy, const AABB& aabb);
+
+    // @summary Rebuild the tree from all the objects with the surface area
+    // heuristic. The proxies stay valid.
+    void
+    Rebuild();
+
+    void
+    Clear();
+
+    const AABB&
+    GetBound(int proxy) const;
+
+    void *
+    GetData(int proxy) const;
+
+    int
+    GetObjectNum() const;
+
+    // @return Height of the tree, which is zero when the tree only has one
+    // object.
+    int
+    GetHeight() const;
+
+    // @summary Sum of the surface area of the internal nodes relative to the
+    // root, which is proportional to the expected cost of a random ray.
+    float
+    GetCost() const;
+
+    /************************************************************************/
+    /* Query                                                                */
+    /************************************************************************/
+    // @param callback bool(int proxy), return false to stop the query.
+    template <typename Callback>
+    void
+    QueryAABB(const AABB& aabb, Callback callback) const;
+
+    // @param callback bool(int proxy), return false to stop the query.
+    template <typename Callback>
+    void
+    QuerySphere(const Sphere& sphere, Callback callback) const;
+
+    // @param callback bool(int proxy), return false to stop the query.
+    //
+    // @remark The object inside the frustum entirely is reported without
+    // testing its own bound.
+    template <typename Callback>
+    void
+    QueryFrustum(const Frustum& frustum, Callback callback) const;
+
+    // @param callback float(int proxy, float distanceMax), return the new
+    // largest distance of the query, zero to stop the query. The nearer
+    // child is visited first.
+    template <typename Callback>
+    void
+    QueryRay(const Ray& ray, float distanceMax, Callback callback) const;
+
+    // @summary Find the nearest object whose enlarged bound the ray hits.
+    //
+    // @return The proxy of the object, null index when missed.
+    int
+    Raycast(const Ray& ray, float distanceMax, float& distance) const;
+
+private:
+    int
+    AllocateNode();
+
+    void
+    FreeNode(int nodeIndex);
+
+    void
+    InsertLeaf(int leafIndex);
+
+    void
+    RemoveLeaf(int leafIndex);
+
+    // @summary Rotate the grandchild with the child of the node when it
+    // lowers the surface area, and update the node.
+    void
+    Rotate(int nodeIndex);
+
+    void
+    UpdateNode(int nodeIndex);
+
+    // @summary Build the subtree over the leaves in the range with binned
+    // surface area heuristic.
+    int
+    BuildNode(int *leafBegin, int *leafEnd, const std::vector<Vector3f>& centroidList);
+
+private:
+    std::vector<BoundingVolumeNode> mNodeList;
+    int                             mNodeFree;
+    int                             mRoot;
+    int                             mObjectNum;
+    float                           mMargin;
+};
+#pragma warning(default: 4251)
+
+template <typename Callback>
+void
+BoundingVolumeHierarchy::QueryAABB(const AABB& aabb, Callback callback) const
+{
+    if (mRoot == NullIndex)
+    {
+        return;
+    }
+
+    BoundingVolumeStack stack;
+    stack.Push(mRoot);
+    while (!stack.Empty())
+    {
+        const auto& node = mNodeList[stack.Pop()];
+        if (!node.mBound.Intersects(aabb))
+        {
+            continue;
+        }
+
+        if (node.IsLeaf())
+        {
+            if (!callback(int(&node - mNodeList.data())))
+            {
+                return;
+            }
+        }
+        else
+        {
+            stack.Push(node.mChild[0]);
+            stack.Push(node.mChild[1]);
+        }
+    }
+}
+
+template <typename Callback>
+void
+BoundingVolumeHierarchy::QuerySphere(const Sphere& sphere, Callback callback) const
+{
+    if (mRoot == NullIndex)
+    {
+        return;
+    }
+
+    BoundingVolumeStack stack;
+    stack.Push(mRoot);
+    while (!stack.Empty())
+    {
+        const auto& node = mNodeList[stack.Pop()];
+        if (!sphere.Intersects(node.mBound))
+        {
+            continue;
+        }
+
+        if (node.IsLeaf())
+        {
+            if (!callback(int(&node - mNodeList.data())))
+            {
+                return;
+            }
+        }
+        else
+        {
+            stack.Push(node.mChild[0]);
+            stack.Push(node.mChild[1]);
+        }
+    }
+}
+
+template <typename Callback>
+void
+BoundingVolumeHierarchy::QueryFrustum(const Frustum& frustum, Callback callback) const
+{
+    if (mRoot == NullIndex)
+    {
+        return;
+    }
+
+    // NOTE: The stack item is tagged by its sign to mark the subtree
+    // which is inside the frustum entirely.
+    BoundingVolumeStack stack;
+    stack.Push(mRoot);
+    while (!stack.Empty())
+    {
+        auto item = stack.Pop();
+        auto inside = item < 0;
+        auto nodeIndex = inside ? ~item : item;
+
+        const auto& node = mNodeList[nodeIndex];
+        if (!inside)
+        {
+            auto containment = frustum.Contains(node.mBound);
+            if (containment == FrustumContainment::Outside)
+            {
+                continue;
+            }
+
+            inside = containment == FrustumContainment::Inside;
+        }
+
+        if (node.IsLeaf())
+        {
+            if (!callback(nodeIndex))
+            {
+                return;
+            }
+        }
+        else
+        {
+            stack.Push(inside ? ~node.mChild[0] : node.mChild[0]);
+            stack.Push(inside ? ~node.mChild[1] : node.mChild[1]);
+        }
+    }
+}
+
+template <typename Callback>
+void
+BoundingVolumeHierarchy::QueryRay(const Ray& ray, float distanceMax, Callback callback) const
+{
+    float distance;
+    if (mRoot == NullIndex || !ray.Intersects(mNodeList[mRoot].mBound, distanceMax, distance))
+    {
+        return;
+    }
+
+    BoundingVolumeStack stack;
+    stack.Push(mRoot);
+    while (!stack.Empty())
+    {
+        auto nodeIndex = stack.Pop();
+        const auto& node = mNodeList[nodeIndex];
+
+        // NOTE: Test again, because the distance might be clipped
+        // since the node was pushed.
+        if (!ray.Intersects(node.mBound, distanceMax, distance))
+        {
+            continue;
+        }
+
+        if (node.IsLeaf())
+        {
+            distanceMax = callback(nodeIndex, distanceMax);
+            if (distanceMax <= 0.0f)
+            {
+                return;
+            }
+
+            continue;
+        }
+
+        float distance0;
+        float distance1;
+        auto hit0 = ray.Intersects(mNodeList[node.mChild[0]].mBound, distanceMax, distance0);
+        auto hit1 = ray.Intersects(mNodeList[node.mChild[1]].mBound, distanceMax, distance1);
+        if (hit0 && hit1)
+        {
+            // Push the farther child first so that the nearer one is visited first.
+            if (distance0 <= distance1)
+            {
+                stack.Push(node.mChild[1]);
+                stack.Push(node.mChild[0]);
+            }
+            else
+            {
+                stack.Push(node.mChild[0]);
+                stack.Push(node.mChild[1]);
+            }
+        }
+        else if (hit0)
+        {
+            stack.Push(node.mChild[0]);
+        }
+        else if (hit1)
+        {
+            stack.Push(node.mChild[1]);
+        }
+    }
+}
+
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <FalconEngine/Math/Common.h>
+
+#include <array>
+
+#include <FalconEngine/Math/AABB.h>
+#include <FalconEngine/Math/Matrix4.h>
+#include <FalconEngine/Math/Vector3.h>
+#include <FalconEngine/Math/Vector4.h>
+
+namespace FalconEngine
+{
+
+enum class FALCON_ENGINE_API FrustumContainment
+{
+    Outside,
+    Intersect,
+    Inside,
+};
+
+#pragma warning(disable : 4251)
+class FALCON_ENGINE_API Frustum final
+{
+public:
+    /************************************************************************/
+    /* Static Members                                                       */
+    /************************************************************************/
+    // @summary Extract the planes from the matrix that transforms into the
+    // OpenGL clip space.
+    // @ref Gribb and Hartmann, Fast Extraction of Viewing Frustum Planes from
+    // the World-View-Projection Matrix, 2001.
+    static Frustum
+    CreateFromViewProjection(const Matrix4f& viewProjection);
+
+public:
+    /************************************************************************/
+    /* Constructors and Destructor                                          */
+    /************************************************************************/
+    Frustum() = default;
+    ~Frustum() = default;
+
+public:
+    /************************************************************************/
+    /* Public Members                                                       */
+    /************************************************************************/
+    FrustumContainment
+    Contains(const AABB& aabb) const;
+
+public:
+    // NOTE: Plane is stored as normal and distance from origin, whose
+    // normal points inside the frustum and is normalized.
+    std::array<Vector4f, 6> mPlaneList;                                         // Left, right, bottom, top, near and far.
+};
+#pragma warning(default : 4251)
+
+inline FrustumContainment
+Frustum::Contains(const AABB& aabb) const
+{
+    auto center = aabb.GetCenter();
+    auto extent = aabb.GetExtent();
+
+    auto containment = FrustumContainment::Inside;
+    for (const auto& plane : mPlaneList)
+    {
+        auto distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w;
+        auto radius = extent.x * (plane.x < 0 ? -plane.x : plane.x)
+                      + extent.y * (plane.y < 0 ? -plane.y : plane.y)
+                      + extent.z * (plane.z < 0 ? -plane.z : plane.z);
+        if (distance < -radius)
+        {
+            return FrustumContainment::Outside;
+        }
+
+        if (distance < radius)
+        {
+            containment = FrustumContainment::Intersect;
+        }
+    }
+
+    return containment;
+}
+
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <FalconEngine/Math/Common.h>
+
+#include <FalconEngine/Math/AABB.h>
+#include <FalconEngine/Math/Vector3.h>
+
+namespace FalconEngine
+{
+
+#pragma pack(push, 1)
+class FALCON_ENGINE_API Ray final
+{
+public:
+    /************************************************************************/
+    /* Constructors and Destructor                                          */
+    /************************************************************************/
+    // @remark The direction is normalized.
+    Ray(const Vector3f& origin, const Vector3f& direction);
+    ~Ray() = default;
+
+public:
+    /************************************************************************/
+    /* Public Members                                                       */
+    /************************************************************************/
+    // @summary Intersect the ray with the box using slab test.
+    //
+    // @param distance The distance where the ray enters the box, which is zero
+    // when the origin is inside the box.
+    // @return Whether the ray hits the box no farther than the given distance.
+    bool
+    Intersects(const AABB& aabb, float distanceMax, float& distance) const;
+
+    Vector3f
+    GetPoint(float distance) const;
+
+public:
+    Vector3f mOrigin;
+    Vector3f mDirection;
+    Vector3f mDirectionInverse;                                                 // Reciprocal of each direction component, infinite on the axis the ray is parallel to.
+};
+#pragma pack(pop)
+
+inline bool
+Ray::Intersects(const AABB& aabb, float distanceMax, float& distance) const
+{
+    auto tx0 = (aabb.mMin.x - mOrigin.x) * mDirectionInverse.x;
+    auto tx1 = (aabb.mMax.x - mOrigin.x) * mDirectionInverse.x;
+    auto ty0 = (aabb.mMin.y - mOrigin.y) * mDirectionInverse.y;
+    auto ty1 = (aabb.mMax.y - mOrigin.y) * mDirectionInverse.y;
+    auto tz0 = (aabb.mMin.z - mOrigin.z) * mDirectionInverse.z;
+    auto tz1 = (aabb.mMax.z - mOrigin.z) * mDirectionInverse.z;
+
+    auto tNear = 0.0f;
+    tNear = tx0 < tx1 ? (tx0 > tNear ? tx0 : tNear) : (tx1 > tNear ? tx1 : tNear);
+    tNear = ty0 < ty1 ? (ty0 > tNear ? ty0 : tNear) : (ty1 > tNear ? ty1 : tNear);
+    tNear = tz0 < tz1 ? (tz0 > tNear ? tz0 : tNear) : (tz1 > tNear ? tz1 : tNear);
+
+    auto tFar = distanceMax;
+    tFar = tx0 < tx1 ? (tx1 < tFar ? tx1 : tFar) : (tx0 < tFar ? tx0 : tFar);
+    tFar = ty0 < ty1 ? (ty1 < tFar ? ty1 : tFar) : (ty0 < tFar ? ty0 : tFar);
+    tFar = tz0 < tz1 ? (tz1 < tFar ? tz1 : tFar) : (tz0 < tFar ? tz0 : tFar);
+
+    distance = tNear;
+    return tNear <= tFar;
+}
+
+inline Vector3f
+Ray::GetPoint(float distance) const
+{
+    return mOrigin + mDirection * distance;
+}
+
+}
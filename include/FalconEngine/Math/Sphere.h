@@ -0,0 +1,54 @@
+#pragma once
+
+#include <FalconEngine/Math/Common.h>
+
+#include <FalconEngine/Math/AABB.h>
+#include <FalconEngine/Math/Vector3.h>
+
+namespace FalconEngine
+{
+
+#pragma pack(push, 1)
+class FALCON_ENGINE_API Sphere final
+{
+public:
+    /************************************************************************/
+    /* Constructors and Destructor                                          */
+    /************************************************************************/
+    Sphere(const Vector3f& center, float radius);
+    ~Sphere() = default;
+
+public:
+    /************************************************************************/
+    /* Public Members                                                       */
+    /************************************************************************/
+    bool
+    Intersects(const AABB& aabb) const;
+
+public:
+    Vector3f mCenter;
+    float    mRadius;
+};
+#pragma pack(pop)
+
+inline bool
+Sphere::Intersects(const AABB& aabb) const
+{
+    // Squared distance from the center to the closest point in the box.
+    auto distanceSquare = 0.0f;
+    for (int i = 0; i < 3; ++i)
+    {
+        if (mCenter[i] < aabb.mMin[i])
+        {
+            distanceSquare += (aabb.mMin[i] - mCenter[i]) * (aabb.mMin[i] - mCenter[i]);
+        }
+        else if (mCenter[i] > aabb.mMax[i])
+        {
+            distanceSquare += (mCenter[i] - aabb.mMax[i]) * (mCenter[i] - aabb.mMax[i]);
+        }
+    }
+
+    return distanceSquare <= mRadius * mRadius;
+}
+
+}
@@ -0,0 +1,613 @@
+#include <FalconEngine/Benchmark/Benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <new>
+#include <sstream>
+
+#include <FalconEngine/Context/GameEngineGraphics.h>
+#include <FalconEngine/Context/GameEnginePlatform.h>
+#include <FalconEngine/Context/GameEngineSettings.h>
+
+#if defined(FALCON_ENGINE_WINDOW_GLFW)
+#include <FalconEngine/Context/Platform/GLFW/GLFWGameEngineData.h>
+#endif
+
+// @summary Entry of the benchmark suite. Each benchmark is calibrated until the
+// timed loop runs longer than the minimum time, then repeated to report the
+// spread, and the result is written as JSON to compare across commits.
+//
+// Usage: FalconEngine.Benchmark [--filter=<substring>] [--output=<json path>]
+//            [--label=<commit>] [--min-time=<ms>] [--repetition=<num>] [--list]
+
+/************************************************************************/
+/* Allocation Counting                                                  */
+/************************************************************************/
+static std::atomic<uint64_t> sAllocationNum(0);
+
+void *
+operator new(size_t size)
+{
+    sAllocationNum.fetch_add(1, std::memory_order_relaxed);
+
+    auto pointer = malloc(size);
+    if (pointer == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    return pointer;
+}
+
+void *
+operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void
+operator delete(void *pointer) noexcept
+{
+    free(pointer);
+}
+
+void
+operator delete[](void *pointer) noexcept
+{
+    free(pointer);
+}
+
+void
+operator delete(void *pointer, size_t /* size */) noexcept
+{
+    free(pointer);
+}
+
+void
+operator delete[](void *pointer, size_t /* size */) noexcept
+{
+    free(pointer);
+}
+
+namespace FalconEngine
+{
+
+const void *volatile gBenchmarkSink = nullptr;
+
+/************************************************************************/
+/* Benchmark State                                                      */
+/************************************************************************/
+BenchmarkState::BenchmarkState(int64_t iterationNum) :
+    mIterationNum(iterationNum),
+    mIterationIndex(0),
+    mItemNum(0),
+    mElapsedNanosecond(0),
+    mAllocationNum(0),
+    mTiming(false),
+    mAllocationBegun(0)
+{
+}
+
+bool
+BenchmarkState::KeepRunning()
+{
+    if (mIterationIndex == 0 && !mTiming)
+    {
+        ResumeTiming();
+    }
+
+    if (mIterationIndex < mIterationNum && mSkipMessage.empty())
+    {
+        ++mIterationIndex;
+        return true;
+    }
+
+    if (mTiming)
+    {
+        PauseTiming();
+    }
+
+    return false;
+}
+
+void
+BenchmarkState::PauseTiming()
+{
+    mElapsedNanosecond += std::chrono::duration<double, std::nano>(BenchmarkClock::now() - mTimingBegun).count();
+    mAllocationNum += sAllocationNum.load(std::memory_order_relaxed) - mAllocationBegun;
+    mTiming = false;
+}
+
+void
+BenchmarkState::ResumeTiming()
+{
+    mTiming = true;
+    mAllocationBegun = sAllocationNum.load(std::memory_order_relaxed);
+    mTimingBegun = BenchmarkClock::now();
+}
+
+int64_t
+BenchmarkState::GetIterationNum() const
+{
+    return mIterationNum;
+}
+
+void
+BenchmarkState::SetItemNum(int64_t itemNum)
+{
+    mItemNum = itemNum;
+}
+
+void
+BenchmarkState::SetCounter(const std::string& name, double value)
+{
+    mCounterTable[name] = value;
+}
+
+void
+BenchmarkState::Skip(const std::string& message)
+{
+    mSkipMessage = message;
+}
+
+/************************************************************************/
+/* Benchmark Registry                                                   */
+/************************************************************************/
+void
+BenchmarkRegistry::Register(const std::string& name, BenchmarkFunction function, int64_t iterationNum)
+{
+    mBenchmarkList.push_back({ name, function, iterationNum });
+}
+
+const std::vector<Benchmark>&
+BenchmarkRegistry::GetBenchmarkList() const
+{
+    return mBenchmarkList;
+}
+
+/************************************************************************/
+/* Benchmark Environment                                                */
+/************************************************************************/
+bool
+BenchmarkInitializeGraphics()
+{
+    static int sInitialized = -1;
+    if (sInitialized >= 0)
+    {
+        return sInitialized == 1;
+    }
+
+    sInitialized = 0;
+
+    // NOTE: The window is hidden, so that the benchmark runs without
+    // presenting anything. The context still needs a display server.
+    auto gameEngineSettings = GameEngineSettings::GetInstance();
+    gameEngineSettings->mContentDirectory = "Content/";
+    gameEngineSettings->mShaderDirectory = "Content/Shader/";
+    gameEngineSettings->mMouseVisible = true;
+    gameEngineSettings->mMouseLimited = true;
+    gameEngineSettings->mWindowVisible = false;
+
+    GameEnginePlatform::GetInstance()->Initialize();
+
+#if defined(FALCON_ENGINE_WINDOW_GLFW)
+    if (GameEngineData::GetInstance()->mWindow == nullptr)
+    {
+        return false;
+    }
+#endif
+
+    GameEngineGraphics::GetInstance()->Initialize();
+
+    sInitialized = 1;
+    return true;
+}
+
+bool
+BenchmarkFileExists(const std::string& filePath)
+{
+    std::ifstream fileStream(filePath.c_str());
+    return fileStream.good();
+}
+
+}
+
+using namespace FalconEngine;
+
+/************************************************************************/
+/* Benchmark Runner                                                     */
+/************************************************************************/
+class BenchmarkOption
+{
+public:
+    std::string mFilter;
+    std::string mOutputPath = "FalconEngine.Benchmark.json";
+    std::string mLabel;
+    double      mMinMillisecond = 200.0;
+    int         mRepetitionNum = 5;
+    bool        mListed = false;
+};
+
+class BenchmarkResult
+{
+public:
+    std::string                   mName;
+    int64_t                       mIterationNum = 0;
+    std::vector<double>           mNanosecondList;                              // Time per iteration of each repetition.
+    double                        mAllocationNum = 0;                           // Allocation per iteration.
+    int64_t                       mItemNum = 0;
+    std::map<std::string, double> mCounterTable;
+    std::string                   mSkipMessage;
+};
+
+static BenchmarkState
+RunOnce(const Benchmark& benchmark, int64_t iterationNum)
+{
+    BenchmarkState state(iterationNum);
+    benchmark.mFunction(state);
+    return state;
+}
+
+static BenchmarkResult
+Run(const Benchmark& benchmark, const BenchmarkOption& option)
+{
+    BenchmarkResult result;
+    result.mName = benchmark.mName;
+
+    // Find the iteration number which runs longer than the minimum time.
+    auto iterationNum = benchmark.mIterationNum > 0 ? benchmark.mIterationNum : int64_t(1);
+    if (benchmark.mIterationNum == 0)
+    {
+        const auto minNanosecond = option.mMinMillisecond * 1e6;
+        const auto iterationNumMax = int64_t(1e9);
+        while (true)
+        {
+            auto state = RunOnce(benchmark, iterationNum);
+            if (!state.mSkipMessage.empty())
+            {
+                result.mSkipMessage = state.mSkipMessage;
+                return result;
+            }
+
+            if (state.mElapsedNanosecond >= minNanosecond || iterationNum >= iterationNumMax)
+            {
+                break;
+            }
+
+            // NOTE: Overshoot the estimate a bit so that it usually
+            // takes only one more run, but grow at most ten times to avoid
+            // running forever after a noisy short run.
+            auto multiplier = state.mElapsedNanosecond > 0 ? minNanosecond * 1.4 / state.mElapsedNanosecond : 10.0;
+            multiplier = std::min(std::max(multiplier, 2.0), 10.0);
+            iterationNum = std::min(int64_t(std::ceil(double(iterationNum) * multiplier)), iterationNumMax);
+        }
+    }
+
+    result.mIterationNum = iterationNum;
+
+    uint64_t allocationNum = 0;
+    for (int repetitionIndex = 0; repetitionIndex < option.mRepetitionNum; ++repetitionIndex)
+    {
+        auto state = RunOnce(benchmark, iterationNum);
+        if (!state.mSkipMessage.empty())
+        {
+            result.mSkipMessage = state.mSkipMessage;
+            return result;
+        }
+
+        result.mNanosecondList.push_back(state.mElapsedNanosecond / double(iterationNum));
+        result.mItemNum = state.mItemNum;
+        result.mCounterTable = state.mCounterTable;
+        allocationNum += state.mAllocationNum;
+    }
+
+    result.mAllocationNum = double(allocationNum) / (double(iterationNum) * option.mRepetitionNum);
+    return result;
+}
+
+class BenchmarkStatistics
+{
+public:
+    double mMin;
+    double mMedian;
+    double mMean;
+    double mStddev;
+};
+
+static BenchmarkStatistics
+GetStatistics(std::vector<double> valueList)
+{
+    BenchmarkStatistics statistics = { 0, 0, 0, 0 };
+    if (valueList.empty())
+    {
+        return statistics;
+    }
+
+    std::sort(valueList.begin(), valueList.end());
+
+    auto valueNum = valueList.size();
+    statistics.mMin = valueList.front();
+    statistics.mMedian = valueNum % 2 == 1 ? valueList[valueNum / 2]
+                         : (valueList[valueNum / 2 - 1] + valueList[valueNum / 2]) * 0.5;
+
+    for (auto value : valueList)
+    {
+        statistics.mMean += value;
+    }
+
+    statistics.mMean /= double(valueNum);
+
+    for (auto value : valueList)
+    {
+        statistics.mStddev += (value - statistics.mMean) * (value - statistics.mMean);
+    }
+
+    statistics.mStddev = valueNum > 1 ? std::sqrt(statistics.mStddev / double(valueNum - 1)) : 0.0;
+    return statistics;
+}
+
+/************************************************************************/
+/* Output                                                               */
+/************************************************************************/
+static std::string
+EscapeJson(const std::string& text)
+{
+    std::string textEscaped;
+    for (auto c : text)
+    {
+        switch (c)
+        {
+        case '"':
+            textEscaped += "\\\"";
+            break;
+        case '\\':
+            textEscaped += "\\\\";
+            break;
+        case '\n':
+            textEscaped += "\\n";
+            break;
+        case '\t':
+            textEscaped += "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20)
+            {
+                char code[8];
+                snprintf(code, sizeof(code), "\\u%04x", c);
+                textEscaped += code;
+            }
+            else
+            {
+                textEscaped += c;
+            }
+        }
+    }
+
+    return textEscaped;
+}
+
+static std::string
+GetJsonNumber(double value)
+{
+    if (!std::isfinite(value))
+    {
+        return "null";
+    }
+
+    char number[32];
+    snprintf(number, sizeof(number), "%.6g", value);
+    return number;
+}
+
+static void
+OutputTable(const BenchmarkResult& result)
+{
+    if (!result.mSkipMessage.empty())
+    {
+        printf("%-48s skipped: %s\n", result.mName.c_str(), result.mSkipMessage.c_str());
+        return;
+    }
+
+    auto statistics = GetStatistics(result.mNanosecondList);
+    printf("%-48s %14.1f %10.1f%% %12lld %10.2f", result.mName.c_str(), statistics.mMedian,
+           statistics.mMean > 0 ? statistics.mStddev / statistics.mMean * 100.0 : 0.0,
+           (long long)(result.mIterationNum), result.mAllocationNum);
+
+    if (result.mItemNum > 0 && statistics.mMedian > 0)
+    {
+        printf(" %12.3g items/s", double(result.mItemNum) * 1e9 / statistics.mMedian);
+    }
+
+    printf("\n");
+}
+
+static void
+OutputJson(std::ostream& stream, const std::vector<BenchmarkResult>& resultList, const BenchmarkOption& option)
+{
+    char date[32];
+    auto time = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&time));
+
+#if defined(NDEBUG)
+    const char *build = "release";
+#else
+    const char *build = "debug";
+#endif
+
+    stream << "{\n";
+    stream << "  \"context\": {\n";
+    stream << "    \"date\": \"" << date << "\",\n";
+    stream << "    \"label\": \"" << EscapeJson(option.mLabel) << "\",\n";
+    stream << "    \"build\": \"" << build << "\",\n";
+    stream << "    \"min_time_ms\": " << GetJsonNumber(option.mMinMillisecond) << ",\n";
+    stream << "    \"repetitions\": " << option.mRepetitionNum << "\n";
+    stream << "  },\n";
+    stream << "  \"benchmarks\": [";
+
+    for (size_t resultIndex = 0; resultIndex < resultList.size(); ++resultIndex)
+    {
+        const auto& result = resultList[resultIndex];
+
+        stream << (resultIndex == 0 ? "\n" : ",\n");
+        stream << "    {\n";
+        stream << "      \"name\": \"" << EscapeJson(result.mName) << "\",\n";
+
+        if (!result.mSkipMessage.empty())
+        {
+            stream << "      \"skipped\": \"" << EscapeJson(result.mSkipMessage) << "\"\n";
+            stream << "    }";
+            continue;
+        }
+
+        auto statistics = GetStatistics(result.mNanosecondList);
+        stream << "      \"iterations\": " << result.mIterationNum << ",\n";
+        stream << "      \"time_unit\": \"ns\",\n";
+        stream << "      \"time_min\": " << GetJsonNumber(statistics.mMin) << ",\n";
+        stream << "      \"time_median\": " << GetJsonNumber(statistics.mMedian) << ",\n";
+        stream << "      \"time_mean\": " << GetJsonNumber(statistics.mMean) << ",\n";
+        stream << "      \"time_stddev\": " << GetJsonNumber(statistics.mStddev) << ",\n";
+        stream << "      \"time_list\": [";
+        for (size_t timeIndex = 0; timeIndex < result.mNanosecondList.size(); ++timeIndex)
+        {
+            stream << (timeIndex == 0 ? "" : ", ") << GetJsonNumber(result.mNanosecondList[timeIndex]);
+        }
+        stream << "],\n";
+
+        if (result.mItemNum > 0 && statistics.mMedian > 0)
+        {
+            stream << "      \"items_per_second\": " << GetJsonNumber(double(result.mItemNum) * 1e9 / statistics.mMedian) << ",\n";
+        }
+
+        stream << "      \"allocations_per_iteration\": " << GetJsonNumber(result.mAllocationNum);
+        if (!result.mCounterTable.empty())
+        {
+            stream << ",\n      \"counters\": {";
+            bool counterFirst = true;
+            for (const auto& counterPair : result.mCounterTable)
+            {
+                stream << (counterFirst ? "\n" : ",\n");
+                stream << "        \"" << EscapeJson(counterPair.first) << "\": " << GetJsonNumber(counterPair.second);
+                counterFirst = false;
+            }
+            stream << "\n      }";
+        }
+
+        stream << "\n    }";
+    }
+
+    stream << "\n  ]\n";
+    stream << "}\n";
+}
+
+static bool
+ParseOption(int argc, char **argv, BenchmarkOption& option)
+{
+    for (int argIndex = 1; argIndex < argc; ++argIndex)
+    {
+        std::string arg = argv[argIndex];
+        auto GetValue = [&arg](const char *prefix, std::string& value)
+        {
+            auto prefixLength = strlen(prefix);
+            if (arg.compare(0, prefixLength, prefix) == 0)
+            {
+                value = arg.substr(prefixLength);
+                return true;
+            }
+
+            return false;
+        };
+
+        std::string value;
+        if (GetValue("--filter=", value))
+        {
+            option.mFilter = value;
+        }
+        else if (GetValue("--output=", value))
+        {
+            option.mOutputPath = value;
+        }
+        else if (GetValue("--label=", value))
+        {
+            option.mLabel = value;
+        }
+        else if (GetValue("--min-time=", value))
+        {
+            option.mMinMillisecond = std::max(atof(value.c_str()), 1.0);
+        }
+        else if (GetValue("--repetition=", value))
+        {
+            option.mRepetitionNum = std::max(atoi(value.c_str()), 1);
+        }
+        else if (arg == "--list")
+        {
+            option.mListed = true;
+        }
+        else
+        {
+            fprintf(stderr, "Unknown option: %s\n", arg.c_str());
+            fprintf(stderr, "Usage: %s [--filter=<substring>] [--output=<json path>] [--label=<commit>] "
+                    "[--min-time=<ms>] [--repetition=<num>] [--list]\n", argv[0]);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int
+main(int argc, char **argv)
+{
+    BenchmarkOption option;
+    if (!ParseOption(argc, argv, option))
+    {
+        return 1;
+    }
+
+    auto benchmarkList = BenchmarkRegistry::GetInstance()->GetBenchmarkList();
+    std::sort(benchmarkList.begin(), benchmarkList.end(), [](const Benchmark & lhs, const Benchmark & rhs)
+    {
+        return lhs.mName < rhs.mName;
+    });
+
+    if (option.mListed)
+    {
+        for (const auto& benchmark : benchmarkList)
+        {
+            printf("%s\n", benchmark.mName.c_str());
+        }
+
+        return 0;
+    }
+
+    printf("%-48s %14s %11s %12s %10s\n", "Benchmark", "Median ns/op", "Stddev", "Iterations", "Alloc/op");
+
+    std::vector<BenchmarkResult> resultList;
+    for (const auto& benchmark : benchmarkList)
+    {
+        if (!option.mFilter.empty() && benchmark.mName.find(option.mFilter) == std::string::npos)
+        {
+            continue;
+        }
+
+        resultList.push_back(Run(benchmark, option));
+        OutputTable(resultList.back());
+    }
+
+    std::ofstream outputStream(option.mOutputPath.c_str());
+    if (!outputStream)
+    {
+        fprintf(stderr, "Failed to open %s.\n", option.mOutputPath.c_str());
+        return 1;
+    }
+
+    OutputJson(outputStream, resultList, option);
+    printf("Result is written to %s.\n", option.mOutputPath.c_str());
+
+    return 0;
+}
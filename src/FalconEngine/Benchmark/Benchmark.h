@@ -0,0 +1,156 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace FalconEngine
+{
+
+using BenchmarkClock = std::chrono::high_resolution_clock;
+
+// NOTE: Storing the address into the volatile pointer on MSVC, or
+// passing the value into the empty assembly on other compilers, forces the
+// value to be computed, so that the benchmarked work is not optimized away.
+extern const void *volatile gBenchmarkSink;
+
+template <typename T>
+inline void
+BenchmarkDoNotOptimize(const T& value)
+{
+#if defined(_MSC_VER)
+    gBenchmarkSink = &value;
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+
+// @summary State of one run of the benchmark, which times the loop of the
+// given iteration number.
+//
+// @remark Setup before the first KeepRunning call and cleanup after the last
+// are not timed. The allocation through global operator new is counted only
+// while timing.
+class BenchmarkState
+{
+public:
+    explicit BenchmarkState(int64_t iterationNum);
+
+public:
+    // @return Whether the timed loop should run another iteration.
+    bool
+    KeepRunning();
+
+    void
+    PauseTiming();
+
+    void
+    ResumeTiming();
+
+    int64_t
+    GetIterationNum() const;
+
+    // @summary Set the number of items processed in each iteration, so that
+    // the throughput is reported.
+    void
+    SetItemNum(int64_t itemNum);
+
+    // @summary Report the value along with the timing, the last value of all
+    // the runs is kept.
+    void
+    SetCounter(const std::string& name, double value);
+
+    // @summary Skip the benchmark, when the environment couldn't run it.
+    void
+    Skip(const std::string& message);
+
+public:
+    int64_t                       mIterationNum;
+    int64_t                       mIterationIndex;
+    int64_t                       mItemNum;
+    std::map<std::string, double> mCounterTable;
+    std::string                   mSkipMessage;
+
+    double                        mElapsedNanosecond;                           // Timed duration of the whole loop.
+    uint64_t                      mAllocationNum;                               // Allocation number of the whole loop.
+
+private:
+    bool                          mTiming;
+    BenchmarkClock::time_point    mTimingBegun;
+    uint64_t                      mAllocationBegun;
+};
+
+using BenchmarkFunction = std::function<void(BenchmarkState&)>;
+
+class Benchmark
+{
+public:
+    std::string       mName;
+    BenchmarkFunction mFunction;
+    int64_t           mIterationNum;                                            // Fixed iteration number, zero to calibrate by time.
+};
+
+// @summary Benchmarks registered by the static initializer of each source file.
+class BenchmarkRegistry
+{
+public:
+    static BenchmarkRegistry *
+    GetInstance()
+    {
+        static BenchmarkRegistry sInstance;
+        return &sInstance;
+    }
+
+public:
+    void
+    Register(const std::string& name, BenchmarkFunction function, int64_t iterationNum = 0);
+
+    const std::vector<Benchmark>&
+    GetBenchmarkList() const;
+
+private:
+    std::vector<Benchmark> mBenchmarkList;
+};
+
+class BenchmarkRegistration
+{
+public:
+    BenchmarkRegistration(const std::string& name, BenchmarkFunction function, int64_t iterationNum = 0)
+    {
+        BenchmarkRegistry::GetInstance()->Register(name, function, iterationNum);
+    }
+};
+
+// @summary Create the hidden window and its rendering context, which is used
+// by the benchmarks of the content and renderer.
+//
+// @return Whether the context is created. The context is only created once.
+bool
+BenchmarkInitializeGraphics();
+
+// @return Whether the file exists relative to the working directory.
+bool
+BenchmarkFileExists(const std::string& filePath);
+
+}
+
+// @summary Define the benchmark function and register it with the name.
+#define FALCON_ENGINE_BENCHMARK(function, name) \
+    static void function(FalconEngine::BenchmarkState& state); \
+    static FalconEngine::BenchmarkRegistration function##Registration(name, function); \
+    static void function(FalconEngine::BenchmarkState& state)
+
+// @summary Define the benchmark function run with fixed iteration number, used
+// when each iteration is too long to be calibrated by time.
+#define FALCON_ENGINE_BENCHMARK_FIXED(function, name, iterationNum) \
+    static void function(FalconEngine::BenchmarkState& state); \
+    static FalconEngine::BenchmarkRegistration function##Registration(name, function, iterationNum); \
+    static void function(FalconEngine::BenchmarkState& state)
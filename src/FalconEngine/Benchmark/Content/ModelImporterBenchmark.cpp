@@ -0,0 +1,51 @@
+#include <FalconEngine/Benchmark/Benchmark.h>
+
+#include <memory>
+#include <string>
+
+#include <FalconEngine/Content/ModelImporter.h>
+#include <FalconEngine/Core/Path.h>
+
+// @summary Measure the model import, which parses the file and creates the
+// buffers of each mesh. The texture is cached by the asset manager, so that
+// only the first import loads it.
+
+using namespace FalconEngine;
+
+static void
+BenchmarkImport(BenchmarkState& state, const std::string& modelFilePath)
+{
+    if (!BenchmarkInitializeGraphics())
+    {
+        state.Skip("Rendering context could not be created.");
+        return;
+    }
+
+    if (!BenchmarkFileExists(modelFilePath))
+    {
+        state.Skip("Model '" + modelFilePath + "' was not found.");
+        return;
+    }
+
+    auto modelImportOption = ModelImportOption::GetDefault();
+    while (state.KeepRunning())
+    {
+        auto model = std::make_shared<Model>(AssetSource::Normal, GetFileStem(modelFilePath), modelFilePath);
+        ModelImporter::Import(model.get(), modelFilePath, modelImportOption);
+
+        // NOTE: The release of the buffers is not part of the import.
+        state.PauseTiming();
+        model.reset();
+        state.ResumeTiming();
+    }
+}
+
+FALCON_ENGINE_BENCHMARK_FIXED(ModelImporterBox, "Content/ModelImporter/Box", 50)
+{
+    BenchmarkImport(state, "Content/Model/Engine/Box.dae");
+}
+
+FALCON_ENGINE_BENCHMARK_FIXED(ModelImporterBedroom, "Content/ModelImporter/Bedroom", 5)
+{
+    BenchmarkImport(state, "Content/Model/Bedroom.dae");
+}
@@ -0,0 +1,243 @@
+#include <FalconEngine/Benchmark/Benchmark.h>
+
+#include <functional>
+#include <list>
+#include <string>
+#include <vector>
+
+#include <FalconEngine/Core/EventHandler.h>
+
+using namespace FalconEngine;
+
+// @summary Compare event handler against the previous std::list and
+// std::function based implementation, in the pattern the scene graph uses it:
+// every node owns two handlers which are invoked every update, most of which
+// have no subscriber.
+
+/************************************************************************/
+/* Legacy Implementation                                                */
+/************************************************************************/
+namespace Legacy
+{
+
+template <typename T>
+using EventBinder = std::function<void(void *, T)>;
+
+template <typename T>
+class EventCallback
+{
+public:
+    EventCallback() = default;
+
+    EventCallback(const EventBinder<T> binder) :
+        mBinder(binder)
+    {
+    }
+
+public:
+    EventBinder<T> mBinder;
+};
+
+template <typename T>
+class EventHandler
+{
+public:
+    void
+    operator += (EventCallback<T> *callback)
+    {
+        mCallbackList.emplace_front(callback);
+    }
+
+    void
+    operator -= (EventCallback<T> *callback)
+    {
+        mCallbackList.remove(callback);
+    }
+
+    void
+    Invoke(void *sender, T data)
+    {
+        for (auto callback : mCallbackList)
+        {
+            callback->mBinder(sender, data);
+        }
+    }
+
+private:
+    std::list<EventCallback<T>*> mCallbackList;
+};
+
+}
+
+/************************************************************************/
+/* Benchmark                                                            */
+/************************************************************************/
+class BenchmarkEntity
+{
+public:
+    void
+    UpdateLocalTransform(bool initiator)
+    {
+        mCounter += initiator ? 1 : 2;
+    }
+
+public:
+    int64_t mCounter = 0;
+};
+
+// NOTE: Entity used to subscribe with std::bind, which doesn't fit in
+// the small buffer of std::function, so both the way it used to subscribe and
+// the lambda it subscribes with now are measured.
+enum class BenchmarkBinding
+{
+    Bind,
+    Lambda,
+};
+
+template <typename Binder>
+static Binder
+CreateBinder(BenchmarkEntity *entity, BenchmarkBinding binding)
+{
+    using namespace std::placeholders;
+
+    if (binding == BenchmarkBinding::Bind)
+    {
+        return Binder(std::bind(&BenchmarkEntity::UpdateLocalTransform, entity, _2));
+    }
+
+    return Binder([entity](void * /* sender */, bool initiator)
+    {
+        entity->UpdateLocalTransform(initiator);
+    });
+}
+
+static const int sNodeNum = 100000;
+
+// @summary Each node has begun and ended handler like Node.
+template <template <typename> class Handler, template <typename> class Callback, typename Binder>
+class EventHandlerScene
+{
+public:
+    EventHandlerScene() :
+        mHandlerList(size_t(sNodeNum) * 2),
+        mEntityList(sNodeNum),
+        mCallbackList(size_t(sNodeNum) * 2)
+    {
+    }
+
+public:
+    // @param subscribedRatio - one in given number of nodes has a subscriber.
+    int
+    Subscribe(int subscribedRatio, BenchmarkBinding binding)
+    {
+        int subscribedNum = 0;
+        for (int nodeIndex = 0; nodeIndex < sNodeNum; nodeIndex += subscribedRatio)
+        {
+            auto entity = &mEntityList[nodeIndex];
+            for (int handlerIndex = nodeIndex * 2; handlerIndex < nodeIndex * 2 + 2; ++handlerIndex)
+            {
+                mCallbackList[handlerIndex] = CreateBinder<Binder>(entity, binding);
+                mHandlerList[handlerIndex] += &mCallbackList[handlerIndex];
+                ++subscribedNum;
+            }
+        }
+
+        return subscribedNum;
+    }
+
+    void
+    Unsubscribe()
+    {
+        for (size_t handlerIndex = 0; handlerIndex < mHandlerList.size(); ++handlerIndex)
+        {
+            mHandlerList[handlerIndex] -= &mCallbackList[handlerIndex];
+        }
+    }
+
+public:
+    std::vector<Handler<bool>>   mHandlerList;
+    std::vector<BenchmarkEntity> mEntityList;
+    std::vector<Callback<bool>>  mCallbackList;
+};
+
+template <template <typename> class Handler, template <typename> class Callback, typename Binder>
+static void
+BenchmarkSubscribe(BenchmarkState& state, int subscribedRatio, BenchmarkBinding binding)
+{
+    EventHandlerScene<Handler, Callback, Binder> scene;
+
+    int subscribedNum = 0;
+    while (state.KeepRunning())
+    {
+        subscribedNum = scene.Subscribe(subscribedRatio, binding);
+
+        state.PauseTiming();
+        scene.Unsubscribe();
+        state.ResumeTiming();
+    }
+
+    state.SetItemNum(subscribedNum);
+}
+
+template <template <typename> class Handler, template <typename> class Callback, typename Binder>
+static void
+BenchmarkInvoke(BenchmarkState& state, int subscribedRatio, BenchmarkBinding binding)
+{
+    EventHandlerScene<Handler, Callback, Binder> scene;
+    scene.Subscribe(subscribedRatio, binding);
+
+    while (state.KeepRunning())
+    {
+        for (auto& handler : scene.mHandlerList)
+        {
+            handler.Invoke(&handler, false);
+        }
+    }
+
+    int64_t checksum = 0;
+    for (auto& entity : scene.mEntityList)
+    {
+        checksum += entity.mCounter;
+    }
+
+    BenchmarkDoNotOptimize(checksum);
+
+    scene.Unsubscribe();
+
+    state.SetItemNum(int64_t(scene.mHandlerList.size()));
+}
+
+static bool
+RegisterEventHandlerBenchmark()
+{
+    auto benchmarkRegistry = BenchmarkRegistry::GetInstance();
+
+    for (int subscribedRatio : { 1, 4, 1000000 })
+    {
+        for (auto binding : { BenchmarkBinding::Bind, BenchmarkBinding::Lambda })
+        {
+            auto suffix = std::string(binding == BenchmarkBinding::Bind ? "Bind" : "Lambda") + "/1:" + std::to_string(subscribedRatio);
+
+            benchmarkRegistry->Register("Core/EventHandler/Subscribe/Legacy/" + suffix, [ = ](BenchmarkState & state)
+            {
+                BenchmarkSubscribe<Legacy::EventHandler, Legacy::EventCallback, Legacy::EventBinder<bool>>(state, subscribedRatio, binding);
+            });
+            benchmarkRegistry->Register("Core/EventHandler/Subscribe/Current/" + suffix, [ = ](BenchmarkState & state)
+            {
+                BenchmarkSubscribe<FalconEngine::EventHandler, FalconEngine::EventCallback, FalconEngine::EventBinder<bool>>(state, subscribedRatio, binding);
+            });
+            benchmarkRegistry->Register("Core/EventHandler/Invoke/Legacy/" + suffix, [ = ](BenchmarkState & state)
+            {
+                BenchmarkInvoke<Legacy::EventHandler, Legacy::EventCallback, Legacy::EventBinder<bool>>(state, subscribedRatio, binding);
+            });
+            benchmarkRegistry->Register("Core/EventHandler/Invoke/Current/" + suffix, [ = ](BenchmarkState & state)
+            {
+                BenchmarkInvoke<FalconEngine::EventHandler, FalconEngine::EventCallback, FalconEngine::EventBinder<bool>>(state, subscribedRatio, binding);
+            });
+        }
+    }
+
+    return true;
+}
+
+static bool sEventHandlerBenchmarkRegistered = RegisterEventHandlerBenchmark();
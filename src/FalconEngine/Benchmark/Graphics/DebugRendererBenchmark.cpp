@@ -0,0 +1,209 @@
+#include <FalconEngine/Benchmark/Benchmark.h>
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <FalconEngine/Context/GameEngineGraphics.h>
+#include <FalconEngine/Core/FrameAllocator.h>
+#include <FalconEngine/Graphics/Renderer/Camera.h>
+#include <FalconEngine/Graphics/Renderer/Debug/DebugRenderer.h>
+#include <FalconEngine/Math/Color.h>
+#include <FalconEngine/Math/Coordinate.h>
+#include <FalconEngine/Math/Handedness.h>
+
+// @summary Measure the recording of the debug messages from several threads,
+// and the whole frame with the debug shapes recorded every frame, which are
+// drawn as instances of the unit mesh.
+
+using namespace FalconEngine;
+
+static const int sShapeGridSize = 10;
+static const int sRecordThreadNum = 4;
+static const int sRecordLineNum = 10000;
+
+// @summary Record the lines from the worker threads without any rendering
+// context, then merge them on the calling thread as the game thread does. The
+// worker threads persist across the iterations like the job threads, so that
+// each thread keeps recording into the same buffer.
+FALCON_ENGINE_BENCHMARK_FIXED(DebugRendererRecordThread, "Graphics/DebugRenderer/Record/Thread", 50)
+{
+    auto debugRenderer = DebugRenderer::GetInstance();
+
+    std::mutex              workMutex;
+    std::condition_variable workCondition;
+    uint64_t                workFrame = 0;
+    int                     workDoneNum = 0;
+    bool                    workExit = false;
+
+    std::vector<std::thread> threadList;
+    for (int threadIndex = 0; threadIndex < sRecordThreadNum; ++threadIndex)
+    {
+        threadList.emplace_back([&, threadIndex]()
+        {
+            uint64_t frame = 0;
+            for (;;)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(workMutex);
+                    workCondition.wait(lock, [&]()
+                    {
+                        return workExit || workFrame != frame;
+                    });
+
+                    if (workExit)
+                    {
+                        return;
+                    }
+
+                    frame = workFrame;
+                }
+
+                for (int lineIndex = 0; lineIndex < sRecordLineNum; ++lineIndex)
+                {
+                    auto from = Vector3f(float(threadIndex), float(lineIndex), 0.0f);
+                    debugRenderer->AddLine(nullptr, from, from + Vector3f::UnitZ, ColorPalette::White);
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock(workMutex);
+                    ++workDoneNum;
+                }
+
+                workCondition.notify_all();
+            }
+        });
+    }
+
+    while (state.KeepRunning())
+    {
+        {
+            std::lock_guard<std::mutex> lock(workMutex);
+            ++workFrame;
+            workDoneNum = 0;
+        }
+
+        workCondition.notify_all();
+
+        {
+            std::unique_lock<std::mutex> lock(workMutex);
+            workCondition.wait(lock, [&]()
+            {
+                return workDoneNum == sRecordThreadNum;
+            });
+        }
+
+        debugRenderer->UpdateFrame(0.0);
+        debugRenderer->Handoff();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(workMutex);
+        workExit = true;
+    }
+
+    workCondition.notify_all();
+    for (auto& thread : threadList)
+    {
+        thread.join();
+    }
+
+    state.SetItemNum(sRecordThreadNum * sRecordLineNum);
+}
+
+static std::shared_ptr<Camera>
+CreateDebugCamera(BenchmarkState& state)
+{
+    if (!BenchmarkInitializeGraphics())
+    {
+        state.Skip("Rendering context could not be created.");
+        return nullptr;
+    }
+
+    auto camera = std::make_shared<Camera>(Coordinate::GetStandard(), HandednessRight::GetInstance(), 1.0f, 16.0f / 9.0f);
+    camera->SetPosition(Vector3f(0.0f, 10.0f, 20.0f));
+    DebugRenderer::GetInstance()->AddCamera(camera.get());
+    return camera;
+}
+
+template <typename F>
+static void
+RenderDebugFrame(BenchmarkState& state, const Camera *camera, F addShape)
+{
+    auto graphics = GameEngineGraphics::GetInstance();
+    while (state.KeepRunning())
+    {
+        FrameAllocator::BeginFrame();
+
+        for (int x = 0; x < sShapeGridSize; ++x)
+        {
+            for (int z = 0; z < sShapeGridSize; ++z)
+            {
+                addShape(camera, Vector3f(3.0f * (x - sShapeGridSize / 2), 0.0f, -3.0f * z));
+            }
+        }
+
+        graphics->UpdateFrame(0.0);
+
+        graphics->RenderBegin();
+        graphics->ClearFrameBuffer(ColorPalette::Black, 1.0f, 0);
+        graphics->Render(0.0);
+        graphics->RenderEnd();
+    }
+
+    state.SetCounter("render_ms", graphics->GetLastRenderElapsedMillisecond());
+    state.SetItemNum(sShapeGridSize * sShapeGridSize);
+}
+
+FALCON_ENGINE_BENCHMARK(DebugRendererSphere, "Graphics/DebugRenderer/Sphere")
+{
+    auto camera = CreateDebugCamera(state);
+    if (camera == nullptr)
+    {
+        return;
+    }
+
+    auto debugRenderer = DebugRenderer::GetInstance();
+    RenderDebugFrame(state, camera.get(), [debugRenderer](const Camera *debugCamera, const Vector3f& center)
+    {
+        debugRenderer->AddSphere(debugCamera, center, 1.0f, ColorPalette::Red);
+    });
+
+    debugRenderer->RemoveCamera(camera.get());
+}
+
+FALCON_ENGINE_BENCHMARK(DebugRendererCapsule, "Graphics/DebugRenderer/Capsule")
+{
+    auto camera = CreateDebugCamera(state);
+    if (camera == nullptr)
+    {
+        return;
+    }
+
+    auto debugRenderer = DebugRenderer::GetInstance();
+    RenderDebugFrame(state, camera.get(), [debugRenderer](const Camera *debugCamera, const Vector3f& center)
+    {
+        debugRenderer->AddCapsule(debugCamera, center, center + Vector3f(0.0f, 2.0f, 0.0f), 0.5f, ColorPalette::Green);
+    });
+
+    debugRenderer->RemoveCamera(camera.get());
+}
+
+FALCON_ENGINE_BENCHMARK(DebugRendererLine, "Graphics/DebugRenderer/Line")
+{
+    auto camera = CreateDebugCamera(state);
+    if (camera == nullptr)
+    {
+        return;
+    }
+
+    auto debugRenderer = DebugRenderer::GetInstance();
+    RenderDebugFrame(state, camera.get(), [debugRenderer](const Camera *debugCamera, const Vector3f& center)
+    {
+        debugRenderer->AddLine(debugCamera, center, center + Vector3f(0.0f, 2.0f, 0.0f), ColorPalette::Blue);
+    });
+
+    debugRenderer->RemoveCamera(camera.get());
+}
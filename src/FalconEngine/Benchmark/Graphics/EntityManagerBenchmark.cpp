@@ -0,0 +1,236 @@
+#include <FalconEngine/Benchmark/Benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <FalconEngine/Graphics/Renderer/Entity/EntityManager.h>
+
+// @summary Measure the entity manager with the entity number of an open world,
+// where the entities spread over several archetypes and only some of them
+// match the query.
+
+using namespace FalconEngine;
+
+class EntityBenchmarkPosition
+{
+public:
+    float mX, mY, mZ;
+};
+
+class EntityBenchmarkVelocity
+{
+public:
+    float mX, mY, mZ;
+};
+
+class EntityBenchmarkHealth
+{
+public:
+    int mValue;
+};
+
+class EntityBenchmarkTag
+{
+public:
+    int mValue;
+};
+
+static const int sEntityNum = 100000;
+
+// @summary Create the entities over four archetypes, half of which have both
+// position and velocity.
+static void
+CreateEntityList(EntityManager& entityManager, std::vector<EntityId>& entityList, int entityNum)
+{
+    for (int entityIndex = 0; entityIndex < entityNum; ++entityIndex)
+    {
+        auto entity = entityManager.CreateEntity();
+        entityManager.AddComponent<EntityBenchmarkPosition>(entity, EntityBenchmarkPosition{ float(entityIndex), 0.0f, 0.0f });
+
+        switch (entityIndex % 4)
+        {
+        case 0:
+            entityManager.AddComponent<EntityBenchmarkVelocity>(entity, EntityBenchmarkVelocity{ 1.0f, 0.0f, 0.0f });
+            break;
+        case 1:
+            entityManager.AddComponent<EntityBenchmarkVelocity>(entity, EntityBenchmarkVelocity{ 0.0f, 1.0f, 0.0f });
+            entityManager.AddComponent<EntityBenchmarkHealth>(entity, EntityBenchmarkHealth{ 100 });
+            break;
+        case 2:
+            entityManager.AddComponent<EntityBenchmarkHealth>(entity, EntityBenchmarkHealth{ 100 });
+            break;
+        default:
+            break;
+        }
+
+        entityList.push_back(entity);
+    }
+}
+
+class EntityFixture
+{
+public:
+    EntityFixture()
+    {
+        CreateEntityList(mEntityManager, mEntityList, sEntityNum);
+
+        mEntityShuffledList = mEntityList;
+        std::mt19937 generator(17);
+        std::shuffle(mEntityShuffledList.begin(), mEntityShuffledList.end(), generator);
+    }
+
+public:
+    EntityManager         mEntityManager;
+    std::vector<EntityId> mEntityList;
+    std::vector<EntityId> mEntityShuffledList;
+};
+
+static EntityFixture&
+GetEntityFixture()
+{
+    static EntityFixture sFixture;
+    return sFixture;
+}
+
+FALCON_ENGINE_BENCHMARK_FIXED(EntityManagerCreate, "Graphics/EntityManager/Create", 20)
+{
+    while (state.KeepRunning())
+    {
+        state.PauseTiming();
+        {
+            auto entityManager = std::make_unique<EntityManager>();
+            std::vector<EntityId> entityList;
+            entityList.reserve(sEntityNum);
+            state.ResumeTiming();
+
+            CreateEntityList(*entityManager, entityList, sEntityNum);
+
+            // NOTE: The release of the storage is not part of the
+            // creation.
+            state.PauseTiming();
+        }
+        state.ResumeTiming();
+    }
+
+    state.SetItemNum(sEntityNum);
+}
+
+FALCON_ENGINE_BENCHMARK_FIXED(EntityManagerDestroy, "Graphics/EntityManager/Destroy", 20)
+{
+    while (state.KeepRunning())
+    {
+        state.PauseTiming();
+        {
+            auto entityManager = std::make_unique<EntityManager>();
+            std::vector<EntityId> entityList;
+            CreateEntityList(*entityManager, entityList, sEntityNum);
+            state.ResumeTiming();
+
+            for (auto entity : entityList)
+            {
+                entityManager->DestroyEntity(entity);
+            }
+
+            state.PauseTiming();
+        }
+        state.ResumeTiming();
+    }
+
+    state.SetItemNum(sEntityNum);
+}
+
+// @summary Integrate the position of the entities with velocity through the
+// cached query, which iterates the matching archetypes linearly.
+FALCON_ENGINE_BENCHMARK(EntityManagerQuery, "Graphics/EntityManager/Query/Archetype")
+{
+    auto& fixture = GetEntityFixture();
+    auto& entityManager = fixture.mEntityManager;
+    auto query = entityManager.GetQuery<EntityBenchmarkPosition, EntityBenchmarkVelocity>();
+
+    while (state.KeepRunning())
+    {
+        query->ForEach<EntityBenchmarkPosition, EntityBenchmarkVelocity>(
+            [](EntityId /* entity */, EntityBenchmarkPosition& position, const EntityBenchmarkVelocity& velocity)
+        {
+            position.mX += velocity.mX * 0.016f;
+            position.mY += velocity.mY * 0.016f;
+            position.mZ += velocity.mZ * 0.016f;
+        });
+
+        BenchmarkDoNotOptimize(query);
+    }
+
+    state.SetItemNum(int64_t(query->GetEntityNum()));
+}
+
+// @summary Integrate the same entities by walking every entity and looking up
+// its components, which is what the game had to do without the query.
+FALCON_ENGINE_BENCHMARK(EntityManagerQueryLookup, "Graphics/EntityManager/Query/Lookup")
+{
+    auto& fixture = GetEntityFixture();
+    auto& entityManager = fixture.mEntityManager;
+
+    while (state.KeepRunning())
+    {
+        for (auto entity : fixture.mEntityList)
+        {
+            auto velocity = entityManager.GetComponent<EntityBenchmarkVelocity>(entity);
+            if (velocity == nullptr)
+            {
+                continue;
+            }
+
+            auto position = entityManager.GetComponent<EntityBenchmarkPosition>(entity);
+            if (position == nullptr)
+            {
+                continue;
+            }
+
+            position->mX += velocity->mX * 0.016f;
+            position->mY += velocity->mY * 0.016f;
+            position->mZ += velocity->mZ * 0.016f;
+        }
+
+        BenchmarkDoNotOptimize(fixture.mEntityList);
+    }
+
+    state.SetItemNum(int64_t(fixture.mEntityList.size()));
+}
+
+// @summary Look up the component of the entity in random order.
+FALCON_ENGINE_BENCHMARK(EntityManagerGetComponent, "Graphics/EntityManager/GetComponent")
+{
+    auto& fixture = GetEntityFixture();
+    auto& entityManager = fixture.mEntityManager;
+
+    size_t entityIndex = 0;
+    while (state.KeepRunning())
+    {
+        auto entity = fixture.mEntityShuffledList[entityIndex];
+        entityIndex = (entityIndex + 1) % fixture.mEntityShuffledList.size();
+
+        auto position = entityManager.GetComponent<EntityBenchmarkPosition>(entity);
+        BenchmarkDoNotOptimize(position);
+    }
+}
+
+// @summary Add and remove a component, which moves the entity to another
+// archetype and back.
+FALCON_ENGINE_BENCHMARK(EntityManagerAddRemove, "Graphics/EntityManager/AddRemove")
+{
+    auto& fixture = GetEntityFixture();
+    auto& entityManager = fixture.mEntityManager;
+
+    size_t entityIndex = 0;
+    while (state.KeepRunning())
+    {
+        auto entity = fixture.mEntityShuffledList[entityIndex];
+        entityIndex = (entityIndex + 1) % fixture.mEntityShuffledList.size();
+
+        entityManager.AddComponent<EntityBenchmarkTag>(entity, EntityBenchmarkTag{ 1 });
+        entityManager.RemoveComponent<EntityBenchmarkTag>(entity);
+    }
+}
@@ -0,0 +1,214 @@
+#include <FalconEngine/Benchmark/Benchmark.h>
+
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <FalconEngine/Content/AssetManager.h>
+#include <FalconEngine/Graphics/Effect/FontEffect.h>
+#include <FalconEngine/Graphics/Renderer/Font/Font.h>
+#include <FalconEngine/Graphics/Renderer/Font/FontAtlas.h>
+#include <FalconEngine/Graphics/Renderer/Font/FontGlyphMap.h>
+#include <FalconEngine/Graphics/Renderer/Font/FontRendererHelper.h>
+#include <FalconEngine/Graphics/Renderer/Resource/BufferAdaptor.h>
+#include <FalconEngine/Graphics/Renderer/Resource/VertexBuffer.h>
+#include <FalconEngine/Math/Color.h>
+
+// @summary Measure the text layout the font renderer does for every text in
+// each frame, over a paragraph of the size of the debug overlay.
+
+using namespace FalconEngine;
+
+static const char *sFontFilePath = "Content/Font/LuciadaConsoleDistanceField.fnt.bin";
+static const char *sFontDynamicFilePath = "Content/Font/LucidaConsole.ttf";
+
+static std::wstring
+CreateParagraph()
+{
+    std::wstring paragraph;
+    for (int lineIndex = 0; lineIndex < 16; ++lineIndex)
+    {
+        paragraph += L"The quick brown fox jumps over the lazy dog. 0123456789 (x, y, z) = [1.00, 2.00, 3.00]\n";
+    }
+
+    return paragraph;
+}
+
+static const Font *
+LoadFont(BenchmarkState& state)
+{
+    if (!BenchmarkFileExists(sFontFilePath))
+    {
+        state.Skip(std::string("Font '") + sFontFilePath + "' was not found.");
+        return nullptr;
+    }
+
+    return AssetManager::GetInstance()->LoadFont(sFontFilePath).get();
+}
+
+FALCON_ENGINE_BENCHMARK(FontLayout, "Graphics/Font/Layout")
+{
+    auto font = LoadFont(state);
+    if (font == nullptr)
+    {
+        return;
+    }
+
+    auto text = FontText(16.0f, CreateParagraph(), Vector4f(0.0f, 0.0f, 1600.0f, 900.0f));
+
+    std::vector<FontLine> textLineList;
+    int glyphNum = 0;
+    while (state.KeepRunning())
+    {
+        textLineList.clear();
+        glyphNum = FontRendererHelper::CreateTextLineList(font, text, textLineList);
+    }
+
+    state.SetItemNum(glyphNum);
+}
+
+// @summary Lay out the text and fill the vertices into the buffer in host
+// memory, which is the whole work done on the CPU for the text.
+FALCON_ENGINE_BENCHMARK(FontLayoutFill, "Graphics/Font/LayoutFill")
+{
+    auto font = LoadFont(state);
+    if (font == nullptr)
+    {
+        return;
+    }
+
+    auto text = FontText(16.0f, CreateParagraph(), Vector4f(0.0f, 0.0f, 1600.0f, 900.0f));
+
+    std::vector<FontLine> textLineList;
+    auto glyphNum = FontRendererHelper::CreateTextLineList(font, text, textLineList);
+
+    auto vertexBuffer = std::make_shared<VertexBuffer>(glyphNum * 6, sizeof(FontVertex), BufferStorageMode::Host, BufferUsage::Stream);
+    BufferAdaptor vertexBufferAdaptor(vertexBuffer);
+
+    while (state.KeepRunning())
+    {
+        textLineList.clear();
+        FontRendererHelper::CreateTextLineList(font, text, textLineList);
+
+        vertexBufferAdaptor.FillBegin();
+        FontRendererHelper::FillTextLineList(&vertexBufferAdaptor, vertexBuffer->GetData(), font, text.mFontSize,
+                                             Vector2f(text.mTextBounds.x, text.mTextBounds.y), ColorPalette::White, textLineList);
+        vertexBufferAdaptor.FillEnd();
+    }
+
+    state.SetItemNum(glyphNum);
+}
+
+// @summary Create the codepoint list of a large character set, which has the
+// ASCII and the CJK Unified Ideographs, looked up in the order of the glyphs.
+static std::vector<uint32_t>
+CreateCodepointList()
+{
+    std::vector<uint32_t> codepointList;
+    for (uint32_t codepoint = 0x20; codepoint < 0x7F; ++codepoint)
+    {
+        codepointList.push_back(codepoint);
+    }
+
+    for (uint32_t codepoint = 0x4E00; codepoint < 0xA000; ++codepoint)
+    {
+        codepointList.push_back(codepoint);
+    }
+
+    return codepointList;
+}
+
+// @summary Look up the glyph index in the dense table indexed by codepoint,
+// which could only cover the codepoints below U+A000.
+FALCON_ENGINE_BENCHMARK(FontGlyphLookupDense, "Graphics/Font/GlyphLookup/Dense")
+{
+    auto codepointList = CreateCodepointList();
+
+    std::vector<size_t> glyphIndexTable(0xA000, 0);
+    for (size_t glyphIndex = 0; glyphIndex < codepointList.size(); ++glyphIndex)
+    {
+        glyphIndexTable[codepointList[glyphIndex]] = glyphIndex + 1;
+    }
+
+    size_t glyphIndexSum = 0;
+    while (state.KeepRunning())
+    {
+        for (auto codepoint : codepointList)
+        {
+            glyphIndexSum += glyphIndexTable[codepoint];
+        }
+
+        BenchmarkDoNotOptimize(glyphIndexSum);
+    }
+
+    state.SetCounter("memory_bytes", double(glyphIndexTable.capacity() * sizeof(size_t)));
+    state.SetItemNum(int64_t(codepointList.size()));
+}
+
+// @summary Look up the glyph index in the glyph map, which covers the whole
+// Unicode range.
+FALCON_ENGINE_BENCHMARK(FontGlyphLookupSparse, "Graphics/Font/GlyphLookup/Sparse")
+{
+    auto codepointList = CreateCodepointList();
+
+    FontGlyphMap glyphMap;
+    for (size_t glyphIndex = 0; glyphIndex < codepointList.size(); ++glyphIndex)
+    {
+        glyphMap.Insert(codepointList[glyphIndex], uint32_t(glyphIndex + 1));
+    }
+
+    size_t glyphIndexSum = 0;
+    while (state.KeepRunning())
+    {
+        for (auto codepoint : codepointList)
+        {
+            glyphIndexSum += glyphMap.Find(codepoint);
+        }
+
+        BenchmarkDoNotOptimize(glyphIndexSum);
+    }
+
+    state.SetCounter("memory_bytes", double(glyphMap.GetMemorySize()));
+    state.SetItemNum(int64_t(codepointList.size()));
+}
+
+// @summary Rasterize the printable ASCII glyphs into a new atlas, which is the
+// cost the first frame pays for the text of the font loaded at runtime.
+FALCON_ENGINE_BENCHMARK_FIXED(FontDynamicRasterize, "Graphics/Font/Dynamic/Rasterize", 20)
+{
+    if (!BenchmarkFileExists(sFontDynamicFilePath))
+    {
+        state.Skip(std::string("Font '") + sFontDynamicFilePath + "' was not found.");
+        return;
+    }
+
+    std::vector<unsigned char> fontFileData;
+    {
+        std::ifstream fontFileStream(sFontDynamicFilePath, std::ios::binary);
+        fontFileData.assign(std::istreambuf_iterator<char>(fontFileStream), std::istreambuf_iterator<char>());
+    }
+
+    double glyphWidthSum = 0;
+    while (state.KeepRunning())
+    {
+        state.PauseTiming();
+        auto fontAtlas = std::make_unique<FontAtlas>(std::vector<unsigned char>(fontFileData));
+        state.ResumeTiming();
+
+        for (uint32_t codepoint = 0x20; codepoint < 0x7F; ++codepoint)
+        {
+            glyphWidthSum += fontAtlas->GetGlyph(codepoint).mWidth;
+        }
+
+        BenchmarkDoNotOptimize(glyphWidthSum);
+
+        state.PauseTiming();
+        fontAtlas.reset();
+        state.ResumeTiming();
+    }
+
+    state.SetItemNum(0x7F - 0x20);
+}
@@ -0,0 +1,135 @@
+#include <FalconEngine/Benchmark/Benchmark.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <FalconEngine/Content/AssetManager.h>
+#include <FalconEngine/Context/GameEngineGraphics.h>
+#include <FalconEngine/Core/FrameAllocator.h>
+#include <FalconEngine/Graphics/Effect/PaintEffect.h>
+#include <FalconEngine/Graphics/Renderer/Camera.h>
+#include <FalconEngine/Graphics/Renderer/Entity/Entity.h>
+#include <FalconEngine/Graphics/Renderer/Entity/EntityRenderer.h>
+#include <FalconEngine/Graphics/Renderer/Scene/Model.h>
+#include <FalconEngine/Graphics/Renderer/Scene/Node.h>
+#include <FalconEngine/Math/Color.h>
+#include <FalconEngine/Math/Coordinate.h>
+#include <FalconEngine/Math/Handedness.h>
+
+// @summary Measure the submission of the entities to the renderer, and the
+// whole frame rendered into the hidden window.
+
+using namespace FalconEngine;
+
+static const char *sBoxFilePath = "Content/Model/Engine/Box.dae";
+static const int   sGridSize = 32;
+
+class RendererScene
+{
+public:
+    std::shared_ptr<Camera>              mCamera;
+    std::shared_ptr<Node>                mNode;
+    std::vector<std::shared_ptr<Entity>> mEntityList;
+};
+
+// @return Whether the scene is created, otherwise the benchmark is skipped.
+static bool
+CreateScene(BenchmarkState& state, RendererScene& scene)
+{
+    if (!BenchmarkInitializeGraphics())
+    {
+        state.Skip("Rendering context could not be created.");
+        return false;
+    }
+
+    if (!BenchmarkFileExists(sBoxFilePath))
+    {
+        state.Skip(std::string("Model '") + sBoxFilePath + "' was not found.");
+        return false;
+    }
+
+    auto boxModel = AssetManager::GetInstance()->LoadModel(sBoxFilePath);
+
+    auto boxEffect = std::make_shared<PaintEffect>();
+    auto boxEffectParams = std::make_shared<PaintEffectParams>(ColorPalette::Red);
+
+    scene.mNode = CreateSpatial<Node>();
+    for (int x = 0; x < sGridSize; ++x)
+    {
+        for (int z = 0; z < sGridSize; ++z)
+        {
+            auto boxNode = ShareClone(boxModel->GetNode());
+            boxNode->mLocalTransform = Matrix4f::CreateTranslation(3.0f * (x - sGridSize / 2), 0.0f, -3.0f * z);
+            boxEffect->CreateInstance(boxNode.get(), boxEffectParams);
+            scene.mNode->AttachChild(boxNode);
+            scene.mEntityList.push_back(std::make_shared<Entity>(boxNode));
+        }
+    }
+
+    scene.mNode->Update(0.0, true);
+
+    scene.mCamera = std::make_shared<Camera>(Coordinate::GetStandard(), HandednessRight::GetInstance(), 1.0f, 16.0f / 9.0f);
+    scene.mCamera->SetPosition(Vector3f(0.0f, 10.0f, 20.0f));
+    return true;
+}
+
+// @summary Submit the entities and hand them off to the render side, which
+// collects and interpolates the visuals without issuing any command.
+FALCON_ENGINE_BENCHMARK(RendererSubmit, "Graphics/Renderer/Submit")
+{
+    RendererScene scene;
+    if (!CreateScene(state, scene))
+    {
+        return;
+    }
+
+    auto entityRenderer = EntityRenderer::GetInstance();
+    while (state.KeepRunning())
+    {
+        FrameAllocator::BeginFrame();
+
+        for (auto& entity : scene.mEntityList)
+        {
+            entityRenderer->Draw(scene.mCamera.get(), entity.get());
+        }
+
+        entityRenderer->Handoff(0.0);
+    }
+
+    state.SetItemNum(int64_t(scene.mEntityList.size()));
+}
+
+// @summary Submit the entities and render the whole frame, including the
+// buffer swap.
+FALCON_ENGINE_BENCHMARK(RendererFrame, "Graphics/Renderer/Frame")
+{
+    RendererScene scene;
+    if (!CreateScene(state, scene))
+    {
+        return;
+    }
+
+    auto graphics = GameEngineGraphics::GetInstance();
+    auto entityRenderer = EntityRenderer::GetInstance();
+    while (state.KeepRunning())
+    {
+        FrameAllocator::BeginFrame();
+
+        graphics->RenderBegin();
+        graphics->ClearFrameBuffer(ColorPalette::Black, 1.0f, 0);
+
+        for (auto& entity : scene.mEntityList)
+        {
+            entityRenderer->Draw(scene.mCamera.get(), entity.get());
+        }
+
+        graphics->Render(0.0);
+        graphics->RenderEnd();
+    }
+
+    state.SetCounter("render_ms", graphics->GetLastRenderElapsedMillisecond());
+    state.SetCounter("swap_ms", graphics->GetLastSwapElapsedMillisecond());
+    state.SetCounter("triangles", entityRenderer->GetFrameTriangleNum());
+    state.SetItemNum(int64_t(scene.mEntityList.size()));
+}
@@ -0,0 +1,340 @@
+#include <FalconEngine/Benchmark/Benchmark.h>
+
+#include <deque>
+#include <memory>
+#include <queue>
+#include <vector>
+
+#include <FalconEngine/Core/FrameAllocator.h>
+#include <FalconEngine/Graphics/Renderer/Scene/Node.h>
+#include <FalconEngine/Graphics/Renderer/Scene/Visual.h>
+#include <FalconEngine/Math/Matrix4.h>
+
+// @summary Measure the scene graph update over the tree of nodes the size of
+// the imported level, with and without the world transform invalidated. The
+// visual collection is measured over a deep hierarchy, with the dynamic cast
+// and level order queue it used to have, with the spatial type over the child
+// slots, and with the sibling links the entity renderer uses now. Building and
+// cloning the deep hierarchy are measured with the heap and the spatial pool.
+
+using namespace FalconEngine;
+
+static const int sTreeDepth = 4;
+static const int sTreeBranchNum = 8;
+
+static int
+CreateTree(Node *node, int depth)
+{
+    if (depth == 0)
+    {
+        return 1;
+    }
+
+    int nodeNum = 1;
+    for (int branchIndex = 0; branchIndex < sTreeBranchNum; ++branchIndex)
+    {
+        auto child = CreateSpatial<Node>();
+        child->mLocalTransform = Matrix4f::CreateTranslation(float(branchIndex), 0.0f, 1.0f) * Matrix4f::CreateRotationY(0.1f * branchIndex);
+        node->AttachChild(child);
+        nodeNum += CreateTree(child.get(), depth - 1);
+    }
+
+    return nodeNum;
+}
+
+// @summary Update the tree whose transforms are all current, which is the
+// cost paid by the static level in each frame.
+FALCON_ENGINE_BENCHMARK(SceneUpdateStatic, "Graphics/Scene/Update/Static")
+{
+    auto root = CreateSpatial<Node>();
+    auto nodeNum = CreateTree(root.get(), sTreeDepth);
+    root->Update(0.0, true);
+
+    while (state.KeepRunning())
+    {
+        root->Update(0.0, true);
+    }
+
+    state.SetItemNum(nodeNum);
+}
+
+// @summary Update the tree after the root is moved, so that every world
+// transform is recomputed.
+FALCON_ENGINE_BENCHMARK(SceneUpdateMoved, "Graphics/Scene/Update/Moved")
+{
+    auto root = CreateSpatial<Node>();
+    auto nodeNum = CreateTree(root.get(), sTreeDepth);
+    root->Update(0.0, true);
+
+    float rootPosition = 0.0f;
+    while (state.KeepRunning())
+    {
+        rootPosition += 0.01f;
+        root->mLocalTransform = Matrix4f::CreateTranslation(rootPosition, 0.0f, 0.0f);
+        root->mWorldTransformIsCurrent = false;
+        root->Update(0.0, true);
+    }
+
+    state.SetItemNum(nodeNum);
+}
+
+FALCON_ENGINE_BENCHMARK(SceneInterpolate, "Graphics/Scene/Interpolate")
+{
+    auto root = CreateSpatial<Node>();
+    auto nodeNum = CreateTree(root.get(), sTreeDepth);
+    root->Update(0.0, true);
+
+    root->mLocalTransform = Matrix4f::CreateTranslation(1.0f, 0.0f, 0.0f);
+    root->mWorldTransformIsCurrent = false;
+    root->Update(0.0, true);
+
+    while (state.KeepRunning())
+    {
+        root->Interpolate(0.5);
+    }
+
+    state.SetItemNum(nodeNum);
+}
+
+static const int sDeepTreeDepth = 12;
+static const int sDeepTreeBranchNum = 2;
+static const int sDeepTreeVisualNum = 2;
+
+// NOTE: The traversal doesn't touch the mesh, so the visual is created
+// without one.
+class SceneTraverseVisual : public Visual
+{
+public:
+    SceneTraverseVisual() :
+        Visual()
+    {
+    }
+};
+
+static int
+CreateDeepTree(Node *node, int depth)
+{
+    int visualNum = 0;
+    for (int visualIndex = 0; visualIndex < sDeepTreeVisualNum; ++visualIndex)
+    {
+        node->AttachChild(CreateSpatial<SceneTraverseVisual>());
+        ++visualNum;
+    }
+
+    if (depth == 0)
+    {
+        return visualNum;
+    }
+
+    for (int branchIndex = 0; branchIndex < sDeepTreeBranchNum; ++branchIndex)
+    {
+        auto child = CreateSpatial<Node>();
+        node->AttachChild(child);
+        visualNum += CreateDeepTree(child.get(), depth - 1);
+    }
+
+    return visualNum;
+}
+
+// @summary Collect the visuals as the entity renderer did before the spatial
+// type, kept here as the reference.
+FALCON_ENGINE_BENCHMARK(SceneTraverseDynamicCast, "Graphics/Scene/Traverse/DynamicCast")
+{
+    auto root = CreateSpatial<Node>();
+    auto visualNum = CreateDeepTree(root.get(), sDeepTreeDepth);
+
+    using NodeQueue = std::queue<const Node *, std::deque<const Node *, FrameStlAllocator<const Node *>>>;
+
+    std::vector<const Visual *> visualList;
+    while (state.KeepRunning())
+    {
+        FrameAllocator::BeginFrame();
+        visualList.clear();
+
+        NodeQueue nodeQueue;
+        nodeQueue.push(root.get());
+        while (!nodeQueue.empty())
+        {
+            auto node = nodeQueue.front();
+            nodeQueue.pop();
+
+            auto slotNum = node->GetChildrenSlotNum();
+            for (auto slotIndex = 0; slotIndex < slotNum; ++slotIndex)
+            {
+                auto child = node->GetChildAt(slotIndex);
+                if (auto childVisual = dynamic_cast<const Visual *>(child))
+                {
+                    visualList.push_back(childVisual);
+                }
+                else if (auto childNode = dynamic_cast<const Node *>(child))
+                {
+                    nodeQueue.push(childNode);
+                }
+            }
+        }
+
+        BenchmarkDoNotOptimize(visualList.data());
+    }
+
+    state.SetItemNum(visualNum);
+}
+
+// @summary Collect the visuals over the child slots as the entity renderer did
+// before the sibling links.
+FALCON_ENGINE_BENCHMARK(SceneTraverseSpatialType, "Graphics/Scene/Traverse/SpatialType")
+{
+    auto root = CreateSpatial<Node>();
+    auto visualNum = CreateDeepTree(root.get(), sDeepTreeDepth);
+
+    std::vector<const Node *> nodeStack;
+    std::vector<const Visual *> visualList;
+    while (state.KeepRunning())
+    {
+        FrameAllocator::BeginFrame();
+        visualList.clear();
+
+        nodeStack.push_back(root.get());
+        while (!nodeStack.empty())
+        {
+            auto node = nodeStack.back();
+            nodeStack.pop_back();
+
+            auto slotNum = node->GetChildrenSlotNum();
+            for (auto slotIndex = 0; slotIndex < slotNum; ++slotIndex)
+            {
+                auto child = node->GetChildAt(slotIndex);
+                if (child == nullptr)
+                {
+                    continue;
+                }
+
+                if (child->mSpatialType == SpatialType::Visual)
+                {
+                    visualList.push_back(static_cast<const Visual *>(child));
+                }
+                else
+                {
+                    nodeStack.push_back(static_cast<const Node *>(child));
+                }
+            }
+        }
+
+        BenchmarkDoNotOptimize(visualList.data());
+    }
+
+    state.SetItemNum(visualNum);
+}
+
+// @summary Collect the visuals as the entity renderer does.
+FALCON_ENGINE_BENCHMARK(SceneTraverseSibling, "Graphics/Scene/Traverse/Sibling")
+{
+    auto root = CreateSpatial<Node>();
+    auto visualNum = CreateDeepTree(root.get(), sDeepTreeDepth);
+
+    std::vector<const Node *> nodeStack;
+    std::vector<const Visual *> visualList;
+    while (state.KeepRunning())
+    {
+        visualList.clear();
+
+        nodeStack.push_back(root.get());
+        while (!nodeStack.empty())
+        {
+            auto node = nodeStack.back();
+            nodeStack.pop_back();
+
+            for (auto child = node->GetFirstChild(); child != nullptr; child = child->GetNextSibling())
+            {
+                if (child->mSpatialType == SpatialType::Visual)
+                {
+                    visualList.push_back(static_cast<const Visual *>(child));
+                }
+                else
+                {
+                    nodeStack.push_back(static_cast<const Node *>(child));
+                }
+            }
+        }
+
+        BenchmarkDoNotOptimize(visualList.data());
+    }
+
+    state.SetItemNum(visualNum);
+}
+
+// @summary Build the deep hierarchy with each spatial allocated from the heap
+// as it used to be, kept here as the reference.
+static int
+CreateDeepTreeHeap(Node *node, int depth)
+{
+    int spatialNum = 0;
+    for (int visualIndex = 0; visualIndex < sDeepTreeVisualNum; ++visualIndex)
+    {
+        node->AttachChild(std::make_shared<SceneTraverseVisual>());
+        ++spatialNum;
+    }
+
+    if (depth == 0)
+    {
+        return spatialNum;
+    }
+
+    for (int branchIndex = 0; branchIndex < sDeepTreeBranchNum; ++branchIndex)
+    {
+        auto child = std::make_shared<Node>();
+        node->AttachChild(child);
+        spatialNum += 1 + CreateDeepTreeHeap(child.get(), depth - 1);
+    }
+
+    return spatialNum;
+}
+
+FALCON_ENGINE_BENCHMARK_FIXED(SceneBuildHeap, "Graphics/Scene/Build/Heap", 50)
+{
+    int spatialNum = 0;
+    while (state.KeepRunning())
+    {
+        auto root = std::make_shared<Node>();
+        spatialNum = CreateDeepTreeHeap(root.get(), sDeepTreeDepth);
+
+        // NOTE: The release of the hierarchy is not part of the
+        // building.
+        state.PauseTiming();
+        root.reset();
+        state.ResumeTiming();
+    }
+
+    state.SetItemNum(spatialNum);
+}
+
+FALCON_ENGINE_BENCHMARK_FIXED(SceneBuildPool, "Graphics/Scene/Build/Pool", 50)
+{
+    int spatialNum = 0;
+    while (state.KeepRunning())
+    {
+        auto root = CreateSpatial<Node>();
+        spatialNum = CreateDeepTree(root.get(), sDeepTreeDepth) + (1 << (sDeepTreeDepth + 1)) - 2;
+
+        state.PauseTiming();
+        root.reset();
+        state.ResumeTiming();
+    }
+
+    state.SetItemNum(spatialNum);
+}
+
+// @summary Clone the deep hierarchy as the imported model is shared by the
+// entities, along with the release of the clone.
+FALCON_ENGINE_BENCHMARK_FIXED(SceneClone, "Graphics/Scene/Clone", 50)
+{
+    auto root = CreateSpatial<Node>();
+    auto spatialNum = CreateDeepTree(root.get(), sDeepTreeDepth) + (1 << (sDeepTreeDepth + 1)) - 2;
+
+    while (state.KeepRunning())
+    {
+        auto clone = ShareClone(root);
+        BenchmarkDoNotOptimize(clone);
+    }
+
+    state.SetItemNum(spatialNum);
+}
@@ -0,0 +1,344 @@
+#include <FalconEngine/Benchmark/Benchmark.h>
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <FalconEngine/Math/BoundingVolumeHierarchy.h>
+#include <FalconEngine/Math/Handedness.h>
+#include <FalconEngine/Math/Matrix4.h>
+
+// @summary Measure the bounding volume hierarchy against the linear scan the
+// scene used to do, in the pattern of an open world: many small objects
+// spread over a large flat area, a fraction of which moves every frame.
+
+using namespace FalconEngine;
+
+class BoundingVolumeScene
+{
+public:
+    std::vector<AABB> mBoundList;
+    std::vector<int>  mProxyList;
+};
+
+class BoundingVolumeQuery
+{
+public:
+    std::vector<Ray>     mRayList;
+    std::vector<AABB>    mAABBList;
+    std::vector<Sphere>  mSphereList;
+    std::vector<Frustum> mFrustumList;
+};
+
+static const float sWorldSize = 1000.0f;
+
+static AABB
+CreateBound(const Vector3f& center, const Vector3f& extent)
+{
+    return AABB(center - extent, center + extent);
+}
+
+static void
+CreateScene(BoundingVolumeScene& scene, int objectNum, std::mt19937& generator)
+{
+    std::uniform_real_distribution<float> positionDistribution(-sWorldSize * 0.5f, sWorldSize * 0.5f);
+    std::uniform_real_distribution<float> heightDistribution(0.0f, sWorldSize * 0.05f);
+    std::uniform_real_distribution<float> extentDistribution(0.25f, 2.0f);
+
+    for (int objectIndex = 0; objectIndex < objectNum; ++objectIndex)
+    {
+        auto center = Vector3f(positionDistribution(generator), heightDistribution(generator), positionDistribution(generator));
+        auto extent = Vector3f(extentDistribution(generator), extentDistribution(generator), extentDistribution(generator));
+        scene.mBoundList.push_back(CreateBound(center, extent));
+    }
+}
+
+static void
+CreateQuery(BoundingVolumeQuery& query, int queryNum, std::mt19937& generator)
+{
+    std::uniform_real_distribution<float> positionDistribution(-sWorldSize * 0.5f, sWorldSize * 0.5f);
+    std::uniform_real_distribution<float> directionDistribution(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> angleDistribution(0.0f, 6.2831853f);
+
+    for (int queryIndex = 0; queryIndex < queryNum; ++queryIndex)
+    {
+        auto origin = Vector3f(positionDistribution(generator), 2.0f, positionDistribution(generator));
+
+        // NOTE: Picking ray is mostly horizontal in the open world.
+        query.mRayList.push_back(Ray(origin, Vector3f(directionDistribution(generator), directionDistribution(generator) * 0.05f, directionDistribution(generator))));
+        query.mAABBList.push_back(CreateBound(origin, Vector3f(10.0f)));
+        query.mSphereList.push_back(Sphere(origin, 10.0f));
+
+        auto angle = angleDistribution(generator);
+        auto target = origin + Vector3f(std::cos(angle), 0.0f, std::sin(angle));
+        auto handedness = HandednessRight::GetInstance();
+        auto view = handedness->CreateLookAt(origin, target, Vector3f::UnitY);
+        auto projection = handedness->CreatePerspectiveFieldOfView(1.0f, 16.0f / 9.0f, 0.1f, 200.0f);
+        query.mFrustumList.push_back(Frustum::CreateFromViewProjection(projection * view));
+    }
+}
+
+/************************************************************************/
+/* Linear Implementation                                                */
+/************************************************************************/
+static int
+RaycastLinear(const BoundingVolumeScene& scene, const Ray& ray, float distanceMax)
+{
+    int objectHit = -1;
+    for (int objectIndex = 0; objectIndex < int(scene.mBoundList.size()); ++objectIndex)
+    {
+        float distance;
+        if (ray.Intersects(scene.mBoundList[objectIndex], distanceMax, distance))
+        {
+            objectHit = objectIndex;
+            distanceMax = distance;
+        }
+    }
+
+    return objectHit;
+}
+
+template <typename Predicate>
+static int
+QueryLinear(const BoundingVolumeScene& scene, Predicate predicate)
+{
+    int objectNum = 0;
+    for (const auto& bound : scene.mBoundList)
+    {
+        objectNum += predicate(bound) ? 1 : 0;
+    }
+
+    return objectNum;
+}
+
+/************************************************************************/
+/* Benchmark                                                            */
+/************************************************************************/
+static const int   sObjectNum = 100000;
+static const int   sQueryNum = 1000;
+static const int   sMovingRatio = 10;
+static const float sDistanceMax = sWorldSize;
+
+class BoundingVolumeFixture
+{
+public:
+    BoundingVolumeFixture()
+    {
+        std::mt19937 generator(1);
+        CreateScene(mScene, sObjectNum, generator);
+        CreateQuery(mQuery, sQueryNum, generator);
+
+        for (int objectIndex = 0; objectIndex < sObjectNum; ++objectIndex)
+        {
+            mScene.mProxyList.push_back(mHierarchy.Insert(mScene.mBoundList[objectIndex], reinterpret_cast<void *>(intptr_t(objectIndex))));
+        }
+
+        mHierarchy.Rebuild();
+    }
+
+public:
+    BoundingVolumeScene     mScene;
+    BoundingVolumeQuery     mQuery;
+    BoundingVolumeHierarchy mHierarchy;                                         // Rebuilt with surface area heuristic.
+};
+
+// NOTE: The scene is built once and shared by the query benchmarks,
+// because building it takes longer than most of the queries.
+static const BoundingVolumeFixture&
+GetFixture()
+{
+    static BoundingVolumeFixture sFixture;
+    return sFixture;
+}
+
+FALCON_ENGINE_BENCHMARK(BoundingVolumeHierarchyInsert, "Math/BoundingVolumeHierarchy/Insert")
+{
+    const auto& fixture = GetFixture();
+
+    while (state.KeepRunning())
+    {
+        BoundingVolumeHierarchy hierarchy;
+        for (int objectIndex = 0; objectIndex < sObjectNum; ++objectIndex)
+        {
+            hierarchy.Insert(fixture.mScene.mBoundList[objectIndex], nullptr);
+        }
+
+        state.SetCounter("height", hierarchy.GetHeight());
+        state.SetCounter("cost", hierarchy.GetCost());
+    }
+
+    state.SetItemNum(sObjectNum);
+}
+
+FALCON_ENGINE_BENCHMARK(BoundingVolumeHierarchyRebuild, "Math/BoundingVolumeHierarchy/Rebuild")
+{
+    auto hierarchy = GetFixture().mHierarchy;
+
+    while (state.KeepRunning())
+    {
+        hierarchy.Rebuild();
+    }
+
+    state.SetCounter("height", hierarchy.GetHeight());
+    state.SetCounter("cost", hierarchy.GetCost());
+    state.SetItemNum(sObjectNum);
+}
+
+// @summary Move a fraction of the objects as the dynamic objects do in each
+// frame.
+FALCON_ENGINE_BENCHMARK(BoundingVolumeHierarchyMove, "Math/BoundingVolumeHierarchy/Move")
+{
+    const auto& fixture = GetFixture();
+
+    auto scene = fixture.mScene;
+    auto hierarchy = fixture.mHierarchy;
+
+    std::mt19937 generator(2);
+    std::uniform_real_distribution<float> velocityDistribution(-0.2f, 0.2f);
+
+    int64_t frameIndex = 0;
+    int64_t reinsertedNum = 0;
+    while (state.KeepRunning())
+    {
+        for (int objectIndex = int(frameIndex % sMovingRatio); objectIndex < sObjectNum; objectIndex += sMovingRatio)
+        {
+            auto& bound = scene.mBoundList[objectIndex];
+            auto velocity = Vector3f(velocityDistribution(generator), 0.0f, velocityDistribution(generator));
+            bound = AABB(bound.mMin + velocity, bound.mMax + velocity);
+            reinsertedNum += hierarchy.Move(scene.mProxyList[objectIndex], bound) ? 1 : 0;
+        }
+
+        ++frameIndex;
+    }
+
+    state.SetCounter("reinserted_per_frame", double(reinsertedNum) / double(frameIndex));
+    state.SetCounter("height", hierarchy.GetHeight());
+    state.SetItemNum(sObjectNum / sMovingRatio);
+}
+
+// @summary Compare each query against the linear scan the scene used to do,
+// one query per iteration.
+FALCON_ENGINE_BENCHMARK(BoundingVolumeRaycastLinear, "Math/BoundingVolumeHierarchy/Raycast/Linear")
+{
+    const auto& fixture = GetFixture();
+
+    int64_t queryIndex = 0;
+    while (state.KeepRunning())
+    {
+        auto objectHit = RaycastLinear(fixture.mScene, fixture.mQuery.mRayList[queryIndex++ % sQueryNum], sDistanceMax);
+        BenchmarkDoNotOptimize(objectHit);
+    }
+}
+
+FALCON_ENGINE_BENCHMARK(BoundingVolumeRaycastHierarchy, "Math/BoundingVolumeHierarchy/Raycast/Hierarchy")
+{
+    const auto& fixture = GetFixture();
+
+    int64_t queryIndex = 0;
+    while (state.KeepRunning())
+    {
+        float distance;
+        auto proxy = fixture.mHierarchy.Raycast(fixture.mQuery.mRayList[queryIndex++ % sQueryNum], sDistanceMax, distance);
+        BenchmarkDoNotOptimize(proxy);
+    }
+}
+
+FALCON_ENGINE_BENCHMARK(BoundingVolumeAABBLinear, "Math/BoundingVolumeHierarchy/AABB/Linear")
+{
+    const auto& fixture = GetFixture();
+
+    int64_t queryIndex = 0;
+    while (state.KeepRunning())
+    {
+        const auto& aabb = fixture.mQuery.mAABBList[queryIndex++ % sQueryNum];
+        auto objectNum = QueryLinear(fixture.mScene, [&aabb](const AABB & bound)
+        {
+            return bound.Intersects(aabb);
+        });
+        BenchmarkDoNotOptimize(objectNum);
+    }
+}
+
+FALCON_ENGINE_BENCHMARK(BoundingVolumeAABBHierarchy, "Math/BoundingVolumeHierarchy/AABB/Hierarchy")
+{
+    const auto& fixture = GetFixture();
+
+    int64_t queryIndex = 0;
+    while (state.KeepRunning())
+    {
+        int objectNum = 0;
+        fixture.mHierarchy.QueryAABB(fixture.mQuery.mAABBList[queryIndex++ % sQueryNum], [&objectNum](int /* proxy */)
+        {
+            ++objectNum;
+            return true;
+        });
+        BenchmarkDoNotOptimize(objectNum);
+    }
+}
+
+FALCON_ENGINE_BENCHMARK(BoundingVolumeSphereLinear, "Math/BoundingVolumeHierarchy/Sphere/Linear")
+{
+    const auto& fixture = GetFixture();
+
+    int64_t queryIndex = 0;
+    while (state.KeepRunning())
+    {
+        const auto& sphere = fixture.mQuery.mSphereList[queryIndex++ % sQueryNum];
+        auto objectNum = QueryLinear(fixture.mScene, [&sphere](const AABB & bound)
+        {
+            return sphere.Intersects(bound);
+        });
+        BenchmarkDoNotOptimize(objectNum);
+    }
+}
+
+FALCON_ENGINE_BENCHMARK(BoundingVolumeSphereHierarchy, "Math/BoundingVolumeHierarchy/Sphere/Hierarchy")
+{
+    const auto& fixture = GetFixture();
+
+    int64_t queryIndex = 0;
+    while (state.KeepRunning())
+    {
+        int objectNum = 0;
+        fixture.mHierarchy.QuerySphere(fixture.mQuery.mSphereList[queryIndex++ % sQueryNum], [&objectNum](int /* proxy */)
+        {
+            ++objectNum;
+            return true;
+        });
+        BenchmarkDoNotOptimize(objectNum);
+    }
+}
+
+FALCON_ENGINE_BENCHMARK(BoundingVolumeFrustumLinear, "Math/BoundingVolumeHierarchy/Frustum/Linear")
+{
+    const auto& fixture = GetFixture();
+
+    int64_t queryIndex = 0;
+    while (state.KeepRunning())
+    {
+        const auto& frustum = fixture.mQuery.mFrustumList[queryIndex++ % sQueryNum];
+        auto objectNum = QueryLinear(fixture.mScene, [&frustum](const AABB & bound)
+        {
+            return frustum.Contains(bound) != FrustumContainment::Outside;
+        });
+        BenchmarkDoNotOptimize(objectNum);
+    }
+}
+
+FALCON_ENGINE_BENCHMARK(BoundingVolumeFrustumHierarchy, "Math/BoundingVolumeHierarchy/Frustum/Hierarchy")
+{
+    const auto& fixture = GetFixture();
+
+    int64_t queryIndex = 0;
+    while (state.KeepRunning())
+    {
+        int objectNum = 0;
+        fixture.mHierarchy.QueryFrustum(fixture.mQuery.mFrustumList[queryIndex++ % sQueryNum], [&objectNum](int /* proxy */)
+        {
+            ++objectNum;
+            return true;
+        });
+        BenchmarkDoNotOptimize(objectNum);
+    }
+}
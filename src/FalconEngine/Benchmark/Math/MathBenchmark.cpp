@@ -0,0 +1,217 @@
+#include <FalconEngine/Benchmark/Benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include <FalconEngine/Math/AABB.h>
+#include <FalconEngine/Math/Matrix4.h>
+#include <FalconEngine/Math/Quaternion.h>
+#include <FalconEngine/Math/Vector3.h>
+#include <FalconEngine/Math/Vector4.h>
+
+// @summary Measure the math types used in each frame by the scene graph and
+// culling, over arrays large enough to leave the registers but small enough to
+// stay in the cache.
+
+using namespace FalconEngine;
+
+static const int sElementNum = 1024;
+
+class MathData
+{
+public:
+    MathData()
+    {
+        std::mt19937 generator(1);
+        std::uniform_real_distribution<float> positionDistribution(-100.0f, 100.0f);
+        std::uniform_real_distribution<float> angleDistribution(0.0f, 6.2831853f);
+        std::uniform_real_distribution<float> extentDistribution(0.25f, 2.0f);
+
+        for (int elementIndex = 0; elementIndex < sElementNum; ++elementIndex)
+        {
+            auto position = Vector3f(positionDistribution(generator), positionDistribution(generator), positionDistribution(generator));
+            auto axis = Vector3f::Normalize(Vector3f(positionDistribution(generator), positionDistribution(generator), positionDistribution(generator)));
+            auto angle = angleDistribution(generator);
+            auto extent = Vector3f(extentDistribution(generator), extentDistribution(generator), extentDistribution(generator));
+
+            mAngleList.push_back(angle);
+            mAxisList.push_back(axis);
+            mQuaternionList.push_back(Quaternion::CreateFromAxisAngle(axis, angle));
+            mMatrixList.push_back(Matrix4f::CreateTranslation(position) * Matrix4f::CreateRotation(mQuaternionList.back()));
+            mVectorList.push_back(Vector4f(position, 1.0f));
+            mAABBList.push_back(AABB(position - extent, position + extent));
+        }
+    }
+
+public:
+    std::vector<float>      mAngleList;
+    std::vector<Vector3f>   mAxisList;
+    std::vector<Quaternion> mQuaternionList;
+    std::vector<Matrix4f>   mMatrixList;
+    std::vector<Vector4f>   mVectorList;
+    std::vector<AABB>       mAABBList;
+};
+
+static const MathData&
+GetMathData()
+{
+    static MathData sData;
+    return sData;
+}
+
+/************************************************************************/
+/* Matrix                                                               */
+/************************************************************************/
+FALCON_ENGINE_BENCHMARK(Matrix4fMultiply, "Math/Matrix4f/Multiply")
+{
+    const auto& data = GetMathData();
+
+    while (state.KeepRunning())
+    {
+        for (int elementIndex = 0; elementIndex < sElementNum; ++elementIndex)
+        {
+            Matrix4f result = data.mMatrixList[elementIndex] * data.mMatrixList[sElementNum - 1 - elementIndex];
+            BenchmarkDoNotOptimize(result);
+        }
+    }
+
+    state.SetItemNum(sElementNum);
+}
+
+FALCON_ENGINE_BENCHMARK(Matrix4fInverse, "Math/Matrix4f/Inverse")
+{
+    const auto& data = GetMathData();
+
+    while (state.KeepRunning())
+    {
+        for (int elementIndex = 0; elementIndex < sElementNum; ++elementIndex)
+        {
+            auto result = Matrix4f::Inverse(data.mMatrixList[elementIndex]);
+            BenchmarkDoNotOptimize(result);
+        }
+    }
+
+    state.SetItemNum(sElementNum);
+}
+
+FALCON_ENGINE_BENCHMARK(Matrix4fTransform, "Math/Matrix4f/Transform")
+{
+    const auto& data = GetMathData();
+
+    while (state.KeepRunning())
+    {
+        for (int elementIndex = 0; elementIndex < sElementNum; ++elementIndex)
+        {
+            Vector4f result = data.mMatrixList[elementIndex] * data.mVectorList[elementIndex];
+            BenchmarkDoNotOptimize(result);
+        }
+    }
+
+    state.SetItemNum(sElementNum);
+}
+
+/************************************************************************/
+/* AABB                                                                 */
+/************************************************************************/
+FALCON_ENGINE_BENCHMARK(AABBIntersects, "Math/AABB/Intersects")
+{
+    const auto& data = GetMathData();
+
+    while (state.KeepRunning())
+    {
+        int intersectedNum = 0;
+        for (int elementIndex = 0; elementIndex < sElementNum; ++elementIndex)
+        {
+            intersectedNum += data.mAABBList[elementIndex].Intersects(data.mAABBList[(elementIndex * 7 + 1) % sElementNum]) ? 1 : 0;
+        }
+
+        BenchmarkDoNotOptimize(intersectedNum);
+    }
+
+    state.SetItemNum(sElementNum);
+}
+
+FALCON_ENGINE_BENCHMARK(AABBExtend, "Math/AABB/Extend")
+{
+    const auto& data = GetMathData();
+
+    while (state.KeepRunning())
+    {
+        AABB aabb(data.mAABBList[0]);
+        for (int elementIndex = 1; elementIndex < sElementNum; ++elementIndex)
+        {
+            aabb.Extend(data.mAABBList[elementIndex]);
+        }
+
+        BenchmarkDoNotOptimize(aabb);
+    }
+
+    state.SetItemNum(sElementNum);
+}
+
+/************************************************************************/
+/* Quaternion                                                           */
+/************************************************************************/
+FALCON_ENGINE_BENCHMARK(QuaternionCreateFromAxisAngle, "Math/Quaternion/CreateFromAxisAngle")
+{
+    const auto& data = GetMathData();
+
+    while (state.KeepRunning())
+    {
+        for (int elementIndex = 0; elementIndex < sElementNum; ++elementIndex)
+        {
+            auto result = Quaternion::CreateFromAxisAngle(data.mAxisList[elementIndex], data.mAngleList[elementIndex]);
+            BenchmarkDoNotOptimize(result);
+        }
+    }
+
+    state.SetItemNum(sElementNum);
+}
+
+FALCON_ENGINE_BENCHMARK(QuaternionMultiply, "Math/Quaternion/Multiply")
+{
+    const auto& data = GetMathData();
+
+    while (state.KeepRunning())
+    {
+        for (int elementIndex = 0; elementIndex < sElementNum; ++elementIndex)
+        {
+            Quaternion result = data.mQuaternionList[elementIndex] * data.mQuaternionList[sElementNum - 1 - elementIndex];
+            BenchmarkDoNotOptimize(result);
+        }
+    }
+
+    state.SetItemNum(sElementNum);
+}
+
+FALCON_ENGINE_BENCHMARK(QuaternionNormalize, "Math/Quaternion/Normalize")
+{
+    const auto& data = GetMathData();
+
+    while (state.KeepRunning())
+    {
+        for (int elementIndex = 0; elementIndex < sElementNum; ++elementIndex)
+        {
+            auto result = Quaternion::Normalize(data.mQuaternionList[elementIndex]);
+            BenchmarkDoNotOptimize(result);
+        }
+    }
+
+    state.SetItemNum(sElementNum);
+}
+
+FALCON_ENGINE_BENCHMARK(QuaternionToMatrix, "Math/Quaternion/ToMatrix")
+{
+    const auto& data = GetMathData();
+
+    while (state.KeepRunning())
+    {
+        for (int elementIndex = 0; elementIndex < sElementNum; ++elementIndex)
+        {
+            auto result = Matrix4f::CreateRotation(data.mQuaternionList[elementIndex]);
+            BenchmarkDoNotOptimize(result);
+        }
+    }
+
+    state.SetItemNum(sElementNum);
+}
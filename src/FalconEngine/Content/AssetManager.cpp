@@ -1,7 +1,9 @@
 #include <FalconEngine/Content/AssetManager.h>
 
 #include <fstream>
+#include <iterator>
 #include <stdexcept>
+#include <vector>
 
 #include <cereal/archives/portable_binary.hpp>
 
@@ -9,6 +11,7 @@
 #include <FalconEngine/Content/Asset.h>
 #include <FalconEngine/Core/Path.h>
 #include <FalconEngine/Graphics/Renderer/Font/Font.h>
+#include <FalconEngine/Graphics/Renderer/Font/FontAtlas.h>
 #include <FalconEngine/Graphics/Renderer/Resource/Buffer.h>
 #include <FalconEngine/Graphics/Renderer/Resource/Sampler.h>
 #include <FalconEngine/Graphics/Renderer/Resource/Texture1d.h>
@@ -72,11 +75,30 @@ AssetManager::LoadFont(const std::string& fontAssetPath)
         return font;
     }
 
+    // NOTE: Font textures are recorded as font memory.
+    MemoryTagScope memoryTagScope(MemoryTag::Font);
+
     font = LoadFontInternal(fontAssetPath);
     mFontTable[font->mFilePath] = font;
     return font;
 }
 
+std::shared_ptr<Font>
+AssetManager::LoadFontDynamic(const std::string& fontFilePath)
+{
+    auto font = GetFont(fontFilePath);
+    if (font)
+    {
+        return font;
+    }
+
+    MemoryTagScope memoryTagScope(MemoryTag::Font);
+
+    font = LoadFontDynamicInternal(fontFilePath);
+    mFontTable[font->mFilePath] = font;
+    return font;
+}
+
 std::shared_ptr<Model>
 AssetManager::GetModel(const std::string& modelFilePath)
 {
@@ -98,6 +120,8 @@ AssetManager::LoadModel(const std::string& modelFilePath, const ModelImportOptio
         return model;
     }
 
+    MemoryTagScope memoryTagScope(MemoryTag::Asset);
+
     model = LoadModelInternal(modelFilePath, modelImportOption);
     mModelTable[model->mFilePath] = model;
     return model;
@@ -124,6 +148,8 @@ AssetManager::LoadShaderSource(const std::string& shaderFilePath)
         return shaderSource;
     }
 
+    MemoryTagScope memoryTagScope(MemoryTag::Asset);
+
     shaderSource = LoadShaderSourceInternal(shaderFilePath);
     mShaderSourceTable[shaderSource->mFilePath] = shaderSource;
     return shaderSource;
@@ -157,38 +183,55 @@ AssetManager::LoadFontInternal(const std::string& fontAssetPath)
         fontAssetArchive(font);
 
         font->mAssetSource = AssetSource::Stream;
+        font->BuildGlyphMap();
     }
 
     // Load font texture array.
     auto fontAssetDirPath = GetFileDirectory(fontAssetPath);
     {
         // Load the first texture, then, use the texture metadata to create texture array.
-        std::shared_ptr<Texture2dArray> fontPageTextureArray;
-        {
-            auto fontPage0TextureAssetName = font->mTextureArchiveNameList[0];
-            auto fontPage0TextureAssetPath = fontAssetDirPath + fontPage0TextureAssetName;
-            auto fontPage0Texture = LoadTexture<Texture2d>(fontPage0TextureAssetPath);
-
-            // NEW(Wuxiang): Add mipmap support.
-            fontPageTextureArray = std::make_shared<Texture2dArray>(AssetSource::Virtual,
-                                   "None", "None", fontPage0Texture->mDimension[0],
-                                   fontPage0Texture->mDimension[1], font->mTexturePages,
-                                   TextureFormat::R8G8B8A8, BufferUsage::Static, 0);
-        }
+        auto fontPage0TextureAssetName = font->mTextureArchiveNameList[0];
+        auto fontPage0TextureAssetPath = fontAssetDirPath + fontPage0TextureAssetName;
+        auto fontPage0Texture = LoadTexture<Texture2d>(fontPage0TextureAssetPath);
+
+        // NEW(Wuxiang): Add mipmap support.
+        auto fontPageTextureArray = std::make_shared<Texture2dArray>(AssetSource::Virtual,
+                                    "None", "None", fontPage0Texture->mDimension[0],
+                                    fontPage0Texture->mDimension[1], font->mTexturePages,
+                                    TextureFormat::R8G8B8A8, BufferUsage::Static, 0);
+
+        // NOTE: The font with large character set has many pages,
+        // most of which are never used by the text. The other pages are loaded
+        // when the glyph on them is first rendered.
+        fontPageTextureArray->SetTextureSlice(0, fontPage0Texture);
+        font->SetTexture(fontPageTextureArray, fontAssetDirPath);
+    }
 
-        // Load the other textures.
-        for (int fontPageId = 0; fontPageId < font->mTexturePages; ++fontPageId)
-        {
-            auto textureAssetName = font->mTextureArchiveNameList[fontPageId];
-            auto textureAssetPath = fontAssetDirPath + textureAssetName;
+    // Set font texture sampler.
+    auto sampler = std::make_shared<Sampler>();
+    sampler->mMagnificationFilter = SamplerMagnificationFilter::Linear;
+    sampler->mMinificationFilter = SamplerMinificationFilter::Linear;
+    font->SetSampler(sampler);
 
-            auto fontPageTexture = LoadTexture<Texture2d>(textureAssetPath);
-            fontPageTextureArray->PushTextureSlice(fontPageTexture);
-        }
-        font->SetTexture(fontPageTextureArray);
+    return font;
+}
+
+std::shared_ptr<Font>
+AssetManager::LoadFontDynamicInternal(const std::string& fontFilePath)
+{
+    CheckFileExists(fontFilePath);
+
+    // NOTE: The font file is kept in memory by the atlas, because the
+    // glyph outline is read from it whenever the glyph is rasterized.
+    std::vector<unsigned char> fontFileData;
+    {
+        ifstream fontFileStream(fontFilePath, std::ios::binary);
+        fontFileData.assign(istreambuf_iterator<char>(fontFileStream), istreambuf_iterator<char>());
     }
 
-    // Set font texture sampler.
+    auto font = make_shared<Font>(AssetSource::Normal, GetFileStem(fontFilePath), fontFilePath);
+    font->SetAtlas(make_shared<FontAtlas>(std::move(fontFileData)));
+
     auto sampler = std::make_shared<Sampler>();
     sampler->mMagnificationFilter = SamplerMagnificationFilter::Linear;
     sampler->mMinificationFilter = SamplerMinificationFilter::Linear;
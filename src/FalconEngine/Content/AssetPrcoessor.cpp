@@ -93,7 +93,7 @@ void
 LoadFntGlyphLine(
     Font&     font,
     vector<string>& fontGlyphElems,
-    size_t          fontGlyphIndex,
+    size_t       /* fontGlyphIndex */,
     int             fontGlyphPT,
     int             fontGlyphPR,
     int          /* fontGlyphPB */,
@@ -138,11 +138,6 @@ LoadFntGlyphLine(
 
     int page = lexical_cast<int>(sFontGlyphKeyValuePairTable.at("page").c_str());
 
-    // NOTE(Wuxiang): Indirect lookup in glyph table. First you look up the glyph
-    // index with the codepoint, which indexes into the glyph table. Then you use
-    // the glyph index to look up the glyph. This implementation achieve best
-    // performance and lowest storage in runtime.
-    font.mGlyphIndexTable[id] = fontGlyphIndex;
     font.mGlyphTable.push_back(FontGlyph(id, width, height, offsetX,
                                          offsetY, advance, page, s1, t1, s2, t2));
 }
@@ -271,16 +266,6 @@ LoadFntFile(const std::string& fntFilePath)
         split(sFntElems, sFntLine, is_space());
         font->mGlyphCount = lexical_cast<int>(ReadFntPair(sFntElems[1]).second.c_str());
 
-        // NOTE(Wuxiang): Unicode Codepoint range: http://inamidst.com/stuff/unidata/
-        // U+4E00 to U+9FFF: CJK Unified Ideographs
-        // U+A000 to U+A48F: Yi Syllables
-        static const int sMaxCodepointPastOne = 0xA000;
-
-        // Allocate storage for index table. This member would be large. The default
-        // value refers to the none character, which has id = 0. This character is
-        // always loaded first.
-        font->mGlyphIndexTable.assign(sMaxCodepointPastOne, 0);
-
         // Read every glyph
         boost::regex spaceMultiple("[ ]+");
         string space = " ";
@@ -297,6 +282,10 @@ LoadFntFile(const std::string& fntFilePath)
 
             LoadFntGlyphLine(*font, sFntElems, fontGlyphIndex, fontGlyphPT, fontGlyphPR, fontGlyphPB, fontGlyphPL);
         }
+
+        // NOTE: The glyph not in the font maps into the none
+        // character, which has id = 0. This character is always loaded first.
+        font->BuildGlyphMap();
     }
 
     fntStream.close();
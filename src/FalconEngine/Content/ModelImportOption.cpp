@@ -5,6 +5,17 @@
 namespace FalconEngine
 {
 
+/************************************************************************/
+/* Constructors and Destructor                                          */
+/************************************************************************/
+ModelLayoutOption::ModelLayoutOption(ModelVertexCompression vertexCompression) :
+    mPosition(vertexCompression == ModelVertexCompression::None ? BufferLayout::Separated : BufferLayout::Interleaved),
+    mNormal(mPosition),
+    mTexCoord(mPosition),
+    mVertexCompression(vertexCompression)
+{
+}
+
 /************************************************************************/
 /* Constructors and Destructor                                          */
 /************************************************************************/
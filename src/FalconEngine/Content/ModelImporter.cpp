@@ -1,6 +1,13 @@
 #include <FalconEngine/Content/ModelImporter.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <FalconEngine/Core/Memory.h>
 #include <FalconEngine/Graphics/Renderer/Renderer.h>
 
+#include <glm/gtc/packing.hpp>
+
 namespace FalconEngine
 {
 
@@ -80,6 +87,18 @@ ModelImporter::Import(Model *model, const string& modelFilePath, const ModelImpo
     // children nodes and textures.
     model->SetNode(CreateNode(model, modelFilePath, modelImportOption, scene, scene->mRootNode));
 
+    ReportVertexCompression(model, modelImportOption.mVertexBufferLayout);
+
+    if (modelImportOption.mMaterialPacked)
+    {
+        vector<Material *> materialList;
+        CollectMaterial(model->GetNode().get(), materialList);
+
+        auto materialAtlas = make_shared<MaterialAtlas>();
+        materialAtlas->Pack(materialList);
+        model->SetMaterialAtlas(materialAtlas);
+    }
+
     return true;
 }
 
@@ -89,7 +108,7 @@ ModelImporter::Import(Model *model, const string& modelFilePath, const ModelImpo
 std::shared_ptr<Node>
 ModelImporter::CreateNode(Model *model, const string& modelFilePath, const ModelImportOption& modelImportOption, const aiScene *aiScene, const aiNode *aiNode)
 {
-    auto node = make_shared<Node>();
+    auto node = CreateSpatial<Node>();
 
     // Load node transform.
     node->mLocalTransform = Matrix4f(
@@ -118,30 +137,37 @@ ModelImporter::CreateNode(Model *model, const string& modelFilePath, const Model
 std::shared_ptr<Mesh>
 ModelImporter::CreateMesh(Model *model, const string& modelFilePath, const ModelImportOption& modelImportOption, const aiScene *aiScene, const aiMesh *aiMesh)
 {
+    // Extract bounding box from mesh. The bounding box is also the quantization
+    // range of compressed vertex position.
+    auto aabb = CreateAABB(aiMesh);
+
     // Load vertex and index data.
     auto vertexGroup = CreateVertexGroup(model,
                                          modelImportOption.mVertexBufferUsage,
-                                         modelImportOption.mVertexBufferLayout, aiMesh);
+                                         modelImportOption.mVertexBufferLayout,
+                                         aabb, aiMesh);
     auto indexBuffer = CreateIndexBuffer(model,
                                          modelImportOption.mIndexType,
                                          modelImportOption.mIndexBufferUsage, aiMesh);
 
-    auto primitive = make_shared<PrimitiveTriangles>(GetVertexFormat(), vertexGroup, indexBuffer);
-
-    // Extract bounding box from mesh.
-    primitive->SetAABB(CreateAABB(aiMesh));
+    auto vertexFormat = GetVertexFormat(modelImportOption.mVertexBufferLayout.mVertexCompression);
+    auto primitive = make_shared<PrimitiveTriangles>(vertexFormat, vertexGroup, indexBuffer);
+    primitive->SetAABB(aabb);
 
     // Load texture data in term of material.
     auto material = CreateMaterial(modelFilePath, aiScene, aiMesh);
 
-    return make_shared<Mesh>(primitive, material);
+    auto mesh = make_shared<Mesh>(primitive, material);
+    CreateLod(mesh.get(), modelImportOption, vertexFormat, vertexGroup, aiMesh);
+
+    return mesh;
 }
 
 std::shared_ptr<Visual>
 ModelImporter::CreateVisual(Model *model, const string& modelFilePath, const ModelImportOption& modelImportOption, const aiScene *aiScene, const aiMesh *aiMesh)
 {
     // Create visual without vertex format and vertex group.
-    return make_shared<Visual>(CreateMesh(model, modelFilePath, modelImportOption, aiScene, aiMesh));
+    return CreateSpatial<Visual>(CreateMesh(model, modelFilePath, modelImportOption, aiScene, aiMesh));
 }
 
 AABB
@@ -182,31 +208,146 @@ ModelImporter::CreateIndexBuffer(Model *model, IndexType indexType, BufferUsage
     }
 }
 
+void
+ModelImporter::CreateLod(Mesh *mesh, const ModelImportOption& modelImportOption, const std::shared_ptr<VertexFormat>& vertexFormat, const std::shared_ptr<VertexGroup>& vertexGroup, const aiMesh *aiMesh)
+{
+    if (modelImportOption.mLodNum <= 1 || aiMesh->mPrimitiveTypes != aiPrimitiveType_TRIANGLE)
+    {
+        return;
+    }
+
+    vector<Vector3f> positionList(aiMesh->mNumVertices);
+    for (unsigned int vertexIndex = 0; vertexIndex < aiMesh->mNumVertices; ++vertexIndex)
+    {
+        positionList[vertexIndex] = Vector3f(aiMesh->mVertices[vertexIndex].x,
+                                             aiMesh->mVertices[vertexIndex].y,
+                                             aiMesh->mVertices[vertexIndex].z);
+    }
+
+    vector<unsigned int> indexList;
+    indexList.reserve(aiMesh->mNumFaces * 3);
+    for (unsigned int faceIndex = 0; faceIndex < aiMesh->mNumFaces; ++faceIndex)
+    {
+        auto& face = aiMesh->mFaces[faceIndex];
+        indexList.insert(indexList.end(), face.mIndices, face.mIndices + face.mNumIndices);
+    }
+
+    auto indexNumLast = indexList.size();
+    auto lodError = 0.0f;
+    for (int lodIndex = 1; lodIndex < modelImportOption.mLodNum; ++lodIndex)
+    {
+        auto indexNumTarget = int(indexList.size() * pow(modelImportOption.mLodReduction, lodIndex)) / 3 * 3;
+
+        // NOTE: Each level is simplified from the original index
+        // list, so that its error is measured against the original surface.
+        vector<unsigned int> indexListLod;
+        lodError = max(lodError, MeshSimplifier::Simplify(indexListLod, positionList, indexList,
+                       indexNumTarget, modelImportOption.mLodErrorMax));
+
+        // Stop when the error limit keeps the level from getting coarser
+        // enough to pay for its index buffer.
+        if (indexListLod.empty()
+                || indexListLod.size() > indexNumLast * (1.0f + modelImportOption.mLodReduction) * 0.5f)
+        {
+            break;
+        }
+
+        indexNumLast = indexListLod.size();
+
+        shared_ptr<IndexBuffer> indexBuffer;
+        switch (modelImportOption.mIndexType)
+        {
+        case IndexType::UnsignedShort:
+            indexBuffer = CreateIndexBufferInternal<unsigned short>(modelImportOption.mIndexType,
+                          modelImportOption.mIndexBufferUsage, indexListLod);
+            break;
+
+        case IndexType::UnsignedInt:
+            indexBuffer = CreateIndexBufferInternal<unsigned int>(modelImportOption.mIndexType,
+                          modelImportOption.mIndexBufferUsage, indexListLod);
+            break;
+
+        default:
+            FALCON_ENGINE_THROW_ASSERTION_EXCEPTION();
+        }
+
+        auto primitive = make_shared<PrimitiveTriangles>(vertexFormat, vertexGroup, indexBuffer);
+        primitive->SetAABB(*mesh->GetAABB());
+        mesh->PushLod(primitive, lodError);
+    }
+}
+
 std::shared_ptr<VertexFormat>
-ModelImporter::CreateVertexFormat()
+ModelImporter::CreateVertexFormat(ModelVertexCompression vertexCompression)
 {
     auto vertexFormat = std::make_shared<VertexFormat>();
-    vertexFormat->PushVertexAttribute(0, "Position", VertexAttributeType::FloatVec3, false, 0);
-    vertexFormat->PushVertexAttribute(1, "Normal", VertexAttributeType::FloatVec3, false, 1);
-    vertexFormat->PushVertexAttribute(2, "TexCoord", VertexAttributeType::FloatVec2, false, 2);
+    switch (vertexCompression)
+    {
+    case ModelVertexCompression::None:
+        vertexFormat->PushVertexAttribute(0, "Position", VertexAttributeType::FloatVec3, false, 0);
+        vertexFormat->PushVertexAttribute(1, "Normal", VertexAttributeType::FloatVec3, false, 1);
+        vertexFormat->PushVertexAttribute(2, "TexCoord", VertexAttributeType::FloatVec2, false, 2);
+        break;
+
+    // NOTE: The shader still receives vec3 position and normal. The
+    // position w component is dropped and normal z component is filled as
+    // zero, then both are decoded in the shader.
+    case ModelVertexCompression::Snorm16Position:
+        vertexFormat->PushVertexAttribute(0, "Position", VertexAttributeType::ShortVec4, true, 0);
+        vertexFormat->PushVertexAttribute(1, "Normal", VertexAttributeType::ShortVec2, true, 0);
+        vertexFormat->PushVertexAttribute(2, "TexCoord", VertexAttributeType::HalfVec2, false, 0);
+        break;
+
+    case ModelVertexCompression::HalfPosition:
+        vertexFormat->PushVertexAttribute(0, "Position", VertexAttributeType::HalfVec4, false, 0);
+        vertexFormat->PushVertexAttribute(1, "Normal", VertexAttributeType::ShortVec2, true, 0);
+        vertexFormat->PushVertexAttribute(2, "TexCoord", VertexAttributeType::HalfVec2, false, 0);
+        break;
+
+    default:
+        FALCON_ENGINE_THROW_ASSERTION_EXCEPTION();
+    }
+
     vertexFormat->FinishVertexAttribute();
     return vertexFormat;
 }
 
 std::shared_ptr<VertexFormat>
-ModelImporter::GetVertexFormat()
+ModelImporter::GetVertexFormat(ModelVertexCompression vertexCompression)
 {
-    static auto vertexFormat = CreateVertexFormat();
-    return vertexFormat;
+    static auto sVertexFormat = CreateVertexFormat(ModelVertexCompression::None);
+    static auto sVertexFormatSnorm16Position = CreateVertexFormat(ModelVertexCompression::Snorm16Position);
+    static auto sVertexFormatHalfPosition = CreateVertexFormat(ModelVertexCompression::HalfPosition);
+
+    switch (vertexCompression)
+    {
+    case ModelVertexCompression::None:
+        return sVertexFormat;
+
+    case ModelVertexCompression::Snorm16Position:
+        return sVertexFormatSnorm16Position;
+
+    case ModelVertexCompression::HalfPosition:
+        return sVertexFormatHalfPosition;
+
+    default:
+        FALCON_ENGINE_THROW_ASSERTION_EXCEPTION();
+    }
 }
 
 std::shared_ptr<VertexGroup>
 ModelImporter::CreateVertexGroup(
-    _IN_OUT_ Model                      *model,
-    _IN_     const ModelUsageOption&     vertexBufferUsage,
-    _IN_     const ModelLayoutOption& /* vertexBufferLayout */,
-    _IN_     const aiMesh               *aiMesh)
+    _IN_OUT_ Model                   *model,
+    _IN_     const ModelUsageOption&  vertexBufferUsage,
+    _IN_     const ModelLayoutOption& vertexBufferLayout,
+    _IN_     const AABB&              aabb,
+    _IN_     const aiMesh            *aiMesh)
 {
+    if (vertexBufferLayout.mVertexCompression != ModelVertexCompression::None)
+    {
+        return CreateVertexGroupCompressed(model, vertexBufferUsage, vertexBufferLayout, aabb, aiMesh);
+    }
+
     static auto sMasterRenderer = Renderer::GetInstance();
 
     // NOTE(Wuxiang): I think interleaving is not ideal for model loading. Because
@@ -303,8 +444,11 @@ ModelImporter::CreateVertexGroup(
     }
 
     model->mVertexNum += vertexNum;
+    model->mVertexBufferByteNum += vertexBuffer->GetDataSize() + normalBuffer->GetDataSize() + texCoordBuffer->GetDataSize();
+    model->mVertexBufferByteNumUncompressed += vertexBuffer->GetDataSize() + normalBuffer->GetDataSize() + texCoordBuffer->GetDataSize();
+    model->mVertexBufferNum += 3;
 
-    auto vertexFormat = GetVertexFormat();
+    auto vertexFormat = GetVertexFormat(ModelVertexCompression::None);
     auto vertexGroup = make_shared<VertexGroup>();
     vertexGroup->SetVertexBuffer(0, vertexBuffer, 0, vertexFormat->GetVertexBufferStride(0));
     vertexGroup->SetVertexBuffer(1, normalBuffer, 0, vertexFormat->GetVertexBufferStride(1));
@@ -312,6 +456,151 @@ ModelImporter::CreateVertexGroup(
     return vertexGroup;
 }
 
+std::shared_ptr<VertexGroup>
+ModelImporter::CreateVertexGroupCompressed(
+    _IN_OUT_ Model                   *model,
+    _IN_     const ModelUsageOption&  vertexBufferUsage,
+    _IN_     const ModelLayoutOption& vertexBufferLayout,
+    _IN_     const AABB&              aabb,
+    _IN_     const aiMesh            *aiMesh)
+{
+    static auto sMasterRenderer = Renderer::GetInstance();
+
+    // NOTE: Unlike the uncompressed case, the whole compressed vertex
+    // fits in 16 bytes. Interleaving makes each vertex fetch touch a single
+    // cache line instead of three separated streams.
+
+    // Memory allocation for vertex buffer.
+    auto vertexNum = int(aiMesh->mNumVertices);
+    auto vertexBuffer = std::make_shared<VertexBuffer>(vertexNum,
+                        sizeof(ModelVertexCompressed), BufferStorageMode::Device, vertexBufferUsage.mPosition);
+
+    // NOTE: Position is mapped into [-1, 1] by the AABB. Degenerated
+    // axis is mapped to zero, which is decoded back to the AABB center.
+    auto aabbCenter = aabb.GetCenter();
+    auto aabbExtent = aabb.GetExtent();
+    auto aabbExtentInverse = Vector3f(aabbExtent.x > 0.0f ? 1.0f / aabbExtent.x : 0.0f,
+                                      aabbExtent.y > 0.0f ? 1.0f / aabbExtent.y : 0.0f,
+                                      aabbExtent.z > 0.0f ? 1.0f / aabbExtent.z : 0.0f);
+
+    auto vertexData = reinterpret_cast<ModelVertexCompressed *>(
+                          sMasterRenderer->Map(vertexBuffer.get(),
+                                  BufferAccessMode::WriteBuffer,
+                                  BufferFlushMode::Automatic,
+                                  BufferSynchronizationMode::Unsynchronized,
+                                  vertexBuffer->GetDataOffset(),
+                                  vertexBuffer->GetDataSize()));
+
+    for (size_t vertexIndex = 0; vertexIndex < aiMesh->mNumVertices; ++vertexIndex)
+    {
+        auto& vertex = vertexData[vertexIndex];
+
+        // Position
+        {
+            auto position = Vector3f(aiMesh->mVertices[vertexIndex].x,
+                                     aiMesh->mVertices[vertexIndex].y,
+                                     aiMesh->mVertices[vertexIndex].z);
+            auto positionRelative = glm::clamp(glm::vec4((position - aabbCenter) * aabbExtentInverse, 0.0f), -1.0f, 1.0f);
+
+            if (vertexBufferLayout.mVertexCompression == ModelVertexCompression::Snorm16Position)
+            {
+                vertex.mPosition = glm::packSnorm4x16(positionRelative);
+            }
+            else
+            {
+                vertex.mPosition = glm::packHalf4x16(positionRelative);
+            }
+        }
+
+        // Normal
+        if (aiMesh->mNormals)
+        {
+            vertex.mNormal = glm::packSnorm2x16(EncodeOctahedral(Vector3f(aiMesh->mNormals[vertexIndex].x,
+                                                aiMesh->mNormals[vertexIndex].y,
+                                                aiMesh->mNormals[vertexIndex].z)));
+        }
+        else
+        {
+            vertex.mNormal = glm::packSnorm2x16(Vector2f::Zero);
+        }
+
+        // Texture coordinate
+        if (aiMesh->mTextureCoords[0])
+        {
+            vertex.mTexCoord = glm::packHalf2x16(Vector2f(aiMesh->mTextureCoords[0][vertexIndex].x,
+                                                 aiMesh->mTextureCoords[0][vertexIndex].y));
+        }
+        else
+        {
+            vertex.mTexCoord = glm::packHalf2x16(Vector2f::Zero);
+        }
+    }
+
+    sMasterRenderer->Unmap(vertexBuffer.get());
+
+    model->mVertexNum += vertexNum;
+    model->mVertexBufferByteNum += vertexBuffer->GetDataSize();
+    model->mVertexBufferByteNumUncompressed += size_t(vertexNum) * sizeof(ModelVertex);
+    model->mVertexBufferNum += 1;
+
+    auto vertexFormat = GetVertexFormat(vertexBufferLayout.mVertexCompression);
+    auto vertexGroup = make_shared<VertexGroup>();
+    vertexGroup->SetVertexBuffer(0, vertexBuffer, 0, vertexFormat->GetVertexBufferStride(0));
+    return vertexGroup;
+}
+
+Vector2f
+ModelImporter::EncodeOctahedral(const Vector3f& normal)
+{
+    auto l1Norm = glm::abs(normal.x) + glm::abs(normal.y) + glm::abs(normal.z);
+    if (l1Norm == 0.0f)
+    {
+        // NOTE: Zero normal is allowed when the model has no normal.
+        return Vector2f::Zero;
+    }
+
+    auto x = normal.x / l1Norm;
+    auto y = normal.y / l1Norm;
+
+    // Fold the lower hemisphere over the diagonals.
+    if (normal.z < 0.0f)
+    {
+        auto xFolded = (1.0f - glm::abs(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+        auto yFolded = (1.0f - glm::abs(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+        x = xFolded;
+        y = yFolded;
+    }
+
+    return Vector2f(x, y);
+}
+
+void
+ModelImporter::ReportVertexCompression(const Model *model, const ModelLayoutOption& vertexBufferLayout)
+{
+    if (vertexBufferLayout.mVertexCompression == ModelVertexCompression::None
+            || model->mVertexNum == 0)
+    {
+        return;
+    }
+
+    auto vertexByteNum = double(model->mVertexBufferByteNum);
+    auto vertexByteNumUncompressed = double(model->mVertexBufferByteNumUncompressed);
+
+    // NOTE: Vertex fetch bandwidth is estimated by assuming each vertex
+    // is fetched once per draw of the whole model at 60 frames per second.
+    Debug::OutputStringFormat("Model \"%s\" vertex compression:\n", model->mFileName.c_str());
+    Debug::OutputStringFormat("    Vertex:    %d vertices in %d vertex buffers.\n",
+                              model->mVertexNum, model->mVertexBufferNum);
+    Debug::OutputStringFormat("    Stride:    %.1f bytes, %.1f bytes uncompressed.\n",
+                              vertexByteNum / model->mVertexNum,
+                              vertexByteNumUncompressed / model->mVertexNum);
+    Debug::OutputStringFormat("    Memory:    %.1f KB, %.1f KB uncompressed, %.1f%% saved.\n",
+                              vertexByteNum / Kilobytes(1), vertexByteNumUncompressed / Kilobytes(1),
+                              100.0 * (1.0 - vertexByteNum / vertexByteNumUncompressed));
+    Debug::OutputStringFormat("    Bandwidth: %.2f MB/s saved at 60 draws per second.\n",
+                              (vertexByteNumUncompressed - vertexByteNum) * 60.0 / Megabytes(1));
+}
+
 std::shared_ptr<Material>
 ModelImporter::CreateMaterial(const string& modelFilePath, const aiScene *aiScene, const aiMesh *aiMesh)
 {
@@ -361,6 +650,27 @@ ModelImporter::GetMaterialFloat(aiMaterial *aiMaterial, const char *param1, int
     return constant;
 }
 
+void
+ModelImporter::CollectMaterial(Node *node, vector<Material *>& materialList)
+{
+    for (auto child = node->GetFirstChild(); child != nullptr; child = child->GetNextSibling())
+    {
+        if (child->mSpatialType == SpatialType::Visual)
+        {
+            auto childVisual = static_cast<Visual *>(child);
+            auto material = childVisual->GetMesh()->GetMaterial();
+            if (material && find(materialList.begin(), materialList.end(), material.get()) == materialList.end())
+            {
+                materialList.push_back(material.get());
+            }
+        }
+        else
+        {
+            CollectMaterial(static_cast<Node *>(child), materialList);
+        }
+    }
+}
+
 Texture2d *
 ModelImporter::LoadMaterialTexture(const string& modelDirectoryPath, const aiMaterial *material, aiTextureType materialType)
 {
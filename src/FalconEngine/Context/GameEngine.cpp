@@ -7,6 +7,9 @@
 
 #include <mutex>
 
+#include <FalconEngine/Core/FrameAllocator.h>
+#include <FalconEngine/Core/MemoryTracker.h>
+
 #if defined(FALCON_ENGINE_WINDOW_GLFW)
 #include <FalconEngine/Context/Platform/GLFW/GLFWGameEngineData.h>
 #endif
@@ -92,6 +95,30 @@ GameEngine::Initialize()
         mGame->Initialize();
     }
 
+    // NOTE: The record and replay begin after the game has loaded
+    // its assets, so that the loading time is not part of the first frame.
+    if (!mSettings->mInputReplayFilePath.empty())
+    {
+        mInput->StartReplay(mSettings->mInputReplayFilePath);
+    }
+
+    if (!mSettings->mInputRecordFilePath.empty())
+    {
+        mInput->StartRecord(mSettings->mInputRecordFilePath);
+    }
+
+    if (!mSettings->mFrameTimingFilePath.empty())
+    {
+        mProfiler->StartFrameTiming(mSettings->mFrameTimingFilePath);
+    }
+
+    // NOTE: The render thread takes the rendering context after the
+    // game has loaded its assets.
+    if (mGraphics != nullptr && mSettings->mRenderThreadEnabled)
+    {
+        mGraphics->StartRenderThread();
+    }
+
     mInitialized = true;
 }
 
@@ -101,83 +128,110 @@ GameEngine::Loop()
     if (mGame != nullptr)
     {
         double lastFrameBegunMillisecond = GameTimer::GetMilliseconds();
-        double lastRenderBegunMillisecond = lastFrameBegunMillisecond;
-        int    lastFrameUpdateTotalCount = 0;
-
-        // First update has no previous elapsed time
         double lastUpdateElapsedMillisecond = 0;
 
+        // NOTE: Start with one update worth of time, so that the first
+        // frame doesn't render the scene before any update.
+        double updateAccumulatedMillisecond = mSettings->mUpdateElapsedMillisecond;
+
+        auto frameAllocator = FrameAllocator::GetInstance();
+        auto memoryTracker = MemoryTracker::GetInstance();
+
         while (mRunning)
         {
+            // NOTE: Release all the frame memory allocated in last frame.
+            FrameAllocator::BeginFrame();
+
             double lastFrameEndedMillisecond = GameTimer::GetMilliseconds();
-            double lastRenderEndedMillisecond = lastFrameEndedMillisecond;
 
             // Get the time elapsed during the LAST frame.
             double lastFrameElapsedMillisecond = lastFrameEndedMillisecond - lastFrameBegunMillisecond;
-            double lastRenderElapsedMillisecond = lastRenderEndedMillisecond - lastRenderBegunMillisecond;
 
             // Reset frame start point.
             lastFrameBegunMillisecond = lastFrameEndedMillisecond;
 
+            // NOTE: Close allocation statistics of the LAST frame.
+            memoryTracker->UpdateFrame(lastFrameElapsedMillisecond);
+
             // NOTE(Wuxiang): Elapsed time count from before last input update
             // to before current input update.
-            mInput->UpdateFrame(lastFrameElapsedMillisecond);
+            //
+            // NOTE: When replaying, the game is driven by the recorded elapsed
+            // time instead, so that it updates exactly as it did when recorded,
+            // while the profiler still measures the actual time.
+            double lastFrameGameElapsedMillisecond = mInput->UpdateFrame(lastFrameElapsedMillisecond);
+            if (mInput->IsReplayFinished())
+            {
+                break;
+            }
 
             // NOTE(Wuxiang): Update frame-rate sensitive data.
-            mGame->UpdateFrame(mGraphics, mInput, lastFrameElapsedMillisecond);
+            mGame->UpdateFrame(mGraphics, mInput, lastFrameGameElapsedMillisecond);
 
-            // Reset update accumulated time elapsed.
-            int    currentFrameUpdateTotalCount = 0;
-            double currentUpdateTotalElapsedMillisecond = 0;
-            double lastUpdateBegunMillisecond = GameTimer::GetMilliseconds();
-            double lastUpdateEndedMillisecond = 0;
+            // NOTE: Consume the elapsed time in fixed steps. When the
+            // update couldn't keep up, running all the updates owed would make
+            // the next frame even longer, so the time beyond the catch-up
+            // budget is dropped and the simulation slows down instead.
+            const double updateElapsedMillisecond = mSettings->mUpdateElapsedMillisecond;
+            const double updateBudgetMillisecond = updateElapsedMillisecond * mSettings->mUpdateCountMax;
 
-            // NOTE(Wuxiang): Elapsed time count from before frame-sensitive
-            // update to after frame-sensitive update.
-            double currentFrameSensitiveUpdateElapsedMillisecond = lastUpdateBegunMillisecond - lastFrameEndedMillisecond;
+            updateAccumulatedMillisecond += lastFrameGameElapsedMillisecond;
 
-            do
+            int currentFrameUpdateSkippedCount = 0;
+            if (updateAccumulatedMillisecond > updateBudgetMillisecond)
             {
-                // NOTE(Wuxiang): Elapsed time count from before last game update
-                // to before current game update.
-                mGame->Update(mGraphics, mInput, currentFrameUpdateTotalCount == 0
-                              ? lastUpdateElapsedMillisecond
-                              + lastRenderElapsedMillisecond
-                              + currentFrameSensitiveUpdateElapsedMillisecond
-                              : lastUpdateElapsedMillisecond);
-                ++currentFrameUpdateTotalCount;
+                currentFrameUpdateSkippedCount = int((updateAccumulatedMillisecond - updateBudgetMillisecond) / updateElapsedMillisecond);
+                updateAccumulatedMillisecond = updateBudgetMillisecond;
+
+                ++mProfiler->mUpdateClampedTotalCount;
+            }
+
+            int currentFrameUpdateTotalCount = 0;
+            while (updateAccumulatedMillisecond >= updateElapsedMillisecond)
+            {
+                double lastUpdateBegunMillisecond = GameTimer::GetMilliseconds();
 
-                lastUpdateEndedMillisecond = GameTimer::GetMilliseconds();
+                mGame->Update(mGraphics, mInput, updateElapsedMillisecond);
+                ++currentFrameUpdateTotalCount;
 
                 // Get the time elapsed during the LAST update.
-                lastUpdateElapsedMillisecond = lastUpdateEndedMillisecond - lastUpdateBegunMillisecond;
-                currentUpdateTotalElapsedMillisecond += lastUpdateElapsedMillisecond;
+                lastUpdateElapsedMillisecond = GameTimer::GetMilliseconds() - lastUpdateBegunMillisecond;
 
-                // Reset update start point.
-                lastUpdateBegunMillisecond = lastUpdateEndedMillisecond;
+                updateAccumulatedMillisecond -= updateElapsedMillisecond;
             }
-            while (currentUpdateTotalElapsedMillisecond <= mSettings->mFrameElapsedMillisecond - lastRenderElapsedMillisecond);
+
+            // NOTE: The remaining time is how far the render time is
+            // past the last update, as a fraction of an update.
+            double interpolationAlpha = updateAccumulatedMillisecond / updateElapsedMillisecond;
 
             // Output performance profile
             double lastFrameFps = 1000 / lastFrameElapsedMillisecond;
 
             mProfiler->mLastFrameElapsedMillisecond  = lastFrameElapsedMillisecond;
-            mProfiler->mLastFrameUpdateTotalCount    = lastFrameUpdateTotalCount;
+            mProfiler->mLastFrameUpdateTotalCount    = currentFrameUpdateTotalCount;
+            mProfiler->mLastFrameUpdateSkippedCount  = currentFrameUpdateSkippedCount;
+            mProfiler->mUpdateSkippedTotalCount     += currentFrameUpdateSkippedCount;
+            mProfiler->mLastFrameInterpolationAlpha  = interpolationAlpha;
             mProfiler->mLastFrameFps                 = lastFrameFps;
             mProfiler->mLastUpdateElapsedMillisecond = lastUpdateElapsedMillisecond;
-            mProfiler->mLastRenderElapsedMillisecond = lastRenderElapsedMillisecond;
-
-            // Store last update count
-            lastFrameUpdateTotalCount = currentFrameUpdateTotalCount;
-
-            // Reset render start point.
-            lastRenderBegunMillisecond = GameTimer::GetMilliseconds();
+            mProfiler->mLastFrameAllocationNum       = memoryTracker->GetLastFrameAllocationNum();
 
+            // NOTE: Submit the frame and hand it off to the render
+            // side, which renders it in place or on the render thread.
             mGame->RenderBegin(mGraphics);
-
-            // NEW(Wuxiang): Add interpolation support.
-            mGame->Render(mGraphics, 1.0f);
+            mGame->Render(mGraphics, interpolationAlpha);
             mGame->RenderEnd(mGraphics);
+
+            // NOTE: The render side timings are published at the
+            // handoff, which are of the previous frame.
+            mProfiler->mLastRenderElapsedMillisecond  = mGraphics->GetLastRenderElapsedMillisecond();
+            mProfiler->mLastSwapElapsedMillisecond    = mGraphics->GetLastSwapElapsedMillisecond();
+            mProfiler->mLastHandoffElapsedMillisecond = mGraphics->GetLastHandoffElapsedMillisecond();
+            mProfiler->mLastFrameLatencyMillisecond   = mGraphics->GetLastFrameLatencyMillisecond();
+
+            mProfiler->mLastFrameAllocatorUsedByte      = frameAllocator->GetUsedSize();
+            mProfiler->mFrameAllocatorHighWaterMarkByte = frameAllocator->GetHighWaterMark();
+            mProfiler->UpdateFrame();
         }
     }
 }
@@ -185,10 +239,25 @@ GameEngine::Loop()
 void
 GameEngine::Destory()
 {
+    // NOTE: Take the rendering context back before the game releases
+    // its resources.
+    if (mGraphics != nullptr)
+    {
+        mGraphics->StopRenderThread();
+    }
+
     if (mGame != nullptr)
     {
         mGame->Destory();
     }
+
+    mInput->StopRecord();
+    mProfiler->StopFrameTiming();
+
+    // NOTE: Report the memory still alive after the asset manager and the
+    // renderers have released their resources, which happens in static
+    // destruction.
+    MemoryTracker::GetInstance()->OutputLeakAtExit();
 }
 
 }
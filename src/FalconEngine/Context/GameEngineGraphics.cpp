@@ -1,10 +1,13 @@
 #include <FalconEngine/Context/GameEngineGraphics.h>
 
+#include <FalconEngine/Context/GameTimer.h>
 #include <FalconEngine/Graphics/Renderer/Renderer.h>
 #include <FalconEngine/Graphics/Renderer/Debug/DebugRenderer.h>
 #include <FalconEngine/Graphics/Renderer/Entity/EntityRenderer.h>
 #include <FalconEngine/Graphics/Renderer/Font/FontRenderer.h>
 
+using namespace std;
+
 namespace FalconEngine
 {
 
@@ -16,7 +19,19 @@ GameEngineGraphics::GameEngineGraphics() :
     mEntityRenderer(nullptr),
     mFontRenderer(nullptr),
     mMasterRenderer(nullptr),
-    mUiRenderer(nullptr)
+    mUiRenderer(nullptr),
+    mPercentRecord(0),
+    mPercentRender(0),
+    mHandoffMillisecond(0),
+    mRenderElapsedMillisecond(0),
+    mSwapElapsedMillisecond(0),
+    mFrameLatencyMillisecond(0),
+    mLastRenderElapsedMillisecond(0),
+    mLastSwapElapsedMillisecond(0),
+    mLastHandoffElapsedMillisecond(0),
+    mLastFrameLatencyMillisecond(0),
+    mRenderPending(false),
+    mRenderExiting(false)
 {
 }
 
@@ -49,35 +64,48 @@ GameEngineGraphics::Initialize()
 void
 GameEngineGraphics::Destroy()
 {
+    StopRenderThread();
+}
+
+void
+GameEngineGraphics::ClearFrameBuffer(const Vector4f& color, float depth, unsigned int stencil)
+{
+    mClearRecord.mEnabled = true;
+    mClearRecord.mColor = color;
+    mClearRecord.mDepth = depth;
+    mClearRecord.mStencil = stencil;
 }
 
 void
 GameEngineGraphics::RenderBegin()
 {
-    mDebugRenderer->RenderBegin();
-    mEntityRenderer->RenderBegin();
-    mFontRenderer->RenderBegin();
+    mClearRecord.mEnabled = false;
 }
 
 void
 GameEngineGraphics::Render(double percent)
 {
-    mEntityRenderer->Render(percent);
-
-    // NOTE(Wuxiang): The render order is important here.
-    mDebugRenderer->Render(percent);
-    mFontRenderer->Render(percent);
+    mPercentRecord = percent;
 }
 
 void
 GameEngineGraphics::RenderEnd()
 {
-    mDebugRenderer->RenderEnd();
-    mEntityRenderer->RenderEnd();
-    mFontRenderer->RenderEnd();
+    Handoff();
 
-    // Has to be the last.
-    mMasterRenderer->SwapFrameBufferPlatform();
+    if (mRenderThread.joinable())
+    {
+        {
+            lock_guard<mutex> lock(mRenderMutex);
+            mRenderPending = true;
+        }
+
+        mRenderCondition.notify_all();
+    }
+    else
+    {
+        RenderFrame();
+    }
 }
 
 void
@@ -91,4 +119,195 @@ GameEngineGraphics::UpdateFrame(double elapsed)
     mDebugRenderer->UpdateFrame(elapsed);
 }
 
+/************************************************************************/
+/* Render Thread API                                                    */
+/************************************************************************/
+void
+GameEngineGraphics::StartRenderThread()
+{
+    if (mRenderThread.joinable())
+    {
+        return;
+    }
+
+    // NOTE: The context could only be made current on the render
+    // thread after it is released here.
+    mMasterRenderer->SetContextCurrent(false);
+
+    mRenderPending = false;
+    mRenderExiting = false;
+    mRenderThread = thread(&GameEngineGraphics::RenderThread, this);
+}
+
+void
+GameEngineGraphics::StopRenderThread()
+{
+    if (!mRenderThread.joinable())
+    {
+        return;
+    }
+
+    {
+        lock_guard<mutex> lock(mRenderMutex);
+        mRenderExiting = true;
+    }
+
+    mRenderCondition.notify_all();
+    mRenderThread.join();
+
+    mMasterRenderer->SetContextCurrent(true);
+}
+
+bool
+GameEngineGraphics::IsRenderThreadRunning() const
+{
+    return mRenderThread.joinable();
+}
+
+double
+GameEngineGraphics::GetLastRenderElapsedMillisecond() const
+{
+    return mLastRenderElapsedMillisecond;
+}
+
+double
+GameEngineGraphics::GetLastSwapElapsedMillisecond() const
+{
+    return mLastSwapElapsedMillisecond;
+}
+
+double
+GameEngineGraphics::GetLastHandoffElapsedMillisecond() const
+{
+    return mLastHandoffElapsedMillisecond;
+}
+
+double
+GameEngineGraphics::GetLastFrameLatencyMillisecond() const
+{
+    return mLastFrameLatencyMillisecond;
+}
+
+/************************************************************************/
+/* Private Members                                                      */
+/************************************************************************/
+void
+GameEngineGraphics::Handoff()
+{
+    double handoffBegunMillisecond = GameTimer::GetMilliseconds();
+
+    if (mRenderThread.joinable())
+    {
+        unique_lock<mutex> lock(mRenderMutex);
+        mRenderCondition.wait(lock, [this]
+        {
+            return !mRenderPending;
+        });
+
+        if (mRenderException)
+        {
+            auto renderException = mRenderException;
+            mRenderException = nullptr;
+            rethrow_exception(renderException);
+        }
+    }
+
+    // NOTE: The render side is idle from here until the frame is
+    // handed off, so that both sides could be accessed.
+    mLastHandoffElapsedMillisecond = GameTimer::GetMilliseconds() - handoffBegunMillisecond;
+    mLastRenderElapsedMillisecond = mRenderElapsedMillisecond;
+    mLastSwapElapsedMillisecond = mSwapElapsedMillisecond;
+    mLastFrameLatencyMillisecond = mFrameLatencyMillisecond;
+
+    mDebugRenderer->Handoff();
+    mEntityRenderer->Handoff(mPercentRecord);
+    mFontRenderer->Handoff();
+
+    mClearRender = mClearRecord;
+    mPercentRender = mPercentRecord;
+
+    mHandoffMillisecond = GameTimer::GetMilliseconds();
+}
+
+void
+GameEngineGraphics::RenderFrame()
+{
+    double renderBegunMillisecond = GameTimer::GetMilliseconds();
+
+    if (mClearRender.mEnabled)
+    {
+        mMasterRenderer->ClearFrameBuffer(mClearRender.mColor, mClearRender.mDepth, mClearRender.mStencil);
+    }
+
+    mDebugRenderer->RenderBegin();
+    mEntityRenderer->RenderBegin();
+    mFontRenderer->RenderBegin();
+
+    mEntityRenderer->Render(mPercentRender);
+
+    // NOTE(Wuxiang): The render order is important here.
+    mDebugRenderer->Render(mPercentRender);
+    mFontRenderer->Render(mPercentRender);
+
+    mDebugRenderer->RenderEnd();
+    mEntityRenderer->RenderEnd();
+    mFontRenderer->RenderEnd();
+
+    // Has to be the last.
+    double swapBegunMillisecond = GameTimer::GetMilliseconds();
+    mMasterRenderer->SwapFrameBufferPlatform();
+    double swapEndedMillisecond = GameTimer::GetMilliseconds();
+
+    mRenderElapsedMillisecond = swapBegunMillisecond - renderBegunMillisecond;
+    mSwapElapsedMillisecond = swapEndedMillisecond - swapBegunMillisecond;
+    mFrameLatencyMillisecond = swapEndedMillisecond - mHandoffMillisecond;
+}
+
+void
+GameEngineGraphics::RenderThread()
+{
+    mMasterRenderer->SetContextCurrent(true);
+
+    unique_lock<mutex> lock(mRenderMutex);
+    while (true)
+    {
+        mRenderCondition.wait(lock, [this]
+        {
+            return mRenderPending || mRenderExiting;
+        });
+
+        // NOTE: The last handed off frame is still rendered before
+        // exiting.
+        if (!mRenderPending)
+        {
+            break;
+        }
+
+        lock.unlock();
+
+        exception_ptr renderException;
+        try
+        {
+            RenderFrame();
+        }
+        catch (...)
+        {
+            renderException = current_exception();
+        }
+
+        lock.lock();
+        mRenderPending = false;
+        if (renderException)
+        {
+            mRenderException = renderException;
+        }
+
+        mRenderCondition.notify_all();
+    }
+
+    lock.unlock();
+
+    mMasterRenderer->SetContextCurrent(false);
+}
+
 }
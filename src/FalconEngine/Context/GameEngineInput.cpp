@@ -1,9 +1,13 @@
 #include <FalconEngine/Context/GameEngineInput.h>
 
 #include <FalconEngine/Context/GameEngineSettings.h>
+#include <FalconEngine/Context/GameTimer.h>
+#include <FalconEngine/Input/InputMap.h>
 #include <FalconEngine/Input/MouseState.h>
 #include <FalconEngine/Input/KeyboardState.h>
 
+#include <cereal/archives/portable_binary.hpp>
+
 #if defined(FALCON_ENGINE_WINDOW_GLFW)
 #include <FalconEngine/Context/Platform/GLFW/GLFWGameEngineData.h>
 #endif
@@ -11,24 +15,40 @@
 namespace FalconEngine
 {
 
+// NOTE: Increase the version when the record format changes, so that
+// the stale record is rejected instead of replayed wrongly.
+static const uint32_t sRecordVersion = 1;
+
 /************************************************************************/
 /* Constructors and Destructor                                          */
 /************************************************************************/
 GameEngineInput::GameEngineInput() :
     mDispatcher(nullptr),
+    mInputMap(std::make_shared<InputMap>()),
     mKeyboardState(std::make_shared<KeyboardState>()),
-    mMouseState(std::make_shared<MouseState>())
+    mMouseState(std::make_shared<MouseState>()),
+    mRecordBegunMillisecond(0),
+    mReplaying(false),
+    mReplayBegunMillisecond(0),
+    mReplayFrameIndex(0)
 {
 }
 
 GameEngineInput::~GameEngineInput()
 {
+    StopRecord();
     DestroyPlatform();
 }
 
 /************************************************************************/
 /* Public Members                                                       */
 /************************************************************************/
+InputMap *
+GameEngineInput::GetInputMap() const
+{
+    return mInputMap.get();
+}
+
 KeyboardState *
 GameEngineInput::GetKeyboardState() const
 {
@@ -45,23 +65,251 @@ void
 GameEngineInput::Initialize()
 {
     InitializePlatform();
+
+    // NOTE: Default movement axes used by the player camera. The game
+    // could rebind them by the name.
+    auto moveForwardAxis = mInputMap->AddAxis("MoveForward");
+    mInputMap->BindAxis(moveForwardAxis, InputBinding(Key::W, 1.0f));
+    mInputMap->BindAxis(moveForwardAxis, InputBinding(Key::S, -1.0f));
+
+    auto moveRightAxis = mInputMap->AddAxis("MoveRight");
+    mInputMap->BindAxis(moveRightAxis, InputBinding(Key::D, 1.0f));
+    mInputMap->BindAxis(moveRightAxis, InputBinding(Key::A, -1.0f));
 }
 
-void
+double
 GameEngineInput::UpdateFrame(double elapsed)
 {
     // NOTE(Wuxiang): Have to poll events before updating based on events.
     PollEvent();
 
+    if (mReplaying)
+    {
+        elapsed = ReplayFrame(elapsed);
+    }
+
+    if (mRecordArchive)
+    {
+        RecordFrame(elapsed);
+    }
+
     // NOTE(Wuxiang): Update based on events pulled.
     UpdateEvent(elapsed);
+
+    return elapsed;
+}
+
+/************************************************************************/
+/* Record and Replay                                                    */
+/************************************************************************/
+void
+GameEngineInput::StartRecord(const std::string& recordFilePath)
+{
+    StopRecord();
+
+    mRecordStream.open(recordFilePath, std::ios::binary | std::ios::trunc);
+    if (!mRecordStream.is_open())
+    {
+        FALCON_ENGINE_THROW_RUNTIME_EXCEPTION(std::string("File\'") + recordFilePath + "\' could not be opened.");
+    }
+
+    mRecordArchive = std::make_unique<cereal::PortableBinaryOutputArchive>(mRecordStream);
+    (*mRecordArchive)(sRecordVersion);
+
+    mRecordBegunMillisecond = GameTimer::GetMilliseconds();
+    mRecordFrame.mEventList.clear();
 }
 
+void
+GameEngineInput::StopRecord()
+{
+    if (!mRecordArchive)
+    {
+        return;
+    }
+
+    mRecordArchive.reset();
+    mRecordStream.close();
+}
+
+bool
+GameEngineInput::IsRecording() const
+{
+    return bool(mRecordArchive);
+}
+
+void
+GameEngineInput::StartReplay(const std::string& recordFilePath)
+{
+    std::ifstream recordStream(recordFilePath, std::ios::binary);
+    if (!recordStream.is_open())
+    {
+        FALCON_ENGINE_THROW_RUNTIME_EXCEPTION(std::string("File\'") + recordFilePath + "\' was not found.");
+    }
+
+    cereal::PortableBinaryInputArchive recordArchive(recordStream);
+
+    uint32_t recordVersion;
+    recordArchive(recordVersion);
+    if (recordVersion != sRecordVersion)
+    {
+        FALCON_ENGINE_THROW_RUNTIME_EXCEPTION(std::string("File\'") + recordFilePath + "\' is recorded in an unsupported version.");
+    }
+
+    // NOTE: The frames are appended as they are recorded, so the
+    // frame number is not known until the end of the file.
+    mReplayFrameList.clear();
+    while (recordStream.peek() != std::ifstream::traits_type::eof())
+    {
+        mReplayFrameList.emplace_back();
+        recordArchive(mReplayFrameList.back());
+    }
+
+    mReplaying = true;
+    mReplayBegunMillisecond = GameTimer::GetMilliseconds();
+    mReplayFrameIndex = 0;
+}
+
+void
+GameEngineInput::StopReplay()
+{
+    mReplaying = false;
+    mReplayFrameList.clear();
+    mReplayFrameIndex = 0;
+}
+
+bool
+GameEngineInput::IsReplaying() const
+{
+    return mReplaying;
+}
+
+bool
+GameEngineInput::IsReplayFinished() const
+{
+    return mReplaying && mReplayFrameIndex >= mReplayFrameList.size();
+}
+
+/************************************************************************/
+/* Internal Members                                                     */
+/************************************************************************/
+void
+GameEngineInput::SetKeyInternal(Key key, bool keyPressed)
+{
+    DispatchEvent(InputEventType::Key, int(key), keyPressed, 0, 0);
+}
+
+void
+GameEngineInput::SetMouseButtonInternal(MouseButton button, bool buttonPressed)
+{
+    DispatchEvent(InputEventType::MouseButton, int(button), buttonPressed, 0, 0);
+}
+
+void
+GameEngineInput::SetMousePositionInternal(double x, double y)
+{
+    DispatchEvent(InputEventType::MousePosition, 0, false, x, y);
+}
+
+void
+GameEngineInput::SetMouseWheelInternal(double yoffset)
+{
+    DispatchEvent(InputEventType::MouseWheel, 0, false, 0, yoffset);
+}
+
+/************************************************************************/
+/* Private Members                                                      */
+/************************************************************************/
 void
 GameEngineInput::UpdateEvent(double elapsed)
 {
     mKeyboardState->UpdateEvent(elapsed);
     mMouseState->UpdateEvent(elapsed);
+
+    // NOTE: Resolve the bindings after the state is updated, so that
+    // the action sees the transition of this frame.
+    mInputMap->UpdateEvent(mKeyboardState.get(), mMouseState.get());
+}
+
+void
+GameEngineInput::ApplyEvent(const InputEvent& event, double timeCurrent)
+{
+    switch (InputEventType(event.mType))
+    {
+    case InputEventType::Key:
+        mKeyboardState->SetKeyInternal(Key(event.mCode), event.mPressed, timeCurrent);
+        break;
+
+    case InputEventType::MouseButton:
+        mMouseState->SetButtonInternal(MouseButton(event.mCode), event.mPressed, timeCurrent);
+        break;
+
+    case InputEventType::MousePosition:
+        mMouseState->SetPositionInternal(event.mX, event.mY, timeCurrent);
+        break;
+
+    case InputEventType::MouseWheel:
+        mMouseState->SetWheelValueInternal(event.mY, timeCurrent);
+        break;
+
+    default:
+        FALCON_ENGINE_THROW_ASSERTION_EXCEPTION();
+    }
+}
+
+void
+GameEngineInput::DispatchEvent(InputEventType type, int code, bool pressed, double x, double y)
+{
+    // NOTE: The live input is dropped while replaying, so that it
+    // doesn't disturb the replayed run.
+    if (mReplaying)
+    {
+        return;
+    }
+
+    auto timeCurrent = GameTimer::GetMilliseconds();
+    auto event = InputEvent(type, code, pressed, x, y, timeCurrent - mRecordBegunMillisecond);
+    RecordEvent(event);
+    ApplyEvent(event, timeCurrent);
+}
+
+void
+GameEngineInput::RecordEvent(const InputEvent& event)
+{
+    if (mRecordArchive)
+    {
+        mRecordFrame.mEventList.push_back(event);
+    }
+}
+
+void
+GameEngineInput::RecordFrame(double elapsed)
+{
+    mRecordFrame.mElapsedMillisecond = elapsed;
+    (*mRecordArchive)(mRecordFrame);
+    mRecordFrame.mEventList.clear();
+}
+
+double
+GameEngineInput::ReplayFrame(double elapsed)
+{
+    // NOTE: The live elapsed time is used after the replay finishes,
+    // until the game stops the replay.
+    if (mReplayFrameIndex >= mReplayFrameList.size())
+    {
+        return elapsed;
+    }
+
+    const auto& frame = mReplayFrameList[mReplayFrameIndex++];
+    for (const auto& event : frame.mEventList)
+    {
+        // NOTE: The event time is relative to the replay, so that it
+        // is spaced as it was recorded.
+        ApplyEvent(event, mReplayBegunMillisecond + event.mTime);
+        RecordEvent(event);
+    }
+
+    return frame.mElapsedMillisecond;
 }
 
 }
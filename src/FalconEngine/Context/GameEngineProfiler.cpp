@@ -11,6 +11,36 @@ GameEngineProfiler::Initialize()
 {
 }
 
+void
+GameEngineProfiler::StartFrameTiming(const std::string& frameTimingFilePath)
+{
+    StopFrameTiming();
+
+    mFrameTimingStream.open(frameTimingFilePath, std::ios::trunc);
+    if (!mFrameTimingStream.is_open())
+    {
+        FALCON_ENGINE_THROW_RUNTIME_EXCEPTION(std::string("File\'") + frameTimingFilePath + "\' could not be opened.");
+    }
+
+    mFrameTimingStream << "frame,frame_ms,update_ms,update_count,update_skipped_count,"
+                       "render_ms,swap_ms,handoff_ms,latency_ms,allocation_num\n";
+}
+
+void
+GameEngineProfiler::StopFrameTiming()
+{
+    if (mFrameTimingStream.is_open())
+    {
+        mFrameTimingStream.close();
+    }
+}
+
+uint64_t
+GameEngineProfiler::GetFrameNum() const
+{
+    return mFrameNum;
+}
+
 double
 GameEngineProfiler::GetLastFrameElapsedMillisecond() const
 {
@@ -29,6 +59,30 @@ GameEngineProfiler::GetLastFrameUpdateTotalCount() const
     return mLastFrameUpdateTotalCount;
 }
 
+int
+GameEngineProfiler::GetLastFrameUpdateSkippedCount() const
+{
+    return mLastFrameUpdateSkippedCount;
+}
+
+uint64_t
+GameEngineProfiler::GetUpdateSkippedTotalCount() const
+{
+    return mUpdateSkippedTotalCount;
+}
+
+uint64_t
+GameEngineProfiler::GetUpdateClampedTotalCount() const
+{
+    return mUpdateClampedTotalCount;
+}
+
+double
+GameEngineProfiler::GetLastFrameInterpolationAlpha() const
+{
+    return mLastFrameInterpolationAlpha;
+}
+
 double
 GameEngineProfiler::GetLastUpdateElapsedMillisecond() const
 {
@@ -41,4 +95,65 @@ GameEngineProfiler::GetLastRenderElapsedMillisecond() const
     return mLastRenderElapsedMillisecond;
 }
 
+double
+GameEngineProfiler::GetLastSwapElapsedMillisecond() const
+{
+    return mLastSwapElapsedMillisecond;
+}
+
+double
+GameEngineProfiler::GetLastHandoffElapsedMillisecond() const
+{
+    return mLastHandoffElapsedMillisecond;
+}
+
+double
+GameEngineProfiler::GetLastFrameLatencyMillisecond() const
+{
+    return mLastFrameLatencyMillisecond;
+}
+
+uint64_t
+GameEngineProfiler::GetLastFrameAllocationNum() const
+{
+    return mLastFrameAllocationNum;
+}
+
+size_t
+GameEngineProfiler::GetLastFrameAllocatorUsedByte() const
+{
+    return mLastFrameAllocatorUsedByte;
+}
+
+size_t
+GameEngineProfiler::GetFrameAllocatorHighWaterMarkByte() const
+{
+    return mFrameAllocatorHighWaterMarkByte;
+}
+
+/************************************************************************/
+/* Private Members                                                      */
+/************************************************************************/
+void
+GameEngineProfiler::UpdateFrame()
+{
+    if (mFrameTimingStream.is_open())
+    {
+        // NOTE: The render side timings are of the previous frame,
+        // because they are published at the handoff.
+        mFrameTimingStream << mFrameNum << ','
+                           << mLastFrameElapsedMillisecond << ','
+                           << mLastUpdateElapsedMillisecond << ','
+                           << mLastFrameUpdateTotalCount << ','
+                           << mLastFrameUpdateSkippedCount << ','
+                           << mLastRenderElapsedMillisecond << ','
+                           << mLastSwapElapsedMillisecond << ','
+                           << mLastHandoffElapsedMillisecond << ','
+                           << mLastFrameLatencyMillisecond << ','
+                           << mLastFrameAllocationNum << '\n';
+    }
+
+    ++mFrameNum;
+}
+
 }
@@ -7,7 +7,28 @@ namespace FalconEngine
 /* Constructors and Destructor                                          */
 /************************************************************************/
 GameEngineSettings::GameEngineSettings() :
-    mFrameElapsedMillisecond(16.66666666666),
+    mUpdateElapsedMillisecond(16.66666666666),
+    mUpdateCountMax(5),
+    mRenderThreadEnabled(false),
+    mBatchEnabled(true),
+    mBatchDrawNumMax(65536),
+    mBatchVertexNumMax(1 << 19),
+    mBatchIndexNumMax(1 << 21),
+    mBatchCullEnabled(false),
+    mBatchOcclusionEnabled(false),
+    mBatchBindlessEnabled(false),
+    mShadowEnabled(false),
+    mShadowCascadeNum(4),
+    mShadowCascadeSize(2048),
+    mShadowCascadeSplitLambda(0.75f),
+    mShadowDistance(100.0f),
+    mShadowFilterRadius(1),
+    mLodEnabled(true),
+    mLodErrorPixel(1.0f),
+    mLodHysteresis(0.25f),
+    mInputRecordFilePath(""),
+    mInputReplayFilePath(""),
+    mFrameTimingFilePath(""),
     mMouseLimited(true),
     mMouseVisible(false),
     mWindowVisible(true),
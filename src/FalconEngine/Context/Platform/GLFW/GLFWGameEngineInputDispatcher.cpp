@@ -1,5 +1,4 @@
 #include <FalconEngine/Context/Platform/GLFW/GLFWGameEngineInputDispatcher.h>
-#include <FalconEngine/Context/GameTimer.h>
 
 #if defined(FALCON_ENGINE_WINDOW_GLFW)
 
@@ -7,8 +6,6 @@
 #include <FalconEngine/Context/Platform/GLFW/GLFWGameEngineData.h>
 
 #include <FalconEngine/Input/MouseButton.h>
-#include <FalconEngine/Input/MouseState.h>
-#include <FalconEngine/Input/KeyboardState.h>
 #include <FalconEngine/Input/KeyState.h>
 
 namespace FalconEngine
@@ -79,19 +76,19 @@ void
 GameEngineInputDispatcher::KeyCallback(GLFWwindow * /* window */, int key, int /* scancode */, int action, int /* mods */)
 {
     auto keyPressed = action == GLFW_PRESS || action == GLFW_REPEAT;
-    mInput->mKeyboardState->SetKeyInternal(Key(key), keyPressed, GameTimer::GetMilliseconds());
+    mInput->SetKeyInternal(Key(key), keyPressed);
 }
 
 void
 GameEngineInputDispatcher::MouseButtonCallback(GLFWwindow * /* window */, int button, int action, int /* mods */)
 {
-    mInput->mMouseState->SetButtonInternal(MouseButton(button), action == GLFW_PRESS, GameTimer::GetMilliseconds());
+    mInput->SetMouseButtonInternal(MouseButton(button), action == GLFW_PRESS);
 }
 
 void
 GameEngineInputDispatcher::ScrollCallback(GLFWwindow * /* window */, double /* xoffset */, double yoffset)
 {
-    mInput->mMouseState->SetWheelValueInternal(yoffset, GameTimer::GetMilliseconds());
+    mInput->SetMouseWheelInternal(yoffset);
 }
 
 void
@@ -109,7 +106,7 @@ GameEngineInputDispatcher::MousePositionCallback(GLFWwindow *window, double x, d
         sScreenInitialized = true;
     }
 
-    mInput->mMouseState->SetPositionInternal(x, sScreenHeight - y, GameTimer::GetMilliseconds());
+    mInput->SetMousePositionInternal(x, sScreenHeight - y);
 }
 
 }
@@ -0,0 +1,69 @@
+#include <FalconEngine/Core/FrameAllocator.h>
+
+#include <FalconEngine/Core/Memory.h>
+
+namespace FalconEngine
+{
+
+/************************************************************************/
+/* Static Members                                                       */
+/************************************************************************/
+const size_t FrameAllocator::Capacity = size_t(Megabytes(4));
+
+std::atomic<int64_t> FrameAllocator::sFrameIndex(0);
+
+FrameAllocator *
+FrameAllocator::GetInstance()
+{
+    // NOTE: Thread-local instance is defined in the translation unit
+    // because thread-local data could not have dll interface.
+    static thread_local FrameAllocator sInstance;
+    return &sInstance;
+}
+
+void
+FrameAllocator::BeginFrame()
+{
+    auto frameIndex = ++sFrameIndex;
+
+    auto frameAllocator = GetInstance();
+    frameAllocator->Reset();
+    frameAllocator->mFrameIndex = frameIndex;
+}
+
+int64_t
+FrameAllocator::GetFrameIndex()
+{
+    return sFrameIndex.load(std::memory_order_relaxed);
+}
+
+/************************************************************************/
+/* Constructors and Destructor                                          */
+/************************************************************************/
+FrameAllocator::FrameAllocator() :
+    LinearAllocator(Capacity),
+    mFrameIndex(sFrameIndex.load(std::memory_order_relaxed))
+{
+}
+
+FrameAllocator::~FrameAllocator()
+{
+}
+
+/************************************************************************/
+/* Public Members                                                       */
+/************************************************************************/
+void *
+FrameAllocator::Allocate(size_t size, size_t alignment)
+{
+    auto frameIndex = sFrameIndex.load(std::memory_order_relaxed);
+    if (mFrameIndex != frameIndex)
+    {
+        Reset();
+        mFrameIndex = frameIndex;
+    }
+
+    return LinearAllocator::Allocate(size, alignment);
+}
+
+}
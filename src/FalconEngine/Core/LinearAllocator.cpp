@@ -0,0 +1,110 @@
+#include <FalconEngine/Core/LinearAllocator.h>
+
+#include <cstdlib>
+
+namespace FalconEngine
+{
+
+/************************************************************************/
+/* Constructors and Destructor                                          */
+/************************************************************************/
+LinearAllocator::LinearAllocator(size_t capacity, MemoryTag tag) :
+    MemoryAllocator(capacity, tag),
+    mStorage(static_cast<unsigned char *>(malloc(capacity)))
+{
+    if (mStorage == nullptr)
+    {
+        FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("Failed to allocate allocator storage.\n");
+    }
+
+    MemoryTracker::GetInstance()->RecordAllocation(mTag, mCapacity);
+}
+
+LinearAllocator::~LinearAllocator()
+{
+#if defined(FALCON_ENGINE_DEBUG_MEMORY)
+    for (auto guardOffset : mGuardOffsetList)
+    {
+        if (!CheckGuard(mStorage + guardOffset))
+        {
+            // NOTE: Avoid throwing in destructor.
+            Debug::OutputString("Memory overflow detected: allocation guard is corrupted.\n");
+            Debug::Break();
+            break;
+        }
+    }
+#endif
+
+    MemoryTracker::GetInstance()->RecordDeallocation(mTag, mCapacity);
+
+    free(mStorage);
+}
+
+/************************************************************************/
+/* Public Members                                                       */
+/************************************************************************/
+void *
+LinearAllocator::Allocate(size_t size, size_t alignment)
+{
+    if (!IsMemoryAlignmentValid(alignment))
+    {
+        FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("Alignment must be power of two.\n");
+    }
+
+    auto storageAddress = uintptr_t(mStorage);
+    auto address = AlignMemoryAddress(storageAddress + mUsedSize, alignment);
+    auto usedSize = size_t(address - storageAddress) + size + GuardSize;
+    if (usedSize > mCapacity)
+    {
+        ThrowOutOfCapacity(size);
+    }
+
+#if defined(FALCON_ENGINE_DEBUG_MEMORY)
+    WriteGuard(mStorage + usedSize - GuardSize);
+    mGuardOffsetList.push_back(usedSize - GuardSize);
+#endif
+
+    mUsedSize = usedSize;
+    UpdateHighWaterMark();
+
+    return reinterpret_cast<void *>(address);
+}
+
+void
+LinearAllocator::Deallocate(void * /* pointer */)
+{
+}
+
+void
+LinearAllocator::Reset()
+{
+    Rewind(0);
+}
+
+/************************************************************************/
+/* Protected Members                                                    */
+/************************************************************************/
+void
+LinearAllocator::Rewind(size_t usedSize)
+{
+    if (usedSize > mUsedSize)
+    {
+        FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("Could not rewind beyond used memory.\n");
+    }
+
+#if defined(FALCON_ENGINE_DEBUG_MEMORY)
+    while (!mGuardOffsetList.empty() && mGuardOffsetList.back() >= usedSize)
+    {
+        if (!CheckGuard(mStorage + mGuardOffsetList.back()))
+        {
+            ThrowOverflow();
+        }
+
+        mGuardOffsetList.pop_back();
+    }
+#endif
+
+    mUsedSize = usedSize;
+}
+
+}
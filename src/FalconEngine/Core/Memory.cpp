@@ -1,84 +1,69 @@
 #include <FalconEngine/Core/Memory.h>
-#include <FalconEngine/Core/MemoryPool.h>
 
-#include <cstdlib>
+#include <mutex>
+#include <unordered_map>
 
 namespace FalconEngine
 {
 
-const char *__file__ = "Unknown";
-size_t      __line__ = 0;
-
-void
-PushMemoryRecord(void * /* pointer */, const char * /* file */, size_t /* line */)
+#if defined(FALCON_ENGINE_DEBUG_MEMORY)
+class MemoryRecord
 {
-    // NEW(Wuxiang): Implement to detect memory leak.
-}
-
-void
-PopMemoryRecord(void * /* pointer */)
+public:
+    const char *mFile;
+    size_t      mLine;
+};
+
+// NOTE: Use function local static to avoid static initialization
+// order problem, because allocation could happen during static initialization.
+static std::mutex&
+GetMemoryRecordMutex()
 {
-    // NEW(Wuxiang): Implement to detect memory leak.
+    static std::mutex sMutex;
+    return sMutex;
 }
 
-}
-
-using namespace FalconEngine;
-
-void *
-operator new(size_t size, MemoryPool *memory)
+static std::unordered_map<void *, MemoryRecord>&
+GetMemoryRecordTable()
 {
-    using namespace FalconEngine;
-
-    void *pointer = memory->mStorage;
-
-    // Modify storage
-    memory->mStorage = reinterpret_cast<uint8_t *>(pointer) + size;
-    memory->mStorageSize += size;
-
-    PushMemoryRecord(pointer, __file__, __line__);
-
-    // Reset to default
-    __file__ = "Unknown";
-    __line__ = 0;
-
-    return pointer;
+    static std::unordered_map<void *, MemoryRecord> sTable;
+    return sTable;
 }
+#endif
 
-void *
-operator new[](size_t size, MemoryPool *memory)
+void
+PushMemoryRecord(void *pointer, const char *file, size_t line)
 {
-    using namespace FalconEngine;
-
-    void *pointer = memory->mStorage;
-
-    // Modify storage
-    memory->mStorage = reinterpret_cast<uint8_t *>(pointer) + size;
-    memory->mStorageSize += memory->mStorageSize + size;
-
-    PushMemoryRecord(pointer, __file__, __line__);
-
-    // Reset to default
-    __file__ = "Unknown";
-    __line__ = 0;
-
-    return pointer;
+#if defined(FALCON_ENGINE_DEBUG_MEMORY)
+    std::lock_guard<std::mutex> lock(GetMemoryRecordMutex());
+    GetMemoryRecordTable()[pointer] = MemoryRecord{ file, line };
+#else
+    (void) pointer;
+    (void) file;
+    (void) line;
+#endif
 }
 
 void
-operator delete[](void *pointer, MemoryPool * /* memory */)
+PopMemoryRecord(void *pointer)
 {
-    using namespace FalconEngine;
-
-    PopMemoryRecord(pointer);
-    free(pointer);
+#if defined(FALCON_ENGINE_DEBUG_MEMORY)
+    std::lock_guard<std::mutex> lock(GetMemoryRecordMutex());
+    GetMemoryRecordTable().erase(pointer);
+#else
+    (void) pointer;
+#endif
 }
 
-void
-operator delete(void *pointer, MemoryPool * /* memory */)
+size_t
+GetMemoryRecordNum()
 {
-    using namespace FalconEngine;
+#if defined(FALCON_ENGINE_DEBUG_MEMORY)
+    std::lock_guard<std::mutex> lock(GetMemoryRecordMutex());
+    return GetMemoryRecordTable().size();
+#else
+    return 0;
+#endif
+}
 
-    PopMemoryRecord(pointer);
-    free(pointer);
 }
@@ -0,0 +1,161 @@
+#include <FalconEngine/Core/MemoryAllocator.h>
+
+#include <cstring>
+
+#include <FalconEngine/Core/Memory.h>
+
+namespace FalconEngine
+{
+
+/************************************************************************/
+/* Constructors and Destructor                                          */
+/************************************************************************/
+MemoryAllocator::MemoryAllocator(size_t capacity, MemoryTag tag) :
+    mCapacity(capacity),
+    mUsedSize(0),
+    mHighWaterMark(0),
+    mTag(tag)
+{
+}
+
+MemoryAllocator::~MemoryAllocator()
+{
+}
+
+/************************************************************************/
+/* Public Members                                                       */
+/************************************************************************/
+size_t
+MemoryAllocator::GetCapacity() const
+{
+    return mCapacity;
+}
+
+size_t
+MemoryAllocator::GetUsedSize() const
+{
+    return mUsedSize;
+}
+
+size_t
+MemoryAllocator::GetHighWaterMark() const
+{
+    return mHighWaterMark;
+}
+
+MemoryTag
+MemoryAllocator::GetTag() const
+{
+    return mTag;
+}
+
+/************************************************************************/
+/* Protected Members                                                    */
+/************************************************************************/
+void
+MemoryAllocator::UpdateHighWaterMark()
+{
+    if (mUsedSize > mHighWaterMark)
+    {
+        mHighWaterMark = mUsedSize;
+    }
+}
+
+void
+MemoryAllocator::WriteGuard(unsigned char *address) const
+{
+#if defined(FALCON_ENGINE_DEBUG_MEMORY)
+    // NOTE: The guard might not be aligned, so use memcpy instead of
+    // direct assignment.
+    uint32_t guard = GuardValue;
+    memcpy(address, &guard, GuardSize);
+#else
+    (void) address;
+#endif
+}
+
+bool
+MemoryAllocator::CheckGuard(const unsigned char *address) const
+{
+#if defined(FALCON_ENGINE_DEBUG_MEMORY)
+    uint32_t guard;
+    memcpy(&guard, address, GuardSize);
+    return guard == GuardValue;
+#else
+    (void) address;
+    return true;
+#endif
+}
+
+void
+MemoryAllocator::ThrowOverflow() const
+{
+    FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("Memory overflow detected: allocation guard is corrupted.\n");
+}
+
+void
+MemoryAllocator::ThrowOutOfCapacity(size_t size) const
+{
+    FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("Memory allocator is out of capacity: requested "
+                                          + std::to_string(size) + " bytes with "
+                                          + std::to_string(mUsedSize) + " of "
+                                          + std::to_string(mCapacity) + " bytes used.\n");
+}
+
+}
+
+using namespace FalconEngine;
+
+void *
+operator new(size_t size, MemoryAllocator *allocator)
+{
+    return operator new(size, allocator, "Unknown", 0);
+}
+
+void *
+operator new[](size_t size, MemoryAllocator *allocator)
+{
+    return operator new[](size, allocator, "Unknown", 0);
+}
+
+void *
+operator new(size_t size, MemoryAllocator *allocator, const char *file, size_t line)
+{
+    void *pointer = allocator->Allocate(size, MemoryAlignmentDefault);
+    PushMemoryRecord(pointer, file, line);
+    return pointer;
+}
+
+void *
+operator new[](size_t size, MemoryAllocator *allocator, const char *file, size_t line)
+{
+    void *pointer = allocator->Allocate(size, MemoryAlignmentDefault);
+    PushMemoryRecord(pointer, file, line);
+    return pointer;
+}
+
+void
+operator delete(void *pointer, MemoryAllocator *allocator)
+{
+    PopMemoryRecord(pointer);
+    allocator->Deallocate(pointer);
+}
+
+void
+operator delete[](void *pointer, MemoryAllocator *allocator)
+{
+    PopMemoryRecord(pointer);
+    allocator->Deallocate(pointer);
+}
+
+void
+operator delete(void *pointer, MemoryAllocator *allocator, const char * /* file */, size_t /* line */)
+{
+    operator delete(pointer, allocator);
+}
+
+void
+operator delete[](void *pointer, MemoryAllocator *allocator, const char * /* file */, size_t /* line */)
+{
+    operator delete[](pointer, allocator);
+}
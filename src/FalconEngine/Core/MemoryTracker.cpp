@@ -0,0 +1,350 @@
+#include <FalconEngine/Core/MemoryTracker.h>
+
+#include <cstdlib>
+#include <new>
+
+#include <FalconEngine/Core/Memory.h>
+
+namespace FalconEngine
+{
+
+const char *MemoryTagName[int(MemoryTag::Count)] =
+{
+    "General",
+    "Asset",
+    "Debug",
+    "Font",
+    "Renderer",
+    "Scene",
+};
+
+// NOTE: Construct the tracker in static initialization, before any singleton
+// is lazily constructed, so that the leak is output after all of them are
+// destroyed.
+static MemoryTracker *sMemoryTracker = MemoryTracker::GetInstance();
+
+/************************************************************************/
+/* Memory Header                                                        */
+/************************************************************************/
+// NOTE: The header is aligned to the default alignment so that the
+// memory after the header keeps the alignment malloc guarantees.
+class alignas(MemoryAlignmentDefault) MemoryTracker::MemoryHeader
+{
+public:
+    MemoryHeader *mPrevious;
+    MemoryHeader *mNext;
+    const char   *mFile;
+    size_t        mLine;
+    size_t        mSize;
+    MemoryTag     mTag;
+};
+
+/************************************************************************/
+/* Constructors and Destructor                                          */
+/************************************************************************/
+MemoryTracker::MemoryTracker() :
+    mFrameAllocationNum(0),
+    mLastFrameAllocationNum(0),
+    mLeakOutputAtExit(false)
+{
+    for (int tagIndex = 0; tagIndex < int(MemoryTag::Count); ++tagIndex)
+    {
+        auto& counter = mCounterTable[tagIndex];
+        counter.mLiveByte = 0;
+        counter.mPeakByte = 0;
+        counter.mAllocationNum = 0;
+        counter.mDeallocationNum = 0;
+
+        mLastAllocationNumTable[tagIndex] = 0;
+        mAllocationRateTable[tagIndex] = 0;
+        mHeaderListHead[tagIndex] = nullptr;
+    }
+}
+
+/************************************************************************/
+/* Allocation                                                           */
+/************************************************************************/
+void *
+MemoryTracker::Allocate(size_t size, MemoryTag tag, const char *file, size_t line)
+{
+#if defined(FALCON_ENGINE_PROFILE_MEMORY)
+    auto header = static_cast<MemoryHeader *>(malloc(sizeof(MemoryHeader) + size));
+    if (header == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    header->mPrevious = nullptr;
+    header->mFile = file;
+    header->mLine = line;
+    header->mSize = size;
+    header->mTag = tag;
+
+    {
+        std::lock_guard<std::mutex> lock(mHeaderListMutex[int(tag)]);
+
+        auto& head = mHeaderListHead[int(tag)];
+        header->mNext = head;
+        if (head != nullptr)
+        {
+            head->mPrevious = header;
+        }
+
+        head = header;
+    }
+
+    RecordAllocation(tag, size);
+
+    return header + 1;
+#else
+    (void) tag;
+    (void) file;
+    (void) line;
+
+    auto pointer = malloc(size);
+    if (pointer == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    return pointer;
+#endif
+}
+
+void
+MemoryTracker::Deallocate(void *pointer, MemoryTag tag)
+{
+    if (pointer == nullptr)
+    {
+        return;
+    }
+
+#if defined(FALCON_ENGINE_PROFILE_MEMORY)
+    auto header = static_cast<MemoryHeader *>(pointer) - 1;
+
+    // NOTE: Memory must be released with the tag it is allocated
+    // with, otherwise the per-tag counters would drift.
+    if (header->mTag != tag)
+    {
+        FALCON_ENGINE_THROW_RUNTIME_EXCEPTION(std::string("Memory is allocated with tag ")
+                                              + MemoryTagName[int(header->mTag)]
+                                              + " but released with tag "
+                                              + MemoryTagName[int(tag)] + ".\n");
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mHeaderListMutex[int(tag)]);
+
+        if (header->mPrevious != nullptr)
+        {
+            header->mPrevious->mNext = header->mNext;
+        }
+        else
+        {
+            mHeaderListHead[int(tag)] = header->mNext;
+        }
+
+        if (header->mNext != nullptr)
+        {
+            header->mNext->mPrevious = header->mPrevious;
+        }
+    }
+
+    RecordDeallocation(tag, header->mSize);
+
+    free(header);
+#else
+    (void) tag;
+
+    free(pointer);
+#endif
+}
+
+/************************************************************************/
+/* Statistics                                                           */
+/************************************************************************/
+MemoryTagStat
+MemoryTracker::GetTagStat(MemoryTag tag) const
+{
+    auto& counter = mCounterTable[int(tag)];
+
+    MemoryTagStat stat;
+    stat.mLiveByte = counter.mLiveByte.load(std::memory_order_relaxed);
+    stat.mPeakByte = counter.mPeakByte.load(std::memory_order_relaxed);
+    stat.mAllocationNum = counter.mAllocationNum.load(std::memory_order_relaxed);
+    stat.mDeallocationNum = counter.mDeallocationNum.load(std::memory_order_relaxed);
+    stat.mAllocationRate = mAllocationRateTable[int(tag)];
+    return stat;
+}
+
+uint64_t
+MemoryTracker::GetLastFrameAllocationNum() const
+{
+    return mLastFrameAllocationNum;
+}
+
+void
+MemoryTracker::UpdateFrame(double elapsedMillisecond)
+{
+    mLastFrameAllocationNum = mFrameAllocationNum.exchange(0, std::memory_order_relaxed);
+
+    for (int tagIndex = 0; tagIndex < int(MemoryTag::Count); ++tagIndex)
+    {
+        auto allocationNum = mCounterTable[tagIndex].mAllocationNum.load(std::memory_order_relaxed);
+        auto allocationNumDelta = allocationNum - mLastAllocationNumTable[tagIndex];
+        mLastAllocationNumTable[tagIndex] = allocationNum;
+
+        mAllocationRateTable[tagIndex] = elapsedMillisecond > 0
+                                         ? allocationNumDelta * 1000.0 / elapsedMillisecond
+                                         : 0;
+    }
+}
+
+void
+MemoryTracker::OutputReport() const
+{
+    Debug::OutputString("Memory report:\n");
+    Debug::OutputStringFormat("%-10s %14s %14s %14s %12s\n", "Tag", "Live (KB)", "Peak (KB)", "Allocation", "Rate (/s)");
+
+    for (int tagIndex = 0; tagIndex < int(MemoryTag::Count); ++tagIndex)
+    {
+        auto stat = GetTagStat(MemoryTag(tagIndex));
+        Debug::OutputStringFormat("%-10s %14.1f %14.1f %14llu %12.1f\n",
+                                  MemoryTagName[tagIndex],
+                                  double(stat.mLiveByte) / Kilobytes(1),
+                                  double(stat.mPeakByte) / Kilobytes(1),
+                                  (unsigned long long)(stat.mAllocationNum),
+                                  stat.mAllocationRate);
+    }
+}
+
+size_t
+MemoryTracker::OutputLeak() const
+{
+    size_t leakNum = 0;
+
+#if defined(FALCON_ENGINE_PROFILE_MEMORY)
+    for (int tagIndex = 0; tagIndex < int(MemoryTag::Count); ++tagIndex)
+    {
+        std::lock_guard<std::mutex> lock(mHeaderListMutex[tagIndex]);
+
+        for (auto header = mHeaderListHead[tagIndex]; header != nullptr; header = header->mNext)
+        {
+            Debug::OutputStringFormat("%s(%zu): %zu bytes leaked with tag %s.\n",
+                                      header->mFile, header->mLine, header->mSize,
+                                      MemoryTagName[tagIndex]);
+            ++leakNum;
+        }
+    }
+
+    // NOTE: Live bytes include the untracked call sites, like
+    // container memory and allocator storage.
+    for (int tagIndex = 0; tagIndex < int(MemoryTag::Count); ++tagIndex)
+    {
+        auto liveByte = mCounterTable[tagIndex].mLiveByte.load(std::memory_order_relaxed);
+        if (liveByte > 0)
+        {
+            Debug::OutputStringFormat("%s: %zu bytes still alive.\n", MemoryTagName[tagIndex], liveByte);
+        }
+    }
+
+    Debug::OutputStringFormat("%zu tagged allocations leaked.\n", leakNum);
+#endif
+
+    return leakNum;
+}
+
+void
+MemoryTracker::OutputLeakAtExit()
+{
+    mLeakOutputAtExit = true;
+}
+
+void
+MemoryTracker::OutputLeakAtExitInternal()
+{
+    auto memoryTracker = GetInstance();
+    if (memoryTracker->mLeakOutputAtExit)
+    {
+        memoryTracker->OutputLeak();
+    }
+}
+
+/************************************************************************/
+/* Memory Tag Scope                                                     */
+/************************************************************************/
+static MemoryTag&
+GetMemoryTagCurrent()
+{
+    static thread_local MemoryTag sTag = MemoryTag::General;
+    return sTag;
+}
+
+MemoryTag
+MemoryTagScope::GetCurrent()
+{
+    return GetMemoryTagCurrent();
+}
+
+MemoryTagScope::MemoryTagScope(MemoryTag tag) :
+    mTagPrevious(GetMemoryTagCurrent())
+{
+    GetMemoryTagCurrent() = tag;
+}
+
+MemoryTagScope::~MemoryTagScope()
+{
+    GetMemoryTagCurrent() = mTagPrevious;
+}
+
+}
+
+using namespace FalconEngine;
+
+void *
+operator new(size_t size, MemoryTag tag)
+{
+    return operator new(size, tag, "Unknown", 0);
+}
+
+void *
+operator new[](size_t size, MemoryTag tag)
+{
+    return operator new[](size, tag, "Unknown", 0);
+}
+
+void *
+operator new(size_t size, MemoryTag tag, const char *file, size_t line)
+{
+    return MemoryTracker::GetInstance()->Allocate(size, tag, file, line);
+}
+
+void *
+operator new[](size_t size, MemoryTag tag, const char *file, size_t line)
+{
+    return MemoryTracker::GetInstance()->Allocate(size, tag, file, line);
+}
+
+void
+operator delete(void *pointer, MemoryTag tag)
+{
+    MemoryTracker::GetInstance()->Deallocate(pointer, tag);
+}
+
+void
+operator delete[](void *pointer, MemoryTag tag)
+{
+    MemoryTracker::GetInstance()->Deallocate(pointer, tag);
+}
+
+void
+operator delete(void *pointer, MemoryTag tag, const char * /* file */, size_t /* line */)
+{
+    MemoryTracker::GetInstance()->Deallocate(pointer, tag);
+}
+
+void
+operator delete[](void *pointer, MemoryTag tag, const char * /* file */, size_t /* line */)
+{
+    MemoryTracker::GetInstance()->Deallocate(pointer, tag);
+}
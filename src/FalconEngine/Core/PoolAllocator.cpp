@@ -0,0 +1,155 @@
+#include <FalconEngine/Core/PoolAllocator.h>
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace FalconEngine
+{
+
+/************************************************************************/
+/* Constructors and Destructor                                          */
+/************************************************************************/
+PoolAllocator::PoolAllocator(size_t blockSize, size_t blockNum, size_t blockAlignment, MemoryTag tag) :
+    MemoryAllocator(0, tag),
+    mBlockAlignment(std::max(blockAlignment, alignof(void *))),
+    mBlockSize(std::max(blockSize, sizeof(void *))),
+    mBlockStride(0),
+    mBlockNum(blockNum),
+    mBlockFreeList(nullptr),
+    mStorage(nullptr),
+    mStorageAligned(nullptr)
+{
+    if (!IsMemoryAlignmentValid(blockAlignment))
+    {
+        FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("Alignment must be power of two.\n");
+    }
+
+    // NOTE: Stride is rounded up so that every block is aligned.
+    mBlockStride = size_t(AlignMemoryAddress(mBlockSize + GuardSize, mBlockAlignment));
+    mCapacity = mBlockStride * mBlockNum;
+
+    mStorage = static_cast<unsigned char *>(malloc(mCapacity + mBlockAlignment));
+    if (mStorage == nullptr)
+    {
+        FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("Failed to allocate allocator storage.\n");
+    }
+
+    MemoryTracker::GetInstance()->RecordAllocation(mTag, mCapacity + mBlockAlignment);
+
+    mStorageAligned = reinterpret_cast<unsigned char *>(AlignMemoryAddress(uintptr_t(mStorage), mBlockAlignment));
+
+    // Build the free list in the order of address.
+    for (size_t blockIndex = mBlockNum; blockIndex > 0; --blockIndex)
+    {
+        auto block = mStorageAligned + (blockIndex - 1) * mBlockStride;
+        *reinterpret_cast<void **>(block) = mBlockFreeList;
+        mBlockFreeList = block;
+    }
+
+#if defined(FALCON_ENGINE_DEBUG_MEMORY)
+    mBlockAllocated.assign(mBlockNum, false);
+#endif
+}
+
+PoolAllocator::~PoolAllocator()
+{
+    MemoryTracker::GetInstance()->RecordDeallocation(mTag, mCapacity + mBlockAlignment);
+
+    free(mStorage);
+}
+
+/************************************************************************/
+/* Public Members                                                       */
+/************************************************************************/
+void *
+PoolAllocator::Allocate(size_t size, size_t alignment)
+{
+    if (size > mBlockSize || alignment > mBlockAlignment)
+    {
+        FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("Allocation doesn't fit in pool block.\n");
+    }
+
+    if (mBlockFreeList == nullptr)
+    {
+        ThrowOutOfCapacity(size);
+    }
+
+    auto block = static_cast<unsigned char *>(mBlockFreeList);
+    mBlockFreeList = *reinterpret_cast<void **>(block);
+
+#if defined(FALCON_ENGINE_DEBUG_MEMORY)
+    mBlockAllocated[GetBlockIndex(block)] = true;
+    WriteGuard(block + mBlockSize);
+#endif
+
+    mUsedSize += mBlockStride;
+    UpdateHighWaterMark();
+
+    return block;
+}
+
+void
+PoolAllocator::Deallocate(void *pointer)
+{
+    if (pointer == nullptr)
+    {
+        return;
+    }
+
+    auto block = static_cast<unsigned char *>(pointer);
+
+#if defined(FALCON_ENGINE_DEBUG_MEMORY)
+    auto blockIndex = GetBlockIndex(block);
+    if (!mBlockAllocated[blockIndex])
+    {
+        FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("Pool block is freed twice.\n");
+    }
+
+    if (!CheckGuard(block + mBlockSize))
+    {
+        ThrowOverflow();
+    }
+
+    mBlockAllocated[blockIndex] = false;
+#endif
+
+    *reinterpret_cast<void **>(block) = mBlockFreeList;
+    mBlockFreeList = block;
+
+    mUsedSize -= mBlockStride;
+}
+
+size_t
+PoolAllocator::GetBlockSize() const
+{
+    return mBlockSize;
+}
+
+size_t
+PoolAllocator::GetBlockNum() const
+{
+    return mBlockNum;
+}
+
+size_t
+PoolAllocator::GetBlockUsedNum() const
+{
+    return mUsedSize / mBlockStride;
+}
+
+/************************************************************************/
+/* Private Members                                                      */
+/************************************************************************/
+size_t
+PoolAllocator::GetBlockIndex(const void *pointer) const
+{
+    auto offset = static_cast<const unsigned char *>(pointer) - mStorageAligned;
+    if (offset < 0 || size_t(offset) >= mCapacity || size_t(offset) % mBlockStride != 0)
+    {
+        FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("Pointer is not allocated from this pool.\n");
+    }
+
+    return size_t(offset) / mBlockStride;
+}
+
+}
@@ -0,0 +1,33 @@
+#include <FalconEngine/Core/StackAllocator.h>
+
+namespace FalconEngine
+{
+
+/************************************************************************/
+/* Constructors and Destructor                                          */
+/************************************************************************/
+StackAllocator::StackAllocator(size_t capacity, MemoryTag tag) :
+    LinearAllocator(capacity, tag)
+{
+}
+
+StackAllocator::~StackAllocator()
+{
+}
+
+/************************************************************************/
+/* Public Members                                                       */
+/************************************************************************/
+StackAllocator::Marker
+StackAllocator::GetMarker() const
+{
+    return mUsedSize;
+}
+
+void
+StackAllocator::FreeToMarker(Marker marker)
+{
+    Rewind(marker);
+}
+
+}
@@ -173,4 +173,95 @@ DebugEffect::InitializeInstance(
     }
 }
 
+FALCON_ENGINE_EFFECT_IMPLEMENT(DebugInstancingEffect);
+
+/************************************************************************/
+/* Constructors and Destructor                                          */
+/************************************************************************/
+DebugInstancingEffect::DebugInstancingEffect(bool depthTestEnabled)
+{
+    auto shader = std::make_shared<Shader>();
+    shader->PushShaderFile(ShaderType::VertexShader, "Content/Shader/DebugInstancing.vert.glsl");
+    shader->PushShaderFile(ShaderType::FragmentShader, "Content/Shader/Debug.frag.glsl");
+
+    auto pass = make_unique<VisualEffectPass>();
+    pass->SetShader(shader);
+
+    auto blendState = make_unique<BlendState>();
+    blendState->mEnabled = false;
+    blendState->mSourceFactor = BlendSourceFactor::SRC_ALPHA;
+    blendState->mDestinationFactor = BlendDestinationFactor::ONE_MINUS_SRC_ALPHA;
+    pass->SetBlendState(move(blendState));
+
+    auto cullState = make_unique<CullState>();
+    cullState->mEnabled = false;
+    pass->SetCullState(move(cullState));
+
+    auto depthTestState = make_unique<DepthTestState>();
+    depthTestState->mTestEnabled = depthTestEnabled;
+    pass->SetDepthTestState(move(depthTestState));
+
+    pass->SetOffsetState(make_unique<OffsetState>());
+    pass->SetStencilTestState(make_unique<StencilTestState>());
+
+    auto wireframwState = make_unique<WireframeState>();
+    wireframwState->mEnabled = true;
+    pass->SetWireframeState(move(wireframwState));
+
+    InsertPass(move(pass));
+}
+
+DebugInstancingEffect::~DebugInstancingEffect()
+{
+}
+
+/************************************************************************/
+/* Public Members                                                       */
+/************************************************************************/
+std::shared_ptr<VisualEffectInstance>
+DebugInstancingEffect::CreateInstance(Visual *visual, const std::shared_ptr<DebugEffectParams>& params)
+{
+    auto instance = InstallInstance(visual, params);
+
+    for (int cameraIndex = 0; cameraIndex < DebugEffect::CameraNumMax; ++cameraIndex)
+    {
+        instance->SetShaderUniform(0, params->mCameraSlotUniform[cameraIndex]);
+    }
+
+    return instance;
+}
+
+std::shared_ptr<VertexFormat>
+DebugInstancingEffect::GetVertexFormat() const
+{
+    static shared_ptr<VertexFormat> sVertexFormat = CreateVertexFormat();
+    return sVertexFormat;
+}
+
+/************************************************************************/
+/* Protected Members                                                    */
+/************************************************************************/
+std::shared_ptr<VertexFormat>
+DebugInstancingEffect::CreateVertexFormat() const
+{
+    auto vertexFormat = std::make_shared<VertexFormat>();
+
+    // NOTE: Fixed vertex data of the unit mesh.
+    vertexFormat->PushVertexAttribute(0, "Position", VertexAttributeType::FloatVec3, false, 0);
+
+    // NOTE: Each shape has its own color, camera and transform, used
+    // with instancing.
+    vertexFormat->PushVertexAttribute(1, "Color", VertexAttributeType::FloatVec4, false, 1, 1);
+    vertexFormat->PushVertexAttribute(2, "Camera", VertexAttributeType::Int, false, 1, 1);
+    vertexFormat->PushVertexAttribute(3, "Transform", VertexAttributeType::FloatVec4, false, 1, 1);
+
+    // NOTE(Wuxiang): The name is not meant to be valid for mat4.
+    vertexFormat->PushVertexAttribute(4, "", VertexAttributeType::FloatVec4, false, 1, 1);
+    vertexFormat->PushVertexAttribute(5, "", VertexAttributeType::FloatVec4, false, 1, 1);
+    vertexFormat->PushVertexAttribute(6, "", VertexAttributeType::FloatVec4, false, 1, 1);
+    vertexFormat->FinishVertexAttribute();
+
+    return vertexFormat;
+}
+
 }
@@ -106,6 +106,7 @@ MeshEffect::InitializeInstance(_IN_OUT_ VisualEffectInstance
     SetShaderUniformAutomaticModelViewTransform(instance, 0, "ModelViewTransform");
     SetShaderUniformAutomaticNormalTransform(instance, 0, "NormalTransform");
     SetShaderUniformAutomaticScreenTransform(instance, 0, "ScreenTransform");
+    SetShaderUniformAutomaticVertexDecode(instance, 0);
 
     // Material
     {
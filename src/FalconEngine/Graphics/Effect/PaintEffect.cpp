@@ -111,7 +111,8 @@ PaintEffect::InitializeInstance(
     _IN_     const std::shared_ptr<PaintEffectParams>& params) const
 {
     // Transform
-    SetShaderUniformAutomaticModelViewProjectionTransform(instance, 0, "ModelViewProjectionTransform");
+    SetShaderUniformAutomaticDraw(instance, 0, params.get());
+    SetShaderUniformAutomaticVertexDecode(instance, 0);
 
     // Color
     instance->SetShaderUniform(0, ShareAutomatic<Vector4f>("Color", bind([ = ]
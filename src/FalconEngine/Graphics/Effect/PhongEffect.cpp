@@ -1,14 +1,18 @@
 #include <FalconEngine/Graphics/Effect/PhongEffect.h>
 
+#include <FalconEngine/Graphics/Renderer/Batch/BatchRenderer.h>
 #include <FalconEngine/Graphics/Renderer/Camera.h>
 #include <FalconEngine/Graphics/Renderer/Scene/Light.h>
 #include <FalconEngine/Graphics/Renderer/Scene/Material.h>
 #include <FalconEngine/Graphics/Renderer/Scene/Mesh.h>
 #include <FalconEngine/Graphics/Renderer/Shader/ShaderUniformAutomatic.h>
 #include <FalconEngine/Graphics/Renderer/Shader/Shader.h>
+#include <FalconEngine/Graphics/Renderer/Shadow/ShadowRenderer.h>
 #include <FalconEngine/Graphics/Renderer/VisualEffectInstance.h>
 #include <FalconEngine/Graphics/Renderer/VisualEffectPass.h>
 #include <FalconEngine/Graphics/Renderer/Resource/Texture2d.h>
+#include <FalconEngine/Graphics/Renderer/Resource/Sampler.h>
+#include <FalconEngine/Graphics/Renderer/Resource/Texture2dArray.h>
 #include <FalconEngine/Graphics/Renderer/Resource/VertexAttribute.h>
 #include <FalconEngine/Graphics/Renderer/Resource/VertexFormat.h>
 
@@ -117,9 +121,30 @@ PhongEffect::InitializeInstance(_IN_OUT_ VisualEffectInstance
     using namespace placeholders;
 
     // Transform
-    SetShaderUniformAutomaticModelViewProjectionTransform(instance, 0, "ModelViewProjectionTransform");
-    SetShaderUniformAutomaticModelViewTransform(instance, 0, "ModelViewTransform");
-    SetShaderUniformAutomaticNormalTransform(instance, 0, "NormalTransform");
+    //
+    // NOTE: Material and params cover all the other uniforms and
+    // textures, so that instances sharing them are batched together. The
+    // buffered material is read from the material buffer of batch instead,
+    // except for the texture array its textures are packed into.
+    if (BatchRenderer::GetInstance()->IsMaterialBuffered(material.get()))
+    {
+        SetShaderUniformAutomaticDraw(instance, 0, params.get(), material->mTextureArray);
+
+        if (material->mTextureArray != nullptr)
+        {
+            instance->SetShaderTexture(0, GetTextureUnit(TextureUnit::Material), material->mTextureArray);
+
+            if (material->mTextureArraySampler != nullptr)
+            {
+                instance->SetShaderSampler(0, GetTextureUnit(TextureUnit::Material), material->mTextureArraySampler);
+            }
+        }
+    }
+    else
+    {
+        SetShaderUniformAutomaticDraw(instance, 0, material.get(), params.get());
+    }
+    SetShaderUniformAutomaticVertexDecode(instance, 0);
 
     // Material
     {
@@ -313,6 +338,62 @@ PhongEffect::InitializeInstance(_IN_OUT_ VisualEffectInstance
 
         }
 
+        // Directional light shadow
+        //
+        // NOTE: The shadow is sampled only when it is rendered for
+        // the directional light seen from the current camera.
+        {
+            static auto sShadowRenderer = ShadowRenderer::GetInstance();
+
+            instance->SetShaderUniform(0, ShareAutomatic<bool>("fe_ShadowEnabled",
+                                       std::bind([ = ](const Visual *, const Camera * camera)
+            {
+                return sShadowRenderer->IsShadowRendered(camera, params->mDirectionalLight.get());
+            }, _1, _2)));
+
+            instance->SetShaderUniform(0, ShareAutomatic<int>("fe_ShadowCascadeNum",
+                                       std::bind([ = ](const Visual *, const Camera *)
+            {
+                return sShadowRenderer->GetCascadeNum();
+            }, _1, _2)));
+
+            instance->SetShaderUniform(0, ShareAutomatic<Vector4f>("fe_ShadowSplit",
+                                       std::bind([ = ](const Visual *, const Camera *)
+            {
+                return Vector4f(sShadowRenderer->GetCascade(0)->mSplit,
+                                sShadowRenderer->GetCascade(1)->mSplit,
+                                sShadowRenderer->GetCascade(2)->mSplit,
+                                sShadowRenderer->GetCascade(3)->mSplit);
+            }, _1, _2)));
+
+            for (int i = 0; i < ShadowRenderer::CascadeNumMax; ++i)
+            {
+                instance->SetShaderUniform(0, ShareAutomatic<Matrix4f>("fe_ShadowTransform[" + std::to_string(i) + "]",
+                                           std::bind([ = ](const Visual *, const Camera *)
+                {
+                    return sShadowRenderer->GetCascade(i)->mEyeTransform;
+                }, _1, _2)));
+            }
+
+            instance->SetShaderUniform(0, ShareAutomatic<int>("fe_ShadowFilterRadius",
+                                       std::bind([ = ](const Visual *, const Camera *)
+            {
+                return sShadowRenderer->GetFilterRadius();
+            }, _1, _2)));
+
+            instance->SetShaderUniform(0, ShareAutomatic<float>("fe_ShadowTexelSize",
+                                       std::bind([ = ](const Visual *, const Camera *)
+            {
+                return sShadowRenderer->GetTexelSize();
+            }, _1, _2)));
+
+            if (sShadowRenderer->IsShadowEnabled())
+            {
+                instance->SetShaderTexture(0, GetTextureUnit(TextureUnit::Shadow), sShadowRenderer->GetShadowTexture());
+                instance->SetShaderSampler(0, GetTextureUnit(TextureUnit::Shadow), sShadowRenderer->GetShadowSampler());
+            }
+        }
+
         // Point light
         {
             instance->SetShaderUniform(0, ShareAutomatic<int>("PointLightNum",
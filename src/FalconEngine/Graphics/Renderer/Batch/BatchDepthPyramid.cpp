@@ -0,0 +1,220 @@
+#include <FalconEngine/Graphics/Renderer/Batch/BatchDepthPyramid.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include <FalconEngine/Graphics/Renderer/Camera.h>
+#include <FalconEngine/Graphics/Renderer/Renderer.h>
+#include <FalconEngine/Graphics/Renderer/Viewport.h>
+#include <FalconEngine/Graphics/Renderer/Resource/ShaderBuffer.h>
+#include <FalconEngine/Graphics/Renderer/Shader/Shader.h>
+#include <FalconEngine/Graphics/Renderer/Shader/ShaderUniformManual.h>
+
+using namespace std;
+
+namespace FalconEngine
+{
+
+// NOTE: Pass and binding points are declared in
+// BatchDepthPyramid.comp.glsl and fe_DepthPyramid.glsl.
+enum class BatchDepthPyramidPass
+{
+    Clear     = 0,
+    Reproject = 1,
+    Reduce    = 2,
+};
+
+static const int DepthBindingIndex = 0;
+static const int PyramidBindingIndex = 7;
+static const int HeaderBindingIndex = 8;
+static const int GroupSize = 8;
+
+/************************************************************************/
+/* Constructors and Destructor                                          */
+/************************************************************************/
+BatchDepthPyramid::BatchDepthPyramid() :
+    mWidth(0),
+    mHeight(0),
+    mCamera(nullptr),
+    mCaptured(false),
+    mBuilt(false)
+{
+    mShader = make_shared<Shader>();
+    mShader->PushShaderFile(ShaderType::ComputeShader, "Content/Shader/BatchDepthPyramid.comp.glsl");
+
+    // NOTE: The uniforms are pushed before the shader is created on
+    // the device, so that their locations are collected.
+    mShader->PushUniform("fe_DepthPyramidPass", ShaderUniformType::Int);
+    mShader->PushUniform("fe_DepthPyramidLevel", ShaderUniformType::Int);
+    mPassUniform = ShareManual<int>("fe_DepthPyramidPass", 0);
+    mLevelUniform = ShareManual<int>("fe_DepthPyramidLevel", 0);
+
+    mHeaderBuffer = make_shared<ShaderBuffer>(sizeof(BatchDepthPyramidHeader),
+                    BufferStorageMode::Device, BufferUsage::Stream);
+}
+
+BatchDepthPyramid::~BatchDepthPyramid()
+{
+}
+
+/************************************************************************/
+/* Public Members                                                       */
+/************************************************************************/
+const Camera *
+BatchDepthPyramid::GetCamera() const
+{
+    return mCamera;
+}
+
+const ShaderBuffer *
+BatchDepthPyramid::GetHeaderBuffer() const
+{
+    return mHeaderBuffer.get();
+}
+
+const ShaderBuffer *
+BatchDepthPyramid::GetPyramidBuffer() const
+{
+    return mPyramidBuffer.get();
+}
+
+void
+BatchDepthPyramid::Capture(const Camera *camera)
+{
+    static auto sMasterRenderer = Renderer::GetInstance();
+
+    FALCON_ENGINE_CHECK_NULLPTR(camera);
+
+    auto viewport = sMasterRenderer->GetViewport();
+    auto width = int(viewport->GetWidth());
+    auto height = int(viewport->GetHeight());
+    if (width < 1 || height < 1)
+    {
+        Reset();
+        return;
+    }
+
+    if (width != mWidth || height != mHeight)
+    {
+        Resize(width, height);
+    }
+
+    sMasterRenderer->CopyDepthBuffer(mDepthBuffer.get());
+
+    mCamera = camera;
+    mCameraViewProjection = camera->GetViewProjection();
+    mCaptured = true;
+    mBuilt = false;
+}
+
+bool
+BatchDepthPyramid::Build(const Camera *camera)
+{
+    static auto sMasterRenderer = Renderer::GetInstance();
+
+    if (!mCaptured || camera != mCamera)
+    {
+        return false;
+    }
+
+    if (mBuilt)
+    {
+        return true;
+    }
+
+    // NOTE: Captured depth is unprojected with the view projection it
+    // is rendered with, then projected with the current one.
+    mHeader.mReprojectTransform = camera->GetViewProjection() * Matrix4f::Inverse(mCameraViewProjection);
+
+    auto header = sMasterRenderer->Map(mHeaderBuffer.get(),
+                                       BufferAccessMode::WriteBufferInvalidateBuffer,
+                                       BufferFlushMode::Automatic,
+                                       BufferSynchronizationMode::Unsynchronized,
+                                       0, sizeof(BatchDepthPyramidHeader));
+    memcpy(header, &mHeader, sizeof(BatchDepthPyramidHeader));
+    sMasterRenderer->Unmap(mHeaderBuffer.get());
+
+    sMasterRenderer->Enable(mDepthBuffer.get(), DepthBindingIndex);
+    sMasterRenderer->Enable(mPyramidBuffer.get(), PyramidBindingIndex);
+    sMasterRenderer->Enable(mHeaderBuffer.get(), HeaderBindingIndex);
+
+    auto dispatch = [this](BatchDepthPyramidPass pass, int levelIndex)
+    {
+        mPassUniform->SetValue(int(pass));
+        mLevelUniform->SetValue(levelIndex);
+
+        sMasterRenderer->Enable(mShader.get());
+        sMasterRenderer->Update(mShader.get(), mPassUniform.get(), nullptr, nullptr);
+        sMasterRenderer->Update(mShader.get(), mLevelUniform.get(), nullptr, nullptr);
+
+        auto width = int(mHeader.mLevel[levelIndex][0]);
+        auto height = int(mHeader.mLevel[levelIndex][1]);
+        sMasterRenderer->Dispatch(mShader.get(),
+                                  (width + GroupSize - 1) / GroupSize,
+                                  (height + GroupSize - 1) / GroupSize, 1);
+    };
+
+    dispatch(BatchDepthPyramidPass::Clear, 0);
+    dispatch(BatchDepthPyramidPass::Reproject, 0);
+    for (int levelIndex = 1; levelIndex < int(mHeader.mLevelNum); ++levelIndex)
+    {
+        dispatch(BatchDepthPyramidPass::Reduce, levelIndex);
+    }
+
+    mBuilt = true;
+    return true;
+}
+
+void
+BatchDepthPyramid::Reset()
+{
+    mCamera = nullptr;
+    mCaptured = false;
+    mBuilt = false;
+}
+
+/************************************************************************/
+/* Private Members                                                      */
+/************************************************************************/
+void
+BatchDepthPyramid::Resize(int width, int height)
+{
+    Reset();
+
+    mWidth = width;
+    mHeight = height;
+
+    // NOTE: Each level halves the previous one rounding up until it
+    // is one texel.
+    int levelNum = 0;
+    int levelWidth = width;
+    int levelHeight = height;
+    unsigned int levelOffset = 0;
+    while (levelNum < BatchDepthPyramidHeader::LevelNumMax)
+    {
+        mHeader.mLevel[levelNum][0] = unsigned(levelWidth);
+        mHeader.mLevel[levelNum][1] = unsigned(levelHeight);
+        mHeader.mLevel[levelNum][2] = levelOffset;
+        mHeader.mLevel[levelNum][3] = 0;
+
+        levelOffset += unsigned(levelWidth * levelHeight);
+        ++levelNum;
+
+        if (levelWidth == 1 && levelHeight == 1)
+        {
+            break;
+        }
+
+        levelWidth = std::max(1, (levelWidth + 1) / 2);
+        levelHeight = std::max(1, (levelHeight + 1) / 2);
+    }
+
+    mHeader.mLevelNum = unsigned(levelNum);
+
+    mDepthBuffer = make_shared<ShaderBuffer>(size_t(width) * size_t(height) * sizeof(float),
+                   BufferStorageMode::Device, BufferUsage::Stream);
+    mPyramidBuffer = make_shared<ShaderBuffer>(size_t(levelOffset) * sizeof(unsigned int),
+                     BufferStorageMode::Device, BufferUsage::Dynamic);
+}
+
+}
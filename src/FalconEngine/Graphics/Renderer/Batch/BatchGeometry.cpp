@@ -0,0 +1,247 @@
+#include <FalconEngine/Graphics/Renderer/Batch/BatchGeometry.h>
+
+#include <algorithm>
+
+#include <FalconEngine/Graphics/Renderer/Primitive.h>
+#include <FalconEngine/Graphics/Renderer/Renderer.h>
+#include <FalconEngine/Graphics/Renderer/Resource/IndexBuffer.h>
+#include <FalconEngine/Graphics/Renderer/Resource/VertexBuffer.h>
+#include <FalconEngine/Graphics/Renderer/Resource/VertexFormat.h>
+#include <FalconEngine/Graphics/Renderer/Resource/VertexGroup.h>
+
+using namespace std;
+
+namespace FalconEngine
+{
+
+/************************************************************************/
+/* Static Members                                                       */
+/************************************************************************/
+const int
+BatchGeometry::DrawIndexLocation = 15;
+
+/************************************************************************/
+/* Constructors and Destructor                                          */
+/************************************************************************/
+BatchGeometry::BatchGeometry(const VertexFormat                   *vertexFormat,
+                             IndexType                             indexType,
+                             int                                   vertexNumMax,
+                             int                                   indexNumMax,
+                             const std::shared_ptr<VertexBuffer>&  drawIndexBuffer) :
+    mIndexType(indexType),
+    mIndexNum(0),
+    mIndexNumMax(indexNumMax),
+    mDrawIndexBindingIndex(0),
+    mVertexNum(0),
+    mVertexNumMax(vertexNumMax)
+{
+    FALCON_ENGINE_CHECK_NULLPTR(vertexFormat);
+    FALCON_ENGINE_CHECK_NULLPTR(drawIndexBuffer);
+
+    // NOTE: Copy the vertex attributes and append the draw index on
+    // a separated binding advanced per instance. The base instance of each draw
+    // command selects the draw index.
+    mVertexFormat = make_shared<VertexFormat>();
+
+    for (auto& vertexAttribute : vertexFormat->mVertexAttributeList)
+    {
+        mVertexFormat->PushVertexAttribute(int(vertexAttribute.mLocation),
+                                           vertexAttribute.mName,
+                                           vertexAttribute.mType,
+                                           vertexAttribute.mNormalized,
+                                           int(vertexAttribute.mBindingIndex),
+                                           int(vertexAttribute.mDivision));
+
+        mDrawIndexBindingIndex = std::max(mDrawIndexBindingIndex, int(vertexAttribute.mBindingIndex) + 1);
+    }
+
+    mVertexFormat->PushVertexAttribute(DrawIndexLocation, "fe_DrawIndex",
+                                       VertexAttributeType::Float, false,
+                                       mDrawIndexBindingIndex, 1);
+    mVertexFormat->FinishVertexAttribute();
+
+    mVertexGroup = make_shared<VertexGroup>();
+    for (int bindingIndex = 0; bindingIndex < mDrawIndexBindingIndex; ++bindingIndex)
+    {
+        auto vertexStride = mVertexFormat->GetVertexBufferStride(bindingIndex);
+        auto vertexBuffer = make_shared<VertexBuffer>(vertexNumMax, vertexStride,
+                            BufferStorageMode::Device, BufferUsage::Static);
+        mVertexGroup->SetVertexBuffer(bindingIndex, vertexBuffer, 0, vertexStride);
+    }
+
+    mVertexGroup->SetVertexBuffer(mDrawIndexBindingIndex, drawIndexBuffer, 0, sizeof(float));
+
+    mIndexBuffer = make_shared<IndexBuffer>(indexNumMax, indexType,
+                                            BufferStorageMode::Device, BufferUsage::Static);
+}
+
+BatchGeometry::~BatchGeometry()
+{
+}
+
+/************************************************************************/
+/* Public Members                                                       */
+/************************************************************************/
+const VertexFormat *
+BatchGeometry::GetVertexFormat() const
+{
+    return mVertexFormat.get();
+}
+
+const VertexGroup *
+BatchGeometry::GetVertexGroup() const
+{
+    return mVertexGroup.get();
+}
+
+const IndexBuffer *
+BatchGeometry::GetIndexBuffer() const
+{
+    return mIndexBuffer.get();
+}
+
+IndexType
+BatchGeometry::GetIndexType() const
+{
+    return mIndexType;
+}
+
+const BatchGeometryRange *
+BatchGeometry::FindRange(const VertexGroup *vertexGroup, const Primitive *primitive)
+{
+    FALCON_ENGINE_CHECK_NULLPTR(vertexGroup);
+    FALCON_ENGINE_CHECK_NULLPTR(primitive);
+
+    auto key = BatchGeometryKey(vertexGroup, primitive);
+    auto iter = mRangeTable.find(key);
+    if (iter == mRangeTable.end())
+    {
+        // NOTE: The primitive that could not be appended is recorded
+        // as well, so that it is not checked again each frame.
+        iter = mRangeTable.emplace(key, Append(vertexGroup, primitive)).first;
+    }
+
+    return iter->second.mAppended ? &iter->second : nullptr;
+}
+
+void
+BatchGeometry::Reset()
+{
+    mRangeTable.clear();
+
+    mIndexNum = 0;
+    mVertexNum = 0;
+}
+
+/************************************************************************/
+/* Private Members                                                      */
+/************************************************************************/
+BatchGeometryRange
+BatchGeometry::Append(const VertexGroup *vertexGroup, const Primitive *primitive)
+{
+    static auto sMasterRenderer = Renderer::GetInstance();
+
+    BatchGeometryRange range;
+    range.mVertexBase = 0;
+    range.mIndexBegin = 0;
+    range.mIndexNum = 0;
+    range.mAppended = false;
+
+    if (primitive->GetPrimitiveType() != PrimitiveType::Triangle)
+    {
+        return range;
+    }
+
+    // NOTE: Only static geometry is batched, because the copy in the
+    // shared buffers is not updated when the geometry changes.
+    auto indexBuffer = primitive->GetIndexBuffer();
+    if (indexBuffer == nullptr
+            || indexBuffer->GetIndexType() != mIndexType
+            || indexBuffer->GetUsage() != BufferUsage::Static)
+    {
+        return range;
+    }
+
+    // NOTE: Index range mirrors the non-batched draw of primitive.
+    auto indexSize = int64_t(indexBuffer->GetElementSize());
+    auto indexNum = indexBuffer->GetElementNum();
+    auto indexOffset = int64_t(primitive->GetIndexOffset()) * indexSize;
+    if (indexNum < 1
+            || size_t(indexOffset + indexNum * indexSize) > indexBuffer->GetCapacitySize()
+            || mIndexNum + indexNum > mIndexNumMax)
+    {
+        return range;
+    }
+
+    auto vertexNum = vertexGroup->GetVertexNum();
+    if (vertexNum < 1 || mVertexNum + vertexNum > mVertexNumMax)
+    {
+        return range;
+    }
+
+    // NOTE: The vertex group must provide every binding of the vertex
+    // format with the same layout as the shared buffers.
+    int vertexBindingNum = 0;
+    for (auto vertexBufferBindingIter = vertexGroup->GetVertexBufferBindingBegin();
+            vertexBufferBindingIter != vertexGroup->GetVertexBufferBindingEnd();
+            ++vertexBufferBindingIter)
+    {
+        auto bindingIndex = vertexBufferBindingIter->first;
+        const auto& vertexBufferBinding = vertexBufferBindingIter->second;
+        if (bindingIndex >= unsigned(mDrawIndexBindingIndex))
+        {
+            return range;
+        }
+
+        auto vertexStride = mVertexFormat->GetVertexBufferStride(bindingIndex);
+        auto vertexBuffer = vertexBufferBinding->GetBuffer();
+        if (vertexBufferBinding->GetStride() != vertexStride
+                || vertexBuffer->GetUsage() != BufferUsage::Static
+                || size_t(vertexBufferBinding->GetOffset() + int64_t(vertexNum) * vertexStride) > vertexBuffer->GetCapacitySize())
+        {
+            return range;
+        }
+
+        ++vertexBindingNum;
+    }
+
+    if (vertexBindingNum != mDrawIndexBindingIndex)
+    {
+        return range;
+    }
+
+    // Copy the vertex data on device.
+    for (auto vertexBufferBindingIter = vertexGroup->GetVertexBufferBindingBegin();
+            vertexBufferBindingIter != vertexGroup->GetVertexBufferBindingEnd();
+            ++vertexBufferBindingIter)
+    {
+        auto bindingIndex = vertexBufferBindingIter->first;
+        const auto& vertexBufferBinding = vertexBufferBindingIter->second;
+
+        auto vertexStride = int64_t(mVertexFormat->GetVertexBufferStride(bindingIndex));
+        sMasterRenderer->Copy(vertexBufferBinding->GetBuffer().get(),
+                              vertexBufferBinding->GetOffset(),
+                              mVertexGroup->GetVertexBuffer(bindingIndex).get(),
+                              int64_t(mVertexNum) * vertexStride,
+                              int64_t(vertexNum) * vertexStride);
+    }
+
+    // Copy the index data on device.
+    sMasterRenderer->Copy(indexBuffer, indexOffset,
+                          mIndexBuffer.get(), int64_t(mIndexNum) * indexSize,
+                          int64_t(indexNum) * indexSize);
+
+    // NOTE: The index is relative to the first vertex of the
+    // primitive, so that the vertex base of the command offsets it.
+    range.mVertexBase = mVertexNum;
+    range.mIndexBegin = mIndexNum;
+    range.mIndexNum = indexNum;
+    range.mAppended = true;
+
+    mVertexNum += vertexNum;
+    mIndexNum += indexNum;
+
+    return range;
+}
+
+}
@@ -0,0 +1,811 @@
+#include <FalconEngine/Graphics/Renderer/Batch/BatchRenderer.h>
+
+#include <algorithm>
+#include <cstring>
+#include <tuple>
+
+#include <FalconEngine/Context/GameEngineSettings.h>
+#include <FalconEngine/Graphics/Renderer/Camera.h>
+#include <FalconEngine/Graphics/Renderer/Primitive.h>
+#include <FalconEngine/Graphics/Renderer/Renderer.h>
+#include <FalconEngine/Graphics/Renderer/VisualEffect.h>
+#include <FalconEngine/Graphics/Renderer/VisualEffectInstance.h>
+#include <FalconEngine/Graphics/Renderer/VisualEffectInstancePass.h>
+#include <FalconEngine/Graphics/Renderer/VisualEffectPass.h>
+#include <FalconEngine/Graphics/Renderer/Batch/BatchDepthPyramid.h>
+#include <FalconEngine/Graphics/Renderer/Batch/BatchGeometry.h>
+#include <FalconEngine/Graphics/Renderer/Shader/Shader.h>
+#include <FalconEngine/Graphics/Renderer/Resource/IndexBuffer.h>
+#include <FalconEngine/Graphics/Renderer/Resource/IndirectBuffer.h>
+#include <FalconEngine/Graphics/Renderer/Resource/ShaderBuffer.h>
+#include <FalconEngine/Graphics/Renderer/Resource/Texture2d.h>
+#include <FalconEngine/Graphics/Renderer/Resource/VertexBuffer.h>
+#include <FalconEngine/Graphics/Renderer/Resource/VertexFormat.h>
+#include <FalconEngine/Graphics/Renderer/Scene/Material.h>
+#include <FalconEngine/Graphics/Renderer/Scene/Mesh.h>
+#include <FalconEngine/Graphics/Renderer/Scene/Visual.h>
+#include <FalconEngine/Math/AABB.h>
+
+using namespace std;
+
+namespace FalconEngine
+{
+
+/************************************************************************/
+/* Static Members                                                       */
+/************************************************************************/
+// @return Whether the material uploads the same data as the other material.
+static bool
+IsMaterialUploadEqual(const Material& lhs, const Material& rhs)
+{
+    return lhs.mAmbientColor == rhs.mAmbientColor
+           && lhs.mDiffuseColor == rhs.mDiffuseColor
+           && lhs.mEmissiveColor == rhs.mEmissiveColor
+           && lhs.mSpecularColor == rhs.mSpecularColor
+           && lhs.mShininess == rhs.mShininess
+           && lhs.mAmbientTexture == rhs.mAmbientTexture
+           && lhs.mDiffuseTexture == rhs.mDiffuseTexture
+           && lhs.mEmissiveTexture == rhs.mEmissiveTexture
+           && lhs.mSpecularTexture == rhs.mSpecularTexture
+           && lhs.mShininessTexture == rhs.mShininessTexture
+           && lhs.mAmbientSampler == rhs.mAmbientSampler
+           && lhs.mDiffuseSampler == rhs.mDiffuseSampler
+           && lhs.mEmissiveSampler == rhs.mEmissiveSampler
+           && lhs.mSpecularSampler == rhs.mSpecularSampler
+           && lhs.mShininessSampler == rhs.mShininessSampler
+           && lhs.mTextureArray == rhs.mTextureArray
+           && lhs.mAmbientTextureLayer == rhs.mAmbientTextureLayer
+           && lhs.mDiffuseTextureLayer == rhs.mDiffuseTextureLayer
+           && lhs.mEmissiveTextureLayer == rhs.mEmissiveTextureLayer
+           && lhs.mSpecularTextureLayer == rhs.mSpecularTextureLayer
+           && lhs.mShininessTextureLayer == rhs.mShininessTextureLayer;
+}
+
+/************************************************************************/
+/* Constructors and Destructor                                          */
+/************************************************************************/
+BatchRenderer::BatchRenderer() :
+    mBatchEnabled(false),
+    mBatchDrawing(false),
+    mBatchDrawNumMax(0),
+    mBatchVertexNumMax(0),
+    mBatchIndexNumMax(0),
+    mCullEnabled(false),
+    mCullVisibleBufferIndex(0),
+    mCullFrameNum(0),
+    mOcclusionEnabled(false),
+    mDrawBoundNum(0),
+    mDrawBoundReset(true),
+    mTextureBindless(false),
+    mDrawMaterialNum(0),
+    mDrawMaterialReset(true),
+    mFrameBatchNum(0),
+    mFrameDrawNum(0),
+    mFrameVisibleNum(-1),
+    mFrameOccludedNum(-1)
+{
+}
+
+BatchRenderer::~BatchRenderer()
+{
+}
+
+/************************************************************************/
+/* Rendering API                                                        */
+/************************************************************************/
+bool
+BatchRenderer::Draw(const Camera *camera, const Visual *visual, VisualEffectInstance *visualEffectInstance)
+{
+    FALCON_ENGINE_CHECK_NULLPTR(visual);
+    FALCON_ENGINE_CHECK_NULLPTR(visualEffectInstance);
+
+    if (!mBatchEnabled || camera == nullptr)
+    {
+        return false;
+    }
+
+    // NOTE: Either all the passes of the instance are batched or none
+    // of them, so that the passes are drawn in order.
+    const int passNum = visualEffectInstance->GetPassNum();
+    if (passNum < 1 || passNum > mBatchDrawNumMax)
+    {
+        return false;
+    }
+
+    for (int passIndex = 0; passIndex < passNum; ++passIndex)
+    {
+        auto visualEffectInstancePass = visualEffectInstance->GetPass(passIndex);
+        if (visualEffectInstancePass->GetShaderBatchKey().first == nullptr
+                || visualEffectInstancePass->GetShaderInstancingNum() != 1)
+        {
+            return false;
+        }
+    }
+
+    auto primitive = visual->GetPrimitive();
+    auto indexBuffer = primitive->GetIndexBuffer();
+    if (indexBuffer == nullptr)
+    {
+        return false;
+    }
+
+    auto geometry = FindGeometry(visual->GetVertexFormat(), indexBuffer->GetIndexType());
+    if (geometry == nullptr)
+    {
+        return false;
+    }
+
+    auto geometryRange = geometry->FindRange(visual->GetVertexGroup(), primitive);
+    if (geometryRange == nullptr)
+    {
+        return false;
+    }
+
+    // NOTE: The batch key doesn't cover the buffered material. The instance is
+    // drawn unbatched when the material buffer is full, instead of reading the
+    // material of the first instance in the batch from the uniforms.
+    auto material = visual->GetMesh()->GetMaterial();
+    int materialIndex = -1;
+    if (IsMaterialBuffered(material))
+    {
+        materialIndex = FindMaterial(material);
+        if (materialIndex < 0)
+        {
+            return false;
+        }
+    }
+
+    // Submit the queued draws when the draw data buffer is full.
+    if (int(mDrawItemList.size()) + passNum > mBatchDrawNumMax)
+    {
+        Flush();
+    }
+
+    auto visualEffect = visualEffectInstance->GetEffect();
+    for (int passIndex = 0; passIndex < passNum; ++passIndex)
+    {
+        BatchDrawItem drawItem;
+        drawItem.mCamera = camera;
+        drawItem.mVisual = visual;
+        drawItem.mPassIndex = passIndex;
+        drawItem.mPass = visualEffect->GetPass(passIndex);
+        drawItem.mInstancePass = visualEffectInstance->GetPass(passIndex);
+        drawItem.mGeometry = geometry;
+        drawItem.mGeometryRange = geometryRange;
+        drawItem.mMaterialIndex = materialIndex;
+        mDrawItemList.push_back(drawItem);
+    }
+
+    return true;
+}
+
+bool
+BatchRenderer::IsBatchDrawing() const
+{
+    return mBatchDrawing;
+}
+
+bool
+BatchRenderer::IsCullEnabled() const
+{
+    return mCullEnabled;
+}
+
+bool
+BatchRenderer::IsOcclusionEnabled() const
+{
+    return mOcclusionEnabled;
+}
+
+bool
+BatchRenderer::IsTextureBindless() const
+{
+    return mTextureBindless;
+}
+
+bool
+BatchRenderer::IsMaterialBuffered(const Material *material) const
+{
+    if (!mBatchEnabled || material == nullptr)
+    {
+        return false;
+    }
+
+    if (material->mTextureArray != nullptr)
+    {
+        return true;
+    }
+
+    if (material->mAmbientTexture == nullptr
+            && material->mDiffuseTexture == nullptr
+            && material->mEmissiveTexture == nullptr
+            && material->mShininessTexture == nullptr
+            && material->mSpecularTexture == nullptr)
+    {
+        return true;
+    }
+
+    // NOTE: The handle is created with sampler object.
+    return mTextureBindless
+           && (material->mAmbientTexture == nullptr || material->mAmbientSampler != nullptr)
+           && (material->mDiffuseTexture == nullptr || material->mDiffuseSampler != nullptr)
+           && (material->mEmissiveTexture == nullptr || material->mEmissiveSampler != nullptr)
+           && (material->mShininessTexture == nullptr || material->mShininessSampler != nullptr)
+           && (material->mSpecularTexture == nullptr || material->mSpecularSampler != nullptr);
+}
+
+int
+BatchRenderer::GetFrameBatchNum() const
+{
+    return mFrameBatchNum;
+}
+
+int
+BatchRenderer::GetFrameDrawNum() const
+{
+    return mFrameDrawNum;
+}
+
+int
+BatchRenderer::GetFrameVisibleNum() const
+{
+    return mFrameVisibleNum;
+}
+
+int
+BatchRenderer::GetFrameOccludedNum() const
+{
+    return mFrameOccludedNum;
+}
+
+void
+BatchRenderer::ResetGeometry()
+{
+    // NOTE: Queued draws refer to the geometry range.
+    mDrawItemList.clear();
+
+    for (auto& geometryPair : mGeometryTable)
+    {
+        if (geometryPair.second)
+        {
+            geometryPair.second->Reset();
+        }
+    }
+
+    // NOTE: The bounds are looked up by the mesh as well.
+    mDrawBoundTable.clear();
+    mDrawBoundNum = 0;
+    mDrawBoundReset = true;
+
+    mDrawMaterialTable.clear();
+    mDrawMaterialNum = 0;
+    mDrawMaterialReset = true;
+
+    // NOTE: Captured depth refers to the camera.
+    if (mDepthPyramid)
+    {
+        mDepthPyramid->Reset();
+    }
+}
+
+/************************************************************************/
+/* Rendering Engine API                                                 */
+/************************************************************************/
+void
+BatchRenderer::Initialize()
+{
+    auto gameEngineSettings = GameEngineSettings::GetInstance();
+
+    mBatchEnabled = gameEngineSettings->mBatchEnabled;
+    mBatchDrawNumMax = gameEngineSettings->mBatchDrawNumMax;
+    mBatchVertexNumMax = gameEngineSettings->mBatchVertexNumMax;
+    mBatchIndexNumMax = gameEngineSettings->mBatchIndexNumMax;
+
+    if (!mBatchEnabled)
+    {
+        return;
+    }
+
+    mDrawDataBuffer = make_shared<ShaderBuffer>(mBatchDrawNumMax * sizeof(BatchDrawData),
+                      BufferStorageMode::Device, BufferUsage::Stream);
+    mDrawCommandBuffer = make_shared<IndirectBuffer>(mBatchDrawNumMax,
+                         BufferStorageMode::Device, BufferUsage::Stream);
+
+    // NOTE: The draw index buffer is instanced vertex attribute
+    // holding the index itself. It is read when the shader doesn't support
+    // draw parameters, so that the base instance of draw command selects the
+    // draw data.
+    mDrawIndexBuffer = make_shared<VertexBuffer>(mBatchDrawNumMax, sizeof(float),
+                       BufferStorageMode::Host, BufferUsage::Static);
+
+    auto drawIndexData = reinterpret_cast<float *>(mDrawIndexBuffer->GetData());
+    for (int drawIndex = 0; drawIndex < mBatchDrawNumMax; ++drawIndex)
+    {
+        drawIndexData[drawIndex] = float(drawIndex);
+    }
+
+    mTextureBindless = gameEngineSettings->mBatchBindlessEnabled
+                       && Renderer::GetInstance()->IsTextureHandleSupported();
+    mDrawMaterialBuffer = make_shared<ShaderBuffer>(mBatchDrawNumMax * sizeof(BatchMaterialData),
+                          BufferStorageMode::Device, BufferUsage::Dynamic);
+
+    mCullEnabled = gameEngineSettings->mBatchCullEnabled;
+    if (!mCullEnabled)
+    {
+        return;
+    }
+
+    mCullShader = make_shared<Shader>();
+    mCullShader->PushShaderFile(ShaderType::ComputeShader, "Content/Shader/BatchCull.comp.glsl");
+
+    mCullBatchBuffer = make_shared<ShaderBuffer>(sizeof(BatchCullHeader) + mBatchDrawNumMax * sizeof(BatchCullBatch),
+                       BufferStorageMode::Device, BufferUsage::Stream);
+    for (auto& cullVisibleBuffer : mCullVisibleBuffer)
+    {
+        cullVisibleBuffer = make_shared<ShaderBuffer>(2 * sizeof(unsigned int),
+                            BufferStorageMode::Device, BufferUsage::Stream);
+    }
+
+    mDrawBoundBuffer = make_shared<ShaderBuffer>(mBatchDrawNumMax * sizeof(BatchDrawBound),
+                       BufferStorageMode::Device, BufferUsage::Dynamic);
+    mDrawCountBuffer = make_shared<ShaderBuffer>(mBatchDrawNumMax * sizeof(unsigned int),
+                       BufferStorageMode::Device, BufferUsage::Stream);
+    mDrawCommandCulledBuffer = make_shared<IndirectBuffer>(mBatchDrawNumMax,
+                               BufferStorageMode::Device, BufferUsage::Stream);
+
+    mOcclusionEnabled = gameEngineSettings->mBatchOcclusionEnabled;
+    if (mOcclusionEnabled)
+    {
+        mDepthPyramid = make_unique<BatchDepthPyramid>();
+    }
+}
+
+void
+BatchRenderer::RenderBegin()
+{
+    static auto sMasterRenderer = Renderer::GetInstance();
+
+    mFrameBatchNum = 0;
+    mFrameDrawNum = 0;
+
+    // NOTE: The material changed is appended again, and the material destroyed
+    // is never looked up again. Restart the full material buffer in the new
+    // frame like the bound buffer.
+    if (mBatchEnabled && mDrawMaterialNum >= mBatchDrawNumMax)
+    {
+        mDrawMaterialTable.clear();
+        mDrawMaterialNum = 0;
+        mDrawMaterialReset = true;
+    }
+
+    if (!mCullEnabled)
+    {
+        return;
+    }
+
+    // NOTE: The bounds of the destroyed meshes are never looked up again.
+    // Restart the full bound buffer in the new frame, so that the new mesh is
+    // culled again. The buffer is invalidated, so that the bounds read by the
+    // draws in flight are not overwritten.
+    if (mDrawBoundNum >= mBatchDrawNumMax)
+    {
+        mDrawBoundTable.clear();
+        mDrawBoundNum = 0;
+        mDrawBoundReset = true;
+    }
+
+    // NOTE: The visible and occluded number are accumulated into a
+    // ring of buffers. The buffer reused in this frame was written a few frames
+    // earlier, so that reading it does not wait for the device in general.
+    mCullVisibleBufferIndex = (mCullVisibleBufferIndex + 1) % CullVisibleBufferNum;
+
+    auto cullVisibleBuffer = mCullVisibleBuffer[mCullVisibleBufferIndex].get();
+    auto cullVisibleNum = reinterpret_cast<unsigned int *>(
+                              sMasterRenderer->Map(cullVisibleBuffer,
+                                      BufferAccessMode::ReadWriteBuffer,
+                                      BufferFlushMode::Automatic,
+                                      BufferSynchronizationMode::Synchronized,
+                                      0, 2 * sizeof(unsigned int)));
+
+    if (mCullFrameNum >= CullVisibleBufferNum)
+    {
+        mFrameVisibleNum = int(cullVisibleNum[0]);
+        mFrameOccludedNum = mOcclusionEnabled ? int(cullVisibleNum[1]) : -1;
+    }
+
+    cullVisibleNum[0] = 0;
+    cullVisibleNum[1] = 0;
+    sMasterRenderer->Unmap(cullVisibleBuffer);
+
+    ++mCullFrameNum;
+}
+
+void
+BatchRenderer::Render(double /* percent */)
+{
+    Flush();
+}
+
+void
+BatchRenderer::CaptureDepth(const Camera *camera)
+{
+    if (!mOcclusionEnabled || camera == nullptr)
+    {
+        return;
+    }
+
+    mDepthPyramid->Capture(camera);
+}
+
+void
+BatchRenderer::RenderEnd()
+{
+}
+
+/************************************************************************/
+/* Private Members                                                      */
+/************************************************************************/
+int
+BatchRenderer::FindBound(const Mesh *mesh)
+{
+    static auto sMasterRenderer = Renderer::GetInstance();
+
+    auto iter = mDrawBoundTable.find(mesh->GetId());
+    if (iter != mDrawBoundTable.end())
+    {
+        return iter->second;
+    }
+
+    // NOTE: The mesh is not culled until the next frame when the
+    // bound buffer is full.
+    int boundIndex = -1;
+    if (mDrawBoundNum < mBatchDrawNumMax)
+    {
+        boundIndex = mDrawBoundNum++;
+
+        // NOTE: The bounds are only appended, so that the range
+        // written is not being read by the device.
+        auto bound = reinterpret_cast<BatchDrawBound *>(
+                         sMasterRenderer->Map(mDrawBoundBuffer.get(),
+                                 mDrawBoundReset ? BufferAccessMode::WriteRangeInvalidateBuffer : BufferAccessMode::WriteRange,
+                                 BufferFlushMode::Automatic,
+                                 BufferSynchronizationMode::Unsynchronized,
+                                 int64_t(boundIndex) * sizeof(BatchDrawBound), sizeof(BatchDrawBound)));
+
+        auto aabb = mesh->GetAABB();
+        bound->mCenter = Vector4f(aabb->GetCenter(), 1.0f);
+        bound->mExtent = Vector4f(aabb->GetExtent(), 0.0f);
+
+        sMasterRenderer->Unmap(mDrawBoundBuffer.get());
+
+        mDrawBoundReset = false;
+    }
+
+    mDrawBoundTable.emplace(mesh->GetId(), boundIndex);
+    return boundIndex;
+}
+
+int
+BatchRenderer::FindMaterial(const Material *material)
+{
+    static auto sMasterRenderer = Renderer::GetInstance();
+
+    auto iter = mDrawMaterialTable.find(material->GetId());
+    if (iter != mDrawMaterialTable.end() && IsMaterialUploadEqual(iter->second.mMaterial, *material))
+    {
+        return iter->second.mMaterialIndex;
+    }
+
+    // NOTE: The changed material is appended instead of written over the
+    // uploaded one, which could still be read by the draws in flight.
+
+    // NOTE: The index is negative when the material buffer is full.
+    int materialIndex = -1;
+    if (mDrawMaterialNum < mBatchDrawNumMax)
+    {
+        materialIndex = mDrawMaterialNum++;
+
+        // NOTE: The materials are only appended like the bounds.
+        auto materialData = reinterpret_cast<BatchMaterialData *>(
+                                sMasterRenderer->Map(mDrawMaterialBuffer.get(),
+                                        mDrawMaterialReset ? BufferAccessMode::WriteRangeInvalidateBuffer : BufferAccessMode::WriteRange,
+                                        BufferFlushMode::Automatic,
+                                        BufferSynchronizationMode::Unsynchronized,
+                                        int64_t(materialIndex) * sizeof(BatchMaterialData), sizeof(BatchMaterialData)));
+
+        // NOTE: The packed texture is read from the texture array,
+        // which is bound by the batch key.
+        auto textureBindless = mTextureBindless && material->mTextureArray == nullptr;
+        auto getTextureHandle = [textureBindless](const Texture2d * texture, const Sampler * sampler)
+        {
+            return textureBindless && texture != nullptr ? sMasterRenderer->GetTextureHandle(texture, sampler) : uint64_t(0);
+        };
+
+        materialData->mAmbient = Vector4f(material->mAmbientColor);
+        materialData->mDiffuse = Vector4f(material->mDiffuseColor);
+        materialData->mEmissive = Vector4f(material->mEmissiveColor);
+        materialData->mSpecular = Vector4f(Vector3f(material->mSpecularColor), material->mShininess);
+
+        materialData->mAmbientTexture = getTextureHandle(material->mAmbientTexture, material->mAmbientSampler);
+        materialData->mDiffuseTexture = getTextureHandle(material->mDiffuseTexture, material->mDiffuseSampler);
+        materialData->mEmissiveTexture = getTextureHandle(material->mEmissiveTexture, material->mEmissiveSampler);
+        materialData->mShininessTexture = getTextureHandle(material->mShininessTexture, material->mShininessSampler);
+        materialData->mSpecularTexture = getTextureHandle(material->mSpecularTexture, material->mSpecularSampler);
+
+        materialData->mTextureExist = (materialData->mAmbientTexture != 0 ? 1u : 0u)
+                                      | (materialData->mDiffuseTexture != 0 ? 2u : 0u)
+                                      | (materialData->mEmissiveTexture != 0 ? 4u : 0u)
+                                      | (materialData->mShininessTexture != 0 ? 8u : 0u)
+                                      | (materialData->mSpecularTexture != 0 ? 16u : 0u);
+
+        materialData->mAmbientLayer = material->mAmbientTextureLayer;
+        materialData->mDiffuseLayer = material->mDiffuseTextureLayer;
+        materialData->mEmissiveLayer = material->mEmissiveTextureLayer;
+        materialData->mShininessLayer = material->mShininessTextureLayer;
+        materialData->mSpecularLayer = material->mSpecularTextureLayer;
+
+        sMasterRenderer->Unmap(mDrawMaterialBuffer.get());
+
+        mDrawMaterialReset = false;
+    }
+
+    auto& materialEntry = mDrawMaterialTable[material->GetId()];
+    materialEntry.mMaterial = *material;
+    materialEntry.mMaterialIndex = materialIndex;
+    return materialIndex;
+}
+
+BatchGeometry *
+BatchRenderer::FindGeometry(const VertexFormat *vertexFormat, IndexType indexType)
+{
+    auto key = BatchGeometryKey(vertexFormat, int(indexType));
+    auto iter = mGeometryTable.find(key);
+    if (iter != mGeometryTable.end())
+    {
+        return iter->second.get();
+    }
+
+    // NOTE: The draw index is placed after all the vertex attributes,
+    // so that vertex format using the reserved location is not batched.
+    unique_ptr<BatchGeometry> geometry;
+    if (!vertexFormat->mVertexAttributeList.empty()
+            && int(vertexFormat->mVertexAttributeList.back().mLocation) < BatchGeometry::DrawIndexLocation)
+    {
+        geometry = make_unique<BatchGeometry>(vertexFormat, indexType,
+                                              mBatchVertexNumMax, mBatchIndexNumMax,
+                                              mDrawIndexBuffer);
+    }
+
+    return mGeometryTable.emplace(key, move(geometry)).first->second.get();
+}
+
+void
+BatchRenderer::Flush()
+{
+    static auto sMasterRenderer = Renderer::GetInstance();
+
+    if (mDrawItemList.empty())
+    {
+        return;
+    }
+
+    // NOTE: Sort the draws so that the draws sharing the same pass,
+    // geometry and batch key are adjacent.
+    std::stable_sort(mDrawItemList.begin(), mDrawItemList.end(),
+                     [](const BatchDrawItem& lhs, const BatchDrawItem& rhs)
+    {
+        return std::tie(lhs.mCamera, lhs.mPassIndex, lhs.mPass, lhs.mGeometry, lhs.mInstancePass->GetShaderBatchKey())
+               < std::tie(rhs.mCamera, rhs.mPassIndex, rhs.mPass, rhs.mGeometry, rhs.mInstancePass->GetShaderBatchKey());
+    });
+
+    auto drawNum = int(mDrawItemList.size());
+
+    // Group the draws into batches.
+    mBatchList.clear();
+    for (int batchBegin = 0; batchBegin < drawNum;)
+    {
+        auto& batchItem = mDrawItemList[batchBegin];
+
+        int batchEnd = batchBegin + 1;
+        while (batchEnd < drawNum)
+        {
+            auto& drawItem = mDrawItemList[batchEnd];
+            if (drawItem.mCamera != batchItem.mCamera
+                    || drawItem.mPass != batchItem.mPass
+                    || drawItem.mGeometry != batchItem.mGeometry
+                    || drawItem.mInstancePass->GetShaderBatchKey() != batchItem.mInstancePass->GetShaderBatchKey())
+            {
+                break;
+            }
+
+            ++batchEnd;
+        }
+
+        mBatchList.push_back(BatchRange(batchBegin, batchEnd));
+        batchBegin = batchEnd;
+    }
+
+    auto batchNum = int(mBatchList.size());
+
+    // Fill per draw data and draw commands.
+    {
+        auto drawData = reinterpret_cast<BatchDrawData *>(
+                            sMasterRenderer->Map(mDrawDataBuffer.get(),
+                                    BufferAccessMode::WriteBufferInvalidateBuffer,
+                                    BufferFlushMode::Automatic,
+                                    BufferSynchronizationMode::Unsynchronized,
+                                    0, int64_t(drawNum) * sizeof(BatchDrawData)));
+
+        auto drawCommand = reinterpret_cast<DrawElementsIndirectCommand *>(
+                               sMasterRenderer->Map(mDrawCommandBuffer.get(),
+                                       BufferAccessMode::WriteBufferInvalidateBuffer,
+                                       BufferFlushMode::Automatic,
+                                       BufferSynchronizationMode::Unsynchronized,
+                                       0, int64_t(drawNum) * sizeof(DrawElementsIndirectCommand)));
+
+        for (int batchIndex = 0; batchIndex < batchNum; ++batchIndex)
+        {
+            for (int drawIndex = mBatchList[batchIndex].first; drawIndex < mBatchList[batchIndex].second; ++drawIndex)
+            {
+                auto& drawItem = mDrawItemList[drawIndex];
+                auto visual = drawItem.mVisual;
+
+                auto& drawDataCurrent = drawData[drawIndex];
+                drawDataCurrent.mModelTransform = visual->mWorldTransformInterpolated;
+                drawDataCurrent.mModelNormalTransform = Matrix4f::Transpose(Matrix4f::Inverse(visual->mWorldTransformInterpolated));
+
+                // NOTE: Mirror the vertex decoding uniforms, see
+                // VisualEffect::SetShaderUniformAutomaticVertexDecode.
+                auto& vertexAttributeList = visual->GetVertexFormat()->mVertexAttributeList;
+                if (vertexAttributeList[0].mType != VertexAttributeType::FloatVec3)
+                {
+                    auto aabb = visual->GetMesh()->GetAABB();
+                    drawDataCurrent.mVertexPositionScale = Vector4f(aabb->GetExtent(), 0.0f);
+                    drawDataCurrent.mVertexPositionOffset = Vector4f(aabb->GetCenter(), 0.0f);
+                }
+                else
+                {
+                    drawDataCurrent.mVertexPositionScale = Vector4f(Vector3f::One, 0.0f);
+                    drawDataCurrent.mVertexPositionOffset = Vector4f(Vector3f::Zero, 0.0f);
+                }
+
+                if (vertexAttributeList.size() > 1 && vertexAttributeList[1].mChannel == 2)
+                {
+                    drawDataCurrent.mVertexPositionOffset.w = 1.0f;
+                }
+
+                drawDataCurrent.mBoundIndex = mCullEnabled ? FindBound(visual->GetMesh()) : -1;
+                drawDataCurrent.mBatchIndex = batchIndex;
+                drawDataCurrent.mMaterialIndex = drawItem.mMaterialIndex;
+
+                // NOTE: The base instance is the draw index, which
+                // is kept when the command is compacted.
+                auto geometryRange = drawItem.mGeometryRange;
+                auto& drawCommandCurrent = drawCommand[drawIndex];
+                drawCommandCurrent.mIndexNum = unsigned(geometryRange->mIndexNum);
+                drawCommandCurrent.mInstanceNum = 1;
+                drawCommandCurrent.mIndexBegin = unsigned(geometryRange->mIndexBegin);
+                drawCommandCurrent.mVertexBase = geometryRange->mVertexBase;
+                drawCommandCurrent.mInstanceBase = unsigned(drawIndex);
+            }
+        }
+
+        sMasterRenderer->Unmap(mDrawCommandBuffer.get());
+        sMasterRenderer->Unmap(mDrawDataBuffer.get());
+    }
+
+    // Cull the draws and compact the commands.
+    if (mCullEnabled)
+    {
+        // NOTE: The pyramid is built before the cull data is mapped,
+        // only for the camera whose depth is captured in previous frame.
+        const Camera *occlusionCamera = nullptr;
+        if (mOcclusionEnabled && mDepthPyramid->Build(mDepthPyramid->GetCamera()))
+        {
+            occlusionCamera = mDepthPyramid->GetCamera();
+        }
+
+        auto cullData = reinterpret_cast<unsigned char *>(
+                            sMasterRenderer->Map(mCullBatchBuffer.get(),
+                                    BufferAccessMode::WriteBufferInvalidateBuffer,
+                                    BufferFlushMode::Automatic,
+                                    BufferSynchronizationMode::Unsynchronized,
+                                    0, sizeof(BatchCullHeader) + int64_t(batchNum) * sizeof(BatchCullBatch)));
+
+        auto cullHeader = reinterpret_cast<BatchCullHeader *>(cullData);
+        cullHeader->mDrawNum = unsigned(drawNum);
+
+        auto cullBatch = reinterpret_cast<BatchCullBatch *>(cullData + sizeof(BatchCullHeader));
+        for (int batchIndex = 0; batchIndex < batchNum; ++batchIndex)
+        {
+            auto batchBegin = mBatchList[batchIndex].first;
+            cullBatch[batchIndex].mViewProjection = mDrawItemList[batchBegin].mCamera->GetViewProjection();
+            cullBatch[batchIndex].mCommandBegin = unsigned(batchBegin);
+            cullBatch[batchIndex].mOcclusionEnabled = mDrawItemList[batchBegin].mCamera == occlusionCamera ? 1 : 0;
+        }
+
+        sMasterRenderer->Unmap(mCullBatchBuffer.get());
+
+        // NOTE: Counters start from zero. Compacted commands are
+        // cleared, so that the commands beyond the count draw nothing when
+        // the count could not be read by the device.
+        auto drawCount = sMasterRenderer->Map(mDrawCountBuffer.get(),
+                                              BufferAccessMode::WriteBufferInvalidateBuffer,
+                                              BufferFlushMode::Automatic,
+                                              BufferSynchronizationMode::Unsynchronized,
+                                              0, int64_t(batchNum) * sizeof(unsigned int));
+        std::memset(drawCount, 0, size_t(batchNum) * sizeof(unsigned int));
+        sMasterRenderer->Unmap(mDrawCountBuffer.get());
+
+        auto drawCommandCulled = sMasterRenderer->Map(mDrawCommandCulledBuffer.get(),
+                                 BufferAccessMode::WriteBufferInvalidateBuffer,
+                                 BufferFlushMode::Automatic,
+                                 BufferSynchronizationMode::Unsynchronized,
+                                 0, int64_t(drawNum) * sizeof(DrawElementsIndirectCommand));
+        std::memset(drawCommandCulled, 0, size_t(drawNum) * sizeof(DrawElementsIndirectCommand));
+        sMasterRenderer->Unmap(mDrawCommandCulledBuffer.get());
+
+        // NOTE: Binding points are declared in BatchCull.comp.glsl
+        // and fe_DepthPyramid.glsl.
+        sMasterRenderer->Enable(mDrawDataBuffer.get(), 0);
+        sMasterRenderer->Enable(mDrawBoundBuffer.get(), 1);
+        sMasterRenderer->Enable(mDrawCommandBuffer.get(), 2);
+        sMasterRenderer->Enable(mDrawCommandCulledBuffer.get(), 3);
+        sMasterRenderer->Enable(mDrawCountBuffer.get(), 4);
+        sMasterRenderer->Enable(mCullBatchBuffer.get(), 5);
+        sMasterRenderer->Enable(mCullVisibleBuffer[mCullVisibleBufferIndex].get(), 6);
+        if (occlusionCamera != nullptr)
+        {
+            sMasterRenderer->Enable(mDepthPyramid->GetPyramidBuffer(), 7);
+            sMasterRenderer->Enable(mDepthPyramid->GetHeaderBuffer(), 8);
+        }
+
+        const int cullGroupSize = 64;
+        sMasterRenderer->Dispatch(mCullShader.get(), (drawNum + cullGroupSize - 1) / cullGroupSize, 1, 1);
+    }
+
+    // Draw each batch.
+    mBatchDrawing = true;
+
+    for (int batchIndex = 0; batchIndex < batchNum; ++batchIndex)
+    {
+        auto batchBegin = mBatchList[batchIndex].first;
+        auto batchEnd = mBatchList[batchIndex].second;
+        auto& batchItem = mDrawItemList[batchBegin];
+
+        auto geometry = batchItem.mGeometry;
+        sMasterRenderer->Enable(geometry->GetVertexFormat());
+        sMasterRenderer->Enable(geometry->GetVertexGroup());
+        sMasterRenderer->Enable(geometry->GetIndexBuffer());
+
+        // NOTE: The instance pass of the first draw provides the
+        // uniforms and textures shared by the batch.
+        sMasterRenderer->Enable(batchItem.mPass);
+        sMasterRenderer->Enable(batchItem.mInstancePass, batchItem.mCamera, batchItem.mVisual);
+        sMasterRenderer->Enable(mDrawDataBuffer.get(), 0);
+
+        // NOTE: Binding point is declared in fe_MaterialTexture.glsl.
+        sMasterRenderer->Enable(mDrawMaterialBuffer.get(), 9);
+
+        if (mCullEnabled)
+        {
+            sMasterRenderer->DrawIndirect(mDrawCommandCulledBuffer.get(), batchBegin, batchEnd - batchBegin,
+                                          mDrawCountBuffer.get(), int64_t(batchIndex) * sizeof(unsigned int),
+                                          PrimitiveType::Triangle, geometry->GetIndexType());
+        }
+        else
+        {
+            sMasterRenderer->DrawIndirect(mDrawCommandBuffer.get(), batchBegin, batchEnd - batchBegin,
+                                          PrimitiveType::Triangle, geometry->GetIndexType());
+        }
+
+        ++mFrameBatchNum;
+    }
+
+    mBatchDrawing = false;
+
+    mFrameDrawNum += drawNum;
+    mDrawItemList.clear();
+}
+
+}
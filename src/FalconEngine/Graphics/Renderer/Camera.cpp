@@ -240,4 +240,32 @@ Camera::Update(double /* elapsed */)
     mViewProjection = mProjection * mView;
 }
 
+/************************************************************************/
+/* Deep and Shallow Copy                                                */
+/************************************************************************/
+void
+Camera::CopyTo(Camera *lhs) const
+{
+    lhs->mAspect = mAspect;
+    lhs->mNear = mNear;
+    lhs->mFar = mFar;
+    lhs->mFovy = mFovy;
+
+    lhs->mPosition = mPosition;
+    lhs->mOrientation = mOrientation;
+
+    lhs->mProjection = mProjection;
+    lhs->mView = mView;
+    lhs->mViewProjection = mViewProjection;
+    lhs->mWorld = mWorld;
+}
+
+Camera *
+Camera::GetClone() const
+{
+    auto clone = new Camera(mCoordinate, mHandedness);
+    CopyTo(clone);
+    return clone;
+}
+
 }
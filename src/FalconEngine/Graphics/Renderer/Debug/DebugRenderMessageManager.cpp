@@ -1,29 +1,163 @@
 #include <FalconEngine/Graphics/Renderer/Debug/DebugRenderMessageManager.h>
 
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <mutex>
+
+using namespace std;
+
 namespace FalconEngine
 {
 
-void
-DebugRenderMessageManager::UpdateFrame(double elapsed)
+/************************************************************************/
+/* Buffer Pool                                                          */
+/************************************************************************/
+// @summary Buffers of the manager. The pool is shared with the recording
+// threads, so that the thread exiting after the manager is destroyed still
+// returns its buffer.
+class DebugRenderMessageBufferPool
 {
-    auto tSecond = elapsed / 1000;
-
-    for (auto messageIter = mMessageList.begin();
-            messageIter != mMessageList.end(); )
+public:
+    DebugRenderMessageBuffer *
+    Acquire()
     {
-        // Compute left duration.
-        messageIter->mDuration -= float(tSecond);
-        if (messageIter->mDuration < 0)
+        lock_guard<mutex> lock(mBufferMutex);
+
+        if (!mBufferFreeList.empty())
         {
-            auto messageIterPrevious = messageIter;
-            ++messageIter;
-            mMessageList.erase(messageIterPrevious);
+            auto buffer = mBufferFreeList.back();
+            mBufferFreeList.pop_back();
+            return buffer;
         }
-        else
+
+        mBufferList.push_back(make_unique<DebugRenderMessageBuffer>());
+        return mBufferList.back().get();
+    }
+
+    void
+    Release(DebugRenderMessageBuffer *buffer)
+    {
+        lock_guard<mutex> lock(mBufferMutex);
+
+        mBufferFreeList.push_back(buffer);
+    }
+
+public:
+    mutex                                        mBufferMutex;
+    vector<unique_ptr<DebugRenderMessageBuffer>> mBufferList;                   // Buffer of each thread recording, or released by the exited thread.
+    vector<DebugRenderMessageBuffer *>           mBufferFreeList;               // Buffer released by the exited thread, whose messages are still merged.
+};
+
+// @summary Buffer cache of the calling thread, which returns the buffer to the
+// pool when the thread exits.
+class DebugRenderMessageThreadBuffer
+{
+public:
+    ~DebugRenderMessageThreadBuffer()
+    {
+        Reset();
+    }
+
+    void
+    Reset()
+    {
+        if (mBufferPool)
         {
-            ++messageIter;
+            mBufferPool->Release(mBuffer);
+            mBufferPool.reset();
         }
+
+        mManagerId = 0;
+        mBuffer = nullptr;
     }
+
+public:
+    uint64_t                                 mManagerId = 0;
+    shared_ptr<DebugRenderMessageBufferPool> mBufferPool;
+    DebugRenderMessageBuffer                *mBuffer = nullptr;
+};
+
+/************************************************************************/
+/* Static Members                                                       */
+/************************************************************************/
+static atomic<uint64_t> sManagerIdNext(1);
+
+// NOTE: Thread-local data is defined in the translation unit because
+// thread-local data could not have dll interface.
+static thread_local DebugRenderMessageThreadBuffer sThreadBuffer;
+
+/************************************************************************/
+/* Constructors and Destructor                                          */
+/************************************************************************/
+DebugRenderMessageManager::DebugRenderMessageManager() :
+    mManagerId(sManagerIdNext++),
+    mBufferPool(make_shared<DebugRenderMessageBufferPool>())
+{
 }
 
-}
\ No newline at end of file
+DebugRenderMessageManager::~DebugRenderMessageManager()
+{
+}
+
+/************************************************************************/
+/* Public Members                                                       */
+/************************************************************************/
+void
+DebugRenderMessageManager::AddMessage(DebugRenderMessage&& message)
+{
+    GetThreadBuffer()->mMessageList.push_back(std::move(message));
+}
+
+void
+DebugRenderMessageManager::Merge()
+{
+    lock_guard<mutex> lock(mBufferPool->mBufferMutex);
+
+    for (auto& buffer : mBufferPool->mBufferList)
+    {
+        auto& bufferMessageList = buffer->mMessageList;
+        move(bufferMessageList.begin(), bufferMessageList.end(), back_inserter(mMessageList));
+
+        // NOTE: The buffer keeps its capacity, so that recording
+        // doesn't allocate after the first few frames.
+        bufferMessageList.clear();
+    }
+}
+
+void
+DebugRenderMessageManager::UpdateFrame(double elapsed)
+{
+    auto tSecond = float(elapsed / 1000);
+
+    // Compute left duration.
+    for (auto& message : mMessageList)
+    {
+        message.mDuration -= tSecond;
+    }
+
+    mMessageList.erase(remove_if(mMessageList.begin(), mMessageList.end(),
+                                 [](const DebugRenderMessage & message)
+    {
+        return message.mDuration < 0;
+    }), mMessageList.end());
+}
+
+/************************************************************************/
+/* Private Members                                                      */
+/************************************************************************/
+DebugRenderMessageBuffer *
+DebugRenderMessageManager::GetThreadBuffer()
+{
+    if (sThreadBuffer.mManagerId != mManagerId)
+    {
+        sThreadBuffer.Reset();
+        sThreadBuffer.mManagerId = mManagerId;
+        sThreadBuffer.mBufferPool = mBufferPool;
+        sThreadBuffer.mBuffer = mBufferPool->Acquire();
+    }
+
+    return sThreadBuffer.mBuffer;
+}
+
+}
@@ -1,9 +1,13 @@
 #include <FalconEngine/Graphics/Renderer/Debug/DebugRenderer.h>
 
+#include <algorithm>
+#include <cmath>
+
 #include <FalconEngine/Content/AssetManager.h>
 #include <FalconEngine/Graphics/Effect/DebugEffect.h>
 #include <FalconEngine/Graphics/Renderer/Camera.h>
 #include <FalconEngine/Graphics/Renderer/Renderer.h>
+#include <FalconEngine/Graphics/Renderer/VisualEffectInstance.h>
 #include <FalconEngine/Graphics/Renderer/Font/FontRenderer.h>
 #include <FalconEngine/Graphics/Renderer/Entity/Entity.h>
 #include <FalconEngine/Graphics/Renderer/Scene/Node.h>
@@ -20,6 +24,11 @@ DebugRenderer::DebugRenderer() :
     mDebugFont(nullptr)
 {
     mDebugBufferResource = make_shared<BufferResource<BufferResourceChannel>>();
+    mDebugShapeBufferResource = make_shared<BufferResource<BufferResourceChannel>>();
+    mDebugChannelElementNumRecord.assign(ChannelCount * 2, 0);
+    mDebugChannelElementNumRender.assign(ChannelCount * 2, 0);
+    mDebugShapeElementNumRecord.assign(ShapeChannelCount * 2, 0);
+    mDebugShapeElementNumRender.assign(ShapeChannelCount * 2, 0);
     mDebugEffectParams = make_shared<DebugEffectParams>();
     mDebugMessageManager = make_shared<DebugRenderMessageManager>();
 }
@@ -30,24 +39,90 @@ DebugRenderer::~DebugRenderer()
 
 enum BufferChannel
 {
+    ChannelNull     = -1,
     ChannelLine     = 0,
     ChannelTriangle = 1,
     ChannelCount
 };
 
+// NOTE: Only the arbitrary lines and triangles are streamed as vertex
+// data. The other shapes are drawn as instance of the unit mesh.
 const int BufferChannelMap[int(DebugRenderType::Count)] =
 {
-    ChannelLine,
-    ChannelLine,
+    ChannelNull,
+    ChannelNull,
 
+    ChannelNull,
+    ChannelNull,
     ChannelLine,
+    ChannelNull,
+    ChannelNull,
     ChannelLine,
-    ChannelLine,
+    ChannelNull,
     ChannelTriangle,
 
-    ChannelTriangle,
+    ChannelNull,
+};
+
+const int ShapeChannelMap[int(DebugRenderType::Count)] =
+{
+    int(DebugShapeType::Box),
+    int(DebugShapeType::Box),
+
+    int(DebugShapeType::Circle),
+    int(DebugShapeType::Cone),
+    ChannelNull,
+    int(DebugShapeType::Cylinder),
+    int(DebugShapeType::Hemisphere),
+    ChannelNull,
+    int(DebugShapeType::Sphere),
+    ChannelNull,
+
+    ChannelNull,
+};
+
+const int ShapeChannelCount = int(DebugShapeType::Count);
+
+// NOTE: Vertex number streamed for each message.
+const int BufferChannelElementNumMap[int(DebugRenderType::Count)] =
+{
+    0,
+    0,
+
+    0,
+    0,
+    6,
+    0,
+    0,
+    2,
+    0,
+    3,
+
+    0,
 };
 
+// @return Channel of the streaming buffer resource.
+inline int
+GetBufferChannel(const DebugRenderMessage& message)
+{
+    int channel = BufferChannelMap[int(message.mType)];
+    return message.mDepthEnabled ? channel + ChannelCount : channel;
+}
+
+// @return Channel of the shape buffer resource, or null channel when the
+// message is streamed as vertex data.
+inline int
+GetShapeChannel(const DebugRenderMessage& message)
+{
+    int shapeChannel = ShapeChannelMap[int(message.mType)];
+    if (shapeChannel == ChannelNull)
+    {
+        return ChannelNull;
+    }
+
+    return message.mDepthEnabled ? shapeChannel + ShapeChannelCount : shapeChannel;
+}
+
 /************************************************************************/
 /* Rendering API                                                        */
 /************************************************************************/
@@ -72,17 +147,15 @@ DebugRenderer::AddAABB(const Camera *camera,
 {
     FALCON_ENGINE_CHECK_NULLPTR(node);
 
-    auto slotNum = node->GetChildrenSlotNum();
-    for (auto slotIndex = 0; slotIndex < slotNum; ++slotIndex)
+    for (auto child = node->GetFirstChild(); child != nullptr; child = child->GetNextSibling())
     {
-        auto child = node->GetChildAt(slotIndex);
-        if (auto childVisual = dynamic_cast<const Visual *>(child))
+        if (child->mSpatialType == SpatialType::Visual)
         {
-            AddAABB(camera, childVisual, color, duration, depthEnabled);
+            AddAABB(camera, static_cast<const Visual *>(child), color, duration, depthEnabled);
         }
-        else if (auto childNode = dynamic_cast<const Node *>(child))
+        else
         {
-            AddAABB(camera, childNode, color, duration, depthEnabled);
+            AddAABB(camera, static_cast<const Node *>(child), color, duration, depthEnabled);
         }
     }
 }
@@ -113,12 +186,42 @@ DebugRenderer::AddAABB(const Camera   *camera,
                        float           duration,
                        bool            depthEnabled)
 {
-    DebugRenderMessage message(DebugRenderType::AABB, color, duration, depthEnabled);
-    message.mCamera = camera;
-    message.mFloatVector1 = min;
-    message.mFloatVector2 = max;
+    auto center = (min + max) * 0.5f;
+    auto extent = (max - min) * 0.5f;
+
+    AddShape(DebugRenderType::AABB, camera,
+             Matrix4f(extent.x, 0.0f, 0.0f, 0.0f,
+                      0.0f, extent.y, 0.0f, 0.0f,
+                      0.0f, 0.0f, extent.z, 0.0f,
+                      center.x, center.y, center.z, 1.0f),
+             color, duration, depthEnabled);
+}
 
-    mDebugMessageManager->mMessageList.push_back(std::move(message));
+void
+DebugRenderer::AddCapsule(const Camera   *camera,
+                          const Vector3f& from,
+                          const Vector3f& to,
+                          float           radius,
+
+                          const Color&    color,
+                          float           duration,
+                          bool            depthEnabled)
+{
+    auto segment = to - from;
+    auto length = sqrt(Vector3f::Dot(segment, segment));
+    auto direction = length > 0.0f ? Vector3f(segment / length) : Vector3f::UnitZ;
+
+    // NOTE: The capsule is composed of the cylinder and the
+    // hemisphere at each end, so that it doesn't need its own unit mesh.
+    AddShape(DebugRenderType::Cylinder, camera,
+             DebugRendererHelper::CreateShapeTransform(from, direction, radius, length),
+             color, duration, depthEnabled);
+    AddShape(DebugRenderType::Hemisphere, camera,
+             DebugRendererHelper::CreateShapeTransform(to, direction, radius, radius),
+             color, duration, depthEnabled);
+    AddShape(DebugRenderType::Hemisphere, camera,
+             DebugRendererHelper::CreateShapeTransform(from, -direction, radius, radius),
+             color, duration, depthEnabled);
 }
 
 void
@@ -131,13 +234,35 @@ DebugRenderer::AddCircle(const Camera   *camera,
                          float           duration,
                          bool            depthEnabled)
 {
-    DebugRenderMessage message(DebugRenderType::Circle, color, duration, depthEnabled);
-    message.mCamera = camera;
-    message.mFloat1 = radius;
-    message.mFloatVector1 = center;
-    message.mFloatVector2 = normal;
+    if (normal == Vector3f::Zero)
+    {
+        FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("Don't allow zero vector here.");
+    }
+
+    AddShape(DebugRenderType::Circle, camera,
+             DebugRendererHelper::CreateShapeTransform(center, Vector3f::Normalize(normal), radius, radius),
+             color, duration, depthEnabled);
+}
+
+void
+DebugRenderer::AddCone(const Camera   *camera,
+                       const Vector3f& apex,
+                       const Vector3f& direction,
+                       float           length,
+                       float           radius,
 
-    mDebugMessageManager->mMessageList.push_back(std::move(message));
+                       const Color&    color,
+                       float           duration,
+                       bool            depthEnabled)
+{
+    if (direction == Vector3f::Zero)
+    {
+        FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("Don't allow zero vector here.");
+    }
+
+    AddShape(DebugRenderType::Cone, camera,
+             DebugRendererHelper::CreateShapeTransform(apex, Vector3f::Normalize(direction), radius, length),
+             color, duration, depthEnabled);
 }
 
 void
@@ -154,7 +279,7 @@ DebugRenderer::AddCross(const Camera   *camera,
     message.mFloat1 = radius;
     message.mFloatVector1 = center;
 
-    mDebugMessageManager->mMessageList.push_back(std::move(message));
+    mDebugMessageManager->AddMessage(std::move(message));
 }
 
 void
@@ -171,7 +296,21 @@ DebugRenderer::AddLine(const Camera   *camera,
     message.mFloatVector1 = from;
     message.mFloatVector2 = to;
 
-    mDebugMessageManager->mMessageList.push_back(std::move(message));
+    mDebugMessageManager->AddMessage(std::move(message));
+}
+
+void
+DebugRenderer::AddOBB(const Camera   *camera,
+                      const Matrix4f& transform,
+                      const Vector3f& extent,
+
+                      const Color&    color,
+                      float           duration,
+                      bool            depthEnabled)
+{
+    AddShape(DebugRenderType::OBB, camera,
+             transform * Matrix4f::CreateScale(extent.x, extent.y, extent.z),
+             color, duration, depthEnabled);
 }
 
 void
@@ -183,12 +322,28 @@ DebugRenderer::AddSphere(const Camera   *camera,
                          float           duration,
                          bool            depthEnabled)
 {
-    DebugRenderMessage message(DebugRenderType::Sphere, color, duration, depthEnabled);
+    AddShape(DebugRenderType::Sphere, camera,
+             DebugRendererHelper::CreateShapeTransform(center, Vector3f::UnitZ, radius, radius),
+             color, duration, depthEnabled);
+}
+
+void
+DebugRenderer::AddTriangle(const Camera   *camera,
+                           const Vector3f& position1,
+                           const Vector3f& position2,
+                           const Vector3f& position3,
+
+                           const Color&    color,
+                           float           duration,
+                           bool            depthEnabled)
+{
+    DebugRenderMessage message(DebugRenderType::Triangle, color, duration, depthEnabled);
     message.mCamera = camera;
-    message.mFloat1 = radius;
-    message.mFloatVector1 = center;
+    message.mFloatVector1 = position1;
+    message.mFloatVector2 = position2;
+    message.mFloatVector3 = position3;
 
-    mDebugMessageManager->mMessageList.push_back(std::move(message));
+    mDebugMessageManager->AddMessage(std::move(message));
 }
 
 void
@@ -206,7 +361,7 @@ DebugRenderer::AddText(const std::string& text,
     message.mFloatVector1 = Vector3f(textPosition, 0);
     message.mString1 = text;
 
-    mDebugMessageManager->mMessageList.push_back(std::move(message));
+    mDebugMessageManager->AddMessage(std::move(message));
 }
 
 /************************************************************************/
@@ -251,76 +406,70 @@ DebugRenderer::Initialize()
         ChannelTriangle + ChannelCount,
         TriangleMaxNum * 3, hasDepthEffect);
 
+    // NOTE: Each shape channel draws all of its shapes in one
+    // instanced draw call.
+    const auto ShapeMaxNum = int(Kilobytes(4));
+
+    auto noDepthInstancingEffect = make_shared<DebugInstancingEffect>(false);
+    auto hasDepthInstancingEffect = make_shared<DebugInstancingEffect>(true);
+
+    mDebugShapeEffectInstanceList.resize(ShapeChannelCount * 2);
+    for (int shapeIndex = 0; shapeIndex < ShapeChannelCount; ++shapeIndex)
+    {
+        CreateShapeChannel(shapeIndex, ShapeMaxNum,
+                           DebugShapeType(shapeIndex), noDepthInstancingEffect);
+        CreateShapeChannel(shapeIndex + ShapeChannelCount, ShapeMaxNum,
+                           DebugShapeType(shapeIndex), hasDepthInstancingEffect);
+    }
+
     // Load necessary asset.
     static auto sAssetManager = AssetManager::GetInstance();
     mDebugFont = sAssetManager->LoadFont("Content/Font/LuciadaConsoleDistanceField.fnt.bin").get();
 }
 
 void
-DebugRenderer::RenderBegin()
+DebugRenderer::Handoff()
 {
-}
+    // NOTE: The render list has been consumed by the render side, so
+    // that it is reused as the record list without reallocation.
+    std::swap(mDebugMessageRecordList, mDebugMessageRenderList);
+    mDebugMessageRecordList.clear();
 
-void
-DebugRenderer::Render(double /* percent */)
-{
-    mDebugBufferResource->Draw(nullptr);
+    std::swap(mDebugChannelElementNumRecord, mDebugChannelElementNumRender);
+    std::fill(mDebugChannelElementNumRecord.begin(), mDebugChannelElementNumRecord.end(), 0);
+
+    std::swap(mDebugShapeElementNumRecord, mDebugShapeElementNumRender);
+    std::fill(mDebugShapeElementNumRecord.begin(), mDebugShapeElementNumRecord.end(), 0);
+
+    // Update transform uniform.
+    for (auto cameraIndexPair : mDebugEffectParams->mCameraSlotTable)
+    {
+        int cameraIndex = cameraIndexPair.second;
+        auto camera = cameraIndexPair.first;
+
+        mDebugEffectParams->mCameraSlotUniform[cameraIndex]->SetValue(
+            camera->GetViewProjection());
+    }
 }
 
 void
-DebugRenderer::RenderEnd()
+DebugRenderer::RenderBegin()
 {
-    mDebugBufferResource->ResetPersistent();
 }
 
 void
-DebugRenderer::UpdateFrame(double elapsed)
+DebugRenderer::Render(double /* percent */)
 {
-    static auto sFontRenderer = FontRenderer::GetInstance();
+    // NOTE: The channel size has been counted on the game side, so
+    // that the messages are filled into the mapped buffer in a single pass.
+    for (int channel = 0; channel < ChannelCount * 2; ++channel)
+    {
+        mDebugBufferResource->AddChannelElement(channel, mDebugChannelElementNumRender[channel]);
+    }
 
-    // Compute channel size.
-    for (auto& message : mDebugMessageManager->mMessageList)
+    for (int shapeChannel = 0; shapeChannel < ShapeChannelCount * 2; ++shapeChannel)
     {
-        // Find channel index.
-        int channel = BufferChannelMap[int(message.mType)];
-        channel = message.mDepthEnabled
-                  ? channel + ChannelCount
-                  : channel;
-
-        // Update channel data number.
-        switch (message.mType)
-        {
-        case DebugRenderType::AABB:
-            mDebugBufferResource->AddChannelElement(
-                channel, 24);
-            break;
-        case DebugRenderType::OBB:
-            FALCON_ENGINE_THROW_SUPPORT_EXCEPTION();
-        case DebugRenderType::Circle:
-            mDebugBufferResource->AddChannelElement(
-                channel, DebugRendererHelper::CircleSampleNum * 2);
-            break;
-        case DebugRenderType::Cross:
-            mDebugBufferResource->AddChannelElement(
-                channel, 6);
-            break;
-        case DebugRenderType::Line:
-            mDebugBufferResource->AddChannelElement(
-                channel, 2);
-            break;
-        case DebugRenderType::Sphere:
-            mDebugBufferResource->AddChannelElement(
-                channel, DebugRendererHelper::SpherePhiSampleNum
-                * DebugRendererHelper::SphereThetaSampleNum * 6);
-            break;
-        case DebugRenderType::Text:
-            sFontRenderer->AddText(
-                mDebugFont, message.mFloat1, Vector2f(message.mFloatVector1),
-                message.mString1, message.mColor, message.mFloat2);
-            break;
-        default:
-            FALCON_ENGINE_THROW_ASSERTION_EXCEPTION();
-        }
+        mDebugShapeBufferResource->AddChannelElement(shapeChannel, mDebugShapeElementNumRender[shapeChannel]);
     }
 
     mDebugBufferResource->FillDataBegin(
@@ -328,45 +477,49 @@ DebugRenderer::UpdateFrame(double elapsed)
         BufferFlushMode::Automatic,
         BufferSynchronizationMode::Unsynchronized);
 
+    mDebugShapeBufferResource->FillDataBegin(
+        BufferAccessMode::WriteBuffer,
+        BufferFlushMode::Automatic,
+        BufferSynchronizationMode::Unsynchronized);
+
     {
+        // Get buffer data pointer of each channel.
+        BufferAdaptor *channelAdaptorList[ChannelCount * 2];
+        unsigned char *channelDataList[ChannelCount * 2];
+        for (int channel = 0; channel < ChannelCount * 2; ++channel)
+        {
+            std::tie(channelAdaptorList[channel], channelDataList[channel]) = mDebugBufferResource->GetChannelData(channel);
+        }
+
+        BufferAdaptor *shapeAdaptorList[ShapeChannelCount * 2];
+        unsigned char *shapeDataList[ShapeChannelCount * 2];
+        for (int shapeChannel = 0; shapeChannel < ShapeChannelCount * 2; ++shapeChannel)
+        {
+            std::tie(shapeAdaptorList[shapeChannel], shapeDataList[shapeChannel]) = mDebugShapeBufferResource->GetChannelData(shapeChannel);
+        }
+
         // Fill channel buffer data.
-        for (auto& message : mDebugMessageManager->mMessageList)
+        for (auto& cameraIndexMessagePair : mDebugMessageRenderList)
         {
-            // Find channel index.
-            int channel = BufferChannelMap[int(message.mType)];
-            channel = message.mDepthEnabled
-                      ? channel + ChannelCount
-                      : channel;
-
-            // Get buffer data pointer.
-            BufferAdaptor *bufferAdaptor;
-            unsigned char *bufferData;
-            std::tie(bufferAdaptor, bufferData) = mDebugBufferResource->GetChannelData(channel);
-
-            // NOTE(Wuxiang): Text doesn't have a camera parameter. When
-            // cameraIndex is invalid it will not be used.
-            int cameraIndex = 0;
-            if (message.mCamera)
+            int cameraIndex = cameraIndexMessagePair.first;
+            auto& message = cameraIndexMessagePair.second;
+
+            int shapeChannel = GetShapeChannel(message);
+            if (shapeChannel != ChannelNull)
             {
-                cameraIndex = mDebugEffectParams->mCameraSlotTable.at(message.mCamera);
+                DebugRendererHelper::FillInstance(
+                    shapeAdaptorList[shapeChannel], shapeDataList[shapeChannel],
+                    message.mTransform, message.mColor, cameraIndex);
+                continue;
             }
 
+            int channel = GetBufferChannel(message);
+            auto bufferAdaptor = channelAdaptorList[channel];
+            auto bufferData = channelDataList[channel];
+
             // Fill vertex data by inspecting the message.
             switch (message.mType)
             {
-            case DebugRenderType::AABB:
-                DebugRendererHelper::FillAABB(
-                    bufferAdaptor, bufferData, message.mFloatVector1,
-                    message.mFloatVector2, message.mColor, cameraIndex);
-                break;
-            case DebugRenderType::OBB:
-                FALCON_ENGINE_THROW_SUPPORT_EXCEPTION();
-            case DebugRenderType::Circle:
-                DebugRendererHelper::FillCircle(
-                    bufferAdaptor, bufferData, message.mFloatVector1,
-                    message.mFloatVector2, message.mFloat1, message.mColor,
-                    cameraIndex);
-                break;
             case DebugRenderType::Cross:
                 DebugRendererHelper::FillCross(
                     bufferAdaptor, bufferData, message.mFloatVector1,
@@ -377,12 +530,11 @@ DebugRenderer::UpdateFrame(double elapsed)
                     bufferAdaptor, bufferData, message.mFloatVector1,
                     message.mFloatVector2, message.mColor, cameraIndex);
                 break;
-            case DebugRenderType::Sphere:
-                DebugRendererHelper::FillSphere(
+            case DebugRenderType::Triangle:
+                DebugRendererHelper::FillTriangle(
                     bufferAdaptor, bufferData, message.mFloatVector1,
-                    message.mFloat1, message.mColor, cameraIndex);
-                break;
-            case DebugRenderType::Text:
+                    message.mFloatVector2, message.mFloatVector3,
+                    message.mColor, cameraIndex);
                 break;
             default:
                 FALCON_ENGINE_THROW_ASSERTION_EXCEPTION();
@@ -393,18 +545,137 @@ DebugRenderer::UpdateFrame(double elapsed)
     mDebugBufferResource->FillDataEnd();
     mDebugBufferResource->Reset();
 
+    mDebugShapeBufferResource->FillDataEnd();
+    mDebugShapeBufferResource->Reset();
+
+    // NOTE: The vertex number of the shape visual is the one of the
+    // unit mesh, the instance number is set on the effect instance.
+    for (int shapeChannel = 0; shapeChannel < ShapeChannelCount * 2; ++shapeChannel)
+    {
+        mDebugShapeEffectInstanceList[shapeChannel]->SetShaderInstancingNum(
+            0, mDebugShapeBufferResource->GetChannelElementNumPersistent(shapeChannel));
+    }
+
+    mDebugBufferResource->Draw(nullptr);
+    mDebugShapeBufferResource->Draw(nullptr);
+}
+
+void
+DebugRenderer::RenderEnd()
+{
+    mDebugBufferResource->ResetPersistent();
+    mDebugShapeBufferResource->ResetPersistent();
+}
+
+void
+DebugRenderer::UpdateFrame(double elapsed)
+{
+    static auto sFontRenderer = FontRenderer::GetInstance();
+
+    // NOTE: Collect the messages recorded by all the threads in last
+    // frame. Only record the message here, which is filled into the buffer on
+    // the render side after the handoff.
+    mDebugMessageManager->Merge();
+
+    for (auto& message : mDebugMessageManager->mMessageList)
+    {
+        if (message.mType == DebugRenderType::Text)
+        {
+            sFontRenderer->AddText(
+                mDebugFont, message.mFloat1, Vector2f(message.mFloatVector1),
+                message.mString1, message.mColor, message.mFloat2);
+            continue;
+        }
+
+        // NOTE: The camera slot is found on the game side, where
+        // the camera is added and removed.
+        int cameraIndex = 0;
+        if (message.mCamera)
+        {
+            cameraIndex = mDebugEffectParams->mCameraSlotTable.at(message.mCamera);
+        }
+
+        int shapeChannel = GetShapeChannel(message);
+        if (shapeChannel != ChannelNull)
+        {
+            ++mDebugShapeElementNumRecord[shapeChannel];
+        }
+        else
+        {
+            mDebugChannelElementNumRecord[GetBufferChannel(message)] += BufferChannelElementNumMap[int(message.mType)];
+        }
+
+        mDebugMessageRecordList.emplace_back(cameraIndex, message);
+    }
+
     // Remove time-out message.
     mDebugMessageManager->UpdateFrame(elapsed);
+}
 
-    // Update transform uniform.
-    for (auto cameraIndexPair : mDebugEffectParams->mCameraSlotTable)
+/************************************************************************/
+/* Private Members                                                      */
+/************************************************************************/
+void
+DebugRenderer::CreateShapeChannel(int                               channel,
+                                  int                               channelInstanceNum,
+                                  DebugShapeType                    shapeType,
+                                  shared_ptr<DebugInstancingEffect> visualEffect)
+{
+    static auto sMasterRenderer = Renderer::GetInstance();
+
+    // NOTE: The unit mesh is filled once and never changes.
+    vector<Vector3f> positionList;
+    DebugRendererHelper::CreateShapeMesh(shapeType, positionList);
+
+    auto meshBuffer = make_shared<VertexBuffer>(
+                          int(positionList.size()), sizeof(Vector3f),
+                          BufferStorageMode::Device, BufferUsage::Static);
     {
-        int cameraIndex = cameraIndexPair.second;
-        auto camera = cameraIndexPair.first;
+        auto meshData = static_cast<Vector3f *>(
+                            sMasterRenderer->Map(meshBuffer.get(),
+                                    BufferAccessMode::WriteBuffer,
+                                    BufferFlushMode::Automatic,
+                                    BufferSynchronizationMode::Unsynchronized,
+                                    meshBuffer->GetDataOffset(),
+                                    meshBuffer->GetDataSize()));
 
-        mDebugEffectParams->mCameraSlotUniform[cameraIndex]->SetValue(
-            camera->GetViewProjection());
+        std::copy(positionList.begin(), positionList.end(), meshData);
+
+        sMasterRenderer->Unmap(meshBuffer.get());
     }
+
+    auto instanceBuffer = make_shared<VertexBuffer>(
+                              channelInstanceNum, sizeof(DebugInstance),
+                              BufferStorageMode::Device, BufferUsage::Stream);
+
+    auto instanceBufferAdaptor = make_shared<BufferCircular>(instanceBuffer, instanceBuffer->GetCapacitySize() / 4);
+
+    auto vertexFormat = visualEffect->GetVertexFormat();
+    auto vertexGroup = make_shared<VertexGroup>();
+    vertexGroup->SetVertexBuffer(0, meshBuffer, 0, vertexFormat->GetVertexBufferStride(0));
+    vertexGroup->SetVertexBuffer(1, instanceBuffer, 0, vertexFormat->GetVertexBufferStride(1));
+
+    auto primitive = make_shared<PrimitiveLines>(vertexFormat, vertexGroup, nullptr);
+
+    auto visual = CreateSpatial<Visual>(make_shared<Mesh>(primitive, nullptr));
+    mDebugShapeEffectInstanceList.at(channel) = visualEffect->CreateInstance(visual.get(), mDebugEffectParams);
+
+    mDebugShapeBufferResource->CreateChannel(channel, instanceBufferAdaptor, visual);
+}
+
+void
+DebugRenderer::AddShape(DebugRenderType type,
+                        const Camera   *camera,
+                        const Matrix4f& transform,
+                        const Color&    color,
+                        float           duration,
+                        bool            depthEnabled)
+{
+    DebugRenderMessage message(type, color, duration, depthEnabled);
+    message.mCamera = camera;
+    message.mTransform = transform;
+
+    mDebugMessageManager->AddMessage(std::move(message));
 }
 
 }
@@ -1,7 +1,8 @@
 #include <FalconEngine/Graphics/Renderer/Debug/DebugRendererHelper.h>
 
+#include <cmath>
+
 #include <FalconEngine/Core/Memory.h>
-#include <FalconEngine/Graphics/Renderer/PrimitiveLines.h>
 #include <FalconEngine/Math/Constant.h>
 
 using namespace std;
@@ -19,124 +20,152 @@ const int
 DebugRendererHelper::SphereThetaSampleNum = 8;
 
 /************************************************************************/
-/* Public Members                                                       */
+/* Shape Members                                                        */
 /************************************************************************/
-void
-DebugRendererHelper::FillAABB(BufferAdaptor  *bufferAdaptor,
-                              unsigned char  *bufferData,
-                              const Vector3f& min,
-                              const Vector3f& max,
-                              const Color&    color,
-                              int             cameraIndex)
+inline void
+AppendLine(vector<Vector3f>& positionList, const Vector3f& from, const Vector3f& to)
 {
-    FillLine(bufferAdaptor, bufferData,
-             Vector3f(min.x, min.y, min.z),
-             Vector3f(max.x, min.y, min.z), color, cameraIndex);
-    FillLine(bufferAdaptor, bufferData,
-             Vector3f(min.x, max.y, min.z),
-             Vector3f(max.x, max.y, min.z), color, cameraIndex);
-    FillLine(bufferAdaptor, bufferData,
-             Vector3f(min.x, min.y, max.z),
-             Vector3f(max.x, min.y, max.z), color, cameraIndex);
-    FillLine(bufferAdaptor, bufferData,
-             Vector3f(min.x, max.y, max.z),
-             Vector3f(max.x, max.y, max.z), color, cameraIndex);
+    positionList.push_back(from);
+    positionList.push_back(to);
+}
 
-    FillLine(bufferAdaptor, bufferData,
-             Vector3f(min.x, min.y, min.z),
-             Vector3f(min.x, max.y, min.z), color, cameraIndex);
-    FillLine(bufferAdaptor, bufferData,
-             Vector3f(max.x, min.y, min.z),
-             Vector3f(max.x, max.y, min.z), color, cameraIndex);
-    FillLine(bufferAdaptor, bufferData,
-             Vector3f(min.x, min.y, max.z),
-             Vector3f(min.x, max.y, max.z), color, cameraIndex);
-    FillLine(bufferAdaptor, bufferData,
-             Vector3f(max.x, min.y, max.z),
-             Vector3f(max.x, max.y, max.z), color, cameraIndex);
+// @summary Append the circle of given radius on the plane parallel to XY plane.
+inline void
+AppendCircle(vector<Vector3f>& positionList, float radius, float z)
+{
+    auto phiStep = float(2 * Pi / DebugRendererHelper::CircleSampleNum);
 
-    FillLine(bufferAdaptor, bufferData,
-             Vector3f(min.x, min.y, min.z),
-             Vector3f(min.x, min.y, max.z), color, cameraIndex);
-    FillLine(bufferAdaptor, bufferData,
-             Vector3f(min.x, max.y, min.z),
-             Vector3f(min.x, max.y, max.z), color, cameraIndex);
-    FillLine(bufferAdaptor, bufferData,
-             Vector3f(max.x, min.y, min.z),
-             Vector3f(max.x, min.y, max.z), color, cameraIndex);
-    FillLine(bufferAdaptor, bufferData,
-             Vector3f(max.x, max.y, min.z),
-             Vector3f(max.x, max.y, max.z), color, cameraIndex);
+    for (int phiIndex = 0; phiIndex < DebugRendererHelper::CircleSampleNum; ++phiIndex)
+    {
+        float phi = phiStep * phiIndex;
+        float phiNext = phiIndex + 1 == DebugRendererHelper::CircleSampleNum
+                        ? 2 * Pi
+                        : phiStep * (phiIndex + 1);
+
+        AppendLine(positionList,
+                   Vector3f(radius * cos(phi), radius * sin(phi), z),
+                   Vector3f(radius * cos(phiNext), radius * sin(phiNext), z));
+    }
 }
 
-// @params u, v Those must be unit vector.
 inline Vector3f
-CirclePosition(float theta, float radius, const Vector3f& u, const Vector3f& v)
+SpherePosition(float radius, float theta, float phi)
 {
-    return radius * (u * sin(theta) + v * cos(theta));
+    return radius * Vector3f(sin(theta) * cos(phi), sin(theta) * sin(phi), cos(theta));
 }
 
-void
-DebugRendererHelper::FillCircle(BufferAdaptor  *bufferAdaptor,
-                                unsigned char  *bufferData,
-
-                                const Vector3f& center,
-                                const Vector3f& normal,
-                                float           radius,
-                                const Color&    color,
-                                int             cameraIndex)
+// @summary Append the meridians and parallels of the unit sphere from the
+// north pole down to the given number of latitude steps.
+inline void
+AppendSphere(vector<Vector3f>& positionList, int thetaIndexEnd)
 {
-    auto thetaStep = float(2 * Pi / CircleSampleNum);
+    auto thetaStep = float(Pi / DebugRendererHelper::SphereThetaSampleNum);
+    auto phiStep = float(2 * Pi / DebugRendererHelper::SpherePhiSampleNum);
 
-    // NOTE(Wuxiang): Get U, V, which is orthogonal base vector on linear space
-    // orthogonal to given normal vector, by solving AX = 0, where:
-    // A = [A B C], X = [x].
-    //     [0 0 0]      [y]
-    //     [0 0 0]      [z]
-    //
-    // Then finish Schmidt process to orthogonalise and normalize those vectors.
+    for (int thetaIndex = 0; thetaIndex < thetaIndexEnd; ++thetaIndex)
+    {
+        float theta = thetaStep * thetaIndex;
+        float thetaNext = thetaStep * (thetaIndex + 1);
 
-    Vector3f u;
-    Vector3f v;
+        // Parallel, except at the pole.
+        if (thetaIndex > 0)
+        {
+            AppendCircle(positionList, sin(theta), cos(theta));
+        }
 
-    if (normal.x != 0)
-    {
-        u = Vector3f(-normal.y / normal.x, 1.0f, 0.0f);
-        v = Vector3f(-normal.z / normal.x, 0.0f, 1.0f);
+        // Meridian.
+        for (int phiIndex = 0; phiIndex < DebugRendererHelper::SpherePhiSampleNum; ++phiIndex)
+        {
+            float phi = phiStep * phiIndex;
+            AppendLine(positionList,
+                       SpherePosition(1.0f, theta, phi),
+                       SpherePosition(1.0f, thetaNext, phi));
+        }
     }
-    else if (normal.y != 0)
+}
+
+void
+DebugRendererHelper::CreateShapeMesh(DebugShapeType shapeType, vector<Vector3f>& positionList)
+{
+    positionList.clear();
+
+    switch (shapeType)
     {
-        u = Vector3f(0.0f, -normal.z / normal.y, 1.0f);
-        v = Vector3f(1.0f, -normal.z / normal.y, 1.0f);
-    }
-    else if (normal.z != 0)
+    case DebugShapeType::Box:
     {
-        u = Vector3f(1.0f, 0.0f, 0.0f);
-        v = Vector3f(0.0f, 1.0f, 0.0f);
+        for (auto y : { -1.0f, 1.0f })
+        {
+            for (auto z : { -1.0f, 1.0f })
+            {
+                AppendLine(positionList, Vector3f(-1, y, z), Vector3f(1, y, z));
+                AppendLine(positionList, Vector3f(y, -1, z), Vector3f(y, 1, z));
+                AppendLine(positionList, Vector3f(y, z, -1), Vector3f(y, z, 1));
+            }
+        }
     }
-    else
+    break;
+    case DebugShapeType::Circle:
+        AppendCircle(positionList, 1.0f, 0.0f);
+        break;
+    case DebugShapeType::Cone:
     {
-        FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("Don't allow zero vector here.");
-    }
-
-    // This is not only normalized but orthogonalised.
-    u = Vector3f::Normalize(u);
-    v = Vector3f::Normalize(v - Vector3f::Dot(u, v) * u);
+        AppendCircle(positionList, 1.0f, 1.0f);
 
-    for (int thetaIndex = 0; thetaIndex < CircleSampleNum; ++thetaIndex)
+        for (auto p : { Vector3f(1, 0, 1), Vector3f(-1, 0, 1), Vector3f(0, 1, 1), Vector3f(0, -1, 1) })
+        {
+            AppendLine(positionList, Vector3f::Zero, p);
+        }
+    }
+    break;
+    case DebugShapeType::Cylinder:
     {
-        float theta = thetaStep * thetaIndex;
-        float thetaNext = thetaIndex + 1 == CircleSampleNum
-                          ? 2 * Pi
-                          : thetaStep * (thetaIndex + 1);;
-
-        FillLine(bufferAdaptor, bufferData,
-                 center + CirclePosition(theta, radius, u, v),
-                 center + CirclePosition(thetaNext, radius, u, v),
-                 color, cameraIndex);
+        AppendCircle(positionList, 1.0f, 0.0f);
+        AppendCircle(positionList, 1.0f, 1.0f);
+
+        for (auto p : { Vector3f(1, 0, 0), Vector3f(-1, 0, 0), Vector3f(0, 1, 0), Vector3f(0, -1, 0) })
+        {
+            AppendLine(positionList, p, p + Vector3f::UnitZ);
+        }
+    }
+    break;
+    case DebugShapeType::Hemisphere:
+        AppendSphere(positionList, SphereThetaSampleNum / 2);
+        AppendCircle(positionList, 1.0f, 0.0f);
+        break;
+    case DebugShapeType::Sphere:
+        AppendSphere(positionList, SphereThetaSampleNum);
+        break;
+    default:
+        FALCON_ENGINE_THROW_ASSERTION_EXCEPTION();
     }
 }
 
+Matrix4f
+DebugRendererHelper::CreateShapeTransform(const Vector3f& origin,
+                                          const Vector3f& axis,
+                                          float           radius,
+                                          float           length)
+{
+    // NOTE: Build the orthonormal basis around the axis without
+    // branching on the degenerated case, using the method from Duff et al.,
+    // "Building an Orthonormal Basis, Revisited".
+    float sign = copysign(1.0f, axis.z);
+    float a = -1.0f / (sign + axis.z);
+    float b = axis.x * axis.y * a;
+
+    auto u = radius * Vector3f(1.0f + sign * axis.x * axis.x * a, sign * b, -sign * axis.x);
+    auto v = radius * Vector3f(b, sign + axis.y * axis.y * a, -axis.y);
+    auto w = length * axis;
+
+    return Matrix4f(u.x, u.y, u.z, 0.0f,
+                    v.x, v.y, v.z, 0.0f,
+                    w.x, w.y, w.z, 0.0f,
+                    origin.x, origin.y, origin.z, 1.0f);
+}
+
+/************************************************************************/
+/* Vertex Members                                                       */
+/************************************************************************/
 void
 DebugRendererHelper::FillCross(BufferAdaptor  *bufferAdaptor,
                                unsigned char  *bufferData,
@@ -159,46 +188,4 @@ DebugRendererHelper::FillCross(BufferAdaptor  *bufferAdaptor,
              center + Vector3f(0, 0, -radius), color, cameraIndex);
 }
 
-inline Vector3f
-SpherePosition(float radius, float theta, float phi)
-{
-    return radius * Vector3f(sin(theta) * cos(phi), sin(theta) * sin(phi), cos(theta));
-}
-
-void
-DebugRendererHelper::FillSphere(BufferAdaptor  *bufferAdaptor,
-                                unsigned char  *bufferData,
-                                const Vector3f& center,
-                                float           radius,
-                                const Color&    color,
-                                int             cameraIndex)
-{
-    auto thetaStep = float(Pi / SphereThetaSampleNum);
-    auto phiStep = float(2 * Pi / SpherePhiSampleNum);
-
-    for (auto thetaIndex = 0; thetaIndex < SphereThetaSampleNum; ++thetaIndex)
-    {
-        float theta = thetaStep * thetaIndex;
-        float thetaNext = thetaIndex + 1 == SphereThetaSampleNum
-                          ? Pi
-                          : (thetaIndex + 1) * thetaStep;
-
-        for (auto phiIndex = 0; phiIndex < SpherePhiSampleNum; ++phiIndex)
-        {
-            float phi = phiStep * phiIndex;
-            float phiNext = phiIndex + 1 == SpherePhiSampleNum
-                            ? 2 * Pi
-                            : (phiIndex + 1) * phiStep;
-
-            auto p0 = center + SpherePosition(radius, theta, phi);
-            auto p1 = center + SpherePosition(radius, theta, phiNext);
-            auto p2 = center + SpherePosition(radius, thetaNext, phi);
-            auto p3 = center + SpherePosition(radius, thetaNext, phiNext);
-
-            FillTriangle(bufferAdaptor, bufferData, p0, p1, p2, color, cameraIndex);
-            FillTriangle(bufferAdaptor, bufferData, p1, p3, p2, color, cameraIndex);
-        }
-    }
-}
-
 }
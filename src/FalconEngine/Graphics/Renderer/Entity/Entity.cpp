@@ -13,16 +13,22 @@ FALCON_ENGINE_RTTI_IMPLEMENT(Entity, Object);
 /* Constructors and Destructor                                          */
 /************************************************************************/
 Entity::Entity(std::shared_ptr<Node> node) :
-    mId(0),
+    mId(EntityManager::GetInstance()->CreateEntity()),
     mNode(node),
     mLocalPosition(),
     mLocalScale(Vector3f(1, 1, 1)),
     mLocalTransformIsCurrent(true)
 {
-    using namespace std::placeholders;
-
-    mNodeUpdateBegunHandler = EventBinder<bool>(std::bind(&Entity::UpdateLocalTransform, this, _2));
-    mNodeUpdateEndedHandler = EventBinder<bool>(std::bind(&Entity::UpdateLocalTransformFeedback, this, _2));
+    // NOTE: Lambda capturing only this pointer fits in the binder's
+    // inline buffer, so that subscription doesn't allocate the binder.
+    mNodeUpdateBegunHandler = EventBinder<bool>([this](void * /* sender */, bool initiator)
+    {
+        UpdateLocalTransform(initiator);
+    });
+    mNodeUpdateEndedHandler = EventBinder<bool>([this](void * /* sender */, bool initiator)
+    {
+        UpdateLocalTransformFeedback(initiator);
+    });
 
     mNode->mUpdateBegun += &mNodeUpdateBegunHandler;
     mNode->mUpdateEnded += &mNodeUpdateEndedHandler;
@@ -32,6 +38,8 @@ Entity::~Entity()
 {
     mNode->mUpdateBegun -= &mNodeUpdateBegunHandler;
     mNode->mUpdateEnded -= &mNodeUpdateEndedHandler;
+
+    EntityManager::GetInstance()->DestroyEntity(mId);
 }
 
 /************************************************************************/
@@ -0,0 +1,267 @@
+#include <FalconEngine/Graphics/Renderer/Entity/EntityManager.h>
+
+namespace FalconEngine
+{
+
+int
+GetComponentTypeIdNext()
+{
+    static int sComponentTypeIdNext = 0;
+    if (sComponentTypeIdNext >= ComponentTypeNumMax)
+    {
+        FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("The component type number exceeds the limit.");
+    }
+
+    return sComponentTypeIdNext++;
+}
+
+/************************************************************************/
+/* Constructors and Destructor                                          */
+/************************************************************************/
+EntityArchetype::EntityArchetype(const ComponentMask& componentMask) :
+    mComponentMask(componentMask)
+{
+    mComponentArrayIndexTable.fill(-1);
+    mArchetypeAddedTable.fill(nullptr);
+    mArchetypeRemovedTable.fill(nullptr);
+}
+
+size_t
+EntityArchetype::GetEntityNum() const
+{
+    return mEntityList.size();
+}
+
+EntityQuery::EntityQuery(const ComponentMask& componentMask) :
+    mComponentMask(componentMask)
+{
+}
+
+size_t
+EntityQuery::GetEntityNum() const
+{
+    size_t entityNum = 0;
+    for (auto archetype : mArchetypeList)
+    {
+        entityNum += archetype->GetEntityNum();
+    }
+
+    return entityNum;
+}
+
+bool
+EntityQuery::IsMatched(const EntityArchetype *archetype) const
+{
+    return (archetype->mComponentMask & mComponentMask) == mComponentMask;
+}
+
+EntityManager::EntityManager() :
+    mEntityNum(0),
+    mArchetypeEmpty(nullptr)
+{
+    mArchetypeEmpty = GetArchetype(ComponentMask());
+}
+
+EntityManager::~EntityManager()
+{
+}
+
+/************************************************************************/
+/* Entity Management                                                    */
+/************************************************************************/
+EntityId
+EntityManager::CreateEntity()
+{
+    uint32_t entityIndex;
+    if (mEntityIndexFreeList.empty())
+    {
+        // NOTE: The largest index is reserved for the null id.
+        if (mEntityRecordList.size() >= EntityIndexMask)
+        {
+            FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("The entity number exceeds the limit.");
+        }
+
+        entityIndex = uint32_t(mEntityRecordList.size());
+        mEntityRecordList.emplace_back();
+    }
+    else
+    {
+        entityIndex = mEntityIndexFreeList.back();
+        mEntityIndexFreeList.pop_back();
+    }
+
+    auto& entityRecord = mEntityRecordList[entityIndex];
+    auto entity = EntityId(entityRecord.mGeneration << EntityIndexBitNum | entityIndex);
+
+    entityRecord.mArchetype = mArchetypeEmpty;
+    entityRecord.mRow = mArchetypeEmpty->GetEntityNum();
+    mArchetypeEmpty->mEntityList.push_back(entity);
+
+    ++mEntityNum;
+    return entity;
+}
+
+void
+EntityManager::DestroyEntity(EntityId entity)
+{
+    CheckEntity(entity);
+
+    auto entityIndex = GetEntityIndex(entity);
+    auto& entityRecord = mEntityRecordList[entityIndex];
+    RemoveRow(entityRecord.mArchetype, entityRecord.mRow);
+
+    // NOTE: The generation wraps around, which only lets a very old
+    // id alive again after the index is reused that many times.
+    entityRecord.mArchetype = nullptr;
+    entityRecord.mRow = 0;
+    entityRecord.mGeneration = (entityRecord.mGeneration + 1) & (0xFFFFFFFFu >> EntityIndexBitNum);
+    mEntityIndexFreeList.push_back(entityIndex);
+
+    --mEntityNum;
+}
+
+bool
+EntityManager::IsAlive(EntityId entity) const
+{
+    auto entityIndex = GetEntityIndex(entity);
+    if (entity == EntityIdNull || entityIndex >= mEntityRecordList.size())
+    {
+        return false;
+    }
+
+    auto& entityRecord = mEntityRecordList[entityIndex];
+    return entityRecord.mArchetype != nullptr && entityRecord.mGeneration == GetEntityGeneration(entity);
+}
+
+size_t
+EntityManager::GetEntityNum() const
+{
+    return mEntityNum;
+}
+
+size_t
+EntityManager::GetArchetypeNum() const
+{
+    return mArchetypeList.size();
+}
+
+/************************************************************************/
+/* Private Members                                                      */
+/************************************************************************/
+void
+EntityManager::CheckEntity(EntityId entity) const
+{
+    if (!IsAlive(entity))
+    {
+        FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("The entity is not alive.");
+    }
+}
+
+EntityArchetype *
+EntityManager::GetArchetype(const ComponentMask& componentMask)
+{
+    auto archetypeIter = mArchetypeTable.find(componentMask);
+    if (archetypeIter != mArchetypeTable.end())
+    {
+        return archetypeIter->second;
+    }
+
+    auto archetype = new EntityArchetype(componentMask);
+    for (int componentType = 0; componentType < ComponentTypeNumMax; ++componentType)
+    {
+        if (componentMask.test(componentType))
+        {
+            archetype->mComponentArrayIndexTable[componentType] = int(archetype->mComponentArrayList.size());
+            archetype->mComponentArrayList.push_back(mComponentArrayPrototypeList[componentType]->CreateEmpty());
+            archetype->mComponentTypeList.push_back(componentType);
+        }
+    }
+
+    mArchetypeList.emplace_back(archetype);
+    mArchetypeTable.insert({ componentMask, archetype });
+
+    // NOTE: Archetype is never destroyed, so the query only needs to
+    // be updated when the archetype is created.
+    for (auto& queryPair : mQueryTable)
+    {
+        auto query = queryPair.second.get();
+        if (query->IsMatched(archetype))
+        {
+            query->mArchetypeList.push_back(archetype);
+        }
+    }
+
+    return archetype;
+}
+
+EntityQuery *
+EntityManager::GetQuery(const ComponentMask& componentMask)
+{
+    auto queryIter = mQueryTable.find(componentMask);
+    if (queryIter != mQueryTable.end())
+    {
+        return queryIter->second.get();
+    }
+
+    auto query = new EntityQuery(componentMask);
+    for (auto& archetype : mArchetypeList)
+    {
+        if (query->IsMatched(archetype.get()))
+        {
+            query->mArchetypeList.push_back(archetype.get());
+        }
+    }
+
+    mQueryTable.insert({ componentMask, std::unique_ptr<EntityQuery>(query) });
+    return query;
+}
+
+void
+EntityManager::MoveEntity(EntityId entity, EntityArchetype *archetype)
+{
+    auto& entityRecord = mEntityRecordList[GetEntityIndex(entity)];
+    auto archetypePrevious = entityRecord.mArchetype;
+    auto rowPrevious = entityRecord.mRow;
+
+    // Move the components the new archetype also has.
+    auto componentArrayNum = int(archetypePrevious->mComponentArrayList.size());
+    for (int componentArrayIndex = 0; componentArrayIndex < componentArrayNum; ++componentArrayIndex)
+    {
+        auto componentType = archetypePrevious->mComponentTypeList[componentArrayIndex];
+        auto componentArrayIndexMoved = archetype->mComponentArrayIndexTable[componentType];
+        if (componentArrayIndexMoved >= 0)
+        {
+            archetypePrevious->mComponentArrayList[componentArrayIndex]->MoveTo(rowPrevious, archetype->mComponentArrayList[componentArrayIndexMoved].get());
+        }
+    }
+
+    // NOTE: The moved components are left in the previous archetype,
+    // so the whole row is removed.
+    RemoveRow(archetypePrevious, rowPrevious);
+
+    entityRecord.mArchetype = archetype;
+    entityRecord.mRow = archetype->GetEntityNum();
+    archetype->mEntityList.push_back(entity);
+}
+
+void
+EntityManager::RemoveRow(EntityArchetype *archetype, size_t row)
+{
+    for (auto& componentArray : archetype->mComponentArrayList)
+    {
+        componentArray->Remove(row);
+    }
+
+    // Update the record of the last entity moved into the row.
+    auto& entityList = archetype->mEntityList;
+    if (row + 1 != entityList.size())
+    {
+        auto entityMoved = entityList.back();
+        entityList[row] = entityMoved;
+        mEntityRecordList[GetEntityIndex(entityMoved)].mRow = row;
+    }
+
+    entityList.pop_back();
+}
+
+}
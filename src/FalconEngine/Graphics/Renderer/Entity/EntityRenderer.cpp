@@ -1,20 +1,48 @@
 #include <FalconEngine/Graphics/Renderer/Entity/EntityRenderer.h>
 
+#include <algorithm>
+#include <cmath>
+
+#include <FalconEngine/Context/GameEngineSettings.h>
+
 #include <FalconEngine/Graphics/Renderer/Camera.h>
+#include <FalconEngine/Graphics/Renderer/Primitive.h>
 #include <FalconEngine/Graphics/Renderer/Renderer.h>
+#include <FalconEngine/Graphics/Renderer/Viewport.h>
+#include <FalconEngine/Graphics/Renderer/VisualEffectInstance.h>
+#include <FalconEngine/Graphics/Renderer/Batch/BatchRenderer.h>
 #include <FalconEngine/Graphics/Renderer/Entity/Entity.h>
+#include <FalconEngine/Graphics/Renderer/Resource/IndexBuffer.h>
 #include <FalconEngine/Graphics/Renderer/Scene/Visual.h>
 #include <FalconEngine/Graphics/Renderer/Scene/Node.h>
+#include <FalconEngine/Graphics/Renderer/Shadow/ShadowRenderer.h>
+#include <FalconEngine/Math/AABB.h>
+#include <FalconEngine/Math/Vector4.h>
 
 using namespace std;
 
 namespace FalconEngine
 {
 
+static int
+GetTriangleNum(const Primitive *primitive)
+{
+    auto indexBuffer = primitive->GetIndexBuffer();
+    return (indexBuffer ? int(indexBuffer->GetElementNum()) : primitive->GetVertexNum()) / 3;
+}
+
 /************************************************************************/
 /* Constructors and Destructor                                          */
 /************************************************************************/
-EntityRenderer::EntityRenderer()
+EntityRenderer::EntityRenderer() :
+    mOcclusionCamera(nullptr),
+    mLodEnabled(false),
+    mLodErrorPixel(0),
+    mLodHysteresis(0),
+    mFrameTriangleNum(0),
+    mFrameTriangleSavedNum(0),
+    mFrameTriangleNumRendered(0),
+    mFrameTriangleSavedNumRendered(0)
 {
 }
 
@@ -33,78 +61,210 @@ EntityRenderer::Draw(const Camera *camera, const Entity *entity)
     mEntityListTable[camera].push_back(entity);
 }
 
+int
+EntityRenderer::GetFrameTriangleNum() const
+{
+    return mFrameTriangleNumRendered;
+}
+
+int
+EntityRenderer::GetFrameTriangleSavedNum() const
+{
+    return mFrameTriangleSavedNumRendered;
+}
+
+const Camera *
+EntityRenderer::GetOcclusionCamera() const
+{
+    return mOcclusionCamera;
+}
+
+void
+EntityRenderer::SetOcclusionCamera(const Camera *camera)
+{
+    mOcclusionCamera = camera;
+}
+
+/************************************************************************/
+/* Rendering Engine API                                                 */
+/************************************************************************/
 void
 EntityRenderer::Initialize()
 {
+    auto gameEngineSettings = GameEngineSettings::GetInstance();
+    mLodEnabled = gameEngineSettings->mLodEnabled;
+    mLodErrorPixel = gameEngineSettings->mLodErrorPixel;
+    mLodHysteresis = gameEngineSettings->mLodHysteresis;
+
+    BatchRenderer::GetInstance()->Initialize();
+    ShadowRenderer::GetInstance()->Initialize();
 }
 
 void
-EntityRenderer::RenderBegin()
+EntityRenderer::Handoff(double percent)
 {
-    // Clean every bucket in the entity table.
+    // NOTE: The statistics of the render side is published at the
+    // handoff, so that the game could read it while the render side runs.
+    mFrameTriangleNumRendered = mFrameTriangleNum;
+    mFrameTriangleSavedNumRendered = mFrameTriangleSavedNum;
+
+    // NOTE: Only the visuals drawn in last frame keep their level, so that the
+    // table doesn't grow with the destroyed visuals.
+    std::swap(mLodTable, mLodTableCurrent);
+    mLodTableCurrent.clear();
+
+    // Remove the render list of the camera which draws nothing since last
+    // handoff.
+    for (auto renderListIter = mRenderListTable.begin(); renderListIter != mRenderListTable.end();)
+    {
+        auto entityListIter = mEntityListTable.find(renderListIter->first);
+        if (entityListIter == mEntityListTable.end() || entityListIter->second.empty())
+        {
+            renderListIter = mRenderListTable.erase(renderListIter);
+        }
+        else
+        {
+            ++renderListIter;
+        }
+    }
+
     for (auto& cameraEntityListPair : mEntityListTable)
     {
+        auto camera = cameraEntityListPair.first;
         auto& entityList = cameraEntityListPair.second;
+        if (entityList.empty())
+        {
+            continue;
+        }
+
+        // NOTE: The copy of camera is kept across the frames, so
+        // that the state keyed by the camera on the render side persists.
+        auto& renderList = mRenderListTable[camera];
+        if (camera != nullptr)
+        {
+            if (renderList.mCamera)
+            {
+                camera->CopyTo(renderList.mCamera.get());
+            }
+            else
+            {
+                renderList.mCamera = shared_ptr<Camera>(camera->GetClone());
+            }
+        }
+
+        renderList.mVisualList.clear();
+        renderList.mVisualLodList.clear();
+
+        // NOTE: The stack keeps its capacity across the frames, so
+        // that the traversal doesn't allocate once it has seen the deepest
+        // hierarchy.
+        mNodeStack.clear();
+        for (auto entity : entityList)
+        {
+            mNodeStack.push_back(entity->GetNode());
+        }
+
         entityList.clear();
+
+        // Use depth first traversal to collect each visual in the hierarchy.
+        while (!mNodeStack.empty())
+        {
+            auto node = mNodeStack.back();
+            mNodeStack.pop_back();
+
+            for (auto child = node->GetFirstChild(); child != nullptr; child = child->GetNextSibling())
+            {
+                // Scene graph only consists of two type of spatial objects:
+                // either Node or Visual.
+                if (child->mSpatialType == SpatialType::Visual)
+                {
+                    auto childVisual = static_cast<const Visual *>(child);
+
+                    // Render the visual between the last two updates.
+                    childVisual->Interpolate(percent);
+                    renderList.mVisualList.push_back(static_pointer_cast<const Visual>(childVisual->shared_from_this()));
+                    renderList.mVisualLodList.push_back(SelectLod(camera, childVisual));
+                }
+                else
+                {
+                    mNodeStack.push_back(static_cast<const Node *>(child));
+                }
+            }
+        }
     }
 }
 
 void
-EntityRenderer::Render(double /* percent */)
+EntityRenderer::RenderBegin()
 {
-    static auto sMasterRenderer = Renderer::GetInstance();
+    BatchRenderer::GetInstance()->RenderBegin();
+    ShadowRenderer::GetInstance()->RenderBegin();
 
-    // Render visuals.
-    for (auto& cameraEntityListPair : mEntityListTable)
-    {
-        std::queue<std::pair<const Node *, int>> nodeQueueCurrent;
-        std::queue<std::pair<const Node *, int>> nodeQueueNext;
+    mFrameTriangleNum = 0;
+    mFrameTriangleSavedNum = 0;
+}
 
-        auto camera = cameraEntityListPair.first;
-        auto& entityList = cameraEntityListPair.second;
+void
+EntityRenderer::Render(double percent)
+{
+    static auto sBatchRenderer = BatchRenderer::GetInstance();
+    static auto sMasterRenderer = Renderer::GetInstance();
+    static auto sShadowRenderer = ShadowRenderer::GetInstance();
 
-        // Prepare the level order traversal
-        for (auto entity : entityList)
+    // NOTE: Shadow is rendered with the visuals of its camera before
+    // any visual samples it.
+    auto shadowRenderListIter = mRenderListTable.find(sShadowRenderer->GetCamera());
+    if (shadowRenderListIter != mRenderListTable.end())
+    {
+        auto& shadowRenderList = shadowRenderListIter->second;
+        for (size_t visualIndex = 0; visualIndex < shadowRenderList.mVisualList.size(); ++visualIndex)
         {
-            nodeQueueCurrent.push(make_pair(entity->GetNode(), 1));
+            shadowRenderList.mVisualList[visualIndex]->SetLodIndex(shadowRenderList.mVisualLodList[visualIndex]);
         }
 
-        // Use level order traversal to render each visual in the hierarchy, which is not totally necessary.
-        while (!nodeQueueCurrent.empty())
+        sShadowRenderer->Render(shadowRenderList.mCamera.get(), shadowRenderList.mVisualList);
+    }
+
+    // Render visuals.
+    for (auto& cameraRenderListPair : mRenderListTable)
+    {
+        auto& renderList = cameraRenderListPair.second;
+        auto camera = renderList.mCamera.get();
+
+        for (size_t visualIndex = 0; visualIndex < renderList.mVisualList.size(); ++visualIndex)
         {
-            // Complete traversing current level.
-            while (!nodeQueueCurrent.empty())
-            {
-                auto renderItemCurrent = nodeQueueCurrent.front();
-                auto renderNodeCurrent = renderItemCurrent.first;
-                auto &sceneDepthCurrent = renderItemCurrent.second;
+            auto visual = renderList.mVisualList[visualIndex].get();
+            visual->SetLodIndex(renderList.mVisualLodList[visualIndex]);
 
-                nodeQueueCurrent.pop();
+            auto primitive = visual->GetPrimitive();
+            auto triangleNum = GetTriangleNum(primitive);
+            mFrameTriangleNum += triangleNum;
+            mFrameTriangleSavedNum += GetTriangleNum(visual->GetMesh()->GetLodPrimitive(0)) - triangleNum;
 
-                // Visit the children.
-                auto slotNum = renderNodeCurrent->GetChildrenSlotNum();
-                for (auto slotIndex = 0; slotIndex < slotNum; ++slotIndex)
+            // NOTE: Instance which could not be batched is drawn
+            // immediately.
+            for (auto visualEffectInstanceIter = visual->GetEffectInstanceBegin();
+                    visualEffectInstanceIter != visual->GetEffectInstanceEnd();
+                    ++visualEffectInstanceIter)
+            {
+                auto visualEffectInstance = visualEffectInstanceIter->get();
+                if (!sBatchRenderer->Draw(camera, visual, visualEffectInstance))
                 {
-                    auto child = renderNodeCurrent->GetChildAt(slotIndex);
-                    if (auto childVisual = dynamic_cast<const Visual *>(child))
-                    {
-                        sMasterRenderer->Draw(camera, childVisual);
-                    }
-                    else if (auto childNode = dynamic_cast<const Node *>(child))
-                    {
-                        // Prepare for traversing next level.
-                        nodeQueueNext.push(make_pair(childNode, sceneDepthCurrent + 1));
-                    }
-                    else
-                    {
-                        // Scene graph only consists of two type of spatial objects:
-                        // either Node or Visual.
-                        FALCON_ENGINE_THROW_ASSERTION_EXCEPTION();
-                    }
+                    sMasterRenderer->Draw(camera, visual, visualEffectInstance);
                 }
             }
+        }
 
-            std::swap(nodeQueueCurrent, nodeQueueNext);
+        // Draw the batched instances of this camera.
+        sBatchRenderer->Render(percent);
+
+        // NOTE: Depth of all the entities of the occlusion camera, batched or
+        // not, occludes its batched draws in next frame. The depth is captured
+        // right after the camera is rendered, because the render lists are not
+        // in the order the cameras are set.
+        if (cameraRenderListPair.first != nullptr && cameraRenderListPair.first == mOcclusionCamera)
+        {
+            sBatchRenderer->CaptureDepth(camera);
         }
     }
 }
@@ -112,6 +272,83 @@ EntityRenderer::Render(double /* percent */)
 void
 EntityRenderer::RenderEnd()
 {
+    BatchRenderer::GetInstance()->RenderEnd();
+}
+
+/************************************************************************/
+/* Private Members                                                      */
+/************************************************************************/
+int
+EntityRenderer::SelectLod(const Camera *camera, const Visual *visual)
+{
+    static auto sMasterRenderer = Renderer::GetInstance();
+
+    auto mesh = visual->GetMesh();
+    auto lodNum = mesh->GetLodNum();
+    if (!mLodEnabled || lodNum == 1 || camera == nullptr)
+    {
+        return 0;
+    }
+
+    auto lodKey = make_pair(camera, visual->GetHandle());
+    auto lodIter = mLodTable.find(lodKey);
+    auto lodIndex = lodIter != mLodTable.end() ? min(lodIter->second, lodNum - 1) : 0;
+
+    // Radius of the mesh bound in world space.
+    const auto& transform = visual->mWorldTransformInterpolated;
+    auto aabb = mesh->GetAABB();
+    auto extent = aabb->GetExtent();
+    auto scale = 0.0f;
+    for (int column = 0; column < 3; ++column)
+    {
+        auto axis = Vector3f(transform[column].x, transform[column].y, transform[column].z);
+        scale = max(scale, Vector3f::Dot(axis, axis));
+    }
+
+    auto radius = sqrt(Vector3f::Dot(extent, extent) * scale);
+
+    // NOTE: The projection scales the unit at the view distance
+    // into the normalized device coordinate, which spans two units over the
+    // viewport height. Perspective projection also divides by the distance.
+    const auto& projection = camera->GetProjection();
+    auto pixelPerUnit = projection[1][1] * sMasterRenderer->GetViewport()->GetHeight() * 0.5f;
+    auto perspective = projection[3][3] == 0.0f;
+    auto inside = false;
+    if (perspective)
+    {
+        auto center = Vector4f(transform * Vector4f(aabb->GetCenter(), 1));
+        auto offset = Vector3f(center.x, center.y, center.z) - camera->GetPosition();
+        auto distance = sqrt(Vector3f::Dot(offset, offset));
+
+        inside = distance <= radius;
+        pixelPerUnit /= max(distance, 1e-6f);
+    }
+
+    if (inside)
+    {
+        lodIndex = 0;
+    }
+    else
+    {
+        auto radiusPixel = radius * pixelPerUnit;
+        auto errorPixelMin = mLodErrorPixel * (1.0f - mLodHysteresis);
+        auto errorPixelMax = mLodErrorPixel * (1.0f + mLodHysteresis);
+
+        // Refine while the current level is clearly too coarse, then coarsen
+        // while the next level is clearly fine enough.
+        while (lodIndex > 0 && mesh->GetLodError(lodIndex) * radiusPixel > errorPixelMax)
+        {
+            --lodIndex;
+        }
+
+        while (lodIndex + 1 < lodNum && mesh->GetLodError(lodIndex + 1) * radiusPixel <= errorPixelMin)
+        {
+            ++lodIndex;
+        }
+    }
+
+    mLodTableCurrent[lodKey] = lodIndex;
+    return lodIndex;
 }
 
 
@@ -1,5 +1,12 @@
 #include <FalconEngine/Graphics/Renderer/Font/Font.h>
 
+#include <algorithm>
+
+#include <FalconEngine/Content/AssetManager.h>
+#include <FalconEngine/Graphics/Renderer/Renderer.h>
+#include <FalconEngine/Graphics/Renderer/Resource/Texture2d.h>
+#include <FalconEngine/Graphics/Renderer/Resource/Texture2dArray.h>
+
 namespace FalconEngine
 {
 
@@ -50,10 +57,102 @@ Font::GetSampler() const
 
 void
 Font::SetTexture(std::shared_ptr<Texture2dArray> texture)
+{
+    SetTexture(texture, "");
+}
+
+void
+Font::SetTexture(std::shared_ptr<Texture2dArray> texture, const std::string& textureDirectoryPath)
 {
     FALCON_ENGINE_CHECK_NULLPTR(texture);
 
     mTexture = texture;
+    mTextureDirectoryPath = textureDirectoryPath;
+    mTexturePageLoadedList.assign(mTexturePages, false);
+
+    auto texturePageNum = std::min(mTexturePages, texture->GetTextureSliceNum());
+    for (int page = 0; page < texturePageNum; ++page)
+    {
+        mTexturePageLoadedList[page] = texture->GetTextureSlice(page) != nullptr;
+    }
+}
+
+void
+Font::SetAtlas(std::shared_ptr<FontAtlas> atlas)
+{
+    FALCON_ENGINE_CHECK_NULLPTR(atlas);
+
+    mAtlas = atlas;
+
+    mLineBase = atlas->GetLineBase();
+    mLineHeight = atlas->GetLineHeight();
+    SetSize(FontAtlas::GlyphSize);
+
+    mTextureWidth = FontAtlas::PageSize;
+    mTextureHeight = FontAtlas::PageSize;
+    mTexturePages = FontAtlas::PageNumMax;
+
+    mGlyphCount = 0;
+    mGlyphTable.clear();
+    mGlyphMap.Clear();
+
+    mTexture = atlas->GetTexture();
+    mTextureDirectoryPath.clear();
+    mTexturePageLoadedList.clear();
+}
+
+FontAtlas *
+Font::GetAtlas() const
+{
+    return mAtlas.get();
+}
+
+bool
+Font::IsTexturePageLoaded(int page) const
+{
+    // NOTE: The atlas page is opened before any glyph is packed into
+    // it.
+    if (mAtlas)
+    {
+        return true;
+    }
+
+    return mTexturePageLoadedList.at(page);
+}
+
+void
+Font::LoadTexturePage(int page) const
+{
+    if (IsTexturePageLoaded(page))
+    {
+        return;
+    }
+
+    auto texturePath = mTextureDirectoryPath + mTextureArchiveNameList.at(page);
+    auto texture = AssetManager::GetInstance()->LoadTexture<Texture2d>(texturePath);
+    mTexture->SetTextureSlice(page, texture);
+    mTexturePageLoadedList[page] = true;
+
+    Renderer::GetInstance()->Update(mTexture.get(), page);
+}
+
+/************************************************************************/
+/* Glyph Management                                                     */
+/************************************************************************/
+void
+Font::BuildGlyphMap()
+{
+    // NOTE(Wuxiang): Indirect lookup in glyph table. First you look up the glyph
+    // index with the codepoint, which indexes into the glyph table. Then you use
+    // the glyph index to look up the glyph. The glyph map only stores the
+    // Unicode blocks the font covers.
+    mGlyphMap.Clear();
+
+    auto glyphNum = mGlyphTable.size();
+    for (size_t glyphIndex = 0; glyphIndex < glyphNum; ++glyphIndex)
+    {
+        mGlyphMap.Insert(uint32_t(mGlyphTable[glyphIndex].mId), uint32_t(glyphIndex));
+    }
 }
 
 const Texture2dArray *
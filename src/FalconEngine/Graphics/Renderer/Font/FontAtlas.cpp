@@ -0,0 +1,346 @@
+#include <FalconEngine/Graphics/Renderer/Font/FontAtlas.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include <FalconEngine/Graphics/Renderer/Renderer.h>
+#include <FalconEngine/Graphics/Renderer/Resource/Texture2d.h>
+#include <FalconEngine/Graphics/Renderer/Resource/Texture2dArray.h>
+
+#pragma warning(disable : 4244)
+#define STB_TRUETYPE_IMPLEMENTATION
+#include <stb/stb_truetype.h>
+#pragma warning(default : 4244)
+
+namespace FalconEngine
+{
+
+/************************************************************************/
+/* Static Members                                                       */
+/************************************************************************/
+// NOTE: The glyph is rasterized in the same size the bitmap fonts are
+// imported in, so that the font width and edge used in the shader work for
+// both kinds of font.
+const int FontAtlas::GlyphSize = 33;
+const int FontAtlas::GlyphPadding = 4;
+const int FontAtlas::GlyphSpacing = 1;
+
+const int FontAtlas::PageSize = 1024;
+const int FontAtlas::PageNumMax = 4;
+
+const uint32_t FontAtlas::GlyphIndexNone = 0;
+const uint32_t FontAtlas::GlyphIndexMissing = 1;
+
+/************************************************************************/
+/* Constructors and Destructor                                          */
+/************************************************************************/
+FontAtlas::FontAtlas(std::vector<unsigned char>&& fontFileData) :
+    mFontFileData(std::move(fontFileData)),
+    mFontInfo(std::make_unique<stbtt_fontinfo>()),
+    mFontScale(0),
+    mLineBase(0),
+    mLineHeight(0),
+    mFrame(1),
+    mPageNum(0)
+{
+    auto fontOffset = stbtt_GetFontOffsetForIndex(mFontFileData.data(), 0);
+    if (fontOffset < 0 || !stbtt_InitFont(mFontInfo.get(), mFontFileData.data(), fontOffset))
+    {
+        FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("Failed to load TrueType font.");
+    }
+
+    mFontScale = stbtt_ScaleForPixelHeight(mFontInfo.get(), float(GlyphSize));
+
+    int ascent, descent, lineGap;
+    stbtt_GetFontVMetrics(mFontInfo.get(), &ascent, &descent, &lineGap);
+    mLineBase = ascent * mFontScale;
+    mLineHeight = (ascent - descent + lineGap) * mFontScale;
+
+    // NOTE: The none glyph is drawn when the glyph could not be
+    // packed. The missing glyph is mapped by the codepoint the font doesn't
+    // have, so that the font is not searched again for the codepoint.
+    int missingAdvance, missingBearing;
+    stbtt_GetGlyphHMetrics(mFontInfo.get(), 0, &missingAdvance, &missingBearing);
+
+    mGlyphTable.push_back(FontGlyph(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0));
+    mGlyphTable.push_back(FontGlyph(0, 0, 0, 0, 0, missingAdvance * mFontScale, 0, 0, 0, 0, 0));
+
+    mPageList.resize(PageNumMax);
+    mTexture = std::make_shared<Texture2dArray>(AssetSource::Virtual, "None", "None",
+               PageSize, PageSize, PageNumMax, TextureFormat::R8G8B8A8,
+               BufferUsage::Dynamic, 0);
+
+    // NOTE: The first page is opened at once, so that the texture
+    // array has the full number of slices when it is bound.
+    OpenPage(mPageNum++);
+}
+
+FontAtlas::~FontAtlas()
+{
+}
+
+/************************************************************************/
+/* Public Members                                                       */
+/************************************************************************/
+double
+FontAtlas::GetLineBase() const
+{
+    return mLineBase;
+}
+
+double
+FontAtlas::GetLineHeight() const
+{
+    return mLineHeight;
+}
+
+int
+FontAtlas::GetPageNum() const
+{
+    return mPageNum;
+}
+
+const std::shared_ptr<Texture2dArray>&
+FontAtlas::GetTexture() const
+{
+    return mTexture;
+}
+
+void
+FontAtlas::BeginFrame()
+{
+    ++mFrame;
+}
+
+void
+FontAtlas::Upload()
+{
+    // NOTE: The glyphs rasterized in the same frame are uploaded
+    // together, at most once for each page.
+    static auto sMasterRenderer = Renderer::GetInstance();
+
+    for (int page = 0; page < mPageNum; ++page)
+    {
+        if (mPageList[page].mDirty)
+        {
+            sMasterRenderer->Update(mTexture.get(), page);
+            mPageList[page].mDirty = false;
+        }
+    }
+}
+
+/************************************************************************/
+/* Private Members                                                      */
+/************************************************************************/
+bool
+FontAtlas::AllocateRegion(int width, int height, int& page, int& x, int& y)
+{
+    for (page = 0; page < mPageNum; ++page)
+    {
+        if (AllocateRegionInPage(page, width, height, x, y))
+        {
+            return true;
+        }
+    }
+
+    if (mPageNum < PageNumMax)
+    {
+        page = mPageNum++;
+        OpenPage(page);
+        return AllocateRegionInPage(page, width, height, x, y);
+    }
+
+    // NOTE: The page used in this frame could not be evicted, because
+    // the text using it is not drawn yet.
+    page = -1;
+    auto frameUsedMin = std::numeric_limits<uint64_t>::max();
+    for (int pageIndex = 0; pageIndex < mPageNum; ++pageIndex)
+    {
+        auto frameUsed = mPageList[pageIndex].mFrameUsed;
+        if (frameUsed < mFrame && frameUsed < frameUsedMin)
+        {
+            page = pageIndex;
+            frameUsedMin = frameUsed;
+        }
+    }
+
+    if (page == -1)
+    {
+        return false;
+    }
+
+    EvictPage(page);
+    return AllocateRegionInPage(page, width, height, x, y);
+}
+
+bool
+FontAtlas::AllocateRegionInPage(int page, int width, int height, int& x, int& y)
+{
+    auto& atlasPage = mPageList[page];
+
+    // Find the shelf wasting the least height.
+    FontAtlasShelf *shelfFit = nullptr;
+    for (auto& shelf : atlasPage.mShelfList)
+    {
+        if (shelf.mHeight >= height && shelf.mWidthUsed + width <= PageSize)
+        {
+            if (shelfFit == nullptr || shelf.mHeight < shelfFit->mHeight)
+            {
+                shelfFit = &shelf;
+            }
+        }
+    }
+
+    if (shelfFit == nullptr)
+    {
+        // NOTE: The shelf height is rounded up, so that the glyphs of
+        // similar height share the shelf.
+        auto shelfHeight = std::min((height + 3) / 4 * 4, PageSize - atlasPage.mShelfHeightUsed);
+        if (shelfHeight < height || width > PageSize)
+        {
+            return false;
+        }
+
+        atlasPage.mShelfList.push_back({ atlasPage.mShelfHeightUsed, shelfHeight, 0 });
+        atlasPage.mShelfHeightUsed += shelfHeight;
+        shelfFit = &atlasPage.mShelfList.back();
+    }
+
+    x = shelfFit->mWidthUsed;
+    y = shelfFit->mY;
+    shelfFit->mWidthUsed += width;
+    return true;
+}
+
+void
+FontAtlas::EvictPage(int page)
+{
+    auto& atlasPage = mPageList[page];
+    for (auto codepoint : atlasPage.mCodepointList)
+    {
+        mGlyphSlotFreeList.push_back(mGlyphMap.Find(codepoint));
+        mGlyphMap.Insert(codepoint, GlyphIndexNone);
+    }
+
+    atlasPage.mCodepointList.clear();
+    atlasPage.mShelfList.clear();
+    atlasPage.mShelfHeightUsed = 0;
+
+    // NOTE: Clear the page so that the evicted glyph doesn't bleed
+    // into the new glyph through filtering.
+    auto texture = atlasPage.mTexture.get();
+    memset(texture->mData, 0, texture->mDataSize);
+}
+
+const FontGlyph&
+FontAtlas::LoadGlyph(uint32_t codepoint)
+{
+    if (codepoint > FontGlyphMap::CodepointMax)
+    {
+        return mGlyphTable[GlyphIndexMissing];
+    }
+
+    auto glyphId = stbtt_FindGlyphIndex(mFontInfo.get(), int(codepoint));
+    if (glyphId == 0)
+    {
+        mGlyphMap.Insert(codepoint, GlyphIndexMissing);
+        return mGlyphTable[GlyphIndexMissing];
+    }
+
+    int advance, bearing;
+    stbtt_GetGlyphHMetrics(mFontInfo.get(), glyphId, &advance, &bearing);
+
+    // NOTE: The distance is 0.5 on the edge and changes by 0.5 over
+    // the padding, which is the distance field the shader expects.
+    int width, height, offsetX, offsetY;
+    auto bitmap = stbtt_GetGlyphSDF(mFontInfo.get(), mFontScale, glyphId,
+                                    GlyphPadding, 128, 128.0f / GlyphPadding,
+                                    &width, &height, &offsetX, &offsetY);
+
+    // NOTE: The offset y is from the line top to the glyph top, as
+    // the one in bitmap font, where stb offset is from the base line.
+    auto glyph = FontGlyph(int(codepoint), 0, 0, offsetX, mLineBase + offsetY,
+                           advance * mFontScale, 0, 0, 0, 0, 0);
+
+    // The glyph without outline, like space, takes no room in the atlas.
+    if (bitmap == nullptr)
+    {
+        auto glyphIndex = PushGlyph(glyph);
+        mGlyphMap.Insert(codepoint, glyphIndex);
+        return mGlyphTable[glyphIndex];
+    }
+
+    int page, x, y;
+    if (!AllocateRegion(width + GlyphSpacing, height + GlyphSpacing, page, x, y))
+    {
+        stbtt_FreeSDF(bitmap, nullptr);
+        return mGlyphTable[GlyphIndexNone];
+    }
+
+    // NOTE: The bitmap is from top-left corner, but the texture is
+    // from bottom-left corner as the one loaded from the file.
+    auto& atlasPage = mPageList[page];
+    auto texture = atlasPage.mTexture.get();
+    for (int row = 0; row < height; ++row)
+    {
+        auto texelRow = texture->mData + (size_t(PageSize - 1 - (y + row)) * PageSize + x) * 4;
+        for (int column = 0; column < width; ++column)
+        {
+            texelRow[column * 4 + 0] = 255;
+            texelRow[column * 4 + 1] = 255;
+            texelRow[column * 4 + 2] = 255;
+            texelRow[column * 4 + 3] = bitmap[row * width + column];
+        }
+    }
+
+    stbtt_FreeSDF(bitmap, nullptr);
+
+    glyph.mWidth = width;
+    glyph.mHeight = height;
+    glyph.mPage = page;
+    glyph.mS1 = double(x) / PageSize;
+    glyph.mS2 = double(x + width) / PageSize;
+    glyph.mT2 = double(PageSize - y) / PageSize;
+    glyph.mT1 = glyph.mT2 - double(height) / PageSize;
+
+    atlasPage.mCodepointList.push_back(codepoint);
+    atlasPage.mFrameUsed = mFrame;
+    atlasPage.mDirty = true;
+
+    auto glyphIndex = PushGlyph(glyph);
+    mGlyphMap.Insert(codepoint, glyphIndex);
+    return mGlyphTable[glyphIndex];
+}
+
+void
+FontAtlas::OpenPage(int page)
+{
+    MemoryTagScope memoryTagScope(MemoryTag::Font);
+
+    auto texture = std::make_shared<Texture2d>(AssetSource::Virtual, "None", "None",
+                   PageSize, PageSize, TextureFormat::R8G8B8A8,
+                   BufferUsage::Dynamic, 0);
+    memset(texture->mData, 0, texture->mDataSize);
+
+    mPageList[page].mTexture = texture;
+    mPageList[page].mDirty = true;
+    mTexture->SetTextureSlice(page, texture);
+}
+
+uint32_t
+FontAtlas::PushGlyph(const FontGlyph& glyph)
+{
+    if (!mGlyphSlotFreeList.empty())
+    {
+        auto glyphIndex = mGlyphSlotFreeList.back();
+        mGlyphSlotFreeList.pop_back();
+        mGlyphTable[glyphIndex] = glyph;
+        return glyphIndex;
+    }
+
+    mGlyphTable.push_back(glyph);
+    return uint32_t(mGlyphTable.size() - 1);
+}
+
+}
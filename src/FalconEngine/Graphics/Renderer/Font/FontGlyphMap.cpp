@@ -0,0 +1,56 @@
+#include <FalconEngine/Graphics/Renderer/Font/FontGlyphMap.h>
+
+namespace FalconEngine
+{
+
+/************************************************************************/
+/* Constructors and Destructor                                          */
+/************************************************************************/
+FontGlyphMap::FontGlyphMap()
+{
+    Clear();
+}
+
+/************************************************************************/
+/* Public Members                                                       */
+/************************************************************************/
+void
+FontGlyphMap::Clear()
+{
+    mBlockTable.assign(BlockNum, 0);
+    mBlockData.assign(BlockSize, 0);
+}
+
+void
+FontGlyphMap::Insert(uint32_t codepoint, uint32_t glyphIndex)
+{
+    if (codepoint > CodepointMax)
+    {
+        FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("Codepoint is out of Unicode range.");
+    }
+
+    auto& blockIndex = mBlockTable[codepoint >> BlockBit];
+    if (blockIndex == 0)
+    {
+        // NOTE: The block number is less than 65536, so that the
+        // block index never overflows.
+        blockIndex = uint16_t(mBlockData.size() >> BlockBit);
+        mBlockData.resize(mBlockData.size() + BlockSize, 0);
+    }
+
+    mBlockData[(uint32_t(blockIndex) << BlockBit) | (codepoint & (BlockSize - 1))] = glyphIndex;
+}
+
+size_t
+FontGlyphMap::GetBlockNum() const
+{
+    return mBlockData.size() >> BlockBit;
+}
+
+size_t
+FontGlyphMap::GetMemorySize() const
+{
+    return mBlockTable.capacity() * sizeof(uint16_t) + mBlockData.capacity() * sizeof(uint32_t);
+}
+
+}
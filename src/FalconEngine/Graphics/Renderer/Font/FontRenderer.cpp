@@ -56,7 +56,7 @@ FontRenderer::AddText(const Font *font,
 {
     FALCON_ENGINE_CHECK_NULLPTR(font);
 
-    BatchText(font, fontSize, GetWString(text), textPosition, textColor, textLineWidth);
+    mTextRecordList.emplace_back(font, FontRenderItem(FontText(fontSize, GetWString(text), textPosition, textLineWidth), textColor));
 }
 
 void
@@ -69,7 +69,7 @@ FontRenderer::AddText(const Font *font,
 {
     FALCON_ENGINE_CHECK_NULLPTR(font);
 
-    BatchText(font, fontSize, text, textPosition, textColor, textLineWidth);
+    mTextRecordList.emplace_back(font, FontRenderItem(FontText(fontSize, text, textPosition, textLineWidth), textColor));
 }
 
 /************************************************************************/
@@ -80,14 +80,42 @@ FontRenderer::Initialize()
 {
 }
 
+void
+FontRenderer::Handoff()
+{
+    // NOTE: The render list has been consumed by the render side, so
+    // that it is reused as the record list without reallocation.
+    std::swap(mTextRecordList, mTextRenderList);
+    mTextRecordList.clear();
+}
+
 void
 FontRenderer::RenderBegin()
 {
+    // NOTE: The atlas page used by the last frame could be evicted
+    // from now on, since the text using it has been drawn.
+    for (auto fontChannelIter = mTextBufferResource->GetChannelBegin();
+            fontChannelIter != mTextBufferResource->GetChannelEnd();
+            ++fontChannelIter)
+    {
+        auto fontAtlas = reinterpret_cast<const Font *>(fontChannelIter->first)->GetAtlas();
+        if (fontAtlas)
+        {
+            fontAtlas->BeginFrame();
+        }
+    }
 }
 
 void
 FontRenderer::Render(double /* percent */)
 {
+    for (auto& fontTextPair : mTextRenderList)
+    {
+        BatchText(fontTextPair.first, std::move(fontTextPair.second));
+    }
+
+    mTextRenderList.clear();
+
     mTextBufferResource->Draw(nullptr);
 
     for (auto fontChannelIter = mTextBufferResource->GetChannelBegin();
@@ -119,14 +147,7 @@ FontRenderer::RenderEnd()
 /* Private Members                                                      */
 /************************************************************************/
 void
-FontRenderer::BatchText(
-    const Font     *font,
-    float           fontSize,
-
-    const wstring&  textString,
-    const Vector2f& textPosition,
-    Color           textColor,
-    float           textLineWidth)
+FontRenderer::BatchText(const Font *font, FontRenderItem&& textItem)
 {
     FALCON_ENGINE_CHECK_NULLPTR(font);
 
@@ -134,14 +155,9 @@ FontRenderer::BatchText(
     auto fontChannel = intptr_t(font);
 
     // Add the text into the batch
-    auto fontVertexNumMapped = int(textString.size()) * 6;
+    auto fontVertexNumMapped = int(textItem.mText.mTextString.size()) * 6;
     mTextBufferResource->AddChannelElementMapped(fontChannel, fontVertexNumMapped);
-    mTextBufferResource->AddChannelItem(fontChannel, FontRenderItem(
-                                            FontText(fontSize,
-                                                    textString,
-                                                    textPosition,
-                                                    textLineWidth),
-                                            textColor));
+    mTextBufferResource->AddChannelItem(fontChannel, std::move(textItem));
 
     // Fill the text VRAM buffer when the batch item number reach the item limit.
     int itemNum = int(fontChannelInfo->mRenderItemList.size());
@@ -182,7 +198,7 @@ FontRenderer::FindChannel(const Font *font)
 
     auto primitive = make_shared<PrimitiveQuads>(vertexFormat, vertexGroup, nullptr);
 
-    auto visual = make_shared<Visual>(make_shared<Mesh>(primitive, nullptr));
+    auto visual = CreateSpatial<Visual>(make_shared<Mesh>(primitive, nullptr));
     auto visualEffectParams = make_shared<FontEffectParams>(font, HandednessRight::GetInstance());
     sVisualEffect->CreateInstance(visual.get(), visualEffectParams);
 
@@ -243,6 +259,13 @@ FontRenderer::FillText(
 
     mTextBufferResource->FillChannelDataEnd(fontChannel);
     mTextBufferResource->ResetChannel(fontChannel);
+
+    // Upload the glyphs rasterized in laying out the text before it is drawn.
+    auto fontAtlas = font->GetAtlas();
+    if (fontAtlas)
+    {
+        fontAtlas->Upload();
+    }
 }
 
 }
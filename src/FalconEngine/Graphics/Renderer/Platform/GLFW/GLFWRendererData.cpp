@@ -6,13 +6,18 @@ namespace FalconEngine
 {
 
 PlatformRendererData::PlatformRendererData(GLFWwindow *window) :
-    mWindow(window)
+    mWindow(window),
+    mFramebufferObj(0)
 {
     mState = std::make_unique<PlatformRendererState>();
 }
 
 PlatformRendererData::~PlatformRendererData()
 {
+    if (mFramebufferObj != 0)
+    {
+        glDeleteFramebuffers(1, &mFramebufferObj);
+    }
 }
 
 }
@@ -1,6 +1,7 @@
 #include <FalconEngine/Graphics/Renderer/Platform/OpenGL/OGLBuffer.h>
 
 #include <FalconEngine/Context/GameDebug.h>
+#include <FalconEngine/Graphics/Renderer/Platform/OpenGL/OGLUtility.h>
 
 namespace FalconEngine
 {
@@ -31,12 +32,17 @@ PlatformBuffer::Map(BufferAccessMode          access,
                     int64_t                   offset,
                     int64_t                   size)
 {
-    glBindBuffer(mBufferTarget, mBufferObj);
+    auto accessMark = OpenGLBufferAccessModeMark[int(access)] |
+                      OpenGLBufferFlushModeMark[int(flush)] |
+                      OpenGLBufferSynchronizationModeMark[int(synchronization)];
 
-    void *data = glMapBufferRange(mBufferTarget, offset, size,
-                                  OpenGLBufferAccessModeMark[int(access)] |
-                                  OpenGLBufferFlushModeMark[int(flush)] |
-                                  OpenGLBufferSynchronizationModeMark[int(synchronization)]);
+    if (IsDirectStateAccessSupported())
+    {
+        return glMapNamedBufferRange(mBufferObj, offset, size, accessMark);
+    }
+
+    glBindBuffer(mBufferTarget, mBufferObj);
+    void *data = glMapBufferRange(mBufferTarget, offset, size, accessMark);
     glBindBuffer(mBufferTarget, 0);
 
     return data;
@@ -45,6 +51,12 @@ PlatformBuffer::Map(BufferAccessMode          access,
 void
 PlatformBuffer::Unmap()
 {
+    if (IsDirectStateAccessSupported())
+    {
+        glUnmapNamedBuffer(mBufferObj);
+        return;
+    }
+
     glBindBuffer(mBufferTarget, mBufferObj);
     glUnmapBuffer(mBufferTarget);
     glBindBuffer(mBufferTarget, 0);
@@ -53,13 +65,38 @@ PlatformBuffer::Unmap()
 void
 PlatformBuffer::Flush(int64_t offset, int64_t size)
 {
-    glBindBuffer(mBufferTarget, mBufferObj);
-
     // NOTE(Wuxiang): Remember that the offset is related to mapped range.
+    if (IsDirectStateAccessSupported())
+    {
+        glFlushMappedNamedBufferRange(mBufferObj, offset, size);
+        return;
+    }
+
+    glBindBuffer(mBufferTarget, mBufferObj);
     glFlushMappedBufferRange(mBufferTarget, offset, size);
     glBindBuffer(mBufferTarget, 0);
 }
 
+void
+PlatformBuffer::Copy(PlatformBuffer *destinationBuffer, int64_t sourceOffset, int64_t destinationOffset, int64_t size)
+{
+    FALCON_ENGINE_CHECK_NULLPTR(destinationBuffer);
+
+    if (IsDirectStateAccessSupported())
+    {
+        glCopyNamedBufferSubData(mBufferObj, destinationBuffer->mBufferObj, sourceOffset, destinationOffset, size);
+        return;
+    }
+
+    // NOTE: Use the dedicated copy targets so that the buffers bound
+    // on the other targets are not disturbed.
+    glBindBuffer(GL_COPY_READ_BUFFER, mBufferObj);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, destinationBuffer->mBufferObj);
+    glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, sourceOffset, destinationOffset, size);
+    glBindBuffer(GL_COPY_READ_BUFFER, 0);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+}
+
 /************************************************************************/
 /* Protected Members                                                    */
 /************************************************************************/
@@ -67,16 +104,22 @@ void
 PlatformBuffer::CheckRangeValid(int64_t offset, int64_t size)
 {
 #if defined(FALCON_ENGINE_DEBUG_GRAPHICS)
-    glBindBuffer(mBufferTarget, mBufferObj);
-
     GLint bufferSize;
-    glGetBufferParameteriv(mBufferTarget, GL_BUFFER_SIZE, &bufferSize);
+    if (IsDirectStateAccessSupported())
+    {
+        glGetNamedBufferParameteriv(mBufferObj, GL_BUFFER_SIZE, &bufferSize);
+    }
+    else
+    {
+        glBindBuffer(mBufferTarget, mBufferObj);
+        glGetBufferParameteriv(mBufferTarget, GL_BUFFER_SIZE, &bufferSize);
+        glBindBuffer(mBufferTarget, 0);
+    }
+
     if (offset + size > bufferSize)
     {
         FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("Buffer is overflowed.");
     }
-
-    glBindBuffer(mBufferTarget, 0);
 #endif
 }
 
@@ -92,6 +135,23 @@ PlatformBuffer::PrintRange(const char *message, GLuint bufferTarget, int64_t off
 void
 PlatformBuffer::Create()
 {
+    // NOTE: Buffer created by glCreateBuffers is initialized without
+    // binding, which the named functions require.
+    if (IsDirectStateAccessSupported())
+    {
+        glCreateBuffers(1, &mBufferObj);
+        glNamedBufferData(mBufferObj, mBufferPtr->GetCapacitySize(), nullptr,
+                          OpenGLBufferUsage[int(mBufferPtr->GetUsage())]);
+
+        if (mBufferPtr->GetStorageMode() == BufferStorageMode::Host)
+        {
+            glNamedBufferSubData(mBufferObj, 0, mBufferPtr->GetDataSize(),
+                                 mBufferPtr->GetData() + mBufferPtr->GetDataOffset());
+        }
+
+        return;
+    }
+
     // Generate buffer.
     glGenBuffers(1, &mBufferObj);
     glBindBuffer(mBufferTarget, mBufferObj);
@@ -0,0 +1,39 @@
+#include <FalconEngine/Graphics/Renderer/Platform/OpenGL/OGLIndirectBuffer.h>
+
+namespace FalconEngine
+{
+
+/************************************************************************/
+/* Constructors and Destructor                                          */
+/************************************************************************/
+PlatformIndirectBuffer::PlatformIndirectBuffer(const IndirectBuffer *indirectBuffer) :
+    PlatformBuffer(GL_DRAW_INDIRECT_BUFFER, indirectBuffer)
+{
+}
+
+PlatformIndirectBuffer::~PlatformIndirectBuffer()
+{
+}
+
+/************************************************************************/
+/* Public Members                                                       */
+/************************************************************************/
+void
+PlatformIndirectBuffer::Enable()
+{
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, mBufferObj);
+}
+
+void
+PlatformIndirectBuffer::Enable(unsigned int bindingIndex)
+{
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, bindingIndex, mBufferObj);
+}
+
+void
+PlatformIndirectBuffer::Disable()
+{
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+}
+
+}
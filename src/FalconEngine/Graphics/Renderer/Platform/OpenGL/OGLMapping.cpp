@@ -43,18 +43,24 @@ const GLuint OpenGLTextureType[int(TextureFormat::Count)] =
 {
     GL_INVALID_ENUM,  // None
     GL_UNSIGNED_BYTE, // R8G8B8A8
+
+    GL_FLOAT,         // D32F
 };
 
 const GLuint OpenGLTextureFormat[int(TextureFormat::Count)] =
 {
     GL_INVALID_ENUM, // None
     GL_RGBA,         // R8G8B8A8
+
+    GL_DEPTH_COMPONENT, // D32F
 };
 
 const GLuint OpenGLTextureInternalFormat[int(TextureFormat::Count)] =
 {
     GL_INVALID_ENUM, // None
     GL_RGBA8,        // R8G8B8A8
+
+    GL_DEPTH_COMPONENT32F, // D32F
 };
 
 const GLuint OpenGLTextureTarget[int(TextureType::Count)] =
@@ -192,26 +198,40 @@ const GLenum OpenGLPrimitiveType[int(PrimitiveType::Count)] =
 
 const GLuint OpenGLShaderAttributeType[int(VertexAttributeType::Count)] =
 {
-    0,        // None
+    0,             // None
+
+    GL_FLOAT,      // Float
+    GL_FLOAT,      // FloatVec2
+    GL_FLOAT,      // FloatVec3
+    GL_FLOAT,      // FloatVec4
 
-    GL_FLOAT, // Float
-    GL_FLOAT, // FloatVec2
-    GL_FLOAT, // FloatVec3
-    GL_FLOAT, // FloatVec4
+    GL_INT,        // Int
+    GL_INT,        // IntVec2
+    GL_INT,        // IntVec3
+    GL_INT,        // IntVec4
 
-    GL_INT,   // Int
-    GL_INT,   // IntVec2
-    GL_INT,   // IntVec3
-    GL_INT,   // IntVec4
+    GL_HALF_FLOAT, // HalfVec2
+    GL_HALF_FLOAT, // HalfVec4
+
+    GL_SHORT,      // ShortVec2
+    GL_SHORT,      // ShortVec4
 };
 
 const GLenum OpenGLShaderType[int(ShaderType::Count)] =
 {
     GL_VERTEX_SHADER,
     GL_GEOMETRY_SHADER,
-    GL_FRAGMENT_SHADER
+    GL_FRAGMENT_SHADER,
+    GL_COMPUTE_SHADER
 };
 
+bool
+IsDirectStateAccessSupported()
+{
+    static const bool sSupported = GLEW_VERSION_4_5 || GLEW_ARB_direct_state_access;
+    return sSupported;
+}
+
 GLuint
 BindTexture(TextureType textureType, GLuint texture)
 {
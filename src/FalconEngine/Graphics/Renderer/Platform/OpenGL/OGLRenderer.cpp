@@ -5,12 +5,20 @@
 #include <FalconEngine/Graphics/Renderer/PrimitiveTriangles.h>
 #include <FalconEngine/Graphics/Renderer/Scene/Visual.h>
 #include <FalconEngine/Graphics/Renderer/Resource/IndexBuffer.h>
+#include <FalconEngine/Graphics/Renderer/Resource/IndirectBuffer.h>
+#include <FalconEngine/Graphics/Renderer/Resource/Texture1d.h>
+#include <FalconEngine/Graphics/Renderer/Resource/Texture2d.h>
 #include <FalconEngine/Graphics/Renderer/State/CullState.h>
 #include <FalconEngine/Graphics/Renderer/State/OffsetState.h>
 #include <FalconEngine/Graphics/Renderer/State/WireframeState.h>
 
 #if defined(FALCON_ENGINE_API_OPENGL)
 #include <FalconEngine/Graphics/Renderer/Platform/OpenGL/OGLRendererState.h>
+#include <FalconEngine/Graphics/Renderer/Platform/OpenGL/OGLShaderBuffer.h>
+#include <FalconEngine/Graphics/Renderer/Platform/OpenGL/OGLTexture1d.h>
+#include <FalconEngine/Graphics/Renderer/Platform/OpenGL/OGLTexture2d.h>
+#include <FalconEngine/Graphics/Renderer/Platform/OpenGL/OGLTexture2dArray.h>
+#include <FalconEngine/Graphics/Renderer/Platform/OpenGL/OGLTextureSampler.h>
 #endif
 #if defined(FALCON_ENGINE_WINDOW_GLFW)
 #include <FalconEngine/Context/Platform/GLFW/GLFWGameEngineData.h>
@@ -21,6 +29,21 @@ using namespace std;
 namespace FalconEngine
 {
 
+static GLenum
+GetIndexTypePlatform(IndexType indexType)
+{
+    if (indexType == IndexType::UnsignedShort)
+    {
+        return GL_UNSIGNED_SHORT;
+    }
+    else if (indexType == IndexType::UnsignedInt)
+    {
+        return GL_UNSIGNED_INT;
+    }
+
+    FALCON_ENGINE_THROW_ASSERTION_EXCEPTION();
+}
+
 /************************************************************************/
 /* Initialization and Destroy                                           */
 /************************************************************************/
@@ -395,12 +418,55 @@ Renderer::ClearStencilBufferPlatform(unsigned stencil)
     glClear(GL_STENCIL_BUFFER_BIT);
 }
 
+void
+Renderer::CopyDepthBufferPlatform(PlatformShaderBuffer *buffer, int x, int y, int width, int height)
+{
+    // NOTE: Reading into pixel pack buffer is queued on the device,
+    // so that it does not wait for the rendering to finish.
+    buffer->EnablePack();
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    glReadPixels(x, y, width, height, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
+    buffer->DisablePack();
+}
+
+void
+Renderer::SetRenderTargetPlatform(PlatformTexture2dArray *depthTextureArray, int layer)
+{
+    if (depthTextureArray == nullptr)
+    {
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        return;
+    }
+
+    if (mData->mFramebufferObj == 0)
+    {
+        glGenFramebuffers(1, &mData->mFramebufferObj);
+    }
+
+    // NOTE: Framebuffer without color attachment has neither draw
+    // buffer nor read buffer.
+    glBindFramebuffer(GL_FRAMEBUFFER, mData->mFramebufferObj);
+    glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT,
+                              depthTextureArray->GetTextureObj(), 0, layer);
+    glDrawBuffer(GL_NONE);
+    glReadBuffer(GL_NONE);
+}
+
 void
 Renderer::SwapFrameBufferPlatform()
 {
     glfwSwapBuffers(mData->mWindow);
 }
 
+/************************************************************************/
+/* Context Management                                                   */
+/************************************************************************/
+void
+Renderer::SetContextCurrentPlatform(bool current)
+{
+    glfwMakeContextCurrent(current ? mData->mWindow : nullptr);
+}
+
 /************************************************************************/
 /* Draw                                                                 */
 /************************************************************************/
@@ -474,6 +540,96 @@ Renderer::DrawPrimitivePlatform(const Primitive *primitive, int primitiveInstanc
     }
 }
 
+void
+Renderer::DrawPrimitiveIndirectPlatform(PrimitiveType primitiveType,
+                                        IndexType     indexType,
+                                        int           commandBegin,
+                                        int           commandNum)
+{
+    if (primitiveType != PrimitiveType::Triangle)
+    {
+        FALCON_ENGINE_THROW_SUPPORT_EXCEPTION();
+    }
+
+    const GLenum primitiveMode = OpenGLPrimitiveType[int(primitiveType)];
+    const GLenum indexTypePlatform = GetIndexTypePlatform(indexType);
+
+    // NOTE: The command offset is relative to the indirect buffer
+    // bound on GL_DRAW_INDIRECT_BUFFER. The commands are tightly packed.
+    const GLvoid *commandOffset = static_cast<DrawElementsIndirectCommand *>(nullptr) + commandBegin;
+    glMultiDrawElementsIndirect(primitiveMode, indexTypePlatform, commandOffset, commandNum, 0);
 }
 
-#endif
+void
+Renderer::DrawPrimitiveIndirectCountPlatform(PrimitiveType         primitiveType,
+                                             IndexType             indexType,
+                                             int                   commandBegin,
+                                             int                   commandNumMax,
+                                             PlatformShaderBuffer *countBuffer,
+                                             int64_t               countOffset)
+{
+    if (primitiveType != PrimitiveType::Triangle)
+    {
+        FALCON_ENGINE_THROW_SUPPORT_EXCEPTION();
+    }
+
+    const GLenum primitiveMode = OpenGLPrimitiveType[int(primitiveType)];
+    const GLenum indexTypePlatform = GetIndexTypePlatform(indexType);
+    const GLvoid *commandOffset = static_cast<DrawElementsIndirectCommand *>(nullptr) + commandBegin;
+
+    // NOTE: GL_ARB_indirect_parameters is not part of OpenGL 4.3.
+    // Without it, every command is drawn and the commands beyond the count
+    // are expected to have zero instance.
+    if (GLEW_ARB_indirect_parameters)
+    {
+        countBuffer->EnableParameter();
+        glMultiDrawElementsIndirectCountARB(primitiveMode, indexTypePlatform, commandOffset,
+                                            GLintptr(countOffset), commandNumMax, 0);
+    }
+    else
+    {
+        glMultiDrawElementsIndirect(primitiveMode, indexTypePlatform, commandOffset, commandNumMax, 0);
+    }
+}
+
+/************************************************************************/
+/* Compute                                                              */
+/************************************************************************/
+void
+Renderer::DispatchPlatform(int groupNumX, int groupNumY, int groupNumZ)
+{
+    glDispatchCompute(GLuint(groupNumX), GLuint(groupNumY), GLuint(groupNumZ));
+
+    // NOTE: The shader storage written by compute shader is read
+    // as draw commands, vertex shader storage, copy source or mapped memory.
+    glMemoryBarrier(GL_COMMAND_BARRIER_BIT
+                    | GL_SHADER_STORAGE_BARRIER_BIT
+                    | GL_BUFFER_UPDATE_BARRIER_BIT
+                    | GL_CLIENT_MAPPED_BUFFER_BARRIER_BIT);
+}
+
+/************************************************************************/
+/* Texture Handle                                                       */
+/************************************************************************/
+bool
+Renderer::IsTextureHandleSupportedPlatform() const
+{
+    static const bool sSupported = GLEW_ARB_bindless_texture != 0;
+    return sSupported;
+}
+
+uint64_t
+Renderer::GetTextureHandlePlatform(const Texture *texture, const PlatformSampler *sampler)
+{
+    switch (texture->mType)
+    {
+    case TextureType::Texture1d:
+        return mTexture1dTable.at(reinterpret_cast<const Texture1d *>(texture))->GetHandle(sampler);
+    case TextureType::Texture2d:
+        return mTexture2dTable.at(reinterpret_cast<const Texture2d *>(texture))->GetHandle(sampler);
+    default:
+        FALCON_ENGINE_THROW_SUPPORT_EXCEPTION();
+    }
+}
+
+}
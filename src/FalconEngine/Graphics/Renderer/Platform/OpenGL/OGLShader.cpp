@@ -98,6 +98,11 @@ PlatformShader::LinkProgram()
         glAttachShader(mProgram, mShaders[FragmentShaderIndex]);
     }
 
+    if (mShaders[ComputeShaderIndex] != 0)
+    {
+        glAttachShader(mProgram, mShaders[ComputeShaderIndex]);
+    }
+
     // Link and check whether the program links fine
     GLint status;
     glLinkProgram(mProgram);
@@ -130,6 +135,11 @@ PlatformShader::LinkProgram()
     {
         glDeleteShader(mShaders[FragmentShaderIndex]);
     }
+
+    if (mShaders[ComputeShaderIndex] != 0)
+    {
+        glDeleteShader(mShaders[ComputeShaderIndex]);
+    }
 }
 
 void
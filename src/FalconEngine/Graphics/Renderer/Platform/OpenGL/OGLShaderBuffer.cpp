@@ -26,6 +26,30 @@ PlatformShaderBuffer::Enable()
     glBindBuffer(GL_SHADER_STORAGE_BUFFER, mBufferObj);
 }
 
+void
+PlatformShaderBuffer::Enable(unsigned int bindingIndex)
+{
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, bindingIndex, mBufferObj);
+}
+
+void
+PlatformShaderBuffer::EnableParameter()
+{
+    glBindBuffer(GL_PARAMETER_BUFFER_ARB, mBufferObj);
+}
+
+void
+PlatformShaderBuffer::EnablePack()
+{
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, mBufferObj);
+}
+
+void
+PlatformShaderBuffer::DisablePack()
+{
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+}
+
 void
 PlatformShaderBuffer::Disable()
 {
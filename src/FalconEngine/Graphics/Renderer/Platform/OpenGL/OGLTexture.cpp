@@ -1,4 +1,5 @@
 #include <FalconEngine/Graphics/Renderer/Platform/OpenGL/OGLTexture.h>
+#include <FalconEngine/Graphics/Renderer/Platform/OpenGL/OGLTextureSampler.h>
 #include <FalconEngine/Graphics/Renderer/Platform/OpenGL/OGLUtility.h>
 
 namespace FalconEngine
@@ -26,6 +27,17 @@ PlatformTexture::PlatformTexture(const Texture *texture) :
     // NEW(Wuxiang): Add mipmap support.
     // int mipmapLevel = texture->mMipmapLevel;
 
+    if (IsDirectStateAccessSupported())
+    {
+        // NOTE: Texture created by glCreateTextures is initialized
+        // with the target, so that it could be edited without binding.
+        glCreateBuffers(1, &mBufferObj);
+        glNamedBufferData(mBufferObj, texture->mDataSize, texture->mData, mUsage);
+
+        glCreateTextures(OpenGLTextureTarget[int(texture->mType)], 1, &mTextureObj);
+        return;
+    }
+
     glGenBuffers(1, &mBufferObj);
     glBindBuffer(GL_PIXEL_UNPACK_BUFFER, mBufferObj);
     glBufferData(GL_PIXEL_UNPACK_BUFFER, texture->mDataSize, nullptr, mUsage);
@@ -48,6 +60,11 @@ PlatformTexture::PlatformTexture(const Texture *texture) :
 
 PlatformTexture::~PlatformTexture()
 {
+    for (auto& handlePair : mHandleTable)
+    {
+        glMakeTextureHandleNonResidentARB(handlePair.second);
+    }
+
     glDeleteBuffers(1, &mBufferObj);
     glDeleteTextures(1, &mTextureObj);
 }
@@ -73,11 +90,17 @@ void *
 PlatformTexture::Map(BufferAccessMode access, BufferFlushMode flush, BufferSynchronizationMode synchronization, int64_t offset, int64_t size)
 {
     // NEW(Wuxiang): Add mipmap support.
+    auto accessMark = OpenGLBufferAccessModeMark[int(access)] |
+                      OpenGLBufferFlushModeMark[int(flush)] |
+                      OpenGLBufferSynchronizationModeMark[int(synchronization)];
+
+    if (IsDirectStateAccessSupported())
+    {
+        return glMapNamedBufferRange(mBufferObj, offset, size, accessMark);
+    }
+
     glBindBuffer(GL_PIXEL_UNPACK_BUFFER, mBufferObj);
-    void *data = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, offset, size,
-                                  OpenGLBufferAccessModeMark[int(access)] |
-                                  OpenGLBufferFlushModeMark[int(flush)] |
-                                  OpenGLBufferSynchronizationModeMark[int(synchronization)]);
+    void *data = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, offset, size, accessMark);
     glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
 
     return data;
@@ -87,9 +110,36 @@ void
 PlatformTexture::Unmap()
 {
     // NEW(Wuxiang): Add mipmap support.
+    if (IsDirectStateAccessSupported())
+    {
+        glUnmapNamedBuffer(mBufferObj);
+        return;
+    }
+
     glBindBuffer(GL_PIXEL_UNPACK_BUFFER, mBufferObj);
     glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
     glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
 }
 
+GLuint64
+PlatformTexture::GetHandle(const PlatformSampler *sampler)
+{
+    FALCON_ENGINE_CHECK_NULLPTR(sampler);
+
+    auto samplerObj = sampler->GetSamplerObj();
+    auto iter = mHandleTable.find(samplerObj);
+    if (iter != mHandleTable.end())
+    {
+        return iter->second;
+    }
+
+    // NOTE: Both the texture and the sampler are immutable once the
+    // handle is created, which holds since neither is edited after creation.
+    auto handle = glGetTextureSamplerHandleARB(mTextureObj, samplerObj);
+    glMakeTextureHandleResidentARB(handle);
+    mHandleTable.emplace(samplerObj, handle);
+
+    return handle;
+}
+
 }
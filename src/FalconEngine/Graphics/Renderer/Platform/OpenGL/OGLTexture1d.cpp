@@ -13,6 +13,19 @@ namespace FalconEngine
 PlatformTexture1d::PlatformTexture1d(const Texture1d *texture) :
     PlatformTexture(texture)
 {
+    // NOTE: The pixel source is still read from the bound unpack
+    // buffer, which has no named equivalent.
+    if (IsDirectStateAccessSupported())
+    {
+        glTextureStorage1D(mTextureObj, 1, mFormatInternal, mDimension[0]);
+
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, mBufferObj);
+        glTextureSubImage1D(mTextureObj, 0, 0, mDimension[0], mFormat, mType, nullptr);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+        return;
+    }
+
     // Bind newly created texture
     GLuint textureBindingPrevious = BindTexture(mTexturePtr->mType, mTextureObj);
 
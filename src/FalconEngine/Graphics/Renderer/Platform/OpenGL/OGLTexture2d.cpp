@@ -13,6 +13,21 @@ namespace FalconEngine
 PlatformTexture2d::PlatformTexture2d(const Texture2d *texture) :
     PlatformTexture(texture)
 {
+    // NOTE: The pixel source is still read from the bound unpack
+    // buffer, which has no named equivalent.
+    if (IsDirectStateAccessSupported())
+    {
+        glTextureStorage2D(mTextureObj, 1, mFormatInternal, mDimension[0],
+                           mDimension[1]);
+
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, mBufferObj);
+        glTextureSubImage2D(mTextureObj, 0, 0, 0, mDimension[0], mDimension[1],
+                            mFormat, mType, nullptr);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+        return;
+    }
+
     // Bind newly created texture
     GLuint textureBindingPrevious = BindTexture(mTexturePtr->mType, mTextureObj);
 
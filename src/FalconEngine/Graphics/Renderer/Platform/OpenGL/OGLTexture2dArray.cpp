@@ -13,6 +13,33 @@ namespace FalconEngine
 PlatformTexture2dArray::PlatformTexture2dArray(const Texture2dArray *textureArray) :
     PlatformTextureArray(textureArray)
 {
+    // NOTE: Only the slices with data are uploaded. The pixel source
+    // is still read from the bound unpack buffer, which has no named
+    // equivalent.
+    if (IsDirectStateAccessSupported())
+    {
+        glTextureStorage3D(mTextureArrayObj, 1, mFormatInternal,
+                           mDimension[0], mDimension[1], mDimension[2]);
+
+        int textureArraySize = int(mBufferObjList.size());
+        for (int textureIndex = 0; textureIndex < textureArraySize; ++textureIndex)
+        {
+            if (mTextureArrayPtr->GetTextureSlice(textureIndex) == nullptr)
+            {
+                continue;
+            }
+
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, mBufferObjList[textureIndex]);
+            glTextureSubImage3D(mTextureArrayObj, 0, 0, 0, textureIndex,
+                                mDimension[0], mDimension[1], 1,
+                                mFormat, mType, nullptr);
+        }
+
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+        return;
+    }
+
     GLuint textureBindingPrevious = BindTexture(mTextureArrayPtr->mType, mTextureArrayObj);
 
     // Allocate texture storage.
@@ -21,9 +48,14 @@ PlatformTexture2dArray::PlatformTexture2dArray(const Texture2dArray *textureArra
                        mDimension[0], mDimension[1], mDimension[2]);
 
         // Bind each texture slice to PBO.
-        int textureArraySize = int(mDimension[2]);
+        int textureArraySize = int(mBufferObjList.size());
         for (int textureIndex = 0; textureIndex < textureArraySize; ++textureIndex)
         {
+            if (mTextureArrayPtr->GetTextureSlice(textureIndex) == nullptr)
+            {
+                continue;
+            }
+
             glBindBuffer(GL_PIXEL_UNPACK_BUFFER, mBufferObjList[textureIndex]);
             glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, textureIndex,
                             mDimension[0], mDimension[1], 1,
@@ -42,5 +74,39 @@ PlatformTexture2dArray::~PlatformTexture2dArray()
 {
 }
 
+/************************************************************************/
+/* Public Members                                                       */
+/************************************************************************/
+void
+PlatformTexture2dArray::UpdateSlice(int textureIndex)
+{
+    auto texture = mTextureArrayPtr->GetTextureSlice(textureIndex);
+    FALCON_ENGINE_CHECK_NULLPTR(texture);
+
+    if (IsDirectStateAccessSupported())
+    {
+        glNamedBufferData(mBufferObjList[textureIndex], texture->mDataSize, texture->mData, mUsage);
+
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, mBufferObjList[textureIndex]);
+        glTextureSubImage3D(mTextureArrayObj, 0, 0, 0, textureIndex,
+                            mDimension[0], mDimension[1], 1,
+                            mFormat, mType, nullptr);
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+        return;
+    }
+
+    GLuint textureBindingPrevious = BindTexture(mTextureArrayPtr->mType, mTextureArrayObj);
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, mBufferObjList[textureIndex]);
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, texture->mDataSize, texture->mData, mUsage);
+    glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, textureIndex,
+                    mDimension[0], mDimension[1], 1,
+                    mFormat, mType, nullptr);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    BindTexture(mTextureArrayPtr->mType, textureBindingPrevious);
+}
+
 }
 
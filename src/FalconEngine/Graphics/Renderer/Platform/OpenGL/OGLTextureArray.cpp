@@ -25,14 +25,49 @@ PlatformTextureArray::PlatformTextureArray(const TextureArray *textureArray) :
     // Initialize dimension list.
     mDimension = mTextureArrayPtr->mDimension;
 
+    // NOTE: Texture array without slice is only allocated storage,
+    // which is rendered into instead of uploaded. The slice not set yet keeps
+    // its buffer empty until it is updated.
+    auto textureSliceNum = mTextureArrayPtr->GetTextureSliceNum();
+
     // Initialize buffer object list.
-    mBufferObjList.assign(mDimension[2], 0);
+    mBufferObjList.assign(textureSliceNum, 0);
+
+    if (IsDirectStateAccessSupported())
+    {
+        if (textureSliceNum > 0)
+        {
+            glCreateBuffers(textureSliceNum, mBufferObjList.data());
+        }
+
+        for (int textureIndex = 0; textureIndex < textureSliceNum; ++textureIndex)
+        {
+            auto texture = mTextureArrayPtr->GetTextureSlice(textureIndex);
+            if (texture == nullptr)
+            {
+                continue;
+            }
+
+            glNamedBufferData(mBufferObjList[textureIndex], texture->mDataSize, texture->mData, mUsage);
+        }
+
+        glCreateTextures(OpenGLTextureTarget[int(mTextureArrayPtr->mType)], 1, &mTextureArrayObj);
+        return;
+    }
 
     // Allocate and setup buffer and dimension.
-    glGenBuffers(mDimension[2], mBufferObjList.data());
-    for (int textureIndex = 0; textureIndex < mDimension[2]; ++textureIndex)
+    if (textureSliceNum > 0)
+    {
+        glGenBuffers(textureSliceNum, mBufferObjList.data());
+    }
+
+    for (int textureIndex = 0; textureIndex < textureSliceNum; ++textureIndex)
     {
         auto texture = mTextureArrayPtr->GetTextureSlice(textureIndex);
+        if (texture == nullptr)
+        {
+            continue;
+        }
 
         glBindBuffer(GL_PIXEL_UNPACK_BUFFER, mBufferObjList[textureIndex]);
         glBufferData(GL_PIXEL_UNPACK_BUFFER, texture->mDataSize, nullptr, mUsage);
@@ -40,9 +75,14 @@ PlatformTextureArray::PlatformTextureArray(const TextureArray *textureArray) :
     }
 
     // Fill in the texture data
-    for (int textureIndex = 0; textureIndex < mDimension[2]; ++textureIndex)
+    for (int textureIndex = 0; textureIndex < textureSliceNum; ++textureIndex)
     {
         auto texture = mTextureArrayPtr->GetTextureSlice(textureIndex);
+        if (texture == nullptr)
+        {
+            continue;
+        }
+
         auto textureData = Map(textureIndex,
                                BufferAccessMode::WriteBuffer,
                                BufferFlushMode::Automatic,
@@ -63,13 +103,23 @@ PlatformTextureArray::PlatformTextureArray(const TextureArray *textureArray) :
 
 PlatformTextureArray::~PlatformTextureArray()
 {
-    glDeleteBuffers(mDimension[2], mBufferObjList.data());
+    if (!mBufferObjList.empty())
+    {
+        glDeleteBuffers(GLsizei(mBufferObjList.size()), mBufferObjList.data());
+    }
+
     glDeleteTextures(1, &mTextureArrayObj);
 }
 
 /************************************************************************/
 /* Public Members                                                       */
 /************************************************************************/
+GLuint
+PlatformTextureArray::GetTextureObj() const
+{
+    return mTextureArrayObj;
+}
+
 void
 PlatformTextureArray::Enable(int textureUnit)
 {
@@ -93,11 +143,17 @@ PlatformTextureArray::Map(int                       textureIndex,
                           int64_t                   size)
 {
     // NEW(Wuxiang): Add mipmap support.
+    auto accessMark = OpenGLBufferAccessModeMark[int(access)] |
+                      OpenGLBufferFlushModeMark[int(flush)] |
+                      OpenGLBufferSynchronizationModeMark[int(synchronization)];
+
+    if (IsDirectStateAccessSupported())
+    {
+        return glMapNamedBufferRange(mBufferObjList[textureIndex], offset, size, accessMark);
+    }
+
     glBindBuffer(GL_PIXEL_UNPACK_BUFFER, mBufferObjList[textureIndex]);
-    void *data = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, offset, size,
-                                  OpenGLBufferAccessModeMark[int(access)] |
-                                  OpenGLBufferFlushModeMark[int(flush)] |
-                                  OpenGLBufferSynchronizationModeMark[int(synchronization)]);
+    void *data = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, offset, size, accessMark);
     glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
 
     return data;
@@ -107,6 +163,12 @@ void
 PlatformTextureArray::Unmap(int textureIndex)
 {
     // NEW(Wuxiang): Add mipmap support.
+    if (IsDirectStateAccessSupported())
+    {
+        glUnmapNamedBuffer(mBufferObjList[textureIndex]);
+        return;
+    }
+
     glBindBuffer(GL_PIXEL_UNPACK_BUFFER, mBufferObjList[textureIndex]);
     glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
     glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
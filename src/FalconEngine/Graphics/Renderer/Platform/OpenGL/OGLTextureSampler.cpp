@@ -10,7 +10,7 @@ namespace FalconEngine
 PlatformSampler::PlatformSampler(const Sampler *sampler) :
     mSamplerPrevious(0)
 {
-    // NEW(Wuxiang): Add support for GL_TEXTURE_BORDER_COLOR, GL_TEXTURE_MIN_LOD, GL_TEXTURE_MAX_LOD, GL_TEXTURE_LOD_BIAS, GL_TEXTURE_COMPARE_MODE, GL_TEXTURE_COMPARE_FUNC
+    // NEW(Wuxiang): Add support for GL_TEXTURE_MIN_LOD, GL_TEXTURE_MAX_LOD, GL_TEXTURE_LOD_BIAS
     glGenSamplers(1, &mSampler);
     glSamplerParameteri(mSampler, GL_TEXTURE_MIN_FILTER,
                         OpenGLSamplerFilterMode[int(sampler->mMinificationFilter)]);
@@ -26,6 +26,16 @@ PlatformSampler::PlatformSampler(const Sampler *sampler) :
 
     glSamplerParameteri(mSampler, GL_TEXTURE_WRAP_R,
                         OpenGLSamplerWrapMode[int(sampler->mWrapR)]);
+
+    if (sampler->mCompareEnabled)
+    {
+        glSamplerParameteri(mSampler, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+        glSamplerParameteri(mSampler, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
+
+        // NOTE: Lookup outside of the depth texture is not occluded.
+        const GLfloat borderColor[] = { 1.0f, 1.0f, 1.0f, 1.0f };
+        glSamplerParameterfv(mSampler, GL_TEXTURE_BORDER_COLOR, borderColor);
+    }
 }
 
 PlatformSampler::~PlatformSampler()
@@ -36,6 +46,12 @@ PlatformSampler::~PlatformSampler()
 /************************************************************************/
 /* Public Members                                                       */
 /************************************************************************/
+GLuint
+PlatformSampler::GetSamplerObj() const
+{
+    return mSampler;
+}
+
 void
 PlatformSampler::Enable(int textureUnit)
 {
@@ -1,4 +1,5 @@
 #include <FalconEngine/Graphics/Renderer/Platform/OpenGL/OGLVertexFormat.h>
+#include <FalconEngine/Graphics/Renderer/Platform/OpenGL/OGLUtility.h>
 #include <FalconEngine/Graphics/Renderer/Resource/VertexFormat.h>
 
 namespace FalconEngine
@@ -40,6 +41,31 @@ PlatformVertexFormat::Disable()
 void
 PlatformVertexFormat::Create()
 {
+    if (IsDirectStateAccessSupported())
+    {
+        glCreateVertexArrays(1, &mVertexArrayObj);
+
+        for (auto& vertexAttrib : mVertexFormatPtr->mVertexAttributeList)
+        {
+            glEnableVertexArrayAttrib(mVertexArrayObj, vertexAttrib.mLocation);
+            glVertexArrayAttribBinding(mVertexArrayObj, vertexAttrib.mLocation,
+                                       vertexAttrib.mBindingIndex);
+            glVertexArrayAttribFormat(mVertexArrayObj, vertexAttrib.mLocation,
+                                      vertexAttrib.mChannel,
+                                      OpenGLShaderAttributeType[int(vertexAttrib.mType)],
+                                      vertexAttrib.mNormalized,
+                                      vertexAttrib.mStride);
+
+            if (vertexAttrib.mDivision != 0)
+            {
+                glVertexArrayBindingDivisor(mVertexArrayObj, vertexAttrib.mBindingIndex,
+                                            vertexAttrib.mDivision);
+            }
+        }
+
+        return;
+    }
+
     // NOTE(Wuxiang): glCreateVertexArrays only available in OGL 4.5.
     glGenVertexArrays(1, &mVertexArrayObj);
     glBindVertexArray(mVertexArrayObj);
@@ -23,6 +23,7 @@ using namespace std;
 #include <FalconEngine/Graphics/Renderer/State/StencilTestState.h>
 #include <FalconEngine/Graphics/Renderer/State/WireframeState.h>
 #include <FalconEngine/Graphics/Renderer/Resource/IndexBuffer.h>
+#include <FalconEngine/Graphics/Renderer/Resource/IndirectBuffer.h>
 #include <FalconEngine/Graphics/Renderer/Resource/ShaderBuffer.h>
 #include <FalconEngine/Graphics/Renderer/Resource/VertexBuffer.h>
 #include <FalconEngine/Graphics/Renderer/Resource/VertexFormat.h>
@@ -35,6 +36,7 @@ using namespace std;
 
 #if defined(FALCON_ENGINE_API_OPENGL)
 #include <FalconEngine/Graphics/Renderer/Platform/OpenGL/OGLIndexBuffer.h>
+#include <FalconEngine/Graphics/Renderer/Platform/OpenGL/OGLIndirectBuffer.h>
 #include <FalconEngine/Graphics/Renderer/Platform/OpenGL/OGLVertexBuffer.h>
 #include <FalconEngine/Graphics/Renderer/Platform/OpenGL/OGLVertexFormat.h>
 #include <FalconEngine/Graphics/Renderer/Platform/OpenGL/OGLTexture1d.h>
@@ -65,7 +67,9 @@ PlatformRendererDataDeleter::operator()(PlatformRendererData *rendererData)
 /* Constructors and Destructor                                          */
 /************************************************************************/
 Renderer::Renderer() :
+    mShaderBufferPrevious(nullptr),
     mIndexBufferPrevious(nullptr),
+    mIndirectBufferPrevious(nullptr),
     mVertexGroupPrevious(nullptr),
     mVertexFormatPrevious(nullptr),
     mPassPrevious(nullptr),
@@ -129,6 +133,15 @@ Renderer::DestroyData()
 {
 }
 
+/************************************************************************/
+/* Context Management                                                   */
+/************************************************************************/
+void
+Renderer::SetContextCurrent(bool current)
+{
+    SetContextCurrentPlatform(current);
+}
+
 /************************************************************************/
 /* Framebuffer Management                                               */
 /************************************************************************/
@@ -156,6 +169,47 @@ Renderer::ClearFrameBuffer(const Vector4f& color, float depth, unsigned stencil)
     ClearFrameBufferPlatform(color, depth, stencil);
 }
 
+void
+Renderer::CopyDepthBuffer(const ShaderBuffer *buffer)
+{
+    FALCON_ENGINE_CHECK_NULLPTR(buffer);
+
+    auto x = int(mViewport.mLeft);
+    auto y = int(mViewport.mBottom);
+    auto width = int(mViewport.GetWidth());
+    auto height = int(mViewport.GetHeight());
+    if (size_t(width) * size_t(height) * sizeof(float) > buffer->GetCapacitySize())
+    {
+        FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("Depth buffer is larger than the buffer capacity.");
+    }
+
+    Bind(buffer);
+    CopyDepthBufferPlatform(mShaderBufferTable.at(buffer), x, y, width, height);
+}
+
+void
+Renderer::SetRenderTarget(const Texture2dArray *depthTextureArray, int layer)
+{
+    if (depthTextureArray == nullptr)
+    {
+        SetRenderTargetPlatform(nullptr, 0);
+        return;
+    }
+
+    if (depthTextureArray->mFormat != TextureFormat::D32F)
+    {
+        FALCON_ENGINE_THROW_SUPPORT_EXCEPTION();
+    }
+
+    if (layer < 0 || layer >= depthTextureArray->mDimension[2])
+    {
+        FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("Render target layer is out of range.");
+    }
+
+    Bind(depthTextureArray);
+    SetRenderTargetPlatform(mTexture2dArrayTable.at(depthTextureArray), layer);
+}
+
 /************************************************************************/
 /* Viewport Management                                                  */
 /************************************************************************/
@@ -228,6 +282,9 @@ Renderer::Bind(const Buffer *buffer)
     case BufferType::ShaderBuffer:
         Bind(reinterpret_cast<const ShaderBuffer *>(buffer));
         break;
+    case BufferType::IndirectBuffer:
+        Bind(reinterpret_cast<const IndirectBuffer *>(buffer));
+        break;
     case BufferType::UniformBuffer:
         FALCON_ENGINE_THROW_SUPPORT_EXCEPTION();
     default:
@@ -251,6 +308,9 @@ Renderer::Unbind(const Buffer *buffer)
     case BufferType::ShaderBuffer:
         Unbind(reinterpret_cast<const ShaderBuffer *>(buffer));
         break;
+    case BufferType::IndirectBuffer:
+        Unbind(reinterpret_cast<const IndirectBuffer *>(buffer));
+        break;
     case BufferType::UniformBuffer:
         FALCON_ENGINE_THROW_SUPPORT_EXCEPTION();
     default:
@@ -274,6 +334,9 @@ Renderer::Enable(const Buffer *buffer)
     case BufferType::ShaderBuffer:
         Enable(reinterpret_cast<const ShaderBuffer *>(buffer));
         break;
+    case BufferType::IndirectBuffer:
+        Enable(reinterpret_cast<const IndirectBuffer *>(buffer));
+        break;
     case BufferType::UniformBuffer:
         FALCON_ENGINE_THROW_SUPPORT_EXCEPTION();
     default:
@@ -297,6 +360,9 @@ Renderer::Disable(const Buffer *buffer)
     case BufferType::ShaderBuffer:
         Disable(reinterpret_cast<const ShaderBuffer *>(buffer));
         break;
+    case BufferType::IndirectBuffer:
+        Disable(reinterpret_cast<const IndirectBuffer *>(buffer));
+        break;
     case BufferType::UniformBuffer:
         FALCON_ENGINE_THROW_SUPPORT_EXCEPTION();
     default:
@@ -317,6 +383,8 @@ Renderer::Map(const Buffer *buffer, BufferAccessMode access, BufferFlushMode flu
         return Map(reinterpret_cast<const IndexBuffer *>(buffer), access, flush, synchronization, offset, size);
     case BufferType::ShaderBuffer:
         return Map(reinterpret_cast<const ShaderBuffer *>(buffer), access, flush, synchronization, offset, size);
+    case BufferType::IndirectBuffer:
+        return Map(reinterpret_cast<const IndirectBuffer *>(buffer), access, flush, synchronization, offset, size);
     case BufferType::UniformBuffer:
         FALCON_ENGINE_THROW_SUPPORT_EXCEPTION();
     default:
@@ -340,6 +408,9 @@ Renderer::Unmap(const Buffer *buffer)
     case BufferType::ShaderBuffer:
         Unmap(reinterpret_cast<const ShaderBuffer *>(buffer));
         break;
+    case BufferType::IndirectBuffer:
+        Unmap(reinterpret_cast<const IndirectBuffer *>(buffer));
+        break;
     case BufferType::UniformBuffer:
         FALCON_ENGINE_THROW_SUPPORT_EXCEPTION();
     default:
@@ -363,6 +434,9 @@ Renderer::Flush(const Buffer *buffer, int64_t offset, int64_t size)
     case BufferType::ShaderBuffer:
         Flush(reinterpret_cast<const ShaderBuffer *>(buffer), offset, size);
         break;
+    case BufferType::IndirectBuffer:
+        Flush(reinterpret_cast<const IndirectBuffer *>(buffer), offset, size);
+        break;
     case BufferType::UniformBuffer:
         FALCON_ENGINE_THROW_SUPPORT_EXCEPTION();
     default:
@@ -386,6 +460,49 @@ Renderer::Update(const Buffer             *buffer,
     Unmap(buffer);
 }
 
+void
+Renderer::Copy(const Buffer *sourceBuffer,
+               int64_t       sourceOffset,
+               const Buffer *destinationBuffer,
+               int64_t       destinationOffset,
+               int64_t       size)
+{
+    FALCON_ENGINE_CHECK_NULLPTR(sourceBuffer);
+    FALCON_ENGINE_CHECK_NULLPTR(destinationBuffer);
+
+    if (size_t(sourceOffset + size) > sourceBuffer->GetCapacitySize()
+            || size_t(destinationOffset + size) > destinationBuffer->GetCapacitySize())
+    {
+        FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("Copy range is out of the buffer capacity.");
+    }
+
+    auto sourceBufferPlatform = GetPlatformBuffer(sourceBuffer);
+    auto destinationBufferPlatform = GetPlatformBuffer(destinationBuffer);
+    sourceBufferPlatform->Copy(destinationBufferPlatform, sourceOffset, destinationOffset, size);
+}
+
+PlatformBuffer *
+Renderer::GetPlatformBuffer(const Buffer *buffer)
+{
+    // NOTE: Binding creates the platform buffer when the buffer is
+    // not used before.
+    Bind(buffer);
+
+    switch (buffer->GetType())
+    {
+    case BufferType::VertexBuffer:
+        return mVertexBufferTable.at(reinterpret_cast<const VertexBuffer *>(buffer));
+    case BufferType::IndexBuffer:
+        return mIndexBufferTable.at(reinterpret_cast<const IndexBuffer *>(buffer));
+    case BufferType::ShaderBuffer:
+        return mShaderBufferTable.at(reinterpret_cast<const ShaderBuffer *>(buffer));
+    case BufferType::IndirectBuffer:
+        return mIndirectBufferTable.at(reinterpret_cast<const IndirectBuffer *>(buffer));
+    default:
+        FALCON_ENGINE_THROW_ASSERTION_EXCEPTION();
+    }
+}
+
 /************************************************************************/
 /* Shader Buffer Management                                             */
 /************************************************************************/
@@ -408,6 +525,28 @@ Renderer::Enable(const ShaderBuffer *shaderBuffer)
     FALCON_ENGINE_RENDERER_ENABLE_IMPLEMENT(shaderBuffer, mShaderBufferTable, PlatformShaderBuffer);
 }
 
+void
+Renderer::Enable(const ShaderBuffer *shaderBuffer, unsigned int bindingIndex)
+{
+    FALCON_ENGINE_CHECK_NULLPTR(shaderBuffer);
+
+    // NOTE: Binding on indexed binding point is not lazy, because
+    // different buffer could be bound on different binding point.
+    auto iter = mShaderBufferTable.find(shaderBuffer);
+    PlatformShaderBuffer *shaderBufferPlatform;
+    if (iter != mShaderBufferTable.end())
+    {
+        shaderBufferPlatform = iter->second;
+    }
+    else
+    {
+        shaderBufferPlatform = New(MemoryTag::Renderer) PlatformShaderBuffer(shaderBuffer);
+        mShaderBufferTable[shaderBuffer] = shaderBufferPlatform;
+    }
+
+    shaderBufferPlatform->Enable(bindingIndex);
+}
+
 void
 Renderer::Disable(const ShaderBuffer *shaderBuffer)
 {
@@ -483,6 +622,68 @@ Renderer::Flush(const IndexBuffer *indexBuffer, int64_t offset, int64_t size)
     FALCON_ENGINE_RENDERER_FLUSH_IMPLEMENT(indexBuffer, mIndexBufferTable);
 }
 
+/************************************************************************/
+/* Indirect Buffer Management                                           */
+/************************************************************************/
+void
+Renderer::Bind(const IndirectBuffer *indirectBuffer)
+{
+    FALCON_ENGINE_RENDERER_BIND_IMPLEMENT(indirectBuffer, mIndirectBufferTable, PlatformIndirectBuffer);
+}
+
+void
+Renderer::Unbind(const IndirectBuffer *indirectBuffer)
+{
+    FALCON_ENGINE_RENDERER_UNBIND_IMPLEMENT(indirectBuffer, mIndirectBufferTable);
+}
+
+void
+Renderer::Enable(const IndirectBuffer *indirectBuffer)
+{
+    FALCON_ENGINE_RENDERER_ENABLE_LAZY(indirectBuffer, mIndirectBufferPrevious);
+    FALCON_ENGINE_RENDERER_ENABLE_IMPLEMENT(indirectBuffer, mIndirectBufferTable, PlatformIndirectBuffer);
+}
+
+void
+Renderer::Enable(const IndirectBuffer *indirectBuffer, unsigned int bindingIndex)
+{
+    FALCON_ENGINE_CHECK_NULLPTR(indirectBuffer);
+
+    // NOTE: Binding on indexed binding point is not lazy, see
+    // Enable(const ShaderBuffer *, unsigned int).
+    Bind(indirectBuffer);
+    mIndirectBufferTable.at(indirectBuffer)->Enable(bindingIndex);
+}
+
+void
+Renderer::Disable(const IndirectBuffer *indirectBuffer)
+{
+    FALCON_ENGINE_RENDERER_DISABLE_IMPLEMENT(indirectBuffer, mIndirectBufferTable);
+}
+
+void *
+Renderer::Map(const IndirectBuffer     *indirectBuffer,
+              BufferAccessMode          access,
+              BufferFlushMode           flush,
+              BufferSynchronizationMode synchronization,
+              int64_t                   offset,
+              int64_t                   size)
+{
+    FALCON_ENGINE_RENDERER_MAP_IMPLEMENT(indirectBuffer, mIndirectBufferTable, PlatformIndirectBuffer);
+}
+
+void
+Renderer::Unmap(const IndirectBuffer *indirectBuffer)
+{
+    FALCON_ENGINE_RENDERER_UNMAP_IMPLEMENT(indirectBuffer, mIndirectBufferTable);
+}
+
+void
+Renderer::Flush(const IndirectBuffer *indirectBuffer, int64_t offset, int64_t size)
+{
+    FALCON_ENGINE_RENDERER_FLUSH_IMPLEMENT(indirectBuffer, mIndirectBufferTable);
+}
+
 /************************************************************************/
 /* Vertex Buffer Management                                             */
 /************************************************************************/
@@ -514,7 +715,7 @@ Renderer::Enable(const VertexBuffer *vertexBuffer,
     }
     else
     {
-        vertexBufferPlatform = new PlatformVertexBuffer(vertexBuffer);
+        vertexBufferPlatform = New(MemoryTag::Renderer) PlatformVertexBuffer(vertexBuffer);
         mVertexBufferTable[vertexBuffer] = vertexBufferPlatform;
     }
 
@@ -873,6 +1074,21 @@ Renderer::Unmap(const Texture2dArray *textureArray,
     FALCON_ENGINE_RENDERER_TEXTURE_ARRAY_UNMAP_IMPLEMENT(textureArray, mTexture2dArrayTable);
 }
 
+void
+Renderer::Update(const Texture2dArray *textureArray,
+                 int                   textureIndex)
+{
+    FALCON_ENGINE_CHECK_NULLPTR(textureArray);
+
+    // NOTE: The texture array not bound yet uploads every slice set
+    // when it is bound.
+    auto iter = mTexture2dArrayTable.find(textureArray);
+    if (iter != mTexture2dArrayTable.end())
+    {
+        iter->second->UpdateSlice(textureIndex);
+    }
+}
+
 /************************************************************************/
 /* Texture 3D Management                                                */
 /************************************************************************/
@@ -928,6 +1144,32 @@ Renderer::Disable(int textureUnit, const Sampler *sampler)
     FALCON_ENGINE_RENDERER_TEXTURE_DISABLE_IMPLEMENT(sampler, mSamplerTable);
 }
 
+/************************************************************************/
+/* Texture Handle Management                                            */
+/************************************************************************/
+bool
+Renderer::IsTextureHandleSupported() const
+{
+    return IsTextureHandleSupportedPlatform();
+}
+
+uint64_t
+Renderer::GetTextureHandle(const Texture *texture, const Sampler *sampler)
+{
+    FALCON_ENGINE_CHECK_NULLPTR(texture);
+    FALCON_ENGINE_CHECK_NULLPTR(sampler);
+
+    if (!IsTextureHandleSupported())
+    {
+        return 0;
+    }
+
+    Bind(texture);
+    Bind(sampler);
+
+    return GetTextureHandlePlatform(texture, mSamplerTable.at(sampler));
+}
+
 /************************************************************************/
 /* Shader Management                                                   */
 /************************************************************************/
@@ -956,6 +1198,21 @@ Renderer::Disable(const Shader *shader)
     FALCON_ENGINE_RENDERER_DISABLE_IMPLEMENT(shader, mShaderTable);
 }
 
+void
+Renderer::Dispatch(Shader *shader, int groupNumX, int groupNumY, int groupNumZ)
+{
+    FALCON_ENGINE_CHECK_NULLPTR(shader);
+
+    if (groupNumX < 1 || groupNumY < 1 || groupNumZ < 1)
+    {
+        return;
+    }
+
+    Enable(shader);
+
+    DispatchPlatform(groupNumX, groupNumY, groupNumZ);
+}
+
 /************************************************************************/
 /* Pass Management                                                      */
 /************************************************************************/
@@ -1021,12 +1278,20 @@ Renderer::Update(const VisualEffectInstancePass *pass, ShaderUniform *uniform, c
     // NOTE(Wuxiang): Note that uniform comes from the instance pass. This
     // means there would be user modification.
 
+    Update(pass->GetShader(), uniform, camera, visual);
+}
+
+void
+Renderer::Update(const Shader *shader, ShaderUniform *uniform, const Camera *camera, const Visual *visual)
+{
+    FALCON_ENGINE_CHECK_NULLPTR(shader);
+    FALCON_ENGINE_CHECK_NULLPTR(uniform);
+
     // Initialize uniform state and location.
     if (!uniform->mInitialized)
     {
         // NOTE(Wuxiang): This is necessary because the uniform in instance
         // pass is different entity from uniform in shader.
-        auto shader = pass->GetShader();
         uniform->mEnabled = shader->IsUniformEnabled(uniform->mName);
         uniform->mLocation = shader->GetUniformLocation(uniform->mName);
         uniform->mInitialized = true;
@@ -1105,7 +1370,7 @@ Renderer::Draw(
     Enable(vertexGroup);
 
     // Fetch primitive in Visual.
-    auto primitive = visual->GetMesh()->GetPrimitive();
+    auto primitive = visual->GetPrimitive();
 
     auto indexBuffer = primitive->GetIndexBuffer();
     if (indexBuffer)
@@ -1132,4 +1397,63 @@ Renderer::Draw(
     }
 }
 
+void
+Renderer::DrawIndirect(const IndirectBuffer *indirectBuffer,
+                       int                   commandBegin,
+                       int                   commandNum,
+                       PrimitiveType         primitiveType,
+                       IndexType             indexType)
+{
+    FALCON_ENGINE_CHECK_NULLPTR(indirectBuffer);
+
+    if (commandNum < 1)
+    {
+        return;
+    }
+
+    if ((commandBegin + commandNum) * indirectBuffer->GetElementSize() > indirectBuffer->GetCapacitySize())
+    {
+        FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("Indirect command range is out of the buffer capacity.");
+    }
+
+    Enable(indirectBuffer);
+
+    DrawPrimitiveIndirectPlatform(primitiveType, indexType, commandBegin, commandNum);
+}
+
+void
+Renderer::DrawIndirect(const IndirectBuffer *indirectBuffer,
+                       int                   commandBegin,
+                       int                   commandNumMax,
+                       const ShaderBuffer   *countBuffer,
+                       int64_t               countOffset,
+                       PrimitiveType         primitiveType,
+                       IndexType             indexType)
+{
+    FALCON_ENGINE_CHECK_NULLPTR(indirectBuffer);
+    FALCON_ENGINE_CHECK_NULLPTR(countBuffer);
+
+    if (commandNumMax < 1)
+    {
+        return;
+    }
+
+    if ((commandBegin + commandNumMax) * indirectBuffer->GetElementSize() > indirectBuffer->GetCapacitySize())
+    {
+        FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("Indirect command range is out of the buffer capacity.");
+    }
+
+    if (countOffset < 0 || countOffset % sizeof(unsigned int) != 0
+            || size_t(countOffset) + sizeof(unsigned int) > countBuffer->GetCapacitySize())
+    {
+        FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("Indirect command count is out of the buffer capacity.");
+    }
+
+    Enable(indirectBuffer);
+
+    Bind(countBuffer);
+    DrawPrimitiveIndirectCountPlatform(primitiveType, indexType, commandBegin, commandNumMax,
+                                       mShaderBufferTable.at(countBuffer), countOffset);
+}
+
 }
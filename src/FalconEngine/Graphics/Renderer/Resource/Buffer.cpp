@@ -13,6 +13,7 @@ Buffer::Buffer(int elementNum,
                BufferStorageMode storageMode,
                BufferType type,
                BufferUsage usage) :
+    mDataMemoryTag(MemoryTagScope::GetCurrent()),
     mDataOffset(0),
     mElementSize(elementSize),
     mStorageMode(storageMode),
@@ -36,7 +37,7 @@ Buffer::Buffer(int elementNum,
     // NOTE(Wuxiang): Only allocate memory when the buffer storage resides on RAM.
     if (mStorageMode == BufferStorageMode::Host)
     {
-        mData = new unsigned char[mDataSize];
+        mData = New(mDataMemoryTag) unsigned char[mDataSize];
     }
     else
     {
@@ -48,7 +49,7 @@ Buffer::~Buffer()
 {
     FALCON_ENGINE_RENDERER_UNBIND(this);
 
-    delete [] mData;
+    Delete(mDataMemoryTag, mData);
 }
 
 /************************************************************************/
@@ -0,0 +1,18 @@
+#include <FalconEngine/Graphics/Renderer/Resource/IndirectBuffer.h>
+
+namespace FalconEngine
+{
+
+/************************************************************************/
+/* Constructors and Destructor                                          */
+/************************************************************************/
+IndirectBuffer::IndirectBuffer(int commandNum, BufferStorageMode storageMode, BufferUsage usage) :
+    Buffer(commandNum, sizeof(DrawElementsIndirectCommand), storageMode, BufferType::IndirectBuffer, usage)
+{
+}
+
+IndirectBuffer::~IndirectBuffer()
+{
+}
+
+}
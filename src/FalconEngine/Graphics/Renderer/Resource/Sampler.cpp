@@ -13,7 +13,8 @@ Sampler::Sampler() :
     mMagnificationFilter(SamplerMagnificationFilter::Linear),
     mWrapS(SamplerWrapMode::Repeat),
     mWrapT(SamplerWrapMode::Repeat),
-    mWrapR(SamplerWrapMode::Repeat)
+    mWrapR(SamplerWrapMode::Repeat),
+    mCompareEnabled(false)
 {
 }
 
@@ -26,7 +27,8 @@ Sampler::Sampler(SamplerMinificationFilter minificationFilter,
     mMagnificationFilter(magnificationFilter),
     mWrapS(wrapS),
     mWrapT(wrapT),
-    mWrapR(wrapR)
+    mWrapR(wrapR),
+    mCompareEnabled(false)
 {
 }
 
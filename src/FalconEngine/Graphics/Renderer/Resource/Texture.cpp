@@ -18,6 +18,7 @@ Texture::Texture() :
     mMipmapLevel(0),
     mType(TextureType::None),
     mData(nullptr),
+    mDataMemoryTag(MemoryTag::General),
     mDataSize(0),
     mStorageMode(BufferStorageMode::Host),
     mUsage(BufferUsage::None)
@@ -39,6 +40,7 @@ Texture::Texture(AssetSource        assetSource,
     mFormat(format),
     mMipmapLevel(mipmapLevel),
     mType(type),
+    mDataMemoryTag(MemoryTagScope::GetCurrent()),
     mStorageMode(storageMode),
     mUsage(usage)
 {
@@ -56,7 +58,7 @@ Texture::Texture(AssetSource        assetSource,
     if (mStorageMode == BufferStorageMode::Host)
     {
         mDataSize = size_t(mDimension[0]) * size_t(mDimension[1]) * size_t(mDimension[2]) * TexelSize[int(mFormat)];
-        mData = new unsigned char[mDataSize];
+        mData = New(mDataMemoryTag) unsigned char[mDataSize];
     }
     else
     {
@@ -69,7 +71,7 @@ Texture::~Texture()
 {
     FALCON_ENGINE_RENDERER_UNBIND(this);
 
-    delete[] mData;
+    Delete(mDataMemoryTag, mData);
 }
 
 }
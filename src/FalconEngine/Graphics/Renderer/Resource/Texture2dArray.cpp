@@ -36,10 +36,34 @@ Texture2dArray::GetTextureSlice(int index) const
     return mTextureList.at(index).get();
 }
 
+int
+Texture2dArray::GetTextureSliceNum() const
+{
+    return int(mTextureList.size());
+}
+
 void
 Texture2dArray::PushTextureSlice(std::shared_ptr<Texture2d> texture)
 {
     mTextureList.push_back(texture);
 }
 
+void
+Texture2dArray::SetTextureSlice(int index, std::shared_ptr<Texture2d> texture)
+{
+    FALCON_ENGINE_CHECK_NULLPTR(texture);
+
+    if (index < 0 || index >= mDimension[2])
+    {
+        FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("Texture slice index is out of range.");
+    }
+
+    if (int(mTextureList.size()) < mDimension[2])
+    {
+        mTextureList.resize(mDimension[2]);
+    }
+
+    mTextureList[index] = texture;
+}
+
 }
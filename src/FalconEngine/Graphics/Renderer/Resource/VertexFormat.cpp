@@ -73,11 +73,14 @@ VertexFormat::PushVertexAttribute(
     }
 
     // Check the vertex attribute has been pushed in order.
-    if (attributeLocation != int(mVertexAttributeList.size()))
+    if (!mVertexAttributeList.empty()
+            && attributeLocation <= int(mVertexAttributeList.back().mLocation))
     {
         // NOTE(Wuxiang): It is not supported for out of order attribute registration.
         // The reason is that in order to correctly count offset for individual
         // vertex attribute, you have to input vertex index in the order of layout location.
+        // Gap between locations is allowed so that attribute reserved by the
+        // engine, like draw index, could use fixed location.
         FALCON_ENGINE_THROW_SUPPORT_EXCEPTION();
     }
 
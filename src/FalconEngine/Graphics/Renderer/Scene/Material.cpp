@@ -1,15 +1,75 @@
 #include <FalconEngine/Graphics/Renderer/Scene/Material.h>
 
+#include <atomic>
+
+using namespace std;
+
 namespace FalconEngine
 {
 
 FALCON_ENGINE_RTTI_IMPLEMENT(Material, Object);
 
+/************************************************************************/
+/* Static Members                                                       */
+/************************************************************************/
+static atomic<uint64_t> sMaterialIdNext(1);
+
 /************************************************************************/
 /* Constructors and Destructor                                          */
 /************************************************************************/
-Material::Material()
+Material::Material() :
+    mId(sMaterialIdNext++)
+{
+}
+
+Material::Material(const Material& rhs) :
+    Object(rhs),
+    mId(sMaterialIdNext++)
+{
+    *this = rhs;
+}
+
+Material&
+Material::operator=(const Material& rhs)
+{
+    // NOTE: The id is not copied, so that each material is cached on its own
+    // by the renderer.
+    mAmbientColor = rhs.mAmbientColor;
+    mDiffuseColor = rhs.mDiffuseColor;
+    mEmissiveColor = rhs.mEmissiveColor;
+    mSpecularColor = rhs.mSpecularColor;
+    mShininess = rhs.mShininess;
+
+    mAmbientTexture = rhs.mAmbientTexture;
+    mDiffuseTexture = rhs.mDiffuseTexture;
+    mEmissiveTexture = rhs.mEmissiveTexture;
+    mSpecularTexture = rhs.mSpecularTexture;
+    mShininessTexture = rhs.mShininessTexture;
+
+    mAmbientSampler = rhs.mAmbientSampler;
+    mDiffuseSampler = rhs.mDiffuseSampler;
+    mEmissiveSampler = rhs.mEmissiveSampler;
+    mSpecularSampler = rhs.mSpecularSampler;
+    mShininessSampler = rhs.mShininessSampler;
+
+    mTextureArray = rhs.mTextureArray;
+    mTextureArraySampler = rhs.mTextureArraySampler;
+    mAmbientTextureLayer = rhs.mAmbientTextureLayer;
+    mDiffuseTextureLayer = rhs.mDiffuseTextureLayer;
+    mEmissiveTextureLayer = rhs.mEmissiveTextureLayer;
+    mSpecularTextureLayer = rhs.mSpecularTextureLayer;
+    mShininessTextureLayer = rhs.mShininessTextureLayer;
+
+    return *this;
+}
+
+/************************************************************************/
+/* Public Members                                                       */
+/************************************************************************/
+uint64_t
+Material::GetId() const
 {
+    return mId;
 }
 
 }
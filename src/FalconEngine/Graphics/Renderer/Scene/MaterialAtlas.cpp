@@ -0,0 +1,247 @@
+#include <FalconEngine/Graphics/Renderer/Scene/MaterialAtlas.h>
+
+#include <algorithm>
+#include <array>
+#include <map>
+#include <tuple>
+
+#include <FalconEngine/Content/AssetManager.h>
+#include <FalconEngine/Graphics/Renderer/Resource/Sampler.h>
+#include <FalconEngine/Graphics/Renderer/Resource/Texture2d.h>
+#include <FalconEngine/Graphics/Renderer/Resource/Texture2dArray.h>
+#include <FalconEngine/Graphics/Renderer/Scene/Material.h>
+
+using namespace std;
+
+namespace FalconEngine
+{
+
+/************************************************************************/
+/* Constructors and Destructor                                          */
+/************************************************************************/
+MaterialAtlas::MaterialAtlas(int layerNumMax) :
+    mLayerNumMax(layerNumMax)
+{
+    if (layerNumMax < 1)
+    {
+        FALCON_ENGINE_THROW_ASSERTION_EXCEPTION();
+    }
+}
+
+MaterialAtlas::~MaterialAtlas()
+{
+}
+
+/************************************************************************/
+/* Public Members                                                       */
+/************************************************************************/
+int
+MaterialAtlas::GetTextureArrayNum() const
+{
+    return int(mTextureArrayList.size());
+}
+
+const Texture2dArray *
+MaterialAtlas::GetTextureArray(int textureArrayIndex) const
+{
+    return mTextureArrayList.at(textureArrayIndex).get();
+}
+
+int
+MaterialAtlas::Pack(const std::vector<Material *>& materialList)
+{
+    // NOTE: Same order as the layer members of material.
+    static const int MaterialTextureNum = 5;
+    using MaterialTextureList = array<const Texture2d *, MaterialTextureNum>;
+    using MaterialLayerList = array<int *, MaterialTextureNum>;
+
+    auto getTextureList = [](const Material * material)
+    {
+        return MaterialTextureList
+        {
+            material->mAmbientTexture,
+            material->mDiffuseTexture,
+            material->mEmissiveTexture,
+            material->mSpecularTexture,
+            material->mShininessTexture,
+        };
+    };
+
+    // Group the materials by texture size, format and sampler.
+    using MaterialGroupKey = tuple<int, int, int, const Sampler *>;
+    map<MaterialGroupKey, vector<Material *>> materialGroupTable;
+    for (auto material : materialList)
+    {
+        FALCON_ENGINE_CHECK_NULLPTR(material);
+
+        if (material->mTextureArray != nullptr)
+        {
+            continue;
+        }
+
+        auto textureList = getTextureList(material);
+        const array<const Sampler *, MaterialTextureNum> samplerList =
+        {
+            material->mAmbientSampler,
+            material->mDiffuseSampler,
+            material->mEmissiveSampler,
+            material->mSpecularSampler,
+            material->mShininessSampler,
+        };
+
+        bool packable = true;
+        const Texture2d *textureFirst = nullptr;
+        const Sampler *samplerFirst = nullptr;
+        for (int textureIndex = 0; textureIndex < MaterialTextureNum && packable; ++textureIndex)
+        {
+            auto texture = textureList[textureIndex];
+            if (texture == nullptr)
+            {
+                continue;
+            }
+
+            if (textureFirst == nullptr)
+            {
+                textureFirst = texture;
+                samplerFirst = samplerList[textureIndex];
+            }
+
+            packable = texture->mDimension[0] == textureFirst->mDimension[0]
+                       && texture->mDimension[1] == textureFirst->mDimension[1]
+                       && texture->mFormat == textureFirst->mFormat
+                       && samplerList[textureIndex] == samplerFirst
+                       && texture->mData != nullptr;
+        }
+
+        // NOTE: Material without texture is read from the material
+        // buffer directly, so that it needs not to be packed.
+        if (!packable || textureFirst == nullptr)
+        {
+            continue;
+        }
+
+        auto key = MaterialGroupKey(textureFirst->mDimension[0], textureFirst->mDimension[1],
+                                    int(textureFirst->mFormat), samplerFirst);
+        materialGroupTable[key].push_back(material);
+    }
+
+    // Pack each group into as few texture arrays as the layer limit allows.
+    auto assetManager = AssetManager::GetInstance();
+
+    int materialPackedNum = 0;
+    for (auto& materialGroupPair : materialGroupTable)
+    {
+        auto& materialGroup = materialGroupPair.second;
+        auto sampler = get<3>(materialGroupPair.first);
+
+        map<const Texture2d *, int> layerTable;
+        vector<shared_ptr<Texture2d>> layerTextureList;
+        vector<Material *> layerMaterialList;
+
+        auto createTextureArray = [&]()
+        {
+            if (layerMaterialList.empty())
+            {
+                return;
+            }
+
+            auto textureFirst = layerTextureList.front();
+            auto textureArray = make_shared<Texture2dArray>(AssetSource::Virtual,
+                                "None", "None", textureFirst->mDimension[0],
+                                textureFirst->mDimension[1], int(layerTextureList.size()),
+                                textureFirst->mFormat, BufferUsage::Static, 0);
+            for (auto& texture : layerTextureList)
+            {
+                textureArray->PushTextureSlice(texture);
+            }
+
+            for (auto material : layerMaterialList)
+            {
+                auto textureList = getTextureList(material);
+                const MaterialLayerList layerList =
+                {
+                    &material->mAmbientTextureLayer,
+                    &material->mDiffuseTextureLayer,
+                    &material->mEmissiveTextureLayer,
+                    &material->mSpecularTextureLayer,
+                    &material->mShininessTextureLayer,
+                };
+
+                for (int textureIndex = 0; textureIndex < MaterialTextureNum; ++textureIndex)
+                {
+                    *layerList[textureIndex] = textureList[textureIndex] != nullptr
+                                               ? layerTable.at(textureList[textureIndex]) : -1;
+                }
+
+                material->mTextureArray = textureArray.get();
+                material->mTextureArraySampler = sampler;
+            }
+
+            materialPackedNum += int(layerMaterialList.size());
+            mTextureArrayList.push_back(textureArray);
+
+            layerTable.clear();
+            layerTextureList.clear();
+            layerMaterialList.clear();
+        };
+
+        for (auto material : materialGroup)
+        {
+            // NOTE: The texture array holds the texture by shared
+            // pointer, which only the asset manager has.
+            vector<shared_ptr<Texture2d>> textureSharedList;
+            bool packable = true;
+            for (auto texture : getTextureList(material))
+            {
+                if (texture == nullptr)
+                {
+                    continue;
+                }
+
+                auto textureShared = assetManager->GetTexture<Texture2d>(texture->mFilePath);
+                if (textureShared.get() != texture)
+                {
+                    packable = false;
+                    break;
+                }
+
+                if (find(textureSharedList.begin(), textureSharedList.end(), textureShared) == textureSharedList.end())
+                {
+                    textureSharedList.push_back(textureShared);
+                }
+            }
+
+            if (!packable || int(textureSharedList.size()) > mLayerNumMax)
+            {
+                continue;
+            }
+
+            auto textureAddedNum = count_if(textureSharedList.begin(), textureSharedList.end(),
+                                            [&layerTable](const shared_ptr<Texture2d>& texture)
+            {
+                return layerTable.count(texture.get()) == 0;
+            });
+            if (int(layerTextureList.size() + textureAddedNum) > mLayerNumMax)
+            {
+                createTextureArray();
+            }
+
+            for (auto& texture : textureSharedList)
+            {
+                if (layerTable.count(texture.get()) == 0)
+                {
+                    layerTable.emplace(texture.get(), int(layerTextureList.size()));
+                    layerTextureList.push_back(texture);
+                }
+            }
+
+            layerMaterialList.push_back(material);
+        }
+
+        createTextureArray();
+    }
+
+    return materialPackedNum;
+}
+
+}
@@ -1,5 +1,7 @@
 #include <FalconEngine/Graphics/Renderer/Scene/Mesh.h>
 
+#include <atomic>
+
 #include <FalconEngine/Content/AssetManager.h>
 #include <FalconEngine/Graphics/Renderer/PrimitiveTriangles.h>
 #include <FalconEngine/Graphics/Renderer/Scene/Model.h>
@@ -11,18 +13,27 @@ namespace FalconEngine
 
 FALCON_ENGINE_RTTI_IMPLEMENT(Mesh, Object);
 
+/************************************************************************/
+/* Static Members                                                       */
+/************************************************************************/
+static atomic<uint64_t> sMeshIdNext(1);
+
 /************************************************************************/
 /* Constructors and Destructor                                          */
 /************************************************************************/
 Mesh::Mesh(std::shared_ptr<Primitive> primitives, std::shared_ptr<Material> material) :
+    mId(sMeshIdNext++),
     mMaterial(material),
-    mPrimitive(primitives)
+    mPrimitive(primitives),
+    mLodList()
 {
 }
 
 Mesh::Mesh() :
+    mId(sMeshIdNext++),
     mMaterial(),
-    mPrimitive()
+    mPrimitive(),
+    mLodList()
 {
 }
 
@@ -39,6 +50,12 @@ Mesh::GetAABB() const
     return mPrimitive->GetAABB();
 }
 
+uint64_t
+Mesh::GetId() const
+{
+    return mId;
+}
+
 const Material *
 Mesh::GetMaterial() const
 {
@@ -71,6 +88,45 @@ Mesh::GetPrimitive()
     return mPrimitive;
 }
 
+/************************************************************************/
+/* Level of Detail Management                                           */
+/************************************************************************/
+int
+Mesh::GetLodNum() const
+{
+    return int(mLodList.size()) + 1;
+}
+
+float
+Mesh::GetLodError(int lodIndex) const
+{
+    return lodIndex == 0 ? 0.0f : mLodList.at(lodIndex - 1).mError;
+}
+
+const Primitive *
+Mesh::GetLodPrimitive(int lodIndex) const
+{
+    return lodIndex == 0 ? mPrimitive.get() : mLodList.at(lodIndex - 1).mPrimitive.get();
+}
+
+void
+Mesh::PushLod(std::shared_ptr<Primitive> primitive, float error)
+{
+    FALCON_ENGINE_CHECK_NULLPTR(primitive);
+
+    if (primitive->GetVertexGroup() != mPrimitive->GetVertexGroup())
+    {
+        FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("Level of detail should share the vertex group with the mesh.");
+    }
+
+    if (error < GetLodError(GetLodNum() - 1))
+    {
+        FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("Level of detail should be coarser than the last level.");
+    }
+
+    mLodList.push_back({ primitive, error });
+}
+
 /************************************************************************/
 /* Deep and Shallow Copy                                                */
 /************************************************************************/
@@ -79,6 +135,7 @@ Mesh::CopyTo(Mesh *lhs) const
 {
     lhs->mMaterial  = mMaterial;
     lhs->mPrimitive = mPrimitive;
+    lhs->mLodList   = mLodList;
 }
 
 Mesh *
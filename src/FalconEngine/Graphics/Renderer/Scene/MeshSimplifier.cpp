@@ -0,0 +1,362 @@
+#include <FalconEngine/Graphics/Renderer/Scene/MeshSimplifier.h>
+
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+namespace FalconEngine
+{
+
+// @summary Sum of the squared distance to the planes, weighted by the triangle
+// area, stored as the symmetric matrix A, vector b and scalar c of
+// v^T A v + 2 b^T v + c.
+class MeshSimplifierQuadric
+{
+public:
+    double mA00, mA11, mA22, mA01, mA02, mA12;
+    double mB0, mB1, mB2;
+    double mC;
+    double mWeight;
+};
+
+class MeshSimplifierCollapse
+{
+public:
+    unsigned int mFrom;
+    unsigned int mTo;
+    double       mError;                                                        // Mean squared distance.
+};
+
+static void
+AddQuadric(MeshSimplifierQuadric& lhs, const MeshSimplifierQuadric& rhs)
+{
+    lhs.mA00 += rhs.mA00;
+    lhs.mA11 += rhs.mA11;
+    lhs.mA22 += rhs.mA22;
+    lhs.mA01 += rhs.mA01;
+    lhs.mA02 += rhs.mA02;
+    lhs.mA12 += rhs.mA12;
+    lhs.mB0 += rhs.mB0;
+    lhs.mB1 += rhs.mB1;
+    lhs.mB2 += rhs.mB2;
+    lhs.mC += rhs.mC;
+    lhs.mWeight += rhs.mWeight;
+}
+
+static MeshSimplifierQuadric
+CreateQuadric(const Vector3f& p0, const Vector3f& p1, const Vector3f& p2)
+{
+    auto normal = Vector3f::Cross(p1 - p0, p2 - p0);
+    double area = sqrt(double(Vector3f::Dot(normal, normal)));
+
+    MeshSimplifierQuadric quadric = {};
+    if (area <= 0.0)
+    {
+        return quadric;
+    }
+
+    double a = normal.x / area;
+    double b = normal.y / area;
+    double c = normal.z / area;
+    double d = -(a * p0.x + b * p0.y + c * p0.z);
+
+    // NOTE: Weight by area so that the small triangles don't keep
+    // their vertices from collapsing.
+    double weight = area * 0.5;
+    quadric.mA00 = weight * a * a;
+    quadric.mA11 = weight * b * b;
+    quadric.mA22 = weight * c * c;
+    quadric.mA01 = weight * a * b;
+    quadric.mA02 = weight * a * c;
+    quadric.mA12 = weight * b * c;
+    quadric.mB0 = weight * a * d;
+    quadric.mB1 = weight * b * d;
+    quadric.mB2 = weight * c * d;
+    quadric.mC = weight * d * d;
+    quadric.mWeight = weight;
+    return quadric;
+}
+
+// @return Mean squared distance from the point to the planes.
+static double
+EvaluateQuadric(const MeshSimplifierQuadric& q, const Vector3f& p)
+{
+    if (q.mWeight <= 0.0)
+    {
+        return 0.0;
+    }
+
+    double x = p.x;
+    double y = p.y;
+    double z = p.z;
+    double error = q.mA00 * x * x + q.mA11 * y * y + q.mA22 * z * z
+                   + 2.0 * (q.mA01 * x * y + q.mA02 * x * z + q.mA12 * y * z)
+                   + 2.0 * (q.mB0 * x + q.mB1 * y + q.mB2 * z)
+                   + q.mC;
+    return max(error, 0.0) / q.mWeight;
+}
+
+/************************************************************************/
+/* Public Members                                                       */
+/************************************************************************/
+float
+MeshSimplifier::Simplify(
+    _OUT_ std::vector<unsigned int>&       indexListSimplified,
+    _IN_  const std::vector<Vector3f>&     positionList,
+    _IN_  const std::vector<unsigned int>& indexList,
+    _IN_  int                              indexNumTarget,
+    _IN_  float                            errorMax)
+{
+    indexListSimplified = indexList;
+
+    auto vertexNum = positionList.size();
+    if (vertexNum == 0 || indexList.size() % 3 != 0)
+    {
+        FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("Invalid triangle list.");
+    }
+
+    // Radius of the bound, which the error is relative to.
+    auto positionMin = positionList[0];
+    auto positionMax = positionList[0];
+    for (const auto& position : positionList)
+    {
+        positionMin = Vector3f(min(positionMin.x, position.x), min(positionMin.y, position.y), min(positionMin.z, position.z));
+        positionMax = Vector3f(max(positionMax.x, position.x), max(positionMax.y, position.y), max(positionMax.z, position.z));
+    }
+
+    auto extent = (positionMax - positionMin) * 0.5f;
+    double radius = sqrt(double(Vector3f::Dot(extent, extent)));
+    if (radius <= 0.0)
+    {
+        return 0.0f;
+    }
+
+    double errorSquareMax = double(errorMax) * radius * double(errorMax) * radius;
+    double errorSquareApplied = 0.0;
+
+    // Accumulate the plane of each triangle into its vertices.
+    vector<MeshSimplifierQuadric> quadricList(vertexNum, MeshSimplifierQuadric());
+    for (size_t i = 0; i < indexList.size(); i += 3)
+    {
+        auto i0 = indexList[i];
+        auto i1 = indexList[i + 1];
+        auto i2 = indexList[i + 2];
+        if (i0 >= vertexNum || i1 >= vertexNum || i2 >= vertexNum)
+        {
+            FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("Index is out of the vertex range.");
+        }
+
+        auto quadric = CreateQuadric(positionList[i0], positionList[i1], positionList[i2]);
+        AddQuadric(quadricList[i0], quadric);
+        AddQuadric(quadricList[i1], quadric);
+        AddQuadric(quadricList[i2], quadric);
+    }
+
+    vector<unsigned int> remapList(vertexNum);
+    vector<unsigned int> triangleOffsetList(vertexNum + 1);
+    vector<unsigned int> triangleList;
+    vector<bool> borderList(vertexNum);
+    vector<bool> collapsedList(vertexNum);
+    vector<MeshSimplifierCollapse> collapseList;
+
+    // NOTE: Each pass sorts all the candidate collapses and applies
+    // the cheapest ones whose neighborhoods don't overlap, then rebuilds the
+    // adjacency from the remapped index list.
+    while (int(indexListSimplified.size()) > indexNumTarget)
+    {
+        auto triangleNum = indexListSimplified.size() / 3;
+
+        // Build the triangle list around each vertex.
+        fill(triangleOffsetList.begin(), triangleOffsetList.end(), 0);
+        for (auto index : indexListSimplified)
+        {
+            ++triangleOffsetList[index + 1];
+        }
+
+        for (size_t vertexIndex = 0; vertexIndex < vertexNum; ++vertexIndex)
+        {
+            triangleOffsetList[vertexIndex + 1] += triangleOffsetList[vertexIndex];
+        }
+
+        triangleList.resize(indexListSimplified.size());
+        {
+            auto triangleCursorList = triangleOffsetList;
+            for (size_t i = 0; i < indexListSimplified.size(); ++i)
+            {
+                triangleList[triangleCursorList[indexListSimplified[i]]++] = unsigned(i / 3);
+            }
+        }
+
+        // The vertex is on the border when any edge from it has no opposite
+        // edge from its neighbor.
+        fill(borderList.begin(), borderList.end(), false);
+        for (size_t triangleIndex = 0; triangleIndex < triangleNum; ++triangleIndex)
+        {
+            for (int e = 0; e < 3; ++e)
+            {
+                auto a = indexListSimplified[triangleIndex * 3 + e];
+                auto b = indexListSimplified[triangleIndex * 3 + (e + 1) % 3];
+
+                auto opposite = false;
+                for (auto t = triangleOffsetList[b]; t < triangleOffsetList[b + 1] && !opposite; ++t)
+                {
+                    auto neighbor = triangleList[t];
+                    for (int f = 0; f < 3; ++f)
+                    {
+                        if (indexListSimplified[neighbor * 3 + f] == b
+                                && indexListSimplified[neighbor * 3 + (f + 1) % 3] == a)
+                        {
+                            opposite = true;
+                            break;
+                        }
+                    }
+                }
+
+                if (!opposite)
+                {
+                    borderList[a] = true;
+                    borderList[b] = true;
+                }
+            }
+        }
+
+        // Pick the cheaper direction of each edge.
+        collapseList.clear();
+        for (size_t triangleIndex = 0; triangleIndex < triangleNum; ++triangleIndex)
+        {
+            for (int e = 0; e < 3; ++e)
+            {
+                auto a = indexListSimplified[triangleIndex * 3 + e];
+                auto b = indexListSimplified[triangleIndex * 3 + (e + 1) % 3];
+
+                // NOTE: Each edge that could be collapsed is visited
+                // from both of its triangles, skip one of them.
+                if (a > b)
+                {
+                    continue;
+                }
+
+                auto quadric = quadricList[a];
+                AddQuadric(quadric, quadricList[b]);
+
+                auto errorAB = borderList[a] ? HUGE_VAL : EvaluateQuadric(quadric, positionList[b]);
+                auto errorBA = borderList[b] ? HUGE_VAL : EvaluateQuadric(quadric, positionList[a]);
+                if (errorAB <= errorBA && errorAB <= errorSquareMax)
+                {
+                    collapseList.push_back({ a, b, errorAB });
+                }
+                else if (errorBA < errorAB && errorBA <= errorSquareMax)
+                {
+                    collapseList.push_back({ b, a, errorBA });
+                }
+            }
+        }
+
+        sort(collapseList.begin(), collapseList.end(),
+             [](const MeshSimplifierCollapse& lhs, const MeshSimplifierCollapse& rhs)
+        {
+            return lhs.mError < rhs.mError;
+        });
+
+        for (size_t vertexIndex = 0; vertexIndex < vertexNum; ++vertexIndex)
+        {
+            remapList[vertexIndex] = unsigned(vertexIndex);
+        }
+
+        fill(collapsedList.begin(), collapsedList.end(), false);
+
+        int indexNumRemoved = 0;
+        auto indexNumRemovedMax = int(indexListSimplified.size()) - indexNumTarget;
+        for (const auto& collapse : collapseList)
+        {
+            if (indexNumRemoved >= indexNumRemovedMax)
+            {
+                break;
+            }
+
+            auto from = collapse.mFrom;
+            auto to = collapse.mTo;
+            if (collapsedList[from] || collapsedList[to])
+            {
+                continue;
+            }
+
+            // Reject the collapse which flips any remaining triangle around the
+            // collapsed vertex.
+            auto flipped = false;
+            int triangleNumRemoved = 0;
+            for (auto t = triangleOffsetList[from]; t < triangleOffsetList[from + 1]; ++t)
+            {
+                auto triangle = &indexListSimplified[triangleList[t] * 3];
+                if (triangle[0] == to || triangle[1] == to || triangle[2] == to)
+                {
+                    ++triangleNumRemoved;
+                    continue;
+                }
+
+                Vector3f p[3];
+                Vector3f q[3];
+                for (int v = 0; v < 3; ++v)
+                {
+                    p[v] = positionList[triangle[v]];
+                    q[v] = triangle[v] == from ? positionList[to] : p[v];
+                }
+
+                auto normalBefore = Vector3f::Cross(p[1] - p[0], p[2] - p[0]);
+                auto normalAfter = Vector3f::Cross(q[1] - q[0], q[2] - q[0]);
+                if (Vector3f::Dot(normalBefore, normalAfter) <= 0)
+                {
+                    flipped = true;
+                    break;
+                }
+            }
+
+            if (flipped)
+            {
+                continue;
+            }
+
+            remapList[from] = to;
+            AddQuadric(quadricList[to], quadricList[from]);
+            errorSquareApplied = max(errorSquareApplied, collapse.mError);
+            indexNumRemoved += triangleNumRemoved * 3;
+
+            // NOTE: Lock the whole neighborhood for the rest of this
+            // pass, so that the flip test above stays valid.
+            for (auto t = triangleOffsetList[from]; t < triangleOffsetList[from + 1]; ++t)
+            {
+                auto triangle = &indexListSimplified[triangleList[t] * 3];
+                collapsedList[triangle[0]] = true;
+                collapsedList[triangle[1]] = true;
+                collapsedList[triangle[2]] = true;
+            }
+        }
+
+        if (indexNumRemoved == 0)
+        {
+            break;
+        }
+
+        // Remap the index and remove the degenerated triangles.
+        size_t indexNum = 0;
+        for (size_t i = 0; i < indexListSimplified.size(); i += 3)
+        {
+            auto i0 = remapList[indexListSimplified[i]];
+            auto i1 = remapList[indexListSimplified[i + 1]];
+            auto i2 = remapList[indexListSimplified[i + 2]];
+            if (i0 != i1 && i1 != i2 && i2 != i0)
+            {
+                indexListSimplified[indexNum++] = i0;
+                indexListSimplified[indexNum++] = i1;
+                indexListSimplified[indexNum++] = i2;
+            }
+        }
+
+        indexListSimplified.resize(indexNum);
+    }
+
+    return float(sqrt(errorSquareApplied) / radius);
+}
+
+}
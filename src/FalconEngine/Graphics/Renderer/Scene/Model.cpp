@@ -1,4 +1,5 @@
 #include <FalconEngine/Graphics/Renderer/Scene/Model.h>
+#include <FalconEngine/Graphics/Renderer/Scene/MaterialAtlas.h>
 #include <FalconEngine/Graphics/Renderer/Scene/Node.h>
 
 using namespace std;
@@ -12,7 +13,10 @@ namespace FalconEngine
 Model::Model(AssetSource assetSource, const std::string& fileName, const std::string& filePath) :
     Asset(assetSource, AssetType::Model, fileName, filePath),
     mVertexNum(),
-    mIndexNum()
+    mIndexNum(),
+    mVertexBufferByteNum(),
+    mVertexBufferByteNumUncompressed(),
+    mVertexBufferNum()
 {
 }
 
@@ -57,4 +61,18 @@ Model::GetSampler() const
     return mSampler.get();
 }
 
+const MaterialAtlas *
+Model::GetMaterialAtlas() const
+{
+    return mMaterialAtlas.get();
+}
+
+void
+Model::SetMaterialAtlas(std::shared_ptr<MaterialAtlas> materialAtlas)
+{
+    FALCON_ENGINE_CHECK_NULLPTR(materialAtlas);
+
+    mMaterialAtlas = materialAtlas;
+}
+
 }
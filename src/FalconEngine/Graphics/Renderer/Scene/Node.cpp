@@ -10,19 +10,17 @@ FALCON_ENGINE_RTTI_IMPLEMENT(Node, Spatial);
 /************************************************************************/
 /* Constructors and Destructor                                          */
 /************************************************************************/
-Node::Node()
+Node::Node() :
+    Spatial(SpatialType::Node),
+    mFirstChild(nullptr),
+    mLastChild(nullptr),
+    mChildrenNum(0)
 {
 }
 
 Node::~Node()
 {
-    for (auto child : mChildrenSlot)
-    {
-        if (child)
-        {
-            child->mParent = nullptr;
-        }
-    }
+    UnlinkChildAll();
 
     mChildrenSlot.clear();
 }
@@ -41,6 +39,7 @@ Node::AttachChild(std::shared_ptr<Spatial> child)
     }
 
     child->mParent = this;
+    LinkChild(child.get());
 
     // Insert the child in the first available slot (if any).
     auto slotIndex = 0;
@@ -74,6 +73,7 @@ Node::DetachChild(std::shared_ptr<Spatial> child)
             if (slot == child)
             {
                 slot->mParent = nullptr;
+                UnlinkChild(slot.get());
 
                 // NTOE(Wuxiang): The detach operation would not change the vector
                 // arrangement. Since the vector stores pointer, if you would just
@@ -101,6 +101,7 @@ Node::DetachChildAt(int slotIndex)
         if (auto child = slot)
         {
             child->mParent = nullptr;
+            UnlinkChild(child.get());
             mChildrenSlot[slotIndex] = nullptr;
 
             return child;
@@ -115,6 +116,8 @@ Node::DetachChildAt(int slotIndex)
 void
 Node::ClearChildrenSlot()
 {
+    UnlinkChildAll();
+
     mChildrenSlot.clear();
 }
 
@@ -159,12 +162,14 @@ Node::SetChildAt(int slotIndex, std::shared_ptr<Spatial> child)
         if (childPrevious)
         {
             childPrevious->mParent = nullptr;
+            UnlinkChild(childPrevious.get());
         }
 
         // Insert the new child in the slot.
         if (child)
         {
             child->mParent = this;
+            LinkChild(child.get());
         }
 
         slot = child;
@@ -176,6 +181,7 @@ Node::SetChildAt(int slotIndex, std::shared_ptr<Spatial> child)
     if (child)
     {
         child->mParent = this;
+        LinkChild(child.get());
     }
 
     mChildrenSlot.push_back(child);
@@ -183,19 +189,22 @@ Node::SetChildAt(int slotIndex, std::shared_ptr<Spatial> child)
     return nullptr;
 }
 
+const Spatial *
+Node::GetFirstChild() const
+{
+    return mFirstChild;
+}
+
+Spatial *
+Node::GetFirstChild()
+{
+    return mFirstChild;
+}
+
 int
 Node::GetChildrenNum() const
 {
-    auto childrenNum = 0;
-    for (auto slotIndex = 0; slotIndex < GetChildrenSlotNum(); ++slotIndex)
-    {
-        if (GetChildAt(slotIndex) != nullptr)
-        {
-            ++childrenNum;
-        }
-    }
-
-    return childrenNum;
+    return mChildrenNum;
 }
 
 int
@@ -211,7 +220,7 @@ Node::Update(double elapsed, bool initiator)
 
     UpdateWorldTransform(elapsed);
 
-    for (auto child : mChildrenSlot)
+    for (auto child = mFirstChild; child != nullptr; child = child->mNextSibling)
     {
         child->Update(elapsed, false);
     }
@@ -219,6 +228,17 @@ Node::Update(double elapsed, bool initiator)
     mUpdateEnded.Invoke(this, initiator);
 }
 
+void
+Node::Interpolate(double alpha) const
+{
+    Spatial::Interpolate(alpha);
+
+    for (auto child = mFirstChild; child != nullptr; child = child->mNextSibling)
+    {
+        child->Interpolate(alpha);
+    }
+}
+
 /************************************************************************/
 /* Deep and Shallow Copy                                                */
 /************************************************************************/
@@ -228,29 +248,25 @@ Node::CopyTo(Node *lhs) const
     Spatial::CopyTo(lhs);
 
     // Clear existing children.
-    {
-        int slotNum = lhs->GetChildrenSlotNum();
-        for (int slotIndex = 0; slotIndex < slotNum; ++slotIndex)
-        {
-            if (auto child = lhs->GetChildAt(slotIndex))
-            {
-                child->SetParent(nullptr);
-            }
-        }
-
-        lhs->ClearChildrenSlot();
-    }
+    lhs->ClearChildrenSlot();
 
     // Create new children.
     {
+        // NOTE: The slots are copied as they are, including the
+        // empty ones, so that the clone keeps the slot index of each child.
         int slotNum = GetChildrenSlotNum();
+        lhs->mChildrenSlot.resize(slotNum);
+
         for (int slotIndex = 0; slotIndex < slotNum; ++slotIndex)
         {
-            auto slot = GetChildAt(slotIndex);
-            if (auto child = slot)
+            if (auto child = mChildrenSlot[slotIndex].get())
             {
-                auto childClone = child->GetClone();
-                lhs->SetChildAt(slotIndex, shared_ptr<Spatial>(childClone));
+                // NOTE: The clones are linked in the slot order,
+                // which might differ from the attaching order of the children.
+                auto childClone = ShareSpatial(child->GetClone());
+                childClone->mParent = lhs;
+                lhs->LinkChild(childClone.get());
+                lhs->mChildrenSlot[slotIndex] = std::move(childClone);
             }
         }
     }
@@ -281,22 +297,87 @@ Node::UpdateWorldTransform(double elapsed)
     // Mark children's world transform dirty.
     if (!mWorldTransformIsCurrent)
     {
-        for (auto slot : mChildrenSlot)
+        for (auto child = mFirstChild; child != nullptr; child = child->mNextSibling)
         {
-            if (auto child = slot)
-            {
-                child->mWorldTransformIsCurrent = false;
-            }
+            child->mWorldTransformIsCurrent = false;
         }
     }
 
     Spatial::UpdateWorldTransform(elapsed);
 }
 
+/************************************************************************/
+/* Private Members                                                      */
+/************************************************************************/
+void
+Node::LinkChild(Spatial *child)
+{
+    child->mPreviousSibling = mLastChild;
+    child->mNextSibling = nullptr;
+
+    if (mLastChild)
+    {
+        mLastChild->mNextSibling = child;
+    }
+    else
+    {
+        mFirstChild = child;
+    }
+
+    mLastChild = child;
+    ++mChildrenNum;
+}
+
+void
+Node::UnlinkChild(Spatial *child)
+{
+    if (child->mPreviousSibling)
+    {
+        child->mPreviousSibling->mNextSibling = child->mNextSibling;
+    }
+    else
+    {
+        mFirstChild = child->mNextSibling;
+    }
+
+    if (child->mNextSibling)
+    {
+        child->mNextSibling->mPreviousSibling = child->mPreviousSibling;
+    }
+    else
+    {
+        mLastChild = child->mPreviousSibling;
+    }
+
+    child->mNextSibling = nullptr;
+    child->mPreviousSibling = nullptr;
+    --mChildrenNum;
+}
+
+void
+Node::UnlinkChildAll()
+{
+    auto child = mFirstChild;
+    while (child)
+    {
+        auto childNext = child->mNextSibling;
+
+        child->mParent = nullptr;
+        child->mNextSibling = nullptr;
+        child->mPreviousSibling = nullptr;
+
+        child = childNext;
+    }
+
+    mFirstChild = nullptr;
+    mLastChild = nullptr;
+    mChildrenNum = 0;
+}
+
 std::shared_ptr<Node>
 ShareClone(std::shared_ptr<Node> node)
 {
-    return std::shared_ptr<Node>(node->GetClone());
+    return ShareSpatial(node->GetClone());
 }
 
 }
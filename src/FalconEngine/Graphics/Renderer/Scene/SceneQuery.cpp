@@ -0,0 +1,296 @@
+#include <FalconEngine/Graphics/Renderer/Scene/SceneQuery.h>
+
+#include <cmath>
+#include <limits>
+
+#include <FalconEngine/Graphics/Renderer/Camera.h>
+#include <FalconEngine/Graphics/Renderer/Entity/Entity.h>
+#include <FalconEngine/Graphics/Renderer/Scene/Mesh.h>
+#include <FalconEngine/Graphics/Renderer/Scene/Node.h>
+#include <FalconEngine/Graphics/Renderer/Scene/Visual.h>
+#include <FalconEngine/Math/Matrix4.h>
+#include <FalconEngine/Math/Vector4.h>
+
+using namespace std;
+
+namespace FalconEngine
+{
+
+// @summary Get the world space bound of the visual.
+static AABB
+GetWorldBound(const Visual *visual)
+{
+    const auto& transform = visual->mWorldTransform;
+    auto aabb = visual->GetMesh()->GetAABB();
+    auto center = aabb->GetCenter();
+    auto extent = aabb->GetExtent();
+
+    // NOTE: Each axis of the transformed box is the sum of the
+    // projected half size on that axis.
+    auto centerWorld = transform * Vector4f(center, 1);
+    Vector3f extentWorld;
+    for (int axisIndex = 0; axisIndex < 3; ++axisIndex)
+    {
+        extentWorld[axisIndex] = std::abs(transform[0][axisIndex]) * extent.x
+                                 + std::abs(transform[1][axisIndex]) * extent.y
+                                 + std::abs(transform[2][axisIndex]) * extent.z;
+    }
+
+    auto centerWorld3 = Vector3f(centerWorld.x, centerWorld.y, centerWorld.z);
+    return AABB(centerWorld3 - extentWorld, centerWorld3 + extentWorld);
+}
+
+// @summary Collect all the visuals in the node hierarchy of the entity.
+static void
+GetVisualList(const Entity *entity, std::vector<const Visual *>& visualList)
+{
+    std::vector<const Node *> nodeStack;
+    nodeStack.push_back(entity->GetNode());
+    while (!nodeStack.empty())
+    {
+        auto node = nodeStack.back();
+        nodeStack.pop_back();
+
+        for (auto child = node->GetFirstChild(); child != nullptr; child = child->GetNextSibling())
+        {
+            if (child->mSpatialType == SpatialType::Visual)
+            {
+                visualList.push_back(static_cast<const Visual *>(child));
+            }
+            else
+            {
+                nodeStack.push_back(static_cast<const Node *>(child));
+            }
+        }
+    }
+}
+
+/************************************************************************/
+/* Static Members                                                       */
+/************************************************************************/
+Ray
+SceneQuery::CreateRay(const Camera *camera, const Vector2f& positionNdc)
+{
+    FALCON_ENGINE_CHECK_NULLPTR(camera);
+
+    auto viewProjectionInverse = Matrix4f::Inverse(camera->GetViewProjection());
+    auto positionNear = viewProjectionInverse * Vector4f(positionNdc.x, positionNdc.y, -1, 1);
+    auto positionFar = viewProjectionInverse * Vector4f(positionNdc.x, positionNdc.y, 1, 1);
+
+    auto origin = Vector3f(positionNear.x, positionNear.y, positionNear.z) / positionNear.w;
+    auto target = Vector3f(positionFar.x, positionFar.y, positionFar.z) / positionFar.w;
+    return Ray(origin, target - origin);
+}
+
+/************************************************************************/
+/* Constructors and Destructor                                          */
+/************************************************************************/
+SceneQuery::SceneQuery(float margin) :
+    mHierarchy(margin)
+{
+}
+
+SceneQuery::~SceneQuery()
+{
+}
+
+/************************************************************************/
+/* Entity Management                                                    */
+/************************************************************************/
+void
+SceneQuery::Insert(const Entity *entity)
+{
+    FALCON_ENGINE_CHECK_NULLPTR(entity);
+
+    if (mEntityTable.find(entity) != mEntityTable.end())
+    {
+        FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("Entity is already inserted.");
+    }
+
+    std::vector<const Visual *> visualList;
+    GetVisualList(entity, visualList);
+
+    auto& proxyList = mEntityTable[entity];
+    for (auto visual : visualList)
+    {
+        auto bound = GetWorldBound(visual);
+
+        // NOTE: The element of unordered map is not moved on rehash,
+        // so that the hierarchy could refer to the item directly.
+        auto proxy = mHierarchy.Insert(bound, nullptr);
+        auto& item = mItemTable.emplace(proxy, SceneQueryItem(bound)).first->second;
+        item.mEntity = entity;
+        item.mVisual = visual;
+        proxyList.push_back(proxy);
+    }
+}
+
+void
+SceneQuery::Remove(const Entity *entity)
+{
+    auto entityIter = mEntityTable.find(entity);
+    if (entityIter == mEntityTable.end())
+    {
+        return;
+    }
+
+    for (auto proxy : entityIter->second)
+    {
+        mHierarchy.Remove(proxy);
+        mItemTable.erase(proxy);
+    }
+
+    mEntityTable.erase(entityIter);
+}
+
+void
+SceneQuery::Update(const Entity *entity)
+{
+    auto entityIter = mEntityTable.find(entity);
+    if (entityIter == mEntityTable.end())
+    {
+        FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("Entity is not inserted.");
+    }
+
+    for (auto proxy : entityIter->second)
+    {
+        auto& item = mItemTable.at(proxy);
+        item.mBound = GetWorldBound(item.mVisual);
+        mHierarchy.Move(proxy, item.mBound);
+    }
+}
+
+void
+SceneQuery::Update()
+{
+    for (auto& itemPair : mItemTable)
+    {
+        auto& item = itemPair.second;
+        item.mBound = GetWorldBound(item.mVisual);
+        mHierarchy.Move(itemPair.first, item.mBound);
+    }
+}
+
+void
+SceneQuery::Rebuild()
+{
+    mHierarchy.Rebuild();
+}
+
+void
+SceneQuery::Clear()
+{
+    mHierarchy.Clear();
+    mItemTable.clear();
+    mEntityTable.clear();
+}
+
+int
+SceneQuery::GetEntityNum() const
+{
+    return int(mEntityTable.size());
+}
+
+int
+SceneQuery::GetVisualNum() const
+{
+    return int(mItemTable.size());
+}
+
+const BoundingVolumeHierarchy *
+SceneQuery::GetHierarchy() const
+{
+    return &mHierarchy;
+}
+
+/************************************************************************/
+/* Query                                                                */
+/************************************************************************/
+bool
+SceneQuery::Pick(const Ray& ray, float distanceMax, SceneQueryHit& hit) const
+{
+    const SceneQueryItem *itemHit = nullptr;
+    float distanceHit = distanceMax;
+
+    // NOTE: The hierarchy only tests the enlarged bound, so that the
+    // exact world bound is tested against the clipped distance here.
+    mHierarchy.QueryRay(ray, distanceMax, [&](int proxy, float distanceCurrent)
+    {
+        const auto& item = mItemTable.at(proxy);
+
+        float distance;
+        if (ray.Intersects(item.mBound, distanceCurrent, distance))
+        {
+            itemHit = &item;
+            distanceHit = distance;
+            return distance;
+        }
+
+        return distanceCurrent;
+    });
+
+    if (itemHit)
+    {
+        hit.mEntity = itemHit->mEntity;
+        hit.mVisual = itemHit->mVisual;
+        hit.mDistance = distanceHit;
+        return true;
+    }
+
+    return false;
+}
+
+void
+SceneQuery::QueryAABB(const AABB& aabb, std::vector<SceneQueryHit>& hitList) const
+{
+    mHierarchy.QueryAABB(aabb, [&](int proxy)
+    {
+        const auto& item = mItemTable.at(proxy);
+        if (item.mBound.Intersects(aabb))
+        {
+            hitList.push_back({ item.mEntity, item.mVisual, 0.0f });
+        }
+
+        return true;
+    });
+}
+
+void
+SceneQuery::QuerySphere(const Sphere& sphere, std::vector<SceneQueryHit>& hitList) const
+{
+    mHierarchy.QuerySphere(sphere, [&](int proxy)
+    {
+        const auto& item = mItemTable.at(proxy);
+        if (sphere.Intersects(item.mBound))
+        {
+            hitList.push_back({ item.mEntity, item.mVisual, 0.0f });
+        }
+
+        return true;
+    });
+}
+
+void
+SceneQuery::QueryFrustum(const Camera *camera, std::vector<SceneQueryHit>& hitList) const
+{
+    FALCON_ENGINE_CHECK_NULLPTR(camera);
+
+    QueryFrustum(Frustum::CreateFromViewProjection(camera->GetViewProjection()), hitList);
+}
+
+void
+SceneQuery::QueryFrustum(const Frustum& frustum, std::vector<SceneQueryHit>& hitList) const
+{
+    mHierarchy.QueryFrustum(frustum, [&](int proxy)
+    {
+        const auto& item = mItemTable.at(proxy);
+        if (frustum.Contains(item.mBound) != FrustumContainment::Outside)
+        {
+            hitList.push_back({ item.mEntity, item.mVisual, 0.0f });
+        }
+
+        return true;
+    });
+}
+
+}
@@ -5,14 +5,37 @@ namespace FalconEngine
 
 FALCON_ENGINE_RTTI_IMPLEMENT(Spatial, Object);
 
+/************************************************************************/
+/* Memory Allocation                                                    */
+/************************************************************************/
+void *
+Spatial::operator new(size_t size)
+{
+    return SpatialPool::GetInstance()->Allocate(size);
+}
+
+void
+Spatial::operator delete(void *pointer, size_t size)
+{
+    SpatialPool::GetInstance()->Deallocate(pointer, size);
+}
+
 /************************************************************************/
 /* Constructors and Destructor                                          */
 /************************************************************************/
-Spatial::Spatial() :
+Spatial::Spatial(SpatialType spatialType) :
+    mSpatialType(spatialType),
     mLocalTransform(Matrix4f::Identity),
     mWorldTransform(Matrix4f::Identity),
     mWorldTransformIsCurrent(false),
-    mParent(nullptr)
+    mWorldTransformPrevious(Matrix4f::Identity),
+    mWorldTransformChanged(false),
+    mWorldTransformInterpolated(Matrix4f::Identity),
+    mWorldTransformUpdated(false),
+    mParent(nullptr),
+    mNextSibling(nullptr),
+    mPreviousSibling(nullptr),
+    mHandle(SpatialPool::GetInstance()->CreateHandle(this))
 {
 }
 
@@ -21,11 +44,30 @@ Spatial::~Spatial()
     // The Parent member is not reference counted by Spatial, so do not
     // release it here. The memory management responsibility belongs to
     // the owner of each Spatial object.
+    SpatialPool::GetInstance()->DestroyHandle(mHandle);
 }
 
 /************************************************************************/
 /* Public Members                                                       */
 /************************************************************************/
+SpatialHandle
+Spatial::GetHandle() const
+{
+    return mHandle;
+}
+
+const Spatial *
+Spatial::GetNextSibling() const
+{
+    return mNextSibling;
+}
+
+Spatial *
+Spatial::GetNextSibling()
+{
+    return mNextSibling;
+}
+
 const Spatial *
 Spatial::GetParent() const
 {
@@ -49,6 +91,24 @@ Spatial::Update(double elaped, bool initiator)
     }
 }
 
+void
+Spatial::Interpolate(double alpha) const
+{
+    if (mWorldTransformChanged)
+    {
+        // NOTE: Component-wise blend is not a proper rotation in
+        // general, but the difference between two updates is small enough
+        // that the error isn't visible.
+        auto t = float(alpha);
+        mWorldTransformInterpolated = Matrix4f(glm::mat4(mWorldTransformPrevious) * (1.0f - t)
+                                               + glm::mat4(mWorldTransform) * t);
+    }
+    else
+    {
+        mWorldTransformInterpolated = mWorldTransform;
+    }
+}
+
 /************************************************************************/
 /* Deep and Shallow Copy                                                */
 /************************************************************************/
@@ -58,6 +118,10 @@ Spatial::CopyTo(Spatial *lhs) const
     lhs->mWorldTransform = mWorldTransform;
     lhs->mLocalTransform = mLocalTransform;
     lhs->mWorldTransformIsCurrent = mWorldTransformIsCurrent;
+    lhs->mWorldTransformPrevious = mWorldTransformPrevious;
+    lhs->mWorldTransformChanged = mWorldTransformChanged;
+    lhs->mWorldTransformInterpolated = mWorldTransformInterpolated;
+    lhs->mWorldTransformUpdated = mWorldTransformUpdated;
 
     // NOTE(Wuxiang): The copying won't try to copy the ownership and parentage.
     lhs->mParent = nullptr;
@@ -69,6 +133,11 @@ Spatial::CopyTo(Spatial *lhs) const
 void
 Spatial::UpdateWorldTransform(double /* elaped */)
 {
+    // NOTE: There is nothing to interpolate from before the first
+    // update, so that the spatial doesn't fly in from its initial transform.
+    mWorldTransformPrevious = mWorldTransform;
+    mWorldTransformChanged = !mWorldTransformIsCurrent && mWorldTransformUpdated;
+
     // NOTE(Wuxiang): Update world transforms in an top-to-bottom way. This
     // method is only guaranteed to work when you called it on the root of
     // hierarchy. You should not expect a child node's update would compute world
@@ -86,6 +155,8 @@ Spatial::UpdateWorldTransform(double /* elaped */)
 
         mWorldTransformIsCurrent = true;
     }
+
+    mWorldTransformUpdated = true;
 }
 
 }
@@ -0,0 +1,215 @@
+#include <FalconEngine/Graphics/Renderer/Scene/SpatialPool.h>
+
+#include <algorithm>
+#include <cstdlib>
+
+#include <FalconEngine/Core/MemoryAllocator.h>
+#include <FalconEngine/Graphics/Renderer/Scene/Node.h>
+#include <FalconEngine/Graphics/Renderer/Scene/Visual.h>
+
+namespace FalconEngine
+{
+
+/************************************************************************/
+/* Static Members                                                       */
+/************************************************************************/
+const size_t SpatialPool::ChunkBlockNum = 1024;
+const size_t SpatialPool::SmallBlockSize = 64;
+
+/************************************************************************/
+/* Constructors and Destructor                                          */
+/************************************************************************/
+SpatialPool::SpatialPool() :
+    mHandleSlotFree(SpatialHandle::IndexNull)
+{
+    mBlockListSmall.mBlockSize = SmallBlockSize;
+    mBlockListSmall.mBlockUsedNum = 0;
+    mBlockListSmall.mBlockFreeList = nullptr;
+
+    // NOTE: The block has room for the control block of the shared
+    // pointer allocated together with the spatial.
+    mBlockListLarge.mBlockSize = size_t(AlignMemoryAddress(std::max(sizeof(Node), sizeof(Visual)) + SmallBlockSize,
+                                                           MemoryAlignmentDefault));
+    mBlockListLarge.mBlockUsedNum = 0;
+    mBlockListLarge.mBlockFreeList = nullptr;
+}
+
+/************************************************************************/
+/* Allocation                                                           */
+/************************************************************************/
+void *
+SpatialPool::Allocate(size_t size)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    auto blockList = GetBlockList(size);
+    if (blockList == nullptr)
+    {
+        return ::operator new(size);
+    }
+
+    if (blockList->mBlockFreeList == nullptr)
+    {
+        AllocateChunk(*blockList);
+    }
+
+    auto block = blockList->mBlockFreeList;
+    blockList->mBlockFreeList = *static_cast<void **>(block);
+    ++blockList->mBlockUsedNum;
+
+    return block;
+}
+
+void
+SpatialPool::Deallocate(void *pointer, size_t size)
+{
+    if (pointer == nullptr)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    auto blockList = GetBlockList(size);
+    if (blockList == nullptr)
+    {
+        ::operator delete(pointer);
+        return;
+    }
+
+    *static_cast<void **>(pointer) = blockList->mBlockFreeList;
+    blockList->mBlockFreeList = pointer;
+    --blockList->mBlockUsedNum;
+}
+
+size_t
+SpatialPool::GetBlockSize() const
+{
+    return mBlockListLarge.mBlockSize;
+}
+
+size_t
+SpatialPool::GetBlockNum() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    return (mBlockListSmall.mChunkList.size() + mBlockListLarge.mChunkList.size()) * ChunkBlockNum;
+}
+
+size_t
+SpatialPool::GetBlockUsedNum() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    return mBlockListSmall.mBlockUsedNum + mBlockListLarge.mBlockUsedNum;
+}
+
+/************************************************************************/
+/* Handle                                                               */
+/************************************************************************/
+SpatialHandle
+SpatialPool::CreateHandle(Spatial *spatial)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    SpatialHandle handle;
+    if (mHandleSlotFree != SpatialHandle::IndexNull)
+    {
+        handle.mIndex = mHandleSlotFree;
+
+        auto& slot = mHandleSlotList[mHandleSlotFree];
+        mHandleSlotFree = slot.mSlotFreeNext;
+        slot.mSpatial = spatial;
+        handle.mGeneration = slot.mGeneration;
+    }
+    else
+    {
+        handle.mIndex = uint32_t(mHandleSlotList.size());
+        mHandleSlotList.push_back({ spatial, 0, SpatialHandle::IndexNull });
+    }
+
+    return handle;
+}
+
+void
+SpatialPool::DestroyHandle(SpatialHandle handle)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    if (handle.mIndex >= mHandleSlotList.size())
+    {
+        FALCON_ENGINE_THROW_ASSERTION_EXCEPTION();
+    }
+
+    auto& slot = mHandleSlotList[handle.mIndex];
+    if (slot.mGeneration != handle.mGeneration)
+    {
+        FALCON_ENGINE_THROW_ASSERTION_EXCEPTION();
+    }
+
+    // NOTE: Increase the generation so that the existing handles of
+    // the slot no longer resolve.
+    slot.mSpatial = nullptr;
+    ++slot.mGeneration;
+    slot.mSlotFreeNext = mHandleSlotFree;
+    mHandleSlotFree = handle.mIndex;
+}
+
+Spatial *
+SpatialPool::GetSpatial(SpatialHandle handle) const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    if (handle.mIndex >= mHandleSlotList.size())
+    {
+        return nullptr;
+    }
+
+    auto& slot = mHandleSlotList[handle.mIndex];
+    return slot.mGeneration == handle.mGeneration ? slot.mSpatial : nullptr;
+}
+
+/************************************************************************/
+/* Private Members                                                      */
+/************************************************************************/
+SpatialPool::SpatialBlockList *
+SpatialPool::GetBlockList(size_t size)
+{
+    if (size <= mBlockListSmall.mBlockSize)
+    {
+        return &mBlockListSmall;
+    }
+
+    if (size <= mBlockListLarge.mBlockSize)
+    {
+        return &mBlockListLarge;
+    }
+
+    return nullptr;
+}
+
+void
+SpatialPool::AllocateChunk(SpatialBlockList& blockList)
+{
+    // NOTE: Malloc is aligned for any scalar type and the block size
+    // is multiple of the default alignment, so that every block is aligned.
+    auto chunkSize = blockList.mBlockSize * ChunkBlockNum;
+    auto chunk = static_cast<unsigned char *>(malloc(chunkSize));
+    if (chunk == nullptr)
+    {
+        FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("Failed to allocate spatial pool chunk.\n");
+    }
+
+    MemoryTracker::GetInstance()->RecordAllocation(MemoryTag::Scene, chunkSize);
+    blockList.mChunkList.push_back(chunk);
+
+    // Build the free list in the order of address.
+    for (size_t blockIndex = ChunkBlockNum; blockIndex > 0; --blockIndex)
+    {
+        auto block = chunk + (blockIndex - 1) * blockList.mBlockSize;
+        *reinterpret_cast<void **>(block) = blockList.mBlockFreeList;
+        blockList.mBlockFreeList = block;
+    }
+}
+
+}
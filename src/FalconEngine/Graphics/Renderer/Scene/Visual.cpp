@@ -14,7 +14,9 @@ FALCON_ENGINE_RTTI_IMPLEMENT(Visual, Spatial);
 /* Constructors and Destructor                                          */
 /************************************************************************/
 Visual::Visual(const std::shared_ptr<Mesh>& mesh) :
-    mMesh(mesh)
+    Spatial(SpatialType::Visual),
+    mMesh(mesh),
+    mLodIndex(0)
 {
     // NOTE(Wuxiang): By default Visual "inherit" from Primitives' vertex
     // information. You could override those vertex information by using the
@@ -25,7 +27,9 @@ Visual::Visual(const std::shared_ptr<Mesh>& mesh) :
     mVertexGroup = primitive->GetVertexGroup();
 }
 
-Visual::Visual()
+Visual::Visual() :
+    Spatial(SpatialType::Visual),
+    mLodIndex(0)
 {
 }
 
@@ -152,6 +156,29 @@ Visual::SetMesh(std::shared_ptr<Mesh> mesh)
     mMesh = mesh;
 }
 
+const Primitive *
+Visual::GetPrimitive() const
+{
+    return mMesh->GetLodPrimitive(mLodIndex);
+}
+
+int
+Visual::GetLodIndex() const
+{
+    return mLodIndex;
+}
+
+void
+Visual::SetLodIndex(int lodIndex) const
+{
+    if (lodIndex < 0 || lodIndex >= mMesh->GetLodNum())
+    {
+        FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("Level of detail is out of range.");
+    }
+
+    mLodIndex = lodIndex;
+}
+
 /************************************************************************/
 /* Spatial Management                                                   */
 /************************************************************************/
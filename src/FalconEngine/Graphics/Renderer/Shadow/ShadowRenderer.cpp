@@ -0,0 +1,475 @@
+#include <FalconEngine/Graphics/Renderer/Shadow/ShadowRenderer.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <FalconEngine/Context/GameEngineSettings.h>
+#include <FalconEngine/Graphics/Renderer/Camera.h>
+#include <FalconEngine/Graphics/Renderer/Primitive.h>
+#include <FalconEngine/Graphics/Renderer/Renderer.h>
+#include <FalconEngine/Graphics/Renderer/Viewport.h>
+#include <FalconEngine/Graphics/Renderer/VisualEffectPass.h>
+#include <FalconEngine/Graphics/Renderer/Resource/IndexBuffer.h>
+#include <FalconEngine/Graphics/Renderer/Resource/Sampler.h>
+#include <FalconEngine/Graphics/Renderer/Resource/Texture2dArray.h>
+#include <FalconEngine/Graphics/Renderer/Resource/VertexAttribute.h>
+#include <FalconEngine/Graphics/Renderer/Resource/VertexFormat.h>
+#include <FalconEngine/Graphics/Renderer/Scene/Light.h>
+#include <FalconEngine/Graphics/Renderer/Scene/Mesh.h>
+#include <FalconEngine/Graphics/Renderer/Scene/Visual.h>
+#include <FalconEngine/Graphics/Renderer/Shader/Shader.h>
+#include <FalconEngine/Graphics/Renderer/Shader/ShaderUniformManual.h>
+#include <FalconEngine/Graphics/Renderer/State/BlendState.h>
+#include <FalconEngine/Graphics/Renderer/State/CullState.h>
+#include <FalconEngine/Graphics/Renderer/State/DepthTestState.h>
+#include <FalconEngine/Graphics/Renderer/State/OffsetState.h>
+#include <FalconEngine/Graphics/Renderer/State/StencilTestState.h>
+#include <FalconEngine/Graphics/Renderer/State/WireframeState.h>
+#include <FalconEngine/Math/AABB.h>
+#include <FalconEngine/Math/Handedness.h>
+#include <FalconEngine/Math/Vector4.h>
+
+using namespace std;
+
+namespace FalconEngine
+{
+
+/************************************************************************/
+/* Constructors and Destructor                                          */
+/************************************************************************/
+ShadowRenderer::ShadowRenderer() :
+    mShadowEnabled(false),
+    mShadowRendered(false),
+    mCamera(nullptr),
+    mCameraRendered(nullptr),
+    mLight(nullptr),
+    mCascadeNum(0),
+    mCascadeSize(0),
+    mCascadeSplitLambda(0),
+    mDistance(0),
+    mFilterRadius(0)
+{
+}
+
+ShadowRenderer::~ShadowRenderer()
+{
+}
+
+/************************************************************************/
+/* Rendering API                                                        */
+/************************************************************************/
+bool
+ShadowRenderer::IsShadowEnabled() const
+{
+    return mShadowEnabled;
+}
+
+bool
+ShadowRenderer::IsShadowRendered(const Camera *camera, const Light *light) const
+{
+    return mShadowRendered && camera == mCameraRendered && light == mLight;
+}
+
+const Camera *
+ShadowRenderer::GetCamera() const
+{
+    return mCamera;
+}
+
+void
+ShadowRenderer::SetCamera(const Camera *camera)
+{
+    mCamera = camera;
+}
+
+const Light *
+ShadowRenderer::GetLight() const
+{
+    return mLight;
+}
+
+void
+ShadowRenderer::SetLight(const Light *light)
+{
+    if (light != nullptr && light->GetLightType() != LightType::Directional)
+    {
+        FALCON_ENGINE_THROW_SUPPORT_EXCEPTION();
+    }
+
+    mLight = light;
+}
+
+int
+ShadowRenderer::GetCascadeNum() const
+{
+    return mCascadeNum;
+}
+
+const ShadowCascade *
+ShadowRenderer::GetCascade(int cascadeIndex) const
+{
+    return &mCascadeList.at(cascadeIndex);
+}
+
+int
+ShadowRenderer::GetFilterRadius() const
+{
+    return mFilterRadius;
+}
+
+float
+ShadowRenderer::GetTexelSize() const
+{
+    return mCascadeSize > 0 ? 1.0f / float(mCascadeSize) : 0.0f;
+}
+
+const Texture2dArray *
+ShadowRenderer::GetShadowTexture() const
+{
+    return mShadowTexture.get();
+}
+
+const Sampler *
+ShadowRenderer::GetShadowSampler() const
+{
+    return mShadowSampler.get();
+}
+
+/************************************************************************/
+/* Rendering Engine API                                                 */
+/************************************************************************/
+void
+ShadowRenderer::Initialize()
+{
+    auto gameEngineSettings = GameEngineSettings::GetInstance();
+
+    mShadowEnabled = gameEngineSettings->mShadowEnabled;
+    mCascadeNum = std::min(std::max(gameEngineSettings->mShadowCascadeNum, 1), CascadeNumMax);
+    mCascadeSize = std::max(gameEngineSettings->mShadowCascadeSize, 1);
+    mCascadeSplitLambda = std::min(std::max(gameEngineSettings->mShadowCascadeSplitLambda, 0.0f), 1.0f);
+    mDistance = gameEngineSettings->mShadowDistance;
+    mFilterRadius = std::max(gameEngineSettings->mShadowFilterRadius, 0);
+
+    for (auto& cascade : mCascadeList)
+    {
+        cascade.mViewProjection = Matrix4f::Identity;
+        cascade.mEyeTransform = Matrix4f::Identity;
+        cascade.mSplit = 0;
+    }
+
+    if (!mShadowEnabled)
+    {
+        return;
+    }
+
+    // NOTE: All the cascades are layers of one texture array, so
+    // that the shader selects the cascade without branching on the sampler.
+    mShadowTexture = make_shared<Texture2dArray>(AssetSource::Virtual, "None", "None",
+                     mCascadeSize, mCascadeSize, mCascadeNum,
+                     TextureFormat::D32F, BufferUsage::Static, 0);
+
+    // NOTE: Linear filter makes the hardware compare four texels of
+    // each lookup.
+    mShadowSampler = make_shared<Sampler>(SamplerMinificationFilter::Linear,
+                                          SamplerMagnificationFilter::Linear,
+                                          SamplerWrapMode::ClampToBorder,
+                                          SamplerWrapMode::ClampToBorder,
+                                          SamplerWrapMode::ClampToBorder);
+    mShadowSampler->mCompareEnabled = true;
+
+    mShader = make_shared<Shader>();
+    mShader->PushShaderFile(ShaderType::VertexShader, "Content/Shader/ShadowDepth.vert.glsl");
+    mShader->PushShaderFile(ShaderType::FragmentShader, "Content/Shader/ShadowDepth.frag.glsl");
+
+    // NOTE: The uniforms are pushed before the shader is created on
+    // the device, so that their locations are collected.
+    mShader->PushUniform("fe_ModelViewProjection", ShaderUniformType::FloatMat4);
+    mShader->PushUniform("fe_VertexPositionScale", ShaderUniformType::FloatVec3);
+    mShader->PushUniform("fe_VertexPositionOffset", ShaderUniformType::FloatVec3);
+    mTransformUniform = ShareManual<Matrix4f>("fe_ModelViewProjection", Matrix4f::Identity);
+    mPositionScaleUniform = ShareManual<Vector3f>("fe_VertexPositionScale", Vector3f::One);
+    mPositionOffsetUniform = ShareManual<Vector3f>("fe_VertexPositionOffset", Vector3f::Zero);
+
+    mPass = make_unique<VisualEffectPass>();
+    mPass->SetShader(mShader);
+
+    auto blendState = make_unique<BlendState>();
+    blendState->mEnabled = false;
+    mPass->SetBlendState(move(blendState));
+
+    // NOTE: Both faces are rendered like PhongEffect does, because
+    // the imported geometry is not guaranteed to be closed.
+    auto cullState = make_unique<CullState>();
+    cullState->mEnabled = false;
+    mPass->SetCullState(move(cullState));
+
+    auto depthTestState = make_unique<DepthTestState>();
+    depthTestState->mTestEnabled = true;
+    depthTestState->mWriteEnabled = true;
+    mPass->SetDepthTestState(move(depthTestState));
+
+    // NOTE: Slope scaled bias removes the self shadowing of the
+    // surfaces facing the light at grazing angle.
+    auto offsetState = make_unique<OffsetState>();
+    offsetState->mFillEnabled = true;
+    offsetState->mFactor = 2.0f;
+    offsetState->mUnit = 4.0f;
+    mPass->SetOffsetState(move(offsetState));
+
+    mPass->SetStencilTestState(make_unique<StencilTestState>());
+
+    auto wireframeState = make_unique<WireframeState>();
+    wireframeState->mEnabled = false;
+    mPass->SetWireframeState(move(wireframeState));
+}
+
+void
+ShadowRenderer::RenderBegin()
+{
+    mShadowRendered = false;
+}
+
+void
+ShadowRenderer::Render(const Camera *camera, const std::vector<std::shared_ptr<const Visual>>& visualList)
+{
+    static auto sMasterRenderer = Renderer::GetInstance();
+
+    FALCON_ENGINE_CHECK_NULLPTR(camera);
+
+    if (!mShadowEnabled || mLight == nullptr)
+    {
+        return;
+    }
+
+    auto cameraNear = camera->GetNear();
+    auto cameraFar = camera->GetFar();
+    auto shadowNear = std::max(cameraNear, 0.001f);
+    auto shadowFar = std::min(cameraFar, mDistance);
+    if (shadowFar <= shadowNear)
+    {
+        return;
+    }
+
+    // NOTE: The light space shares the rotation across the cascades,
+    // so that the caster bound is transformed once per frame.
+    auto lightDirection = Vector3f::Normalize(mLight->mDirection);
+    auto lightUp = std::abs(lightDirection.y) > 0.99f ? Vector3f::UnitZ : Vector3f::UnitY;
+    mLightRotation = HandednessRight::GetInstance()->CreateLookAt(Vector3f::Zero, -lightDirection, lightUp);
+
+    // Unproject the corners of camera frustum.
+    auto viewProjectionInverse = Matrix4f::Inverse(camera->GetViewProjection());
+    for (int cornerIndex = 0; cornerIndex < 8; ++cornerIndex)
+    {
+        auto corner = viewProjectionInverse * Vector4f((cornerIndex & 1) ? 1.0f : -1.0f,
+                      (cornerIndex & 2) ? 1.0f : -1.0f,
+                      (cornerIndex & 4) ? 1.0f : -1.0f, 1.0f);
+        mFrustumCorner[cornerIndex] = Vector3f(corner.x, corner.y, corner.z) / corner.w;
+    }
+
+    CollectCaster(visualList);
+
+    auto viewport = *sMasterRenderer->GetViewport();
+    sMasterRenderer->SetViewport(0, 0, float(mCascadeSize), float(mCascadeSize));
+
+    // NOTE: Practical split scheme blends logarithmic split which
+    // keeps the texel density in the view, and uniform split which keeps the
+    // near cascades from being too small.
+    // @ref Fan Zhang, etc, Parallel-Split Shadow Maps for Large-scale Virtual Environments, 2006
+    float splitNear = shadowNear;
+    for (int cascadeIndex = 0; cascadeIndex < mCascadeNum; ++cascadeIndex)
+    {
+        auto ratio = float(cascadeIndex + 1) / float(mCascadeNum);
+        auto splitLogarithmic = shadowNear * std::pow(shadowFar / shadowNear, ratio);
+        auto splitUniform = shadowNear + (shadowFar - shadowNear) * ratio;
+        auto splitFar = mCascadeSplitLambda * splitLogarithmic + (1.0f - mCascadeSplitLambda) * splitUniform;
+
+        UpdateCascade(camera, cascadeIndex, splitNear, splitFar);
+        RenderCascade(cascadeIndex);
+
+        splitNear = splitFar;
+    }
+
+    sMasterRenderer->SetRenderTarget(nullptr, 0);
+    sMasterRenderer->SetViewport(viewport.mLeft, viewport.mBottom, viewport.GetWidth(), viewport.GetHeight());
+
+    mShadowRendered = true;
+    mCameraRendered = camera;
+}
+
+/************************************************************************/
+/* Private Members                                                      */
+/************************************************************************/
+void
+ShadowRenderer::CollectCaster(const std::vector<std::shared_ptr<const Visual>>& visualList)
+{
+    mCasterList.clear();
+
+    for (auto& visualShared : visualList)
+    {
+        auto visual = visualShared.get();
+        auto mesh = visual->GetMesh();
+        if (visual->GetPrimitive()->GetPrimitiveType() != PrimitiveType::Triangle)
+        {
+            continue;
+        }
+
+        // NOTE: Each axis of the transformed box is the sum of the
+        // projected half size on that axis.
+        auto transform = mLightRotation * visual->mWorldTransformInterpolated;
+        auto aabb = mesh->GetAABB();
+        auto center = aabb->GetCenter();
+        auto extent = aabb->GetExtent();
+
+        ShadowCaster caster;
+        caster.mVisual = visual;
+        caster.mCenter = Vector3f(transform * Vector4f(center, 1));
+        for (int axisIndex = 0; axisIndex < 3; ++axisIndex)
+        {
+            caster.mExtent[axisIndex] = std::abs(transform[0][axisIndex]) * extent.x
+                                        + std::abs(transform[1][axisIndex]) * extent.y
+                                        + std::abs(transform[2][axisIndex]) * extent.z;
+        }
+
+        mCasterList.push_back(caster);
+    }
+}
+
+void
+ShadowRenderer::UpdateCascade(const Camera *camera, int cascadeIndex, float splitNear, float splitFar)
+{
+    auto cameraNear = camera->GetNear();
+    auto cameraFar = camera->GetFar();
+
+    // NOTE: Point on the edge of frustum is linear in eye space
+    // distance between the near corner and the far corner.
+    auto ratioNear = (splitNear - cameraNear) / (cameraFar - cameraNear);
+    auto ratioFar = (splitFar - cameraNear) / (cameraFar - cameraNear);
+
+    std::array<Vector3f, 8> corner;
+    Vector3f center = Vector3f::Zero;
+    for (int cornerIndex = 0; cornerIndex < 4; ++cornerIndex)
+    {
+        auto cornerDiff = mFrustumCorner[cornerIndex + 4] - mFrustumCorner[cornerIndex];
+        corner[cornerIndex] = mFrustumCorner[cornerIndex] + cornerDiff * ratioNear;
+        corner[cornerIndex + 4] = mFrustumCorner[cornerIndex] + cornerDiff * ratioFar;
+        center += corner[cornerIndex] + corner[cornerIndex + 4];
+    }
+
+    center /= 8.0f;
+
+    float radius = 0;
+    for (auto& position : corner)
+    {
+        Vector3f positionDiff = position - center;
+        radius = std::max(radius, std::sqrt(Vector3f::Dot(positionDiff, positionDiff)));
+    }
+
+    // NOTE: Round up the radius so that the floating error doesn't
+    // change the texel size of cascade.
+    radius = std::ceil(radius * 16.0f) / 16.0f;
+
+    // Cull the casters in the light space centered at the cascade.
+    auto centerLight = Vector3f(mLightRotation * Vector4f(center, 1));
+    auto casterNearest = radius;
+
+    mCascadeCasterList.clear();
+    for (int casterIndex = 0; casterIndex < int(mCasterList.size()); ++casterIndex)
+    {
+        const auto& caster = mCasterList[casterIndex];
+        auto casterCenter = caster.mCenter - centerLight;
+        const auto& casterExtent = caster.mExtent;
+
+        // NOTE: Caster beside the cascade or behind the far plane
+        // doesn't cast shadow into the cascade. Caster toward the light
+        // always does, which extends the near plane.
+        if (std::abs(casterCenter.x) - casterExtent.x > radius
+                || std::abs(casterCenter.y) - casterExtent.y > radius
+                || casterCenter.z + casterExtent.z < -radius)
+        {
+            continue;
+        }
+
+        casterNearest = std::max(casterNearest, casterCenter.z + casterExtent.z);
+        mCascadeCasterList.push_back(casterIndex);
+    }
+
+    auto view = Matrix4f::CreateTranslation(-centerLight) * mLightRotation;
+    auto projection = HandednessRight::GetInstance()->CreateOrthogonal(-radius, radius, -radius, radius, -casterNearest, radius);
+    auto viewProjection = projection * view;
+
+    // NOTE: Snap the cascade to its texel, so that the world is
+    // always rasterized at the same texel position while the cascade moves.
+    auto texelHalfNum = float(mCascadeSize) * 0.5f;
+    auto origin = viewProjection * Vector4f(0, 0, 0, 1);
+    auto originX = origin.x * texelHalfNum;
+    auto originY = origin.y * texelHalfNum;
+    viewProjection = Matrix4f::CreateTranslation((std::round(originX) - originX) / texelHalfNum,
+                     (std::round(originY) - originY) / texelHalfNum, 0) * viewProjection;
+
+    // NOTE: Map from clip space into texture space, where depth is
+    // in the range of depth buffer.
+    static const Matrix4f sTextureTransform = Matrix4f::CreateTranslation(0.5f, 0.5f, 0.5f)
+            * Matrix4f::CreateScale(0.5f, 0.5f, 0.5f);
+
+    auto& cascade = mCascadeList[cascadeIndex];
+    cascade.mViewProjection = viewProjection;
+    cascade.mEyeTransform = sTextureTransform * viewProjection * Matrix4f::Inverse(camera->GetView());
+    cascade.mSplit = splitFar;
+}
+
+void
+ShadowRenderer::RenderCascade(int cascadeIndex)
+{
+    static auto sMasterRenderer = Renderer::GetInstance();
+
+    sMasterRenderer->SetRenderTarget(mShadowTexture.get(), cascadeIndex);
+
+    // NOTE: Depth write has to be enabled before the depth is
+    // cleared.
+    sMasterRenderer->Enable(mPass.get());
+    sMasterRenderer->ClearDepthBuffer(1.0f);
+    sMasterRenderer->Enable(mShader.get());
+
+    const auto& viewProjection = mCascadeList[cascadeIndex].mViewProjection;
+    for (auto casterIndex : mCascadeCasterList)
+    {
+        auto visual = mCasterList[casterIndex].mVisual;
+        auto mesh = visual->GetMesh();
+
+        // NOTE: The level of detail is the one last selected for the
+        // camera, because the shadow is rendered before the entities.
+        auto primitive = visual->GetPrimitive();
+        auto vertexFormat = visual->GetVertexFormat();
+
+        mTransformUniform->SetValue(viewProjection * visual->mWorldTransformInterpolated);
+
+        // NOTE: Compressed position is decoded the same way as
+        // VisualEffect::SetShaderUniformAutomaticVertexDecode does.
+        if (vertexFormat->mVertexAttributeList[0].mType != VertexAttributeType::FloatVec3)
+        {
+            mPositionScaleUniform->SetValue(mesh->GetAABB()->GetExtent());
+            mPositionOffsetUniform->SetValue(mesh->GetAABB()->GetCenter());
+        }
+        else
+        {
+            mPositionScaleUniform->SetValue(Vector3f::One);
+            mPositionOffsetUniform->SetValue(Vector3f::Zero);
+        }
+
+        sMasterRenderer->Enable(vertexFormat);
+        sMasterRenderer->Enable(visual->GetVertexGroup());
+
+        auto indexBuffer = primitive->GetIndexBuffer();
+        if (indexBuffer)
+        {
+            sMasterRenderer->Enable(indexBuffer);
+        }
+
+        sMasterRenderer->Update(mShader.get(), mTransformUniform.get(), nullptr, nullptr);
+        sMasterRenderer->Update(mShader.get(), mPositionScaleUniform.get(), nullptr, nullptr);
+        sMasterRenderer->Update(mShader.get(), mPositionOffsetUniform.get(), nullptr, nullptr);
+        sMasterRenderer->DrawPrimitivePlatform(primitive, 1);
+    }
+}
+
+}
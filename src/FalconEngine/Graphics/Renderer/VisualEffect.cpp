@@ -1,11 +1,10 @@
 #include <FalconEngine/Graphics/Renderer/VisualEffect.h>
 
-#include <queue>
-
 #include <FalconEngine/Graphics/Renderer/Camera.h>
 #include <FalconEngine/Graphics/Renderer/Renderer.h>
 #include <FalconEngine/Graphics/Renderer/VisualEffectPass.h>
 #include <FalconEngine/Graphics/Renderer/VisualEffectInstance.h>
+#include <FalconEngine/Graphics/Renderer/Batch/BatchRenderer.h>
 #include <FalconEngine/Graphics/Renderer/Resource/VertexAttribute.h>
 #include <FalconEngine/Graphics/Renderer/Resource/VertexFormat.h>
 #include <FalconEngine/Graphics/Renderer/Resource/VertexGroup.h>
@@ -14,6 +13,7 @@
 #include <FalconEngine/Graphics/Renderer/Resource/Texture2d.h>
 #include <FalconEngine/Graphics/Renderer/Resource/Texture2dArray.h>
 #include <FalconEngine/Graphics/Renderer/Resource/Texture3d.h>
+#include <FalconEngine/Graphics/Renderer/Scene/Mesh.h>
 #include <FalconEngine/Graphics/Renderer/Scene/Node.h>
 #include <FalconEngine/Graphics/Renderer/Scene/Visual.h>
 #include <FalconEngine/Graphics/Renderer/State/BlendState.h>
@@ -26,6 +26,7 @@
 #include <FalconEngine/Graphics/Renderer/Shader/ShaderUniform.h>
 #include <FalconEngine/Graphics/Renderer/Shader/ShaderUniformAutomatic.h>
 #include <FalconEngine/Graphics/Renderer/Shader/ShaderUniformManual.h>
+#include <FalconEngine/Math/AABB.h>
 
 using namespace std;
 
@@ -192,49 +193,33 @@ VisualEffect::GetVertexFormat() const
 void
 VisualEffect::TraverseLevelOrder(Node *node, std::function<void(Visual *visual)> visit) const
 {
-    using namespace std;
-
-    queue<pair<Node *, int>> nodeQueueCurrent;
-    queue<pair<Node *, int>> nodeQueueNext;
+    // NOTE: The node list is used as the queue, where the nodes of
+    // next level are appended behind the ones of current level, so that the
+    // traversal allocates only when the list grows.
+    std::vector<Node *> nodeList;
+    nodeList.push_back(node);
 
     // Use level order traversal to complete operation on each mesh.
-    nodeQueueCurrent.push(make_pair(node, 1));
-    while (!nodeQueueCurrent.empty())
+    for (size_t nodeIndex = 0; nodeIndex < nodeList.size(); ++nodeIndex)
     {
-        // Complete traversing current level.
-        while (!nodeQueueCurrent.empty())
-        {
-            auto renderItemCurrent = nodeQueueCurrent.front();
-            auto renderNodeCurrent = renderItemCurrent.first;
-            auto& sceneDepthCurrent = renderItemCurrent.second;
+        auto nodeCurrent = nodeList[nodeIndex];
 
-            nodeQueueCurrent.pop();
-
-            // Visit the children.
-            auto slotNum = renderNodeCurrent->GetChildrenSlotNum();
-            for (auto slotIndex = 0; slotIndex < slotNum; ++slotIndex)
+        // Visit the children.
+        for (auto child = nodeCurrent->GetFirstChild(); child != nullptr; child = child->GetNextSibling())
+        {
+            // Scene graph only consists of two type of spatial objects:
+            // either Node or Visual.
+            if (child->mSpatialType == SpatialType::Visual)
+            {
+                // Perform the given operation only on Mesh child.
+                visit(static_cast<Visual *>(child));
+            }
+            else
             {
-                auto child = renderNodeCurrent->GetChildAt(slotIndex);
-                if (auto childVisual = dynamic_pointer_cast<Visual>(child))
-                {
-                    // Perform the given operation only on Mesh child.
-                    visit(childVisual.get());
-                }
-                else if (auto childNode = dynamic_pointer_cast<Node>(child))
-                {
-                    // Prepare for traversing next level.
-                    nodeQueueNext.push(make_pair(childNode.get(), sceneDepthCurrent + 1));
-                }
-                else
-                {
-                    // Scene graph only consists of two type of spatial objects:
-                    // either Node or Visual.
-                    FALCON_ENGINE_THROW_ASSERTION_EXCEPTION();
-                }
+                // Prepare for traversing next level.
+                nodeList.push_back(static_cast<Node *>(child));
             }
         }
-
-        swap(nodeQueueCurrent, nodeQueueNext);
     }
 }
 
@@ -250,7 +235,7 @@ VisualEffect::SetShaderUniformAutomaticModelTransform(VisualEffectInstance *visu
     visualEffectInstance->SetShaderUniform(passIndex, ShareAutomatic<Matrix4f>(uniformName,
                                            std::bind([](const Visual * visual, const Camera * /* camera */)
     {
-        return visual->mWorldTransform;
+        return visual->mWorldTransformInterpolated;
     }, _1, _2)));
 }
 
@@ -263,7 +248,7 @@ VisualEffect::SetShaderUniformAutomaticModelViewTransform(VisualEffectInstance *
     visualEffectInstance->SetShaderUniform(passIndex, ShareAutomatic<Matrix4f>(uniformName,
                                            std::bind([](const Visual * visual, const Camera * camera)
     {
-        return camera->GetView() * visual->mWorldTransform;
+        return camera->GetView() * visual->mWorldTransformInterpolated;
     }, _1, _2)));
 }
 
@@ -275,7 +260,7 @@ VisualEffect::SetShaderUniformAutomaticModelViewProjectionTransform(VisualEffect
 
     visualEffectInstance->SetShaderUniform(passIndex, ShareAutomatic<Matrix4f>(uniformName, std::bind([](const Visual * visual, const Camera * camera)
     {
-        return camera->GetViewProjection() * visual->mWorldTransform;
+        return camera->GetViewProjection() * visual->mWorldTransformInterpolated;
     }, _1, _2)));
 }
 
@@ -300,7 +285,7 @@ VisualEffect::SetShaderUniformAutomaticNormalTransform(VisualEffectInstance *vis
     visualEffectInstance->SetShaderUniform(passIndex, ShareAutomatic<Matrix3f>(uniformName,
                                            std::bind([](const Visual * visual, const Camera * camera)
     {
-        auto normalTransform = Matrix4f::Transpose(Matrix4f::Inverse(camera->GetView() * visual->mWorldTransform));
+        auto normalTransform = Matrix4f::Transpose(Matrix4f::Inverse(camera->GetView() * visual->mWorldTransformInterpolated));
         return Matrix3f(normalTransform);
     }, _1, _2)));
 }
@@ -335,4 +320,88 @@ VisualEffect::SetShaderUniformAutomaticScreenTransform(VisualEffectInstance *vis
     }, _1, _2)));
 }
 
+void
+VisualEffect::SetShaderUniformAutomaticVertexDecode(VisualEffectInstance *visualEffectInstance, int passIndex) const
+{
+    using namespace std;
+    using namespace std::placeholders;
+
+    // NOTE: Assume the position is at location 0 and the normal is at
+    // location 1. Compressed position is not stored as float vector, and
+    // compressed normal has only two channels.
+    visualEffectInstance->SetShaderUniform(passIndex, ShareAutomatic<Vector3f>("fe_VertexPositionScale",
+                                           std::bind([](const Visual * visual, const Camera *)
+    {
+        if (visual->GetVertexFormat()->mVertexAttributeList[0].mType != VertexAttributeType::FloatVec3)
+        {
+            return visual->GetMesh()->GetAABB()->GetExtent();
+        }
+
+        return Vector3f::One;
+    }, _1, _2)));
+
+    visualEffectInstance->SetShaderUniform(passIndex, ShareAutomatic<Vector3f>("fe_VertexPositionOffset",
+                                           std::bind([](const Visual * visual, const Camera *)
+    {
+        if (visual->GetVertexFormat()->mVertexAttributeList[0].mType != VertexAttributeType::FloatVec3)
+        {
+            return visual->GetMesh()->GetAABB()->GetCenter();
+        }
+
+        return Vector3f::Zero;
+    }, _1, _2)));
+
+    visualEffectInstance->SetShaderUniform(passIndex, ShareAutomatic<bool>("fe_VertexNormalOctahedral",
+                                           std::bind([](const Visual * visual, const Camera *)
+    {
+        return visual->GetVertexFormat()->mVertexAttributeList[1].mChannel == 2;
+    }, _1, _2)));
+}
+
+void
+VisualEffect::SetShaderUniformAutomaticDraw(VisualEffectInstance *visualEffectInstance, int passIndex, const void *key, const void *keySecondary) const
+{
+    using namespace std;
+    using namespace std::placeholders;
+
+    FALCON_ENGINE_CHECK_NULLPTR(key);
+
+    visualEffectInstance->SetShaderBatchKey(passIndex, key, keySecondary);
+
+    // NOTE: The batch renderer enables the instance pass of the first
+    // draw in the batch, so that these values are shared by the entire batch.
+    visualEffectInstance->SetShaderUniform(passIndex, ShareAutomatic<bool>("fe_DrawIndirect",
+                                           std::bind([](const Visual *, const Camera *)
+    {
+        static auto sBatchRenderer = BatchRenderer::GetInstance();
+        return sBatchRenderer->IsBatchDrawing();
+    }, _1, _2)));
+
+    visualEffectInstance->SetShaderUniform(passIndex, ShareAutomatic<Matrix4f>("fe_View",
+                                           std::bind([](const Visual *, const Camera * camera)
+    {
+        return camera->GetView();
+    }, _1, _2)));
+
+    visualEffectInstance->SetShaderUniform(passIndex, ShareAutomatic<Matrix4f>("fe_ViewProjection",
+                                           std::bind([](const Visual *, const Camera * camera)
+    {
+        return camera->GetViewProjection();
+    }, _1, _2)));
+
+    // NOTE: Model transforms are only used when the pass is not drawn
+    // in a batch.
+    visualEffectInstance->SetShaderUniform(passIndex, ShareAutomatic<Matrix4f>("fe_ModelTransform",
+                                           std::bind([](const Visual * visual, const Camera *)
+    {
+        return visual->mWorldTransformInterpolated;
+    }, _1, _2)));
+
+    visualEffectInstance->SetShaderUniform(passIndex, ShareAutomatic<Matrix4f>("fe_ModelNormalTransform",
+                                           std::bind([](const Visual * visual, const Camera *)
+    {
+        return Matrix4f::Transpose(Matrix4f::Inverse(visual->mWorldTransformInterpolated));
+    }, _1, _2)));
+}
+
 }
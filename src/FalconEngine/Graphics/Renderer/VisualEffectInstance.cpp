@@ -56,6 +56,12 @@ VisualEffectInstance::SetShaderInstancingNum(int passIndex, int instancingNum)
     mEffectInstancePassList.at(passIndex)->SetShaderInstancingNum(instancingNum);
 }
 
+void
+VisualEffectInstance::SetShaderBatchKey(int passIndex, const void *key, const void *keySecondary)
+{
+    mEffectInstancePassList.at(passIndex)->SetShaderBatchKey(VisualEffectBatchKey(key, keySecondary));
+}
+
 const Texture *
 VisualEffectInstance::GetShaderTexture(int passIndex, int textureUnit) const
 {
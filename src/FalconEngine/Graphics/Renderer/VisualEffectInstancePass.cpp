@@ -11,7 +11,8 @@ namespace FalconEngine
 /************************************************************************/
 VisualEffectInstancePass::VisualEffectInstancePass(Shader *shader) :
     mShader(shader),
-    mShaderInstancingNum(1)
+    mShaderInstancingNum(1),
+    mShaderBatchKey(nullptr, nullptr)
 {
 }
 
@@ -69,6 +70,18 @@ VisualEffectInstancePass::SetShaderInstancingNum(int instancingNum)
     mShaderInstancingNum = instancingNum;
 }
 
+const VisualEffectBatchKey&
+VisualEffectInstancePass::GetShaderBatchKey() const
+{
+    return mShaderBatchKey;
+}
+
+void
+VisualEffectInstancePass::SetShaderBatchKey(const VisualEffectBatchKey& batchKey)
+{
+    mShaderBatchKey = batchKey;
+}
+
 int
 VisualEffectInstancePass::GetShaderUniformNum() const
 {
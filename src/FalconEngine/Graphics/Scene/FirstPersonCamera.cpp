@@ -1,8 +1,7 @@
 #include <FalconEngine/Graphics/Scene/FirstPersonCamera.h>
 
 #include <FalconEngine/Context/GameEngineInput.h>
-#include <FalconEngine/Input/KeyboardState.h>
-#include <FalconEngine/Input/KeyState.h>
+#include <FalconEngine/Input/InputMap.h>
 #include <FalconEngine/Input/MouseState.h>
 
 namespace FalconEngine
@@ -77,7 +76,15 @@ FirstPersonCamera::Update(GameEngineInput *input, double elapsed)
 
     auto mouse = input->GetMouseState();
     auto mousePositionDiff = mouse->GetPositionDiff();
-    auto keyboard = input->GetKeyboardState();
+
+    // NOTE: The axis is looked up once, the bindings are resolved by
+    // the input every frame.
+    auto inputMap = input->GetInputMap();
+    if (mMoveForwardAxis < 0)
+    {
+        mMoveForwardAxis = inputMap->AddAxis("MoveForward");
+        mMoveRightAxis = inputMap->AddAxis("MoveRight");
+    }
 
     // Update camera orientation.
     {
@@ -113,28 +120,15 @@ FirstPersonCamera::Update(GameEngineInput *input, double elapsed)
 
     // Update camera position.
     {
-        // NEW(Wuxiang): 2017-05-19 17:11 Add keyboard mapping support.
         auto flyDistanceMeter = float(mFlySpeed * tSecond);
 
-        if (keyboard->KeyPressed(Key::S))
-        {
-            MoveBackward(flyDistanceMeter);
-        }
-
-        if (keyboard->KeyPressed(Key::W))
-        {
-            MoveForward(flyDistanceMeter);
-        }
-
-        if (keyboard->KeyPressed(Key::A))
-        {
-            MoveLeft(flyDistanceMeter);
-        }
-
-        if (keyboard->KeyPressed(Key::D))
-        {
-            MoveRight(flyDistanceMeter);
-        }
+        // NOTE: Clamp the axis so that multiple bindings pressed
+        // together don't speed up the movement.
+        auto moveForwardValue = Clamp<float>(inputMap->GetAxisValue(mMoveForwardAxis), -1, 1);
+        auto moveRightValue = Clamp<float>(inputMap->GetAxisValue(mMoveRightAxis), -1, 1);
+
+        MoveForward(flyDistanceMeter * moveForwardValue);
+        MoveRight(flyDistanceMeter * moveRightValue);
     }
 
     Camera::Update(elapsed);
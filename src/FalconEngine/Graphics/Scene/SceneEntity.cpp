@@ -9,7 +9,7 @@ namespace FalconEngine
 /* Constructors and Destructor                                          */
 /************************************************************************/
 SceneEntity::SceneEntity() :
-    SceneEntity(std::make_shared<Node>())
+    SceneEntity(CreateSpatial<Node>())
 {
 }
 
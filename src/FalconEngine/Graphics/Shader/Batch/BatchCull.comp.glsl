@@ -0,0 +1,184 @@
+#version 430 core
+
+// @summary Test the bound of each batched draw against the frustum of its
+// batch, and against the depth pyramid when the batch enables occlusion culling,
+// then compact the commands of visible draws to the front of the batch's
+// command range.
+
+layout(local_size_x = 64) in;
+
+struct fe_DrawCommand
+{
+    uint IndexNum;
+    uint InstanceNum;
+    uint IndexBegin;
+    int  VertexBase;
+    uint InstanceBase;
+};
+
+struct fe_DrawBound
+{
+    vec4 Center;
+    vec4 Extent;
+};
+
+struct fe_CullBatch
+{
+    mat4 ViewProjection;
+    uint CommandBegin;
+    uint OcclusionEnabled;
+};
+
+#fe_extension : enable
+#include "fe_DrawData.glsl"
+#include "fe_DepthPyramid.glsl"
+#fe_extension : disable
+
+layout(std430, binding = 1) readonly buffer fe_DrawBoundBuffer
+{
+    fe_DrawBound fe_DrawBoundArray[];
+};
+
+layout(std430, binding = 2) readonly buffer fe_DrawCommandBuffer
+{
+    fe_DrawCommand fe_DrawCommandArray[];
+};
+
+layout(std430, binding = 3) writeonly buffer fe_DrawCommandCulledBuffer
+{
+    fe_DrawCommand fe_DrawCommandCulledArray[];
+};
+
+layout(std430, binding = 4) buffer fe_DrawCountBuffer
+{
+    uint fe_DrawCountArray[];
+};
+
+layout(std430, binding = 5) readonly buffer fe_CullBatchBuffer
+{
+    uint         fe_CullDrawNum;
+    fe_CullBatch fe_CullBatchArray[];
+};
+
+layout(std430, binding = 6) buffer fe_CullVisibleBuffer
+{
+    uint fe_CullVisibleNum;
+    uint fe_CullOccludedNum;
+};
+
+// @summary Test world space box against the frustum planes extracted from the
+// view projection transform.
+bool
+fe_IsVisible(mat4 viewProjection, vec3 center, vec3 extent)
+{
+    // NOTE: GLSL matrix is indexed by column, so transpose to get
+    // the rows of the transform.
+    mat4 m = transpose(viewProjection);
+    vec4 planes[6] = vec4[6](m[3] + m[0], m[3] - m[0],
+                             m[3] + m[1], m[3] - m[1],
+                             m[3] + m[2], m[3] - m[2]);
+
+    for (int planeIndex = 0; planeIndex < 6; ++planeIndex)
+    {
+        vec4 plane = planes[planeIndex];
+        float distance = dot(plane.xyz, center) + plane.w;
+        float radius = dot(abs(plane.xyz), extent);
+        if (distance + radius < 0.0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// @summary Test world space box against the depth pyramid. The box is
+// occluded when its nearest depth is behind the farthest depth of the pyramid
+// texels covering its screen rectangle.
+bool
+fe_IsOccluded(mat4 viewProjection, vec3 center, vec3 extent)
+{
+    vec3 ndcMin = vec3(1.0);
+    vec3 ndcMax = vec3(-1.0);
+    for (int cornerIndex = 0; cornerIndex < 8; ++cornerIndex)
+    {
+        vec3 corner = center + extent * vec3((cornerIndex & 1) != 0 ? 1.0 : -1.0,
+                                             (cornerIndex & 2) != 0 ? 1.0 : -1.0,
+                                             (cornerIndex & 4) != 0 ? 1.0 : -1.0);
+        vec4 clip = viewProjection * vec4(corner, 1.0);
+
+        // NOTE: Box crossing the near plane is kept.
+        if (clip.w <= 0.0)
+        {
+            return false;
+        }
+
+        vec3 ndc = clip.xyz / clip.w;
+        ndcMin = min(ndcMin, ndc);
+        ndcMax = max(ndcMax, ndc);
+    }
+
+    uvec4 level0 = fe_DepthPyramidLevelArray[0];
+    vec2 pixelMin = clamp((ndcMin.xy * 0.5 + 0.5) * vec2(level0.xy), vec2(0.0), vec2(level0.xy) - 1.0);
+    vec2 pixelMax = clamp((ndcMax.xy * 0.5 + 0.5) * vec2(level0.xy), vec2(0.0), vec2(level0.xy) - 1.0);
+    float depth = clamp(ndcMin.z * 0.5 + 0.5, 0.0, 1.0);
+
+    // NOTE: Select the level where the rectangle covers at most 2x2
+    // texels.
+    vec2 pixelSize = max(pixelMax - pixelMin, vec2(1.0));
+    int levelIndex = clamp(int(ceil(log2(max(pixelSize.x, pixelSize.y)))), 0, int(fe_DepthPyramidLevelNum) - 1);
+
+    uvec4 level = fe_DepthPyramidLevelArray[levelIndex];
+    uvec2 texelMin = min(uvec2(pixelMin) >> uint(levelIndex), level.xy - 1u);
+    uvec2 texelMax = min(uvec2(pixelMax) >> uint(levelIndex), level.xy - 1u);
+
+    float depthOccluder = 0.0;
+    for (uint texelY = texelMin.y; texelY <= texelMax.y; ++texelY)
+    {
+        for (uint texelX = texelMin.x; texelX <= texelMax.x; ++texelX)
+        {
+            depthOccluder = max(depthOccluder, fe_GetDepthPyramid(levelIndex, uvec2(texelX, texelY)));
+        }
+    }
+
+    return depth > depthOccluder;
+}
+
+void
+main()
+{
+    uint drawIndex = gl_GlobalInvocationID.x;
+    if (drawIndex >= fe_CullDrawNum)
+    {
+        return;
+    }
+
+    fe_DrawData drawData = fe_DrawDataArray[drawIndex];
+    fe_CullBatch batch = fe_CullBatchArray[drawData.BatchIndex];
+
+    bool visible = true;
+    if (drawData.BoundIndex >= 0)
+    {
+        fe_DrawBound bound = fe_DrawBoundArray[drawData.BoundIndex];
+
+        // Transform model space box into world space.
+        mat4 model = drawData.ModelTransform;
+        vec3 center = (model * vec4(bound.Center.xyz, 1.0)).xyz;
+        vec3 extent = mat3(abs(model[0].xyz), abs(model[1].xyz), abs(model[2].xyz)) * bound.Extent.xyz;
+
+        visible = fe_IsVisible(batch.ViewProjection, center, extent);
+        if (visible && batch.OcclusionEnabled != 0u && fe_IsOccluded(batch.ViewProjection, center, extent))
+        {
+            visible = false;
+            atomicAdd(fe_CullOccludedNum, 1u);
+        }
+    }
+
+    if (visible)
+    {
+        uint commandIndex = batch.CommandBegin + atomicAdd(fe_DrawCountArray[drawData.BatchIndex], 1u);
+        fe_DrawCommandCulledArray[commandIndex] = fe_DrawCommandArray[drawIndex];
+
+        atomicAdd(fe_CullVisibleNum, 1u);
+    }
+}
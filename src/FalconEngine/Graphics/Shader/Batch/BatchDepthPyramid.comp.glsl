@@ -0,0 +1,94 @@
+#version 430 core
+
+// @summary Build the depth pyramid from the depth captured in previous frame.
+// Each pass is dispatched with one invocation per texel of the level written.
+
+layout(local_size_x = 8, local_size_y = 8) in;
+
+#fe_extension : enable
+#include "fe_DepthPyramid.glsl"
+#fe_extension : disable
+
+layout(std430, binding = 0) readonly buffer fe_DepthBuffer
+{
+    float fe_DepthArray[];
+};
+
+const int fe_DepthPyramidPassClear = 0;
+const int fe_DepthPyramidPassReproject = 1;
+const int fe_DepthPyramidPassReduce = 2;
+
+uniform int fe_DepthPyramidPass;
+uniform int fe_DepthPyramidLevel;
+
+void
+main()
+{
+    uvec2 texel = gl_GlobalInvocationID.xy;
+
+    if (fe_DepthPyramidPass == fe_DepthPyramidPassClear)
+    {
+        uvec4 level = fe_DepthPyramidLevelArray[0];
+        if (any(greaterThanEqual(texel, level.xy)))
+        {
+            return;
+        }
+
+        fe_DepthPyramidArray[fe_GetDepthPyramidIndex(0, texel)] = floatBitsToUint(1.0);
+    }
+    else if (fe_DepthPyramidPass == fe_DepthPyramidPassReproject)
+    {
+        uvec4 level = fe_DepthPyramidLevelArray[0];
+        if (any(greaterThanEqual(texel, level.xy)))
+        {
+            return;
+        }
+
+        // NOTE: Pixel on the far plane has nothing rendered on it.
+        float depth = fe_DepthArray[texel.y * level.x + texel.x];
+        if (depth >= 1.0)
+        {
+            return;
+        }
+
+        vec2 uv = (vec2(texel) + 0.5) / vec2(level.xy);
+        vec4 clip = fe_DepthReprojectTransform * vec4(uv * 2.0 - 1.0, depth * 2.0 - 1.0, 1.0);
+        if (clip.w <= 0.0)
+        {
+            return;
+        }
+
+        vec3 ndc = clip.xyz / clip.w;
+        if (any(lessThan(ndc, vec3(-1.0))) || any(greaterThan(ndc, vec3(1.0))))
+        {
+            return;
+        }
+
+        // NOTE: Positive float compares the same as its bits, so that
+        // the nearest depth landing on the pixel is kept.
+        uvec2 texelCurrent = min(uvec2((ndc.xy * 0.5 + 0.5) * vec2(level.xy)), level.xy - 1u);
+        atomicMin(fe_DepthPyramidArray[fe_GetDepthPyramidIndex(0, texelCurrent)],
+                  floatBitsToUint(ndc.z * 0.5 + 0.5));
+    }
+    else if (fe_DepthPyramidPass == fe_DepthPyramidPassReduce)
+    {
+        uvec4 level = fe_DepthPyramidLevelArray[fe_DepthPyramidLevel];
+        if (any(greaterThanEqual(texel, level.xy)))
+        {
+            return;
+        }
+
+        // NOTE: Level of odd size is covered by clamping the texel
+        // beyond the edge of previous level.
+        uvec4 levelPrevious = fe_DepthPyramidLevelArray[fe_DepthPyramidLevel - 1];
+        uvec2 texelMin = texel * 2u;
+        uvec2 texelMax = min(texelMin + 1u, levelPrevious.xy - 1u);
+
+        float depth = max(max(fe_GetDepthPyramid(fe_DepthPyramidLevel - 1, texelMin),
+                              fe_GetDepthPyramid(fe_DepthPyramidLevel - 1, uvec2(texelMax.x, texelMin.y))),
+                          max(fe_GetDepthPyramid(fe_DepthPyramidLevel - 1, uvec2(texelMin.x, texelMax.y)),
+                              fe_GetDepthPyramid(fe_DepthPyramidLevel - 1, texelMax)));
+
+        fe_DepthPyramidArray[fe_GetDepthPyramidIndex(fe_DepthPyramidLevel, texel)] = floatBitsToUint(depth);
+    }
+}
@@ -12,6 +12,7 @@ layout(location = 0) out vec4 FragColor;
 #fe_extension : enable
 #include "fe_Material.glsl"
 #include "fe_Texture.glsl"
+#include "fe_MaterialTexture.glsl"
 #include "fe_Lighting.glsl"
 #fe_extension : disable
 
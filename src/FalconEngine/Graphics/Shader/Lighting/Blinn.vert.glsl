@@ -15,13 +15,20 @@ uniform mat4 ModelViewProjectionTransform;
 uniform mat4 ModelViewTransform;
 uniform mat3 NormalTransform;
 
+#fe_extension : enable
+#include "fe_Vertex.glsl"
+#fe_extension : disable
+
 void 
 main()
 {      
-    vout.EyeNormal = normalize(NormalTransform * Normal);
-    vout.EyePosition = (ModelViewTransform * vec4(Position, 1.0)).xyz;
+    vec3 position = fe_DecodePosition(Position);
+    vec3 normal = fe_DecodeNormal(Normal);
+
+    vout.EyeNormal = normalize(NormalTransform * normal);
+    vout.EyePosition = (ModelViewTransform * vec4(position, 1.0)).xyz;
     vout.TexCoord = TexCoord;
 
-    gl_Position = ModelViewProjectionTransform * vec4(Position, 1); 
+    gl_Position = ModelViewProjectionTransform * vec4(position, 1); 
 }
  
\ No newline at end of file
@@ -1,10 +1,13 @@
 #version 430 core
+#extension GL_ARB_bindless_texture : enable
 
 in Vout
 {
     noperspective vec3 EyePosition;
     noperspective vec3 EyeNormal;
+    vec3               ShadowEyePosition;
     vec2               TexCoord;
+    flat int           MaterialIndex;
 } fin;
 
 layout(location = 0) out vec4 FragColor;
@@ -15,7 +18,9 @@ layout(location = 0) out vec4 FragColor;
 
 #fe_extension : enable
 #include "fe_Texture.glsl"
+#include "fe_MaterialTexture.glsl"
 #include "fe_Lighting.glsl"
+#include "fe_Shadow.glsl"
 #fe_extension : disable
 
 uniform DirectionalLightData DirectionalLight;
@@ -30,7 +35,7 @@ uniform SpotLightData[SpotLightNumMax] SpotLightArray;
 
 // @status Finished.
 vec3 
-CalcDirectionalLight(DirectionalLightData light, vec3 eyeN, vec3 eyeV)
+CalcDirectionalLight(DirectionalLightData light, vec3 eyeN, vec3 eyeV, float shadow)
 {
     // Point to light source.
     vec3 eyeL = normalize(light.EyeDirection);
@@ -59,7 +64,9 @@ CalcDirectionalLight(DirectionalLightData light, vec3 eyeN, vec3 eyeV)
         cEmissive,
         cSpecular);
 
-    return cAmbient + cDiffuse + cEmissive + cSpecular;
+    // NOTE: Shadow only blocks the light that reaches the surface
+    // directly.
+    return cAmbient + (cDiffuse + cSpecular) * shadow + cEmissive;
 }
 
 // @status Finished.
@@ -155,18 +162,22 @@ CalcSpotLight(SpotLightData light, vec3 eyeN, vec3 eyeV, vec3 eyePosition)
 void 
 main() 
 { 
+    fe_MaterialIndex = fin.MaterialIndex;
+
     vec3 eyeN = normalize(fin.EyeNormal);
 
     // Point to camera.
     vec3 eyeV = normalize(-fin.EyePosition); 
 
-    vec3 frontColor = CalcDirectionalLight(DirectionalLight, eyeN, eyeV);
+    float shadow = fe_CalcShadow(fin.ShadowEyePosition);
+
+    vec3 frontColor = CalcDirectionalLight(DirectionalLight, eyeN, eyeV, shadow);
     for(int i = 0; i < PointLightNum; ++i) 
     {
         frontColor += CalcPointLight(PointLightArray[i], eyeN, eyeV, fin.EyePosition);
     }
 
-    vec3 backColor = CalcDirectionalLight(DirectionalLight, -eyeN, eyeV);
+    vec3 backColor = CalcDirectionalLight(DirectionalLight, -eyeN, eyeV, shadow);
     for(int i = 0; i < PointLightNum; ++i) 
     {
         backColor += CalcPointLight(PointLightArray[i], -eyeN, eyeV, fin.EyePosition);
@@ -1,4 +1,5 @@
 #version 430 core
+#extension GL_ARB_shader_draw_parameters : enable
 
 layout(location = 0) in vec3 Position;
 layout(location = 1) in vec3 Normal;
@@ -8,20 +9,31 @@ out Vout
 {
     noperspective vec3 EyePosition;
     noperspective vec3 EyeNormal;
+    vec3               ShadowEyePosition;                                       // Perspective correct, used for shadow lookup.
     vec2               TexCoord;
+    flat int           MaterialIndex;
 } vout;
- 
-uniform mat4 ModelViewProjectionTransform;
-uniform mat4 ModelViewTransform;
-uniform mat3 NormalTransform;
+
+#fe_extension : enable
+#include "fe_Vertex.glsl"
+#include "fe_DrawData.glsl"
+#include "fe_Draw.glsl"
+#fe_extension : disable
 
 void 
 main()
 {      
-    vout.EyeNormal = normalize(NormalTransform * Normal);
-    vout.EyePosition = (ModelViewTransform * vec4(Position, 1.0)).xyz;
+    vec3 position = fe_DrawDecodePosition(Position);
+    vec3 normal = fe_DrawDecodeNormal(Normal);
+
+    mat4 modelTransform = fe_GetModelTransform();
+    mat3 normalTransform = mat3(fe_View) * mat3(fe_GetModelNormalTransform());
+
+    vout.EyeNormal = normalize(normalTransform * normal);
+    vout.EyePosition = (fe_View * modelTransform * vec4(position, 1.0)).xyz;
+    vout.ShadowEyePosition = vout.EyePosition;
     vout.TexCoord = TexCoord;
+    vout.MaterialIndex = fe_GetMaterialIndex();
 
-    gl_Position = ModelViewProjectionTransform * vec4(Position, 1); 
+    gl_Position = fe_ViewProjection * modelTransform * vec4(position, 1); 
 }
- 
\ No newline at end of file
@@ -0,0 +1,7 @@
+#version 430 core
+
+// NOTE: Only the depth is written, see ShadowRenderer.
+void
+main()
+{
+}
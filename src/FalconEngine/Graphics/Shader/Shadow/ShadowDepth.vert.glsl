@@ -0,0 +1,15 @@
+#version 430 core
+
+layout(location = 0) in vec3 Position;
+
+#fe_extension : enable
+#include "fe_Vertex.glsl"
+#fe_extension : disable
+
+uniform mat4 fe_ModelViewProjection;
+
+void
+main()
+{
+    gl_Position = fe_ModelViewProjection * vec4(fe_DecodePosition(Position), 1.0);
+}
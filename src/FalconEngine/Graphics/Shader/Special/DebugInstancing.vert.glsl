@@ -0,0 +1,23 @@
+#version 430 core
+
+layout(location = 0) in vec3 Position;
+layout(location = 1) in vec4 Color;
+layout(location = 2) in int  Camera;
+layout(location = 3) in mat4 Transform;
+
+out Vout
+{
+    noperspective vec4 Color;
+} vout;
+
+#define CameraMaxNum 4
+uniform mat4[CameraMaxNum] ViewProjectionTransformArray;
+
+void
+main()
+{
+    vout.Color = Color;
+
+    // Transform the unit mesh into world space.
+    gl_Position = ViewProjectionTransformArray[Camera] * Transform * vec4(Position, 1);
+}
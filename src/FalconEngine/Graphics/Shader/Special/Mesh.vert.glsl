@@ -15,11 +15,18 @@ uniform mat3 NormalTransform;
 uniform mat4 ModelViewTransform;
 uniform mat4 ModelViewProjectionTransform;
 
+#fe_extension : enable
+#include "fe_Vertex.glsl"
+#fe_extension : disable
+
 void main()
 {
-    vout.EyeNormal = normalize(NormalTransform * Normal);
-    vout.EyePosition = vec3(ModelViewTransform * vec4(Position, 1.0));
+    vec3 position = fe_DecodePosition(Position);
+    vec3 normal = fe_DecodeNormal(Normal);
+
+    vout.EyeNormal = normalize(NormalTransform * normal);
+    vout.EyePosition = vec3(ModelViewTransform * vec4(position, 1.0));
     vout.TexCoord = TexCoord;
 
-    gl_Position = ModelViewProjectionTransform * vec4(Position, 1.0);
+    gl_Position = ModelViewProjectionTransform * vec4(position, 1.0);
 }
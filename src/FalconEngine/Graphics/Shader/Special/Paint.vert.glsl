@@ -1,22 +1,27 @@
 #version 430 core
+#extension GL_ARB_shader_draw_parameters : enable
 
 layout(location = 0) in vec3 Position;
-layout(location = 0) in vec3 Normal;
-layout(location = 0) in vec3 TexCoord;
+layout(location = 1) in vec3 Normal;
+layout(location = 2) in vec2 TexCoord;
 
 out Vout
 {
     vec4 Color;
 } vout;
  
-uniform mat4 ModelViewProjectionTransform;
 uniform vec4 Color;
 
+#fe_extension : enable
+#include "fe_Vertex.glsl"
+#include "fe_DrawData.glsl"
+#include "fe_Draw.glsl"
+#fe_extension : disable
+
 void 
 main()
 {      
     vout.Color = Color;
     
-    gl_Position = ModelViewProjectionTransform * vec4(Position, 1); 
+    gl_Position = fe_ViewProjection * fe_GetModelTransform() * vec4(fe_DrawDecodePosition(Position), 1); 
 }
- 
\ No newline at end of file
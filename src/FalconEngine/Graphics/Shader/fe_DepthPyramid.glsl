@@ -0,0 +1,27 @@
+// @summary Hierarchical depth buffer built by BatchDepthPyramid.comp.glsl,
+// whose header mirrors BatchDepthPyramidHeader. Depth is stored as the bits
+// of float, so that it could be reduced with atomic operation.
+layout(std430, binding = 7) buffer fe_DepthPyramidBuffer
+{
+    uint fe_DepthPyramidArray[];
+};
+
+layout(std430, binding = 8) readonly buffer fe_DepthPyramidHeaderBuffer
+{
+    mat4  fe_DepthReprojectTransform;
+    uint  fe_DepthPyramidLevelNum;
+    uvec4 fe_DepthPyramidLevelArray[16];                                        // Width, height and offset of each level.
+};
+
+uint
+fe_GetDepthPyramidIndex(int levelIndex, uvec2 texel)
+{
+    uvec4 level = fe_DepthPyramidLevelArray[levelIndex];
+    return level.z + texel.y * level.x + texel.x;
+}
+
+float
+fe_GetDepthPyramid(int levelIndex, uvec2 texel)
+{
+    return uintBitsToFloat(fe_DepthPyramidArray[fe_GetDepthPyramidIndex(levelIndex, texel)]);
+}
@@ -0,0 +1,94 @@
+// @summary Per draw data of batched draw, see BatchRenderer. When the pass is
+// not drawn in a batch, the data is read from the uniforms instead. Requires
+// GL_ARB_shader_draw_parameters being enabled when it is available.
+
+// #include "fe_Vertex.glsl".
+// #include "fe_DrawData.glsl".
+
+// NOTE: Draw index advanced per instance, which is selected by the
+// base instance of the draw command. Used when draw parameters are not
+// supported.
+layout(location = 15) in float fe_DrawIndex;
+
+uniform bool fe_DrawIndirect;
+
+uniform mat4 fe_View;
+uniform mat4 fe_ViewProjection;
+uniform mat4 fe_ModelTransform;
+uniform mat4 fe_ModelNormalTransform;
+
+// @summary Index of the draw data of current draw.
+int
+fe_GetDrawIndex()
+{
+#if defined(GL_ARB_shader_draw_parameters)
+    // NOTE: Draw id is not used because it restarts from zero in
+    // each multi-draw call and it is changed by command compaction. The base
+    // instance of each command is the draw index.
+    return gl_BaseInstanceARB;
+#else
+    return int(fe_DrawIndex);
+#endif
+}
+
+mat4
+fe_GetModelTransform()
+{
+    if (fe_DrawIndirect)
+    {
+        return fe_DrawDataArray[fe_GetDrawIndex()].ModelTransform;
+    }
+
+    return fe_ModelTransform;
+}
+
+mat4
+fe_GetModelNormalTransform()
+{
+    if (fe_DrawIndirect)
+    {
+        return fe_DrawDataArray[fe_GetDrawIndex()].ModelNormalTransform;
+    }
+
+    return fe_ModelNormalTransform;
+}
+
+// @summary Decode position with the vertex decoding of current draw.
+vec3
+fe_DrawDecodePosition(vec3 position)
+{
+    if (fe_DrawIndirect)
+    {
+        int drawIndex = fe_GetDrawIndex();
+        return fe_DecodePosition(position,
+                                 fe_DrawDataArray[drawIndex].VertexPositionScale.xyz,
+                                 fe_DrawDataArray[drawIndex].VertexPositionOffset.xyz);
+    }
+
+    return fe_DecodePosition(position);
+}
+
+// @summary Decode normal with the vertex decoding of current draw.
+vec3
+fe_DrawDecodeNormal(vec3 normal)
+{
+    if (fe_DrawIndirect)
+    {
+        return fe_DecodeNormal(normal, fe_DrawDataArray[fe_GetDrawIndex()].VertexPositionOffset.w > 0.5);
+    }
+
+    return fe_DecodeNormal(normal);
+}
+
+// @summary Index of the material data of current draw, see
+// fe_MaterialTexture.glsl.
+int
+fe_GetMaterialIndex()
+{
+    if (fe_DrawIndirect)
+    {
+        return fe_DrawDataArray[fe_GetDrawIndex()].MaterialIndex;
+    }
+
+    return -1;
+}
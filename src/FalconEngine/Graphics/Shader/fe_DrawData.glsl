@@ -0,0 +1,16 @@
+// @summary Per draw data of batched draw, which mirrors BatchDrawData.
+struct fe_DrawData
+{
+    mat4 ModelTransform;
+    mat4 ModelNormalTransform;
+    vec4 VertexPositionScale;
+    vec4 VertexPositionOffset;                                                  // W component is one when normal is octahedral encoded.
+    int  BoundIndex;                                                            // Negative when the draw has no bound.
+    int  BatchIndex;
+    int  MaterialIndex;                                                         // Negative when the material is read from the uniforms.
+};
+
+layout(std430, binding = 0) readonly buffer fe_DrawDataBuffer
+{
+    fe_DrawData fe_DrawDataArray[];
+};
@@ -89,6 +89,7 @@ CalcPhongLighting(
 //
 // #include "fe_Material.glsl".
 // #include "fe_Texture.glsl".
+// #include "fe_MaterialTexture.glsl".
 void
 CalcPhongLighting(
 
@@ -111,55 +112,11 @@ CalcPhongLighting(
     out vec3 cEmissive,
     out vec3 cSpecular)
 {
-    vec3 mAmbient;
-    if (fe_TextureAmbientExist)
-    {
-        mAmbient = vec3(texture(fe_TextureAmbient, texCoord));
-    }
-    else
-    {
-        mAmbient = fe_Material.Ambient;
-    }
-
-    vec3 mDiffuse;
-    if (fe_TextureDiffuseExist)
-    {
-        mDiffuse = vec3(texture(fe_TextureDiffuse, texCoord));
-    }
-    else
-    {
-        mDiffuse = fe_Material.Diffuse;
-    }
-
-    vec3 mEmissive;
-    if (fe_TextureEmissiveExist)
-    {
-        mEmissive = vec3(texture(fe_TextureEmissive, texCoord));
-    }
-    else
-    {
-        mEmissive = fe_Material.Emissive;
-    }
-
-    float mShininess;
-    if (fe_TextureShininessExist)
-    {
-        mShininess = texture(fe_TextureShininess, texCoord).a;
-    }
-    else
-    {
-        mShininess = fe_Material.Shininess;
-    }
-
-    vec3 mSpecular;
-    if (fe_TextureSpecularExist)
-    {
-        mSpecular = vec3(texture(fe_TextureSpecular, texCoord));
-    }
-    else
-    {
-        mSpecular = fe_Material.Specular;
-    }
+    vec3 mAmbient = fe_GetMaterialAmbient(texCoord);
+    vec3 mDiffuse = fe_GetMaterialDiffuse(texCoord);
+    vec3 mEmissive = fe_GetMaterialEmissive(texCoord);
+    float mShininess = fe_GetMaterialShininess(texCoord);
+    vec3 mSpecular = fe_GetMaterialSpecular(texCoord);
 
     CalcPhongLighting(
         // @parameter Transform.
@@ -230,6 +187,7 @@ CalcBlinnPhongLighting(
 //
 // #include "fe_Material.glsl".
 // #include "fe_Texture.glsl".
+// #include "fe_MaterialTexture.glsl".
 void
 CalcBlinnPhongLighting(
 
@@ -252,55 +210,11 @@ CalcBlinnPhongLighting(
     out vec3 cEmissive,
     out vec3 cSpecular)
 {
-    vec3 mAmbient;
-    if (fe_TextureAmbientExist)
-    {
-        mAmbient = vec3(texture(fe_TextureAmbient, texCoord));
-    }
-    else
-    {
-        mAmbient = fe_Material.Ambient;
-    }
-
-    vec3 mDiffuse;
-    if (fe_TextureDiffuseExist)
-    {
-        mDiffuse = vec3(texture(fe_TextureDiffuse, texCoord));
-    }
-    else
-    {
-        mDiffuse = fe_Material.Diffuse;
-    }
-
-    vec3 mEmissive;
-    if (fe_TextureEmissiveExist)
-    {
-        mEmissive = vec3(texture(fe_TextureEmissive, texCoord));
-    }
-    else
-    {
-        mEmissive = fe_Material.Emissive;
-    }
-
-    float mShininess;
-    if (fe_TextureShininessExist)
-    {
-        mShininess = texture(fe_TextureShininess, texCoord).a;
-    }
-    else
-    {
-        mShininess = fe_Material.Shininess;
-    }
-
-    vec3 mSpecular;
-    if (fe_TextureSpecularExist)
-    {
-        mSpecular = vec3(texture(fe_TextureSpecular, texCoord));
-    }
-    else
-    {
-        mSpecular = fe_Material.Specular;
-    }
+    vec3 mAmbient = fe_GetMaterialAmbient(texCoord);
+    vec3 mDiffuse = fe_GetMaterialDiffuse(texCoord);
+    vec3 mEmissive = fe_GetMaterialEmissive(texCoord);
+    float mShininess = fe_GetMaterialShininess(texCoord);
+    vec3 mSpecular = fe_GetMaterialSpecular(texCoord);
 
     CalcBlinnPhongLighting(
         // @parameter Transform.
@@ -0,0 +1,183 @@
+// @summary Material color of current fragment. When the fragment is drawn in a
+// batch, the material is read from the material buffer of the batch, see
+// BatchRenderer, otherwise from the uniforms. The texture of buffered material
+// is read either from the layer of material texture array, or through bindless
+// handle when GL_ARB_bindless_texture is enabled.
+
+// #include "fe_Material.glsl".
+// #include "fe_Texture.glsl".
+
+// @summary Mirrors BatchMaterialData.
+struct fe_MaterialData
+{
+    vec4  Ambient;
+    vec4  Diffuse;
+    vec4  Emissive;
+    vec4  Specular;                                                             // W component is shininess.
+    uvec2 TextureAmbient;                                                       // Bindless handle.
+    uvec2 TextureDiffuse;
+    uvec2 TextureEmissive;
+    uvec2 TextureShininess;
+    uvec2 TextureSpecular;
+    uint  TextureExist;                                                         // Bit of each existing texture handle.
+    int   AmbientLayer;                                                         // Layer in fe_TextureMaterial, negative when not packed.
+    int   DiffuseLayer;
+    int   EmissiveLayer;
+    int   ShininessLayer;
+    int   SpecularLayer;
+};
+
+layout(std430, binding = 9) readonly buffer fe_MaterialBuffer
+{
+    fe_MaterialData fe_MaterialArray[];
+};
+
+const uint fe_MaterialTextureAmbient   = 1u;
+const uint fe_MaterialTextureDiffuse   = 2u;
+const uint fe_MaterialTextureEmissive  = 4u;
+const uint fe_MaterialTextureShininess = 8u;
+const uint fe_MaterialTextureSpecular  = 16u;
+
+// @summary Index of material data of current fragment, which is passed from
+// vertex shader. Negative when the material is read from the uniforms.
+int fe_MaterialIndex = -1;
+
+vec3
+fe_GetMaterialAmbient(vec2 texCoord)
+{
+    if (fe_MaterialIndex >= 0)
+    {
+        if (fe_MaterialArray[fe_MaterialIndex].AmbientLayer >= 0)
+        {
+            return vec3(texture(fe_TextureMaterial, vec3(texCoord, fe_MaterialArray[fe_MaterialIndex].AmbientLayer)));
+        }
+
+#if defined(GL_ARB_bindless_texture)
+        if ((fe_MaterialArray[fe_MaterialIndex].TextureExist & fe_MaterialTextureAmbient) != 0u)
+        {
+            return vec3(texture(sampler2D(fe_MaterialArray[fe_MaterialIndex].TextureAmbient), texCoord));
+        }
+#endif
+
+        return fe_MaterialArray[fe_MaterialIndex].Ambient.xyz;
+    }
+
+    if (fe_TextureAmbientExist)
+    {
+        return vec3(texture(fe_TextureAmbient, texCoord));
+    }
+
+    return fe_Material.Ambient;
+}
+
+vec3
+fe_GetMaterialDiffuse(vec2 texCoord)
+{
+    if (fe_MaterialIndex >= 0)
+    {
+        if (fe_MaterialArray[fe_MaterialIndex].DiffuseLayer >= 0)
+        {
+            return vec3(texture(fe_TextureMaterial, vec3(texCoord, fe_MaterialArray[fe_MaterialIndex].DiffuseLayer)));
+        }
+
+#if defined(GL_ARB_bindless_texture)
+        if ((fe_MaterialArray[fe_MaterialIndex].TextureExist & fe_MaterialTextureDiffuse) != 0u)
+        {
+            return vec3(texture(sampler2D(fe_MaterialArray[fe_MaterialIndex].TextureDiffuse), texCoord));
+        }
+#endif
+
+        return fe_MaterialArray[fe_MaterialIndex].Diffuse.xyz;
+    }
+
+    if (fe_TextureDiffuseExist)
+    {
+        return vec3(texture(fe_TextureDiffuse, texCoord));
+    }
+
+    return fe_Material.Diffuse;
+}
+
+vec3
+fe_GetMaterialEmissive(vec2 texCoord)
+{
+    if (fe_MaterialIndex >= 0)
+    {
+        if (fe_MaterialArray[fe_MaterialIndex].EmissiveLayer >= 0)
+        {
+            return vec3(texture(fe_TextureMaterial, vec3(texCoord, fe_MaterialArray[fe_MaterialIndex].EmissiveLayer)));
+        }
+
+#if defined(GL_ARB_bindless_texture)
+        if ((fe_MaterialArray[fe_MaterialIndex].TextureExist & fe_MaterialTextureEmissive) != 0u)
+        {
+            return vec3(texture(sampler2D(fe_MaterialArray[fe_MaterialIndex].TextureEmissive), texCoord));
+        }
+#endif
+
+        return fe_MaterialArray[fe_MaterialIndex].Emissive.xyz;
+    }
+
+    if (fe_TextureEmissiveExist)
+    {
+        return vec3(texture(fe_TextureEmissive, texCoord));
+    }
+
+    return fe_Material.Emissive;
+}
+
+float
+fe_GetMaterialShininess(vec2 texCoord)
+{
+    if (fe_MaterialIndex >= 0)
+    {
+        if (fe_MaterialArray[fe_MaterialIndex].ShininessLayer >= 0)
+        {
+            return texture(fe_TextureMaterial, vec3(texCoord, fe_MaterialArray[fe_MaterialIndex].ShininessLayer)).a;
+        }
+
+#if defined(GL_ARB_bindless_texture)
+        if ((fe_MaterialArray[fe_MaterialIndex].TextureExist & fe_MaterialTextureShininess) != 0u)
+        {
+            return texture(sampler2D(fe_MaterialArray[fe_MaterialIndex].TextureShininess), texCoord).a;
+        }
+#endif
+
+        return fe_MaterialArray[fe_MaterialIndex].Specular.w;
+    }
+
+    if (fe_TextureShininessExist)
+    {
+        return texture(fe_TextureShininess, texCoord).a;
+    }
+
+    return fe_Material.Shininess;
+}
+
+vec3
+fe_GetMaterialSpecular(vec2 texCoord)
+{
+    if (fe_MaterialIndex >= 0)
+    {
+        if (fe_MaterialArray[fe_MaterialIndex].SpecularLayer >= 0)
+        {
+            return vec3(texture(fe_TextureMaterial, vec3(texCoord, fe_MaterialArray[fe_MaterialIndex].SpecularLayer)));
+        }
+
+#if defined(GL_ARB_bindless_texture)
+        if ((fe_MaterialArray[fe_MaterialIndex].TextureExist & fe_MaterialTextureSpecular) != 0u)
+        {
+            return vec3(texture(sampler2D(fe_MaterialArray[fe_MaterialIndex].TextureSpecular), texCoord));
+        }
+#endif
+
+        return fe_MaterialArray[fe_MaterialIndex].Specular.xyz;
+    }
+
+    if (fe_TextureSpecularExist)
+    {
+        return vec3(texture(fe_TextureSpecular, texCoord));
+    }
+
+    return fe_Material.Specular;
+}
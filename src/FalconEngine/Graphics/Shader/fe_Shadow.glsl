@@ -0,0 +1,58 @@
+// @summary Cascaded shadow of the directional light, see ShadowRenderer.
+layout (binding = 7) uniform sampler2DArrayShadow fe_TextureShadow;
+
+#define fe_ShadowCascadeNumMax 4
+uniform bool  fe_ShadowEnabled;
+uniform int   fe_ShadowCascadeNum;
+uniform mat4  fe_ShadowTransform[fe_ShadowCascadeNumMax];                      // From eye space into the texture space of each cascade.
+uniform vec4  fe_ShadowSplit;                                                   // Eye space distance of the far plane of each cascade.
+uniform int   fe_ShadowFilterRadius;                                            // Radius of PCF kernel in texel.
+uniform float fe_ShadowTexelSize;
+
+// @summary Fraction of the directional light reaching the eye space position.
+// The position has to be interpolated with perspective correction.
+float
+fe_CalcShadow(vec3 eyePosition)
+{
+    if (!fe_ShadowEnabled)
+    {
+        return 1.0;
+    }
+
+    float distance = abs(eyePosition.z);
+
+    int cascadeIndex = -1;
+    for (int i = 0; i < fe_ShadowCascadeNum; ++i)
+    {
+        if (distance <= fe_ShadowSplit[i])
+        {
+            cascadeIndex = i;
+            break;
+        }
+    }
+
+    // NOTE: Position beyond the shadow distance is lit.
+    if (cascadeIndex < 0)
+    {
+        return 1.0;
+    }
+
+    // NOTE: Cascade is orthographic, so that w is one.
+    vec3 shadowPosition = (fe_ShadowTransform[cascadeIndex] * vec4(eyePosition, 1.0)).xyz;
+
+    // NOTE: Each lookup compares four texels with linear filter, so
+    // that zero radius is still filtered. Larger radius costs quadratically
+    // more lookups.
+    float lit = 0.0;
+    for (int y = -fe_ShadowFilterRadius; y <= fe_ShadowFilterRadius; ++y)
+    {
+        for (int x = -fe_ShadowFilterRadius; x <= fe_ShadowFilterRadius; ++x)
+        {
+            vec2 texCoord = shadowPosition.xy + vec2(x, y) * fe_ShadowTexelSize;
+            lit += texture(fe_TextureShadow, vec4(texCoord, float(cascadeIndex), shadowPosition.z));
+        }
+    }
+
+    float tapNum = float((2 * fe_ShadowFilterRadius + 1) * (2 * fe_ShadowFilterRadius + 1));
+    return lit / tapNum;
+}
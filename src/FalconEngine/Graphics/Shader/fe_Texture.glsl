@@ -4,6 +4,7 @@ layout (binding = 2) uniform sampler2D      fe_TextureEmissive;
 layout (binding = 3) uniform sampler2D      fe_TextureShininess;
 layout (binding = 4) uniform sampler2D      fe_TextureSpecular;
 layout (binding = 5) uniform sampler2DArray fe_TextureFont;
+layout (binding = 6) uniform sampler2DArray fe_TextureMaterial;
 uniform              bool                   fe_TextureAmbientExist;
 uniform              bool                   fe_TextureDiffuseExist;
 uniform              bool                   fe_TextureEmissiveExist;
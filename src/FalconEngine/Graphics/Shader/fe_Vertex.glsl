@@ -0,0 +1,44 @@
+// @summary Vertex decoding for compressed vertex format. For uncompressed
+// vertex, position scale is one, position offset is zero and normal is not
+// octahedral encoded, so that the decoding is identity.
+uniform vec3 fe_VertexPositionScale;
+uniform vec3 fe_VertexPositionOffset;
+uniform bool fe_VertexNormalOctahedral;
+
+// @summary Decode AABB relative position back into model space.
+vec3
+fe_DecodePosition(vec3 position, vec3 scale, vec3 offset)
+{
+    return position * scale + offset;
+}
+
+vec3
+fe_DecodePosition(vec3 position)
+{
+    return fe_DecodePosition(position, fe_VertexPositionScale, fe_VertexPositionOffset);
+}
+
+// @summary Decode octahedral encoded normal stored in xy component.
+vec3
+fe_DecodeNormal(vec3 normal, bool octahedral)
+{
+    if (octahedral)
+    {
+        vec3 n = vec3(normal.xy, 1.0 - abs(normal.x) - abs(normal.y));
+        if (n.z < 0.0)
+        {
+            vec2 s = vec2(n.x >= 0.0 ? 1.0 : -1.0, n.y >= 0.0 ? 1.0 : -1.0);
+            n.xy = (1.0 - abs(n.yx)) * s;
+        }
+
+        return normalize(n);
+    }
+
+    return normal;
+}
+
+vec3
+fe_DecodeNormal(vec3 normal)
+{
+    return fe_DecodeNormal(normal, fe_VertexNormalOctahedral);
+}
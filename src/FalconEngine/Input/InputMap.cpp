@@ -0,0 +1,219 @@
+#include <FalconEngine/Input/InputMap.h>
+
+#include <FalconEngine/Input/KeyboardState.h>
+#include <FalconEngine/Input/MouseState.h>
+
+namespace FalconEngine
+{
+
+/************************************************************************/
+/* Constructors and Destructor                                          */
+/************************************************************************/
+InputBinding::InputBinding(Key key, float scale) :
+    mType(InputBindingType::Key),
+    mCode(int(key)),
+    mScale(scale)
+{
+}
+
+InputBinding::InputBinding(MouseButton button, float scale) :
+    mType(InputBindingType::MouseButton),
+    mCode(int(button)),
+    mScale(scale)
+{
+}
+
+InputBinding::InputBinding(MouseAxis axis, float scale) :
+    mType(InputBindingType::MouseAxis),
+    mCode(int(axis)),
+    mScale(scale)
+{
+}
+
+InputAction::InputAction(const std::string& name) :
+    mName(name)
+{
+}
+
+InputAxis::InputAxis(const std::string& name) :
+    mName(name)
+{
+}
+
+InputMap::InputMap()
+{
+}
+
+/************************************************************************/
+/* Action                                                               */
+/************************************************************************/
+int
+InputMap::AddAction(const std::string& name)
+{
+    auto actionIter = mActionTable.find(name);
+    if (actionIter != mActionTable.end())
+    {
+        return actionIter->second;
+    }
+
+    auto action = int(mActionList.size());
+    mActionList.emplace_back(name);
+    mActionTable.insert({ name, action });
+    return action;
+}
+
+void
+InputMap::BindAction(int action, const InputBinding& binding)
+{
+    mActionList.at(action).mBindingList.push_back(binding);
+}
+
+void
+InputMap::UnbindAction(int action)
+{
+    mActionList.at(action).mBindingList.clear();
+}
+
+int
+InputMap::GetAction(const std::string& name) const
+{
+    auto actionIter = mActionTable.find(name);
+    return actionIter != mActionTable.end() ? actionIter->second : -1;
+}
+
+bool
+InputMap::ActionPressed(int action) const
+{
+    return mActionList[action].mPressed;
+}
+
+bool
+InputMap::ActionDown(int action) const
+{
+    return mActionList[action].mDown;
+}
+
+bool
+InputMap::ActionUp(int action) const
+{
+    return mActionList[action].mUp;
+}
+
+/************************************************************************/
+/* Axis                                                                 */
+/************************************************************************/
+int
+InputMap::AddAxis(const std::string& name)
+{
+    auto axisIter = mAxisTable.find(name);
+    if (axisIter != mAxisTable.end())
+    {
+        return axisIter->second;
+    }
+
+    auto axis = int(mAxisList.size());
+    mAxisList.emplace_back(name);
+    mAxisTable.insert({ name, axis });
+    return axis;
+}
+
+void
+InputMap::BindAxis(int axis, const InputBinding& binding)
+{
+    mAxisList.at(axis).mBindingList.push_back(binding);
+}
+
+void
+InputMap::UnbindAxis(int axis)
+{
+    mAxisList.at(axis).mBindingList.clear();
+}
+
+int
+InputMap::GetAxis(const std::string& name) const
+{
+    auto axisIter = mAxisTable.find(name);
+    return axisIter != mAxisTable.end() ? axisIter->second : -1;
+}
+
+float
+InputMap::GetAxisValue(int axis) const
+{
+    return mAxisList[axis].mValue;
+}
+
+/************************************************************************/
+/* Internal Members                                                     */
+/************************************************************************/
+void
+InputMap::UpdateEvent(const KeyboardState *keyboard, const MouseState *mouse)
+{
+    for (auto& action : mActionList)
+    {
+        auto actionPressedPrevious = action.mPressed;
+        auto actionPressedCurrent = false;
+        for (const auto& binding : action.mBindingList)
+        {
+            if (GetBindingValue(binding, keyboard, mouse) != 0.0f)
+            {
+                actionPressedCurrent = true;
+                break;
+            }
+        }
+
+        // NOTE: The transition is of the action rather than of the
+        // binding, so that pressing the other binding of the pressed action
+        // does not press it again.
+        action.mPressed = actionPressedCurrent;
+        action.mDown = actionPressedCurrent && !actionPressedPrevious;
+        action.mUp = !actionPressedCurrent && actionPressedPrevious;
+    }
+
+    for (auto& axis : mAxisList)
+    {
+        auto axisValue = 0.0f;
+        for (const auto& binding : axis.mBindingList)
+        {
+            axisValue += GetBindingValue(binding, keyboard, mouse);
+        }
+
+        axis.mValue = axisValue;
+    }
+}
+
+/************************************************************************/
+/* Private Members                                                      */
+/************************************************************************/
+float
+InputMap::GetBindingValue(const InputBinding& binding, const KeyboardState *keyboard, const MouseState *mouse) const
+{
+    switch (binding.mType)
+    {
+    case InputBindingType::Key:
+        return keyboard->KeyPressed(Key(binding.mCode)) ? binding.mScale : 0.0f;
+
+    case InputBindingType::MouseButton:
+        return mouse->ButtonPressed(MouseButton(binding.mCode)) ? binding.mScale : 0.0f;
+
+    case InputBindingType::MouseAxis:
+        switch (MouseAxis(binding.mCode))
+        {
+        case MouseAxis::PositionX:
+            return mouse->GetPositionDiff().x * binding.mScale;
+
+        case MouseAxis::PositionY:
+            return mouse->GetPositionDiff().y * binding.mScale;
+
+        case MouseAxis::Wheel:
+            return mouse->GetWheelValueDiff() * binding.mScale;
+
+        default:
+            FALCON_ENGINE_THROW_ASSERTION_EXCEPTION();
+        }
+
+    default:
+        FALCON_ENGINE_THROW_ASSERTION_EXCEPTION();
+    }
+}
+
+}
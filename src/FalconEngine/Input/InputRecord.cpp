@@ -0,0 +1,29 @@
+#include <FalconEngine/Input/InputRecord.h>
+
+namespace FalconEngine
+{
+
+/************************************************************************/
+/* Constructors and Destructor                                          */
+/************************************************************************/
+InputEvent::InputEvent() :
+    mType(0),
+    mCode(0),
+    mPressed(false),
+    mX(0),
+    mY(0),
+    mTime(0)
+{
+}
+
+InputEvent::InputEvent(InputEventType type, int code, bool pressed, double x, double y, double time) :
+    mType(uint8_t(type)),
+    mCode(int16_t(code)),
+    mPressed(pressed),
+    mX(x),
+    mY(y),
+    mTime(time)
+{
+}
+
+}
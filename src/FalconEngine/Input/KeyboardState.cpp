@@ -1,140 +1,75 @@
 #include <FalconEngine/Input/KeyboardState.h>
 
-#include <vector>
-
-#include <FalconEngine/Context/GameTimer.h>
-
 namespace FalconEngine
 {
 
+// @return Index of the key in the bit sets, or -1 when the key is unknown.
+static int
+GetKeyIndex(Key key)
+{
+    auto keyIndex = int(key);
+    return keyIndex >= 0 && keyIndex < KeyboardState::KeyNum ? keyIndex : -1;
+}
+
 /************************************************************************/
 /* Constructors and Destructor                                          */
 /************************************************************************/
 KeyboardState::KeyboardState()
 {
-    // NOTE(Wuxiang): Copy from the Key enum value.
-    static std::vector<int> sKeyCode = { 32, 39, 44, 45, 46, 47, 48, 49, 50, 51,
-                                         52, 53, 54, 55, 56, 57, 59, 61, 65, 66,
-                                         67, 68, 69, 70, 71, 72, 73, 74, 75, 76,
-                                         77, 78, 79, 80, 81, 82, 83, 84, 85, 86,
-                                         87, 88, 89, 90, 91, 92, 93, 96, 161, 162,
-                                         256, 257, 258, 259, 260, 261, 262, 263,
-                                         264, 265, 266, 267, 268, 269, 280, 281,
-                                         282, 283, 284, 290, 291, 292, 293, 294,
-                                         295, 296, 297, 298, 299, 300, 301, 302,
-                                         303, 304, 305, 306, 307, 308, 309, 310,
-                                         311, 312, 313, 314, 320, 321, 322, 323,
-                                         324, 325, 326, 327, 328, 329, 330, 331,
-                                         332, 333, 334, 335, 336, 340, 341, 342,
-                                         343, 344, 345, 346, 347, 348
-                                       };
-
-    int keyNum = int(sKeyCode.size());
-    for (int keyIndex = 0; keyIndex < keyNum ; ++keyIndex)
-    {
-        auto key = Key(sKeyCode[keyIndex]);
-        insert({ key, KeyState(key) });
-    }
 }
 
-
 bool
 KeyboardState::KeyDown(Key key) const
 {
-    return at(key).mDown;
+    auto keyIndex = GetKeyIndex(key);
+    return keyIndex >= 0 && mKeyDown[keyIndex];
 }
 
 bool
 KeyboardState::KeyPressed(Key key) const
 {
-    return at(key).mPressed;
+    auto keyIndex = GetKeyIndex(key);
+    return keyIndex >= 0 && mKeyPressed[keyIndex];
 }
 
 bool
 KeyboardState::KeyUp(Key key) const
 {
-    return at(key).mPressed;
+    auto keyIndex = GetKeyIndex(key);
+    return keyIndex >= 0 && mKeyUp[keyIndex];
 }
 
 void
-KeyboardState::SetKeyInternal(Key key, bool kepPressed, double timeCurrent)
-{
-    auto keyPressedPrevious = at(key).mPressed;
-    auto keyPressedCurrent = kepPressed;
-    auto& keyState = at(key);
-    keyState.mKeyChanged = true;
-
-    UpdateKey(keyState, keyPressedCurrent, keyPressedPrevious, timeCurrent);
-}
-
-/************************************************************************/
-/* Private Members                                                      */
-/************************************************************************/
-void
-KeyboardState::UpdateEvent(double /* elapsed */)
+KeyboardState::SetKeyInternal(Key key, bool keyPressed, double /* timeCurrent */)
 {
-    for (auto& keyStatePair : *this)
+    // NOTE: GLFW reports the key not in the layout as unknown, which
+    // has no state to update.
+    auto keyIndex = GetKeyIndex(key);
+    if (keyIndex < 0)
     {
-        auto& keyState = keyStatePair.second;
-
-        // NOTE(Wuxiang): The event polling has not polled anything reflecting
-        // position changes. So the position is not changed. We have to reset
-        // position difference.
-        if (!keyState.mKeyChanged)
-        {
-            UpdateKey(keyState,
-                      keyState.mPressed,
-                      keyState.mPressed,
-                      GameTimer::GetMilliseconds());
-        }
-        else
-        {
-            // Reset change flag if there has been changes during this frame.
-            keyState.mKeyChanged = false;
-        }
+        return;
     }
+
+    auto keyPressedPrevious = mKeyPressed[keyIndex];
+    auto keyPressedCurrent = keyPressed;
+    mKeyChanged[keyIndex] = true;
+    mKeyPressed[keyIndex] = keyPressedCurrent;
+
+    // NOTE: The key is just pressed or just released when the state
+    // differs, otherwise it is a repeat which has no transition.
+    mKeyDown[keyIndex] = keyPressedCurrent && !keyPressedPrevious;
+    mKeyUp[keyIndex] = !keyPressedCurrent && keyPressedPrevious;
 }
 
 void
-KeyboardState::UpdateKey(KeyState& keyState,
-                         bool      keyPressedCurrent,
-                         bool      keyPressedPrevious,
-                         double    timeCurrent)
+KeyboardState::UpdateEvent(double /* elapsed */)
 {
-    // When just pressed.
-    if (keyPressedCurrent && !keyPressedPrevious)
-    {
-        keyState.mPressed = true;
-        keyState.mPressedMoment = timeCurrent;
-
-        keyState.mDown = true;
-        keyState.mUp = false;
-    }
-
-    // When just released.
-    else if (!keyPressedCurrent && keyPressedPrevious)
-    {
-        keyState.mPressed = false;
-        keyState.mPressedMoment = 0;
-
-        keyState.mDown = false;
-        keyState.mUp = true;
-    }
-
-    // When still pressed.
-    else if (keyPressedCurrent /*&& keyPressedPrevious*/)
-    {
-        // NOTE(Wuxiang): Need not modify the mPressedMoment.
-        keyState.mDown = false;
-        keyState.mUp = false;
-    }
-
-    // When still released.
-    else // (!keyPressedCurrent && !keyPressedPrevious)
-    {
-        keyState.mDown = false;
-        keyState.mUp = false;
-    }
+    // NOTE: The event polling has not polled anything for the key not
+    // changed, so its transition happened in last frame. We have to reset the
+    // transition and the change flag for this frame.
+    mKeyDown &= mKeyChanged;
+    mKeyUp &= mKeyChanged;
+    mKeyChanged.reset();
 }
 
 }
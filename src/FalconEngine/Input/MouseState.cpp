@@ -1,9 +1,17 @@
 #include <FalconEngine/Input/MouseState.h>
-#include <FalconEngine/Context/GameTimer.h>
 
 namespace FalconEngine
 {
 
+// @return Index of the button in the bit sets, or -1 when the button is not
+// supported.
+static int
+GetButtonIndex(MouseButton button)
+{
+    auto buttonIndex = int(button);
+    return buttonIndex >= 0 && buttonIndex < MouseState::ButtonNum ? buttonIndex : -1;
+}
+
 /************************************************************************/
 /* Constructors and Destructor                                          */
 /************************************************************************/
@@ -21,37 +29,47 @@ MouseState::MouseState() :
 bool
 MouseState::ButtonPressed(MouseButton button) const
 {
-    return mButtonTable.at(button).mPressed;
+    auto buttonIndex = GetButtonIndex(button);
+    return buttonIndex >= 0 && mButtonPressed[buttonIndex];
 }
 
 bool
 MouseState::ButtonReleased(MouseButton button) const
 {
-    return !mButtonTable.at(button).mPressed;
+    return !ButtonPressed(button);
 }
 
 bool
 MouseState::ButtonDown(MouseButton button) const
 {
-    return mButtonTable.at(button).mDown;
+    auto buttonIndex = GetButtonIndex(button);
+    return buttonIndex >= 0 && mButtonDown[buttonIndex];
 }
 
 bool
 MouseState::ButtonUp(MouseButton button) const
 {
-    return mButtonTable.at(button).mUp;
+    auto buttonIndex = GetButtonIndex(button);
+    return buttonIndex >= 0 && mButtonUp[buttonIndex];
 }
 
 void
-MouseState::SetButtonInternal(MouseButton button, bool buttonPressed, double timeCurrent)
+MouseState::SetButtonInternal(MouseButton button, bool buttonPressed, double /* timeCurrent */)
 {
-    auto& buttonState = mButtonTable.at(button);
-    buttonState.mButtonChanged = true;
+    // NOTE: The extra buttons GLFW reports are not tracked.
+    auto buttonIndex = GetButtonIndex(button);
+    if (buttonIndex < 0)
+    {
+        return;
+    }
 
+    auto buttonPressedPrevious = mButtonPressed[buttonIndex];
     auto buttonPressedCurrent = buttonPressed;
-    auto buttonPressedPrevious = buttonState.mPressed;
+    mButtonChanged[buttonIndex] = true;
+    mButtonPressed[buttonIndex] = buttonPressedCurrent;
 
-    UpdateButton(buttonState, buttonPressedCurrent, buttonPressedPrevious, timeCurrent);
+    mButtonDown[buttonIndex] = buttonPressedCurrent && !buttonPressedPrevious;
+    mButtonUp[buttonIndex] = !buttonPressedCurrent && buttonPressedPrevious;
 }
 
 Vector2f
@@ -126,70 +144,14 @@ MouseState::UpdateEvent(double /* elapsed */)
     }
 
     // Same idea as above.
-    for (auto& buttonStatePair : mButtonTable)
-    {
-        auto& buttonState = buttonStatePair.second;
-        if (!buttonState.mButtonChanged)
-        {
-            UpdateButton(buttonState,
-                         buttonState.mPressed,
-                         buttonState.mPressed,
-                         GameTimer::GetMilliseconds());
-        }
-        else
-        {
-            buttonState.mButtonChanged = false;
-        }
-    }
+    mButtonDown &= mButtonChanged;
+    mButtonUp &= mButtonChanged;
+    mButtonChanged.reset();
 }
 
 /************************************************************************/
 /* Private Members                                                      */
 /************************************************************************/
-void
-MouseState::UpdateButton(MouseButtonState& buttonState,
-                         bool              buttonPressedCurrent,
-                         bool              buttonPressedPrevious,
-                         double            timeCurrent)
-{
-    // When just pressed.
-    if (buttonPressedCurrent && !buttonPressedPrevious)
-    {
-        Debug::OutputString("K");
-
-        buttonState.mPressed = true;
-        buttonState.mPressedMoment = timeCurrent;
-
-        buttonState.mDown = true;
-        buttonState.mUp = false;
-    }
-
-    // When just released.
-    else if (!buttonPressedCurrent && buttonPressedPrevious)
-    {
-        buttonState.mPressed = false;
-        buttonState.mPressedMoment = 0;
-
-        buttonState.mDown = false;
-        buttonState.mUp = true;
-    }
-
-    // When still pressed.
-    else if (buttonPressedCurrent /*&& buttonPressedPrevious*/)
-    {
-        // NOTE(Wuxiang): Need not modify the mPressedMoment.
-        buttonState.mDown = false;
-        buttonState.mUp = false;
-    }
-
-    // When still released.
-    else // (!buttonPressedCurrent && !buttonPressedPrevious)
-    {
-        buttonState.mUp = false;
-        buttonState.mDown = false;
-    }
-}
-
 void
 MouseState::UpdatePosition(Vector2f mousePositionCurrent, Vector2f mousePositionPrevious)
 {
@@ -11,6 +11,12 @@ AABB::AABB(const Vector3f& position)
     Initialize(position);
 }
 
+AABB::AABB(const Vector3f& positionMin, const Vector3f& positionMax) :
+    mMax(positionMax),
+    mMin(positionMin)
+{
+}
+
 /************************************************************************/
 /* Public Members                                                       */
 /************************************************************************/
@@ -55,4 +61,16 @@ AABB::Extend(const Vector3f& position)
     }
 }
 
+Vector3f
+AABB::GetCenter() const
+{
+    return (mMax + mMin) * 0.5f;
+}
+
+Vector3f
+AABB::GetExtent() const
+{
+    return (mMax - mMin) * 0.5f;
+}
+
 }
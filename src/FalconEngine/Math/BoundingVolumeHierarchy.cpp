@@ -0,0 +1,538 @@
+#include <FalconEngine/Math/BoundingVolumeHierarchy.h>
+
+#include <algorithm>
+#include <limits>
+
+using namespace std;
+
+namespace FalconEngine
+{
+
+static AABB
+Union(const AABB& lhs, const AABB& rhs)
+{
+    return AABB(Vector3f(min(lhs.mMin.x, rhs.mMin.x), min(lhs.mMin.y, rhs.mMin.y), min(lhs.mMin.z, rhs.mMin.z)),
+                Vector3f(max(lhs.mMax.x, rhs.mMax.x), max(lhs.mMax.y, rhs.mMax.y), max(lhs.mMax.z, rhs.mMax.z)));
+}
+
+static AABB
+CreateEmpty()
+{
+    const auto infinity = numeric_limits<float>::infinity();
+    return AABB(Vector3f(infinity), Vector3f(-infinity));
+}
+
+class BoundingVolumeBin
+{
+public:
+    BoundingVolumeBin() :
+        mBound(CreateEmpty()),
+        mCount(0)
+    {
+    }
+
+public:
+    AABB mBound;
+    int  mCount;
+};
+
+/************************************************************************/
+/* Constructors and Destructor                                          */
+/************************************************************************/
+BoundingVolumeNode::BoundingVolumeNode() :
+    mBound(Vector3f::Zero),
+    mData(nullptr),
+    mParent(BoundingVolumeHierarchy::NullIndex),
+    mChild{ BoundingVolumeHierarchy::NullIndex, BoundingVolumeHierarchy::NullIndex },
+    mHeight(-1)
+{
+}
+
+BoundingVolumeHierarchy::BoundingVolumeHierarchy(float margin) :
+    mNodeFree(NullIndex),
+    mRoot(NullIndex),
+    mObjectNum(0),
+    mMargin(margin)
+{
+}
+
+BoundingVolumeHierarchy::~BoundingVolumeHierarchy()
+{
+}
+
+/************************************************************************/
+/* Object Management                                                    */
+/************************************************************************/
+int
+BoundingVolumeHierarchy::Insert(const AABB& aabb, void *data)
+{
+    auto leafIndex = AllocateNode();
+    auto& leaf = mNodeList[leafIndex];
+    leaf.mBound = AABB(aabb.mMin - Vector3f(mMargin), aabb.mMax + Vector3f(mMargin));
+    leaf.mData = data;
+    leaf.mHeight = 0;
+
+    InsertLeaf(leafIndex);
+    ++mObjectNum;
+
+    return leafIndex;
+}
+
+void
+BoundingVolumeHierarchy::Remove(int proxy)
+{
+    GetData(proxy);
+
+    RemoveLeaf(proxy);
+    FreeNode(proxy);
+    --mObjectNum;
+}
+
+bool
+BoundingVolumeHierarchy::Move(int proxy, const AABB& aabb)
+{
+    if (GetBound(proxy).Contains(aabb))
+    {
+        return false;
+    }
+
+    RemoveLeaf(proxy);
+    mNodeList[proxy].mBound = AABB(aabb.mMin - Vector3f(mMargin), aabb.mMax + Vector3f(mMargin));
+    InsertLeaf(proxy);
+
+    return true;
+}
+
+void
+BoundingVolumeHierarchy::Refit(int proxy, const AABB& aabb)
+{
+    GetData(proxy);
+
+    mNodeList[proxy].mBound = AABB(aabb.mMin - Vector3f(mMargin), aabb.mMax + Vector3f(mMargin));
+    for (auto nodeIndex = mNodeList[proxy].mParent; nodeIndex != NullIndex; nodeIndex = mNodeList[nodeIndex].mParent)
+    {
+        UpdateNode(nodeIndex);
+    }
+}
+
+void
+BoundingVolumeHierarchy::Rebuild()
+{
+    vector<int> leafList;
+    leafList.reserve(mObjectNum);
+
+    // NOTE: The centroid is indexed by the leaf node.
+    vector<Vector3f> centroidList(mNodeList.size());
+    for (int nodeIndex = 0; nodeIndex < int(mNodeList.size()); ++nodeIndex)
+    {
+        auto& node = mNodeList[nodeIndex];
+        if (node.mHeight == 0)
+        {
+            leafList.push_back(nodeIndex);
+            centroidList[nodeIndex] = (node.mBound.mMin + node.mBound.mMax) * 0.5f;
+        }
+        else if (node.mHeight > 0)
+        {
+            FreeNode(nodeIndex);
+        }
+    }
+
+    if (leafList.empty())
+    {
+        mRoot = NullIndex;
+        return;
+    }
+
+    mRoot = BuildNode(leafList.data(), leafList.data() + leafList.size(), centroidList);
+    mNodeList[mRoot].mParent = NullIndex;
+}
+
+void
+BoundingVolumeHierarchy::Clear()
+{
+    mNodeList.clear();
+    mNodeFree = NullIndex;
+    mRoot = NullIndex;
+    mObjectNum = 0;
+}
+
+const AABB&
+BoundingVolumeHierarchy::GetBound(int proxy) const
+{
+    if (proxy < 0 || proxy >= int(mNodeList.size()) || mNodeList[proxy].mHeight != 0)
+    {
+        FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("Invalid proxy.");
+    }
+
+    return mNodeList[proxy].mBound;
+}
+
+void *
+BoundingVolumeHierarchy::GetData(int proxy) const
+{
+    if (proxy < 0 || proxy >= int(mNodeList.size()) || mNodeList[proxy].mHeight != 0)
+    {
+        FALCON_ENGINE_THROW_RUNTIME_EXCEPTION("Invalid proxy.");
+    }
+
+    return mNodeList[proxy].mData;
+}
+
+int
+BoundingVolumeHierarchy::GetObjectNum() const
+{
+    return mObjectNum;
+}
+
+int
+BoundingVolumeHierarchy::GetHeight() const
+{
+    return mRoot == NullIndex ? 0 : mNodeList[mRoot].mHeight;
+}
+
+float
+BoundingVolumeHierarchy::GetCost() const
+{
+    if (mRoot == NullIndex)
+    {
+        return 0.0f;
+    }
+
+    auto area = 0.0f;
+    for (const auto& node : mNodeList)
+    {
+        if (node.mHeight > 0)
+        {
+            area += node.mBound.GetArea();
+        }
+    }
+
+    auto rootArea = mNodeList[mRoot].mBound.GetArea();
+    return rootArea > 0.0f ? area / rootArea : 0.0f;
+}
+
+/************************************************************************/
+/* Query                                                                */
+/************************************************************************/
+int
+BoundingVolumeHierarchy::Raycast(const Ray& ray, float distanceMax, float& distance) const
+{
+    auto proxyNearest = NullIndex;
+    QueryRay(ray, distanceMax, [&](int proxy, float distanceCurrent)
+    {
+        float distanceHit;
+        if (ray.Intersects(mNodeList[proxy].mBound, distanceCurrent, distanceHit))
+        {
+            proxyNearest = proxy;
+            distance = distanceHit;
+            return distanceHit;
+        }
+
+        return distanceCurrent;
+    });
+
+    return proxyNearest;
+}
+
+/************************************************************************/
+/* Private Members                                                      */
+/************************************************************************/
+int
+BoundingVolumeHierarchy::AllocateNode()
+{
+    if (mNodeFree == NullIndex)
+    {
+        mNodeList.push_back(BoundingVolumeNode());
+        return int(mNodeList.size()) - 1;
+    }
+
+    auto nodeIndex = mNodeFree;
+    mNodeFree = mNodeList[nodeIndex].mParent;
+    mNodeList[nodeIndex] = BoundingVolumeNode();
+    return nodeIndex;
+}
+
+void
+BoundingVolumeHierarchy::FreeNode(int nodeIndex)
+{
+    auto& node = mNodeList[nodeIndex];
+    node.mData = nullptr;
+    node.mParent = mNodeFree;
+    node.mChild[0] = NullIndex;
+    node.mChild[1] = NullIndex;
+    node.mHeight = -1;
+    mNodeFree = nodeIndex;
+}
+
+void
+BoundingVolumeHierarchy::InsertLeaf(int leafIndex)
+{
+    if (mRoot == NullIndex)
+    {
+        mRoot = leafIndex;
+        mNodeList[leafIndex].mParent = NullIndex;
+        return;
+    }
+
+    // NOTE: Descend into the child which increases the surface area
+    // of the tree the least, until pairing with the current node is cheaper.
+    auto leafBound = mNodeList[leafIndex].mBound;
+    auto siblingIndex = mRoot;
+    while (!mNodeList[siblingIndex].IsLeaf())
+    {
+        const auto& node = mNodeList[siblingIndex];
+        auto area = node.mBound.GetArea();
+        auto areaCombined = Union(node.mBound, leafBound).GetArea();
+
+        // Cost of creating a new parent for this node and the leaf.
+        auto cost = areaCombined;
+
+        // Cost the ancestors pay for pushing the leaf further down.
+        auto costInherited = areaCombined - area;
+
+        float costChild[2];
+        for (int i = 0; i < 2; ++i)
+        {
+            const auto& child = mNodeList[node.mChild[i]];
+            auto areaChildCombined = Union(child.mBound, leafBound).GetArea();
+            costChild[i] = (child.IsLeaf() ? areaChildCombined : areaChildCombined - child.mBound.GetArea()) + costInherited;
+        }
+
+        if (cost < costChild[0] && cost < costChild[1])
+        {
+            break;
+        }
+
+        siblingIndex = costChild[0] < costChild[1] ? node.mChild[0] : node.mChild[1];
+    }
+
+    auto parentIndexOld = mNodeList[siblingIndex].mParent;
+    auto parentIndex = AllocateNode();
+    {
+        auto& parent = mNodeList[parentIndex];
+        parent.mParent = parentIndexOld;
+        parent.mChild[0] = siblingIndex;
+        parent.mChild[1] = leafIndex;
+    }
+
+    mNodeList[siblingIndex].mParent = parentIndex;
+    mNodeList[leafIndex].mParent = parentIndex;
+
+    if (parentIndexOld == NullIndex)
+    {
+        mRoot = parentIndex;
+    }
+    else
+    {
+        auto& parentOld = mNodeList[parentIndexOld];
+        parentOld.mChild[parentOld.mChild[0] == siblingIndex ? 0 : 1] = parentIndex;
+    }
+
+    // Refit and rotate the ancestors.
+    for (auto nodeIndex = parentIndex; nodeIndex != NullIndex; nodeIndex = mNodeList[nodeIndex].mParent)
+    {
+        Rotate(nodeIndex);
+    }
+}
+
+void
+BoundingVolumeHierarchy::RemoveLeaf(int leafIndex)
+{
+    if (leafIndex == mRoot)
+    {
+        mRoot = NullIndex;
+        return;
+    }
+
+    auto parentIndex = mNodeList[leafIndex].mParent;
+    auto& parent = mNodeList[parentIndex];
+    auto grandParentIndex = parent.mParent;
+    auto siblingIndex = parent.mChild[0] == leafIndex ? parent.mChild[1] : parent.mChild[0];
+
+    mNodeList[siblingIndex].mParent = grandParentIndex;
+    FreeNode(parentIndex);
+
+    if (grandParentIndex == NullIndex)
+    {
+        mRoot = siblingIndex;
+        return;
+    }
+
+    auto& grandParent = mNodeList[grandParentIndex];
+    grandParent.mChild[grandParent.mChild[0] == parentIndex ? 0 : 1] = siblingIndex;
+
+    for (auto nodeIndex = grandParentIndex; nodeIndex != NullIndex; nodeIndex = mNodeList[nodeIndex].mParent)
+    {
+        Rotate(nodeIndex);
+    }
+}
+
+void
+BoundingVolumeHierarchy::Rotate(int nodeIndex)
+{
+    auto& node = mNodeList[nodeIndex];
+
+    // NOTE: Consider swapping either child with a grandchild under the
+    // other child. The swap only changes the bound of the other child, so that
+    // the best swap is the one which shrinks that bound the most.
+    auto areaDiffBest = 0.0f;
+    auto swapChild = NullIndex;
+    auto swapGrandchild = NullIndex;
+    for (int childIndex = 0; childIndex < 2; ++childIndex)
+    {
+        const auto& child = mNodeList[node.mChild[childIndex]];
+        const auto& childOther = mNodeList[node.mChild[1 - childIndex]];
+        if (childOther.IsLeaf())
+        {
+            continue;
+        }
+
+        for (int grandchildIndex = 0; grandchildIndex < 2; ++grandchildIndex)
+        {
+            const auto& grandchildKept = mNodeList[childOther.mChild[1 - grandchildIndex]];
+            auto areaDiff = Union(child.mBound, grandchildKept.mBound).GetArea() - childOther.mBound.GetArea();
+            if (areaDiff < areaDiffBest)
+            {
+                areaDiffBest = areaDiff;
+                swapChild = childIndex;
+                swapGrandchild = grandchildIndex;
+            }
+        }
+    }
+
+    if (swapChild != NullIndex)
+    {
+        auto childIndex = node.mChild[swapChild];
+        auto childOtherIndex = node.mChild[1 - swapChild];
+        auto grandchildIndex = mNodeList[childOtherIndex].mChild[swapGrandchild];
+
+        node.mChild[swapChild] = grandchildIndex;
+        mNodeList[grandchildIndex].mParent = nodeIndex;
+
+        mNodeList[childOtherIndex].mChild[swapGrandchild] = childIndex;
+        mNodeList[childIndex].mParent = childOtherIndex;
+
+        UpdateNode(childOtherIndex);
+    }
+
+    UpdateNode(nodeIndex);
+}
+
+void
+BoundingVolumeHierarchy::UpdateNode(int nodeIndex)
+{
+    auto& node = mNodeList[nodeIndex];
+    const auto& child0 = mNodeList[node.mChild[0]];
+    const auto& child1 = mNodeList[node.mChild[1]];
+
+    node.mBound = Union(child0.mBound, child1.mBound);
+    node.mHeight = 1 + max(child0.mHeight, child1.mHeight);
+}
+
+int
+BoundingVolumeHierarchy::BuildNode(int *leafBegin, int *leafEnd, const std::vector<Vector3f>& centroidList)
+{
+    auto leafNum = int(leafEnd - leafBegin);
+    if (leafNum == 1)
+    {
+        return *leafBegin;
+    }
+
+    // Split on the longest axis of the centroid bound.
+    auto centroidBound = CreateEmpty();
+    for (auto leaf = leafBegin; leaf != leafEnd; ++leaf)
+    {
+        const auto& centroid = centroidList[*leaf];
+        centroidBound = Union(centroidBound, AABB(centroid, centroid));
+    }
+
+    auto centroidSize = centroidBound.mMax - centroidBound.mMin;
+    auto axis = centroidSize.x > centroidSize.y ? (centroidSize.x > centroidSize.z ? 0 : 2) : (centroidSize.y > centroidSize.z ? 1 : 2);
+    auto axisMin = centroidBound.mMin[axis];
+    auto axisSize = centroidSize[axis];
+
+    int *leafMiddle = nullptr;
+    if (axisSize > 0.0f)
+    {
+        const int BinNum = 16;
+
+        auto binIndex = [&](int leaf)
+        {
+            return min(int(BinNum * (centroidList[leaf][axis] - axisMin) / axisSize), BinNum - 1);
+        };
+
+        array<BoundingVolumeBin, BinNum> binList;
+        for (auto leaf = leafBegin; leaf != leafEnd; ++leaf)
+        {
+            auto& bin = binList[binIndex(*leaf)];
+            bin.mBound = Union(bin.mBound, mNodeList[*leaf].mBound);
+            ++bin.mCount;
+        }
+
+        // NOTE: Sweep from the right to accumulate the cost of the
+        // right side of each split, then from the left to find the cheapest.
+        array<float, BinNum> costRight;
+        {
+            auto bound = CreateEmpty();
+            auto count = 0;
+            for (int bin = BinNum - 1; bin > 0; --bin)
+            {
+                bound = Union(bound, binList[bin].mBound);
+                count += binList[bin].mCount;
+                costRight[bin] = count > 0 ? bound.GetArea() * count : 0.0f;
+            }
+        }
+
+        auto costBest = numeric_limits<float>::max();
+        auto splitBest = 0;
+        {
+            auto bound = CreateEmpty();
+            auto count = 0;
+            for (int bin = 1; bin < BinNum; ++bin)
+            {
+                bound = Union(bound, binList[bin - 1].mBound);
+                count += binList[bin - 1].mCount;
+
+                auto cost = (count > 0 ? bound.GetArea() * count : 0.0f) + costRight[bin];
+                if (cost < costBest)
+                {
+                    costBest = cost;
+                    splitBest = bin;
+                }
+            }
+        }
+
+        leafMiddle = partition(leafBegin, leafEnd, [&](int leaf)
+        {
+            return binIndex(leaf) < splitBest;
+        });
+    }
+
+    // NOTE: Split in half when the centroids can't be separated, so
+    // that the tree is balanced for the objects at the same position.
+    if (leafMiddle == nullptr || leafMiddle == leafBegin || leafMiddle == leafEnd)
+    {
+        leafMiddle = leafBegin + leafNum / 2;
+        nth_element(leafBegin, leafMiddle, leafEnd, [&](int lhs, int rhs)
+        {
+            return centroidList[lhs][axis] < centroidList[rhs][axis];
+        });
+    }
+
+    // NOTE: Build the children before taking the reference to the
+    // node, because allocation might reallocate the node list.
+    auto child0 = BuildNode(leafBegin, leafMiddle, centroidList);
+    auto child1 = BuildNode(leafMiddle, leafEnd, centroidList);
+
+    auto nodeIndex = AllocateNode();
+    auto& node = mNodeList[nodeIndex];
+    node.mChild[0] = child0;
+    node.mChild[1] = child1;
+    mNodeList[child0].mParent = nodeIndex;
+    mNodeList[child1].mParent = nodeIndex;
+    UpdateNode(nodeIndex);
+
+    return nodeIndex;
+}
+
+}
@@ -0,0 +1,46 @@
+#include <FalconEngine/Math/Frustum.h>
+
+#include <cmath>
+
+namespace FalconEngine
+{
+
+/************************************************************************/
+/* Static Members                                                       */
+/************************************************************************/
+Frustum
+Frustum::CreateFromViewProjection(const Matrix4f& viewProjection)
+{
+    // NOTE: The matrix is column major, so that the row is gathered
+    // from the same component of each column.
+    auto row = [&viewProjection](int i)
+    {
+        return Vector4f(viewProjection[0][i], viewProjection[1][i], viewProjection[2][i], viewProjection[3][i]);
+    };
+
+    auto row0 = row(0);
+    auto row1 = row(1);
+    auto row2 = row(2);
+    auto row3 = row(3);
+
+    Frustum frustum;
+    frustum.mPlaneList[0] = row3 + row0;
+    frustum.mPlaneList[1] = row3 - row0;
+    frustum.mPlaneList[2] = row3 + row1;
+    frustum.mPlaneList[3] = row3 - row1;
+    frustum.mPlaneList[4] = row3 + row2;
+    frustum.mPlaneList[5] = row3 - row2;
+
+    for (auto& plane : frustum.mPlaneList)
+    {
+        auto length = std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+        if (length > 0.0f)
+        {
+            plane = Vector4f(plane.x / length, plane.y / length, plane.z / length, plane.w / length);
+        }
+    }
+
+    return frustum;
+}
+
+}
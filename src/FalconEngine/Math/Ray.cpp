@@ -0,0 +1,25 @@
+#include <FalconEngine/Math/Ray.h>
+
+#include <limits>
+
+namespace FalconEngine
+{
+
+/************************************************************************/
+/* Constructors and Destructor                                          */
+/************************************************************************/
+Ray::Ray(const Vector3f& origin, const Vector3f& direction) :
+    mOrigin(origin),
+    mDirection(Vector3f::Normalize(direction))
+{
+    const auto infinity = std::numeric_limits<float>::infinity();
+
+    // NOTE: Use infinity on the axis the ray is parallel to, so that
+    // the slab test on that axis either passes or fails entirely. The NaN from
+    // the origin on the slab plane is ignored by the comparison in the test.
+    mDirectionInverse = Vector3f(mDirection.x != 0.0f ? 1.0f / mDirection.x : infinity,
+                                 mDirection.y != 0.0f ? 1.0f / mDirection.y : infinity,
+                                 mDirection.z != 0.0f ? 1.0f / mDirection.z : infinity);
+}
+
+}
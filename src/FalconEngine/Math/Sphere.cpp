@@ -1,4 +1,4 @@
-#include <FalconEngine/Input/KeyState.h>
+#include <FalconEngine/Math/Sphere.h>
 
 namespace FalconEngine
 {
@@ -6,19 +6,10 @@ namespace FalconEngine
 /************************************************************************/
 /* Constructors and Destructor                                          */
 /************************************************************************/
-KeyState::KeyState() :
-    mKey(Key::Unknown),
-    mPressed(false),
-    mUp(false),
-    mDown(false)
+Sphere::Sphere(const Vector3f& center, float radius) :
+    mCenter(center),
+    mRadius(radius)
 {
 }
 
-KeyState::KeyState(Key key) :
-    mKey(key),
-    mPressed(false),
-    mUp(false),
-    mDown(false)
-{
-}
 }
@@ -39,7 +39,10 @@ SampleGame::Initialize()
             auto sceneNode = mScene->GetNode();
             sceneNode->mWorldTransform = Matrix4f::Zero;
 
-            auto roomModel = assetManager->LoadModel("Content/Model/Bedroom.dae");
+            auto roomImportOption = ModelImportOption::GetDefault();
+            roomImportOption.mLodNum = 4;
+
+            auto roomModel = assetManager->LoadModel("Content/Model/Bedroom.dae", roomImportOption);
             mRoomNode = ShareClone(roomModel->GetNode());
             sceneNode->AttachChild(mRoomNode);
 
@@ -58,7 +61,7 @@ SampleGame::Initialize()
             auto axeNodeX = ShareClone(axeModel->GetNode());
             auto axeNodeY = ShareClone(axeModel->GetNode());
             auto axeNodeZ = ShareClone(axeModel->GetNode());
-            auto axeNode = make_shared<Node>();
+            auto axeNode = CreateSpatial<Node>();
             axeNode->AttachChild(axeNodeX);
             axeNode->AttachChild(axeNodeY);
             axeNode->AttachChild(axeNodeZ);
@@ -131,16 +134,29 @@ SampleGame::Initialize()
 
         static auto sDebugRenderer = DebugRenderer::GetInstance();
         sDebugRenderer->AddCamera(mCamera.get());
+
+        static auto sShadowRenderer = ShadowRenderer::GetInstance();
+        sShadowRenderer->SetCamera(mCamera.get());
+        sShadowRenderer->SetLight(mDirectionalLight->GetLight().get());
+
+        static auto sEntityRenderer = EntityRenderer::GetInstance();
+        sEntityRenderer->SetOcclusionCamera(mCamera.get());
+
+        auto inputMap = GameEngineInput::GetInstance()->GetInputMap();
+        mExitAction = inputMap->AddAction("Exit");
+        inputMap->BindAction(mExitAction, InputBinding(Key::Escape));
+
+        mDebugAction = inputMap->AddAction("Debug");
+        inputMap->BindAction(mDebugAction, InputBinding(Key::P));
     }
 }
 
 void
 SampleGame::Render(GameEngineGraphics *graphics, double percent)
 {
-    static auto sMasterRenderer = graphics->GetMasterRenderer();
     static auto sFontRenderer = graphics->GetFontRenderer();
 
-    sMasterRenderer->ClearFrameBuffer(ColorPalette::Gray, 1.f, 0);
+    graphics->ClearFrameBuffer(ColorPalette::Gray, 1.f, 0);
 
     auto gameEngineSettings = GameEngineSettings::GetInstance();
     auto width  = gameEngineSettings->mWindowWidth;
@@ -152,11 +168,20 @@ SampleGame::Render(GameEngineGraphics *graphics, double percent)
         auto lastFrameFPS = int(profiler->GetLastFrameFps());
         auto lastUpdateElapsedMillisecond = int(profiler->GetLastUpdateElapsedMillisecond());
         auto lastFrameUpdateCount = int(profiler->GetLastFrameUpdateTotalCount());
+        auto lastFrameUpdateSkippedCount = profiler->GetLastFrameUpdateSkippedCount();
         auto lastRenderElapsedMillisecond = int(profiler->GetLastRenderElapsedMillisecond());
+        auto lastFrameLatencyMillisecond = int(profiler->GetLastFrameLatencyMillisecond());
 
         sFontRenderer->AddText(mFont, 16.f, Vector2f(50.f, height - 50.f),
-                               "U: " + std::to_string(lastUpdateElapsedMillisecond) + "ms Uc: " + std::to_string(lastFrameUpdateCount) +
-                               " R: " + std::to_string(lastRenderElapsedMillisecond) + "ms Rc: " + std::to_string(lastFrameFPS),
+                               "U: " + std::to_string(lastUpdateElapsedMillisecond) + "ms Uc: " + std::to_string(lastFrameUpdateCount) + " Us: " + std::to_string(lastFrameUpdateSkippedCount) +
+                               " R: " + std::to_string(lastRenderElapsedMillisecond) + "ms Rc: " + std::to_string(lastFrameFPS) +
+                               " L: " + std::to_string(lastFrameLatencyMillisecond) + "ms",
+                               ColorPalette::Gold);
+
+        static auto sEntityRenderer = EntityRenderer::GetInstance();
+        sFontRenderer->AddText(mFont, 16.f, Vector2f(50.f, height - 75.f),
+                               "Triangle: " + std::to_string(sEntityRenderer->GetFrameTriangleNum()) +
+                               " Saved by LOD: " + std::to_string(sEntityRenderer->GetFrameTriangleSavedNum()),
                                ColorPalette::Gold);
     }
 
@@ -204,18 +229,17 @@ SampleGame::Update(GameEngineGraphics *graphics, GameEngineInput *input, double
 void
 SampleGame::UpdateFrame(GameEngineGraphics *graphics, GameEngineInput *input, double elasped)
 {
-    auto keyboard = input->GetKeyboardState();
-    auto mouse = input->GetMouseState();
+    auto inputMap = input->GetInputMap();
 
-    if (keyboard->KeyPressed(Key::Escape))
+    if (inputMap->ActionPressed(mExitAction))
     {
         GetEngine()->Exit();
     }
 
     static auto sDebugRenderer = graphics->GetDebugRenderer();
-    //if (keyboard->KeyDown(Key::P))
+    //if (inputMap->ActionDown(mDebugAction))
     //{
-    if (keyboard->KeyPressed(Key::P))
+    if (inputMap->ActionPressed(mDebugAction))
     {
         //sDebugRenderer->AddText(std::to_string(GameTimer::GetSeconds()), Vector2f(500.0f, 500.0f), 16.0f, ColorPalette::White, 0.0f);
         sDebugRenderer->AddAABB(mCamera.get(), mCamera->GetPosition() + Vector3f(-1, -1, -1), mCamera->GetPosition() + Vector3f(1, 1, 1), Transparent(ColorPalette::Yellow, 1.0f), 4.0f, true);
@@ -38,6 +38,10 @@ private:
     // Fonts
     const Font *mFont = nullptr;
 
+    // Input
+    int mExitAction = -1;
+    int mDebugAction = -1;
+
     // Scene
     std::shared_ptr<SceneEntity>       mScene;
     std::shared_ptr<PhongEffect>       mSceneLightingEffect;
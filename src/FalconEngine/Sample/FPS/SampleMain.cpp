@@ -1,5 +1,7 @@
 #include "SampleGame.h"
 
+#include <cstring>
+
 using namespace std;
 
 using namespace FalconEngine;
@@ -13,6 +15,35 @@ int main(int argc, char **argv)
     gameEngineSettings->mMouseLimited = false;
     gameEngineSettings->mWindowWidth = 1600;
     gameEngineSettings->mWindowHeight = 900;
+    gameEngineSettings->mShadowEnabled = true;
+    gameEngineSettings->mShadowDistance = 30.0f;
+
+    // NOTE: The render thread stays off, because the lights and materials are
+    // still read live by the render side while the game updates them.
+    gameEngineSettings->mRenderThreadEnabled = false;
+
+    // NOTE: Record the input with --record, and replay it with
+    // --replay to profile the same run with --timing.
+    for (int argIndex = 1; argIndex < argc; ++argIndex)
+    {
+        auto argument = string(argv[argIndex]);
+        if (argument.find("--record=") == 0)
+        {
+            gameEngineSettings->mInputRecordFilePath = argument.substr(strlen("--record="));
+        }
+        else if (argument.find("--replay=") == 0)
+        {
+            gameEngineSettings->mInputReplayFilePath = argument.substr(strlen("--replay="));
+        }
+        else if (argument.find("--timing=") == 0)
+        {
+            gameEngineSettings->mFrameTimingFilePath = argument.substr(strlen("--timing="));
+        }
+        else if (argument == "--hidden")
+        {
+            gameEngineSettings->mWindowVisible = false;
+        }
+    }
 
     SampleGame game;
     GameEngine gameEngine(&game);
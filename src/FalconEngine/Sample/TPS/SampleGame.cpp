@@ -62,7 +62,7 @@ SampleGame::Initialize()
             auto axeNodeX = ShareClone(axeModel->GetNode());
             auto axeNodeY = ShareClone(axeModel->GetNode());
             auto axeNodeZ = ShareClone(axeModel->GetNode());
-            mAxeNode = make_shared<Node>();
+            mAxeNode = CreateSpatial<Node>();
             mAxeNode->AttachChild(axeNodeX);
             mAxeNode->AttachChild(axeNodeY);
             mAxeNode->AttachChild(axeNodeZ);
@@ -135,16 +135,19 @@ SampleGame::Initialize()
         mCamera->mAzimuthalRadian = Radian(40.0f);
         mCamera->mPolarRadian = Radian(40.0f);
         mCamera->mRadialDistance = 40.0f;
+
+        auto inputMap = GameEngineInput::GetInstance()->GetInputMap();
+        mExitAction = inputMap->AddAction("Exit");
+        inputMap->BindAction(mExitAction, InputBinding(Key::Escape));
     }
 }
 
 void
 SampleGame::Render(GameEngineGraphics *graphics, double percent)
 {
-    static auto sMasterRenderer = graphics->GetMasterRenderer();
     static auto sFontRenderer = graphics->GetFontRenderer();
 
-    sMasterRenderer->ClearFrameBuffer(ColorPalette::Gray, 1.f, 0);
+    graphics->ClearFrameBuffer(ColorPalette::Gray, 1.f, 0);
 
     auto gameEngineSettings = GameEngineSettings::GetInstance();
 
@@ -154,10 +157,11 @@ SampleGame::Render(GameEngineGraphics *graphics, double percent)
         auto lastFrameFPS = int(profiler->GetLastFrameFps());
         auto lastUpdateElapsedMillisecond = int(profiler->GetLastUpdateElapsedMillisecond());
         auto lastFrameUpdateCount = int(profiler->GetLastFrameUpdateTotalCount());
+        auto lastFrameUpdateSkippedCount = profiler->GetLastFrameUpdateSkippedCount();
         auto lastRenderElapsedMillisecond = int(profiler->GetLastRenderElapsedMillisecond());
 
         sFontRenderer->AddText(mFont, 16.f, Vector2f(50.f, gameEngineSettings->mWindowHeight - 50.f),
-                                  "U: " + std::to_string(lastUpdateElapsedMillisecond) + "ms Uc: " + std::to_string(lastFrameUpdateCount) +
+                                  "U: " + std::to_string(lastUpdateElapsedMillisecond) + "ms Uc: " + std::to_string(lastFrameUpdateCount) + " Us: " + std::to_string(lastFrameUpdateSkippedCount) +
                                   " R: " + std::to_string(lastRenderElapsedMillisecond) + "ms Rc: " + std::to_string(lastFrameFPS),
                                   ColorPalette::Gold);
     }
@@ -203,10 +207,9 @@ SampleGame::Render(GameEngineGraphics *graphics, double percent)
 void
 SampleGame::Update(GameEngineGraphics *graphics, GameEngineInput *input, double elapsed)
 {
-    auto keyboard = input->GetKeyboardState();
-    auto mouse = input->GetMouseState();
+    auto inputMap = input->GetInputMap();
 
-    if (keyboard->KeyPressed(Key::Escape))
+    if (inputMap->ActionPressed(mExitAction))
     {
         GetEngine()->Exit();
     }
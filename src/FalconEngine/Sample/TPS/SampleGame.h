@@ -34,6 +34,9 @@ private:
     // Fonts
     const Font *mFont = nullptr;
 
+    // Input
+    int mExitAction = -1;
+
     // Scene
     std::shared_ptr<SceneEntity>       mScene;
     std::shared_ptr<PhongEffect>       mSceneLightingEffect;